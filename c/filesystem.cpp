@@ -53,5 +53,17 @@ __main() {
         _fputs(stderr, "failed to remove directory: test");
         return 1;
     }
+
+    thread_pool_t pool(2);
+    pool.push([] { throw std::runtime_error("task error"); });
+    if (pool.wait() || !pool.exception()) {
+        _fputs(stderr, "exception of the task is not reported");
+        return 1;
+    }
+    pool.push([] {});
+    if (!pool.wait()) {
+        _fputs(stderr, "exception of the task is reported twice");
+        return 1;
+    }
     return 0;
 }
@@ -0,0 +1,70 @@
+﻿#define _USE_LUZ_CORE
+#define _USE_LUZ_ZIP
+#define _USE_LUZ_LUA
+#include <luz/zip.hpp>
+#include <luz/lua.hpp>
+
+/// run the chunk in the leased state, and get the boolean result
+inline bool check(lua_state_pool_t::lease_t &lease, const std::string &code) {
+    auto result = lease->safe_script(code, sol::script_pass_on_error);
+    return result.valid() && result.get<bool>();
+}
+
+__main() {
+    std::string errorMessage;
+    lua_state_pool_t pool(2, &errorMessage);
+    if (pool.idle() != 2) {
+        _fputs(stderr, "failed to initialize the states: " + errorMessage);
+        return 1;
+    }
+
+    lua_State *first = nullptr;
+    {
+        auto lease = pool.acquire();
+        if (!lease || pool.idle() != 1) {
+            _fputs(stderr, "failed to acquire the idle state");
+            return 1;
+        }
+        first = lease.lua_state();
+        // the globals, the fields of the global tables and package.loaded are changed by the script
+        if (!check(lease, "x = 1; print = nil; fs.extra = true; string.upper = nil; package.loaded.extra = {}; return true")) {
+            _fputs(stderr, "failed to run the script");
+            return 1;
+        }
+    }
+    if (pool.idle() != 2) {
+        _fputs(stderr, "the state is not returned into the pool");
+        return 1;
+    }
+
+    {
+        auto lease = pool.acquire();
+        if (lease.lua_state() != first) {
+            _fputs(stderr, "the returned state is not reused");
+            return 1;
+        }
+        if (!check(lease, "return x == nil and print ~= nil and fs.extra == nil and string.upper ~= nil and package.loaded.extra == nil")) {
+            _fputs(stderr, "the state is not reset to the baseline");
+            return 1;
+        }
+        if (!check(lease, "return fs.path.normalize'a/../b' == 'b'")) {
+            _fputs(stderr, "the standard libraries are broken by the reset");
+            return 1;
+        }
+    }
+
+    {
+        // more leases than the capacity: the surplus states are closed when returned
+        lua_state_pool_t::lease_t leases[3] = {pool.acquire(), pool.acquire(), pool.acquire()};
+        if (!leases[2] || pool.idle() != 0) {
+            _fputs(stderr, "failed to create the state beyond the idle states");
+            return 1;
+        }
+        leases[0].discard();
+    }
+    if (pool.idle() != 2) {
+        _fputs(stderr, "the count of the idle states exceeds the capacity");
+        return 1;
+    }
+    return 0;
+}
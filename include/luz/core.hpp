@@ -1,7 +1,15 @@
 ﻿#pragma once
 
 #include "core/os.hpp"
+#include "core/thread.hpp"
 #include "core/filesystem.hpp"
+#include "core/async.hpp"
+#include "core/watch.hpp"
+#include "core/hash.hpp"
+#include "core/process.hpp"
+#include "core/loop.hpp"
+#include "core/channel.hpp"
+#include "core/shared.hpp"
 
 #ifdef _WINDOWS
     #pragma warning(disable:4005)
@@ -51,5 +59,14 @@
     #include "core/string.cpp"
     #include "core/path.cpp"
     #include "core/os.cpp"
+    #include "core/thread.cpp"
+    #include "core/glob.cpp"
     #include "core/filesystem.cpp"
+    #include "core/async.cpp"
+    #include "core/watch.cpp"
+    #include "core/hash.cpp"
+    #include "core/process.cpp"
+    #include "core/loop.cpp"
+    #include "core/channel.cpp"
+    #include "core/shared.cpp"
 #endif
@@ -0,0 +1,545 @@
+﻿#include "async.hpp"
+#include "filesystem.hpp"
+
+#include <chrono>
+#include <algorithm>
+#include <errno.h>
+
+#ifdef __linux__
+    #include <linux/io_uring.h>
+    #include <sys/syscall.h>
+    #include <sys/mman.h>
+    #include <sys/eventfd.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <sys/sysmacros.h>
+    #include <poll.h>
+#endif
+
+/// @private kinds of request
+enum {
+    __ASYNC_READFILE,
+    __ASYNC_WRITEFILE,
+    __ASYNC_STAT,
+    __ASYNC_COPYFILE,
+};
+
+/// @private steps of request on io_uring
+enum {
+    __ASYNC_OPEN,
+    __ASYNC_STATX,
+    __ASYNC_READ,
+    __ASYNC_WRITE,
+    __ASYNC_CLOSE,
+};
+
+/// @private user_data of the eventfd poll (thread pool notification)
+static const unsigned long long __ASYNC_EVENT_TAG = ~0ULL;
+
+/// @private size of the chunk to read the file whose size is unknown
+static const size_t __ASYNC_CHUNK_SIZE = 64 * 1024;
+
+/// @private max milliseconds to wait for the requests being processed by the kernel when closing
+static const int __ASYNC_CLOSE_TIMEOUT = 5000;
+
+fs_async_t::fs_async_t(size_t entries, size_t threads):
+    nextid(1), uncompleted(0), threads(threads), poolrunning(0),
+    ringfd(-1), eventfd(-1), entries(entries), inflight(0), unsubmitted(0), isEventArmed(false),
+    sqring(nullptr), cqring(nullptr), sqes(nullptr), sqringsize(0), cqringsize(0), sqessize(0)
+{
+    #ifdef __linux__
+        if (!setup_uring()) {
+            if (ringfd >= 0) close(ringfd);
+            ringfd = -1;
+        }
+    #endif
+}
+
+fs_async_t::~fs_async_t() {
+    pool.reset(); // wait for the tasks
+    collect_pool();
+    #ifdef __linux__
+        if (ringfd >= 0) {
+            // complete the armed eventfd poll: no more notification comes from the thread pool
+            if (isEventArmed) {
+                unsigned long long one = 1;
+                if (write(eventfd, &one, sizeof(one)) < 0) {}
+            }
+            // wait for the requests being processed by the kernel: the buffers are owned by this object
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(__ASYNC_CLOSE_TIMEOUT);
+            backlog.clear();
+            if (unsubmitted > 0) submit_sqes(0);
+            while (inflight > 0) {
+                reap_uring(false);
+                if (unsubmitted > 0) submit_sqes(0); // next steps of the requests
+                if (inflight == 0) break;
+                long long remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+                if (remaining <= 0) break; // the kernel cancels the rest when the ring is closed
+                struct pollfd fd = {ringfd, POLLIN, 0};
+                poll(&fd, 1, (int)remaining);
+            }
+            munmap(sqes, sqessize);
+            if (cqring != sqring) munmap(cqring, cqringsize);
+            munmap(sqring, sqringsize);
+            close(ringfd);
+        }
+        if (eventfd >= 0) close(eventfd);
+    #endif
+}
+
+unsigned int fs_async_t::push(std::unique_ptr<request_t> request) {
+    request_t *p = request.get();
+
+    p->id = nextid++;
+    if (nextid == 0) nextid = 1;
+    requests[p->id] = std::move(request);
+    ++uncompleted;
+
+    if (p->kind == __ASYNC_COPYFILE || !is_uring()) run_pool(p);
+    #ifdef __linux__
+        else if (inflight + 2 >= entries) backlog.push_back(p); // keep slots for eventfd poll
+        else start_uring(p);
+    #endif
+    return p->id;
+}
+
+unsigned int fs_async_t::readfile(const std::string &path) {
+    return push(std::unique_ptr<request_t>(new request_t {0, __ASYNC_READFILE, __ASYNC_OPEN, path, "", nullptr, 0, 0, false, false, -1, 0}));
+}
+
+unsigned int fs_async_t::writefile(const std::string &path, const char *data, size_t size) {
+    return push(std::unique_ptr<request_t>(new request_t {0, __ASYNC_WRITEFILE, __ASYNC_OPEN, path, "", data, size, 0, false, false, -1, 0}));
+}
+
+unsigned int fs_async_t::stat(const std::string &path) {
+    return push(std::unique_ptr<request_t>(new request_t {0, __ASYNC_STAT, __ASYNC_STATX, path, "", nullptr, 0, 0, false, false, -1, 0}));
+}
+
+unsigned int fs_async_t::copyfile(const std::string &src, const std::string &dest, bool isOverwrite) {
+    return push(std::unique_ptr<request_t>(new request_t {0, __ASYNC_COPYFILE, 0, src, dest, nullptr, 0, 0, isOverwrite, false, -1, 0}));
+}
+
+void fs_async_t::complete(request_t *request, int error) {
+    request->error = error;
+    completed.push_back(request);
+    --uncompleted;
+}
+
+/*** ================================================== ***/
+/*** thread pool ***/
+
+void fs_async_t::run_pool(request_t *request) {
+    if (!pool) pool.reset(new thread_pool_t(threads));
+    ++poolrunning;
+    #ifdef __linux__
+        if (is_uring()) arm_event();
+    #endif
+
+    pool->push([this, request] {
+        int error = 0;
+        errno = 0;
+        try {
+            switch (request->kind) {
+            case __ASYNC_READFILE:
+                if (!fs_readfile(request->path, -1, [request](const char *data, size_t size) { request->buffer.assign(data, size); })) {
+                    error = path_isdir(request->path.c_str()) ? EISDIR : errno ? errno : ENOENT;
+                }
+                request->size = request->buffer.size();
+                break;
+            case __ASYNC_WRITEFILE:
+                request->offset = fs_writefile(request->path.c_str(), request->data, request->size);
+                if (request->offset != request->size) error = errno ? errno : EIO;
+                request->size = request->offset;
+                break;
+            case __ASYNC_STAT:
+                if (!path_stat(&request->stat, request->path.c_str())) error = errno ? errno : ENOENT;
+                break;
+            case __ASYNC_COPYFILE:
+                if (!fs_copyfile_ex(request->path.c_str(), request->dest.c_str(), request->isOverwrite, false, false)) error = errno ? errno : EIO;
+                break;
+            }
+        } catch (...) { // e.g. std::bad_alloc: the request must be completed anyway
+            error = ENOMEM;
+        }
+        request->error = error;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            poolcompleted.push_back(request);
+        }
+        #ifdef __linux__
+            if (eventfd >= 0) {
+                unsigned long long one = 1;
+                if (write(eventfd, &one, sizeof(one)) < 0) {} // the counter never overflows
+            }
+        #endif
+        finished.notify_one();
+    });
+}
+
+void fs_async_t::collect_pool() {
+    std::vector<request_t*> done;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done.swap(poolcompleted);
+    }
+    for (request_t *request : done) {
+        --poolrunning;
+        complete(request, request->error);
+    }
+}
+
+/*** ================================================== ***/
+/*** io_uring ***/
+
+#ifdef __linux__
+    /// @private store with release semantics (for ring buffer shared with the kernel)
+    template<typename T>
+    static inline void __store_release(T *p, T value) {
+        __atomic_store_n(p, value, __ATOMIC_RELEASE);
+    }
+
+    /// @private load with acquire semantics (for ring buffer shared with the kernel)
+    template<typename T>
+    static inline T __load_acquire(const T *p) {
+        return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+    }
+
+    bool fs_async_t::setup_uring() {
+        struct io_uring_params params;
+
+        memset(&params, 0, sizeof(params));
+        if (entries == 0) entries = 256;
+        ringfd = (int)syscall(__NR_io_uring_setup, (unsigned)entries, &params);
+        if (ringfd < 0) return false;
+        entries = params.sq_entries;
+
+        // check the operations are supported (IORING_REGISTER_PROBE: Linux 5.6+)
+        std::vector<char> probebuf(sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op), 0);
+        struct io_uring_probe *probe = (struct io_uring_probe*)&probebuf[0];
+        if (0 != syscall(__NR_io_uring_register, ringfd, IORING_REGISTER_PROBE, probe, 256)) return false;
+        for (int op : {IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ, IORING_OP_WRITE, IORING_OP_CLOSE, IORING_OP_POLL_ADD}) {
+            if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) return false;
+        }
+
+        // map the rings
+        sqringsize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqringsize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) sqringsize = cqringsize = std::max(sqringsize, cqringsize);
+
+        sqring = mmap(nullptr, sqringsize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringfd, IORING_OFF_SQ_RING);
+        if (sqring == MAP_FAILED) return false;
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            cqring = sqring;
+        } else {
+            cqring = mmap(nullptr, cqringsize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringfd, IORING_OFF_CQ_RING);
+            if (cqring == MAP_FAILED) {
+                munmap(sqring, sqringsize);
+                return false;
+            }
+        }
+        sqessize = params.sq_entries * sizeof(struct io_uring_sqe);
+        sqes = mmap(nullptr, sqessize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringfd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            if (cqring != sqring) munmap(cqring, cqringsize);
+            munmap(sqring, sqringsize);
+            return false;
+        }
+
+        sqhead = (unsigned*)((char*)sqring + params.sq_off.head);
+        sqtail = (unsigned*)((char*)sqring + params.sq_off.tail);
+        sqmask = (unsigned*)((char*)sqring + params.sq_off.ring_mask);
+        sqarray = (unsigned*)((char*)sqring + params.sq_off.array);
+        cqhead = (unsigned*)((char*)cqring + params.cq_off.head);
+        cqtail = (unsigned*)((char*)cqring + params.cq_off.tail);
+        cqmask = (unsigned*)((char*)cqring + params.cq_off.ring_mask);
+        cqes = (char*)cqring + params.cq_off.cqes;
+        return true;
+    }
+
+    void *fs_async_t::get_sqe() {
+        unsigned tail = *sqtail;
+        if (tail - __load_acquire(sqhead) >= entries) submit_sqes(0); // the queue is full
+
+        unsigned index = tail & *sqmask;
+        struct io_uring_sqe *sqe = (struct io_uring_sqe*)sqes + index;
+        memset(sqe, 0, sizeof(*sqe));
+        sqarray[index] = index;
+        __store_release(sqtail, tail + 1);
+        ++unsubmitted;
+        ++inflight;
+        return sqe;
+    }
+
+    void fs_async_t::submit_sqes(unsigned int wait) {
+        while (true) {
+            int n = (int)syscall(__NR_io_uring_enter, ringfd, (unsigned)unsubmitted, wait, wait > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+            if (n >= 0) {
+                unsubmitted -= std::min((size_t)n, unsubmitted);
+                return;
+            }
+            if (errno != EINTR && errno != EAGAIN && errno != EBUSY) return;
+            if (errno != EINTR) reap_uring(); // make room in the completion queue
+        }
+    }
+
+    void fs_async_t::start_uring(request_t *request) {
+        struct io_uring_sqe *sqe = (struct io_uring_sqe*)get_sqe();
+
+        sqe->user_data = request->id;
+        switch (request->step) {
+        case __ASYNC_OPEN:
+            sqe->opcode = IORING_OP_OPENAT;
+            sqe->fd = AT_FDCWD;
+            sqe->addr = (unsigned long long)request->path.c_str();
+            if (request->kind == __ASYNC_WRITEFILE) {
+                sqe->open_flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+                sqe->len = 0666;
+            } else {
+                sqe->open_flags = O_RDONLY | O_CLOEXEC;
+            }
+            break;
+        case __ASYNC_STATX:
+            sqe->opcode = IORING_OP_STATX;
+            if (request->fd >= 0) { // status of the opened file
+                sqe->fd = request->fd;
+                sqe->addr = (unsigned long long)"";
+                sqe->statx_flags = AT_EMPTY_PATH;
+            } else {
+                sqe->fd = AT_FDCWD;
+                sqe->addr = (unsigned long long)request->path.c_str();
+            }
+            sqe->len = STATX_BASIC_STATS;
+            sqe->off = (unsigned long long)request->statx;
+            break;
+        case __ASYNC_READ:
+            sqe->opcode = IORING_OP_READ;
+            sqe->fd = request->fd;
+            sqe->addr = (unsigned long long)&request->buffer[request->offset];
+            sqe->len = (unsigned)std::min(request->buffer.size() - request->offset, (size_t)0x7ffff000);
+            sqe->off = request->offset;
+            break;
+        case __ASYNC_WRITE:
+            sqe->opcode = IORING_OP_WRITE;
+            sqe->fd = request->fd;
+            sqe->addr = (unsigned long long)(request->data + request->offset);
+            sqe->len = (unsigned)std::min(request->size - request->offset, (size_t)0x7ffff000);
+            sqe->off = request->offset;
+            break;
+        case __ASYNC_CLOSE:
+            sqe->opcode = IORING_OP_CLOSE;
+            sqe->fd = request->fd;
+            break;
+        }
+    }
+
+    void fs_async_t::advance_uring(request_t *request, int result) {
+        if (result < 0 && request->step != __ASYNC_CLOSE) {
+            if (request->step == __ASYNC_OPEN && result == -ENOENT && request->kind == __ASYNC_WRITEFILE && !request->isParentCreated) {
+                // create parent directories, and retry
+                request->isParentCreated = true;
+                fs_mkparents(request->path);
+                start_uring(request);
+                return;
+            }
+            if (request->fd >= 0) close(request->fd);
+            complete(request, -result);
+            return;
+        }
+
+        const struct statx *st = (const struct statx*)request->statx;
+        switch (request->step) {
+        case __ASYNC_OPEN:
+            request->fd = result;
+            request->step = request->kind == __ASYNC_READFILE ? __ASYNC_STATX : request->size > 0 ? __ASYNC_WRITE : __ASYNC_CLOSE;
+            break;
+        case __ASYNC_STATX:
+            if (request->kind == __ASYNC_STAT) {
+                request->stat = {
+                    (unsigned long)makedev(st->stx_dev_major, st->stx_dev_minor), (unsigned long)st->stx_ino, st->stx_mode, (short)st->stx_nlink,
+                    (short)st->stx_uid, (short)st->stx_gid, (unsigned long)makedev(st->stx_rdev_major, st->stx_rdev_minor), st->stx_size,
+                    (unsigned long long)st->stx_atime.tv_sec, (unsigned long long)st->stx_mtime.tv_sec, (unsigned long long)st->stx_ctime.tv_sec
+                };
+                complete(request, 0);
+                return;
+            }
+            if (S_ISDIR(st->stx_mode)) {
+                close(request->fd);
+                complete(request, EISDIR);
+                return;
+            }
+            // unknown size (pipe, procfs, etc): read by chunks
+            request->size = S_ISREG(st->stx_mode) ? st->stx_size : 0;
+            request->buffer.resize(request->size > 0 ? request->size : __ASYNC_CHUNK_SIZE);
+            request->step = request->buffer.size() > 0 ? __ASYNC_READ : __ASYNC_CLOSE;
+            break;
+        case __ASYNC_READ:
+            request->offset += result;
+            if (result == 0 || (request->size > 0 && request->offset >= request->size)) { // EOF
+                request->buffer.resize(request->offset);
+                request->size = request->offset;
+                request->step = __ASYNC_CLOSE;
+            } else if (request->offset == request->buffer.size()) {
+                request->buffer.resize(request->buffer.size() * 2);
+            }
+            break;
+        case __ASYNC_WRITE:
+            request->offset += result;
+            if (result == 0 || request->offset >= request->size) {
+                request->size = request->offset;
+                request->step = __ASYNC_CLOSE;
+            }
+            break;
+        case __ASYNC_CLOSE:
+            complete(request, result < 0 ? -result : 0); // e.g. deferred write error reported by close
+            return;
+        }
+        start_uring(request);
+    }
+
+    void fs_async_t::arm_event() {
+        if (isEventArmed) return;
+        if (eventfd < 0 && (eventfd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) < 0) return;
+
+        struct io_uring_sqe *sqe = (struct io_uring_sqe*)get_sqe();
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = eventfd;
+        sqe->poll_events = POLLIN;
+        sqe->user_data = __ASYNC_EVENT_TAG;
+        isEventArmed = true;
+    }
+
+    void fs_async_t::reap_uring(bool isContinued) {
+        unsigned head = *cqhead, tail = __load_acquire(cqtail);
+
+        for (; head != tail; ++head) {
+            const struct io_uring_cqe *cqe = (const struct io_uring_cqe*)cqes + (head & *cqmask);
+            unsigned long long tag = cqe->user_data;
+            int result = cqe->res;
+
+            __store_release(cqhead, head + 1); // the entry can be reused by the kernel
+            --inflight;
+            if (tag == __ASYNC_EVENT_TAG) { // notification from the thread pool
+                unsigned long long count;
+                if (read(eventfd, &count, sizeof(count)) < 0) {} // already drained
+                isEventArmed = false;
+                continue;
+            }
+
+            auto it = requests.find((unsigned int)tag);
+            if (it != requests.end()) advance_uring(it->second.get(), result);
+        }
+
+        if (!isContinued) return;
+
+        // start waiting requests
+        while (!backlog.empty() && inflight + 2 < entries) {
+            request_t *request = backlog.front();
+            backlog.pop_front();
+            start_uring(request);
+        }
+        // count the finished tasks before re-arming, otherwise the poll may stay armed after the last task
+        collect_pool();
+        if (poolrunning > 0) arm_event();
+    }
+#endif
+
+/*** ================================================== ***/
+/*** waiting for completion ***/
+
+size_t fs_async_t::wait(fs_async_result_t *results, size_t capacity, int timeout) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout > 0 ? timeout : 0);
+
+    while (true) {
+        collect_pool();
+        #ifdef __linux__
+            if (is_uring()) {
+                reap_uring();
+                collect_pool();
+                if (unsubmitted > 0) submit_sqes(0); // next steps of the requests
+            }
+        #endif
+        if (!completed.empty() || uncompleted == 0 || timeout == 0) break;
+
+        long long remaining = timeout < 0 ? -1 : (long long)std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+        if (timeout > 0 && remaining <= 0) break;
+        #ifdef __linux__
+            if (is_uring()) {
+                // the ring is readable if the completion queue is not empty
+                struct pollfd fd = {ringfd, POLLIN, 0};
+                poll(&fd, 1, (int)remaining);
+                continue;
+            }
+        #endif
+        std::unique_lock<std::mutex> lock(mutex);
+        if (timeout < 0) finished.wait(lock, [this] { return !poolcompleted.empty(); });
+        else finished.wait_for(lock, std::chrono::milliseconds(remaining), [this] { return !poolcompleted.empty(); });
+    }
+
+    size_t n = 0;
+    for (; n < capacity && !completed.empty(); ++n) {
+        request_t *request = completed.front();
+        completed.pop_front();
+        results[n] = {request->id, request->error, request->buffer.data(), request->size, request->stat};
+    }
+    return n;
+}
+
+void fs_async_t::release(unsigned int id) {
+    requests.erase(id);
+}
+
+int fs_async_t::fd() {
+    #ifdef __linux__
+        if (is_uring()) {
+            if (unsubmitted > 0) submit_sqes(0); // the ring becomes readable only by the submitted requests
+            return ringfd;
+        }
+    #endif
+    return -1;
+}
+
+extern "C" {
+    __export fs_async_t *fs_async_open(size_t entries, size_t threads) {
+        return new fs_async_t(entries, threads);
+    }
+
+    __export void fs_async_close(fs_async_t *self) {
+        delete self;
+    }
+
+    __export bool fs_async_is_uring(fs_async_t *self) {
+        return self->is_uring();
+    }
+
+    __export unsigned int fs_async_readfile(fs_async_t *self, const char *path) {
+        return self->readfile(path);
+    }
+
+    __export unsigned int fs_async_writefile(fs_async_t *self, const char *path, const char *data, size_t size) {
+        return self->writefile(path, data, size);
+    }
+
+    __export unsigned int fs_async_stat(fs_async_t *self, const char *path) {
+        return self->stat(path);
+    }
+
+    __export unsigned int fs_async_copyfile(fs_async_t *self, const char *src, const char *dest, bool isOverwrite) {
+        return self->copyfile(src, dest, isOverwrite);
+    }
+
+    __export size_t fs_async_wait(fs_async_t *self, fs_async_result_t *results, size_t capacity, int timeout) {
+        return self->wait(results, capacity, timeout);
+    }
+
+    __export void fs_async_release(fs_async_t *self, unsigned int id) {
+        self->release(id);
+    }
+
+    __export size_t fs_async_pending(fs_async_t *self) {
+        return self->pending();
+    }
+
+    __export int fs_async_fd(fs_async_t *self) {
+        return self->fd();
+    }
+}
@@ -0,0 +1,160 @@
+﻿#pragma once
+
+#include "path.hpp"
+#include "thread.hpp"
+#include <string>
+#include <deque>
+#include <unordered_map>
+
+extern "C" {
+    /// result of asynchronous file I/O request
+    typedef struct {
+        unsigned int id;
+        int error; // 0: succeeded, errno: failed
+        const char *data; // read data of fs_async_readfile (valid until fs_async_release)
+        unsigned long long size; // read / written size of fs_async_readfile / fs_async_writefile
+        path_stat_t stat; // file status of fs_async_stat
+    } fs_async_result_t;
+}
+
+/*** ================================================== ***/
+/*** utility classes for C++ ***/
+
+/// asynchronous file I/O engine
+// * requests are processed by io_uring on Linux (5.6+), otherwise by the work-stealing thread pool
+// * all methods must be called from the same thread
+class fs_async_t {
+public:
+    /// @param entries: max count of requests processed by io_uring at once (the rest are queued)
+    /// @param threads: count of worker threads of the thread pool (0: count of hardware threads)
+    fs_async_t(size_t entries, size_t threads);
+    ~fs_async_t();
+
+    fs_async_t(const fs_async_t &) = delete;
+    fs_async_t &operator =(const fs_async_t &) = delete;
+
+    /// identifies if io_uring is used
+    bool is_uring() const { return ringfd >= 0; }
+
+    /// start reading all data in the file
+    // @return request id (0: failed)
+    unsigned int readfile(const std::string &path);
+
+    /// start writing data into the file (data must be kept until the request is completed)
+    unsigned int writefile(const std::string &path, const char *data, size_t size);
+
+    /// start getting the file status
+    unsigned int stat(const std::string &path);
+
+    /// start copying the file
+    unsigned int copyfile(const std::string &src, const std::string &dest, bool isOverwrite);
+
+    /// wait for completed requests
+    // @param timeout: milliseconds (-1: infinite, 0: no wait)
+    // @return count of results stored into `results` (call release() for each result)
+    size_t wait(fs_async_result_t *results, size_t capacity, int timeout);
+
+    /// free the completed request
+    void release(unsigned int id);
+
+    /// count of uncompleted requests
+    size_t pending() const { return uncompleted; }
+
+    /// get the descriptor which becomes readable when any request is completed (for event loops)
+    // * the queued requests are submitted to be waited for; call wait() with timeout = 0 when it's readable
+    // @return -1 if io_uring is not used
+    int fd();
+
+private:
+    struct request_t {
+        unsigned int id;
+        int kind, step;
+        std::string path, dest;
+        const char *data;
+        size_t size, offset;
+        bool isOverwrite, isParentCreated;
+        int fd, error;
+        std::string buffer;
+        path_stat_t stat;
+        #ifdef __linux__
+            unsigned char statx[256]; // struct statx
+        #endif
+    };
+
+    std::unordered_map<unsigned int, std::unique_ptr<request_t>> requests;
+    std::deque<request_t*> backlog;   // requests waiting for a free slot of io_uring
+    std::deque<request_t*> completed; // completed requests not returned by wait() yet
+    unsigned int nextid;
+    size_t uncompleted;
+
+    // thread pool
+    std::unique_ptr<thread_pool_t> pool;
+    size_t threads, poolrunning;
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::vector<request_t*> poolcompleted; // completed by the thread pool (guarded by mutex)
+
+    // io_uring
+    int ringfd, eventfd;
+    size_t entries, inflight, unsubmitted;
+    bool isEventArmed;
+    void *sqring, *cqring, *sqes;
+    size_t sqringsize, cqringsize, sqessize;
+    unsigned *sqhead, *sqtail, *sqmask, *sqarray, *cqhead, *cqtail, *cqmask;
+    void *cqes;
+
+    unsigned int push(std::unique_ptr<request_t> request);
+    void run_pool(request_t *request);
+    void collect_pool();
+    void complete(request_t *request, int error);
+
+    bool setup_uring();
+    void *get_sqe();
+    void submit_sqes(unsigned int wait);
+    void start_uring(request_t *request);
+    void advance_uring(request_t *request, int result);
+    void arm_event();
+    void reap_uring(bool isContinued = true); // isContinued: start the backlog and re-arm the eventfd poll
+};
+
+extern "C" {
+    /// open asynchronous file I/O engine
+    // @param entries: max count of requests processed by io_uring at once (0: 256)
+    // @param threads: count of worker threads of the thread pool (0: count of hardware threads)
+    __export fs_async_t *fs_async_open(size_t entries, size_t threads);
+
+    /// close asynchronous file I/O engine (waits for uncompleted requests)
+    __export void fs_async_close(fs_async_t *self);
+
+    /// identifies if io_uring is used
+    __export bool fs_async_is_uring(fs_async_t *self);
+
+    /// start reading all data in the file
+    // @return request id (0: failed)
+    __export unsigned int fs_async_readfile(fs_async_t *self, const char *path);
+
+    /// start writing data into the file (parent directories are created automatically)
+    // * data must be kept until the request is completed
+    __export unsigned int fs_async_writefile(fs_async_t *self, const char *path, const char *data, size_t size);
+
+    /// start getting the file status
+    __export unsigned int fs_async_stat(fs_async_t *self, const char *path);
+
+    /// start copying the file
+    __export unsigned int fs_async_copyfile(fs_async_t *self, const char *src, const char *dest, bool isOverwrite);
+
+    /// wait for completed requests
+    // @param timeout: milliseconds (-1: infinite, 0: no wait)
+    // @return count of results stored into `results` (call fs_async_release for each result)
+    __export size_t fs_async_wait(fs_async_t *self, fs_async_result_t *results, size_t capacity, int timeout);
+
+    /// free the completed request
+    __export void fs_async_release(fs_async_t *self, unsigned int id);
+
+    /// count of uncompleted requests
+    __export size_t fs_async_pending(fs_async_t *self);
+
+    /// get the descriptor which becomes readable when any request is completed (for event loops)
+    // @return -1 if io_uring is not used: poll with fs_async_wait periodically instead
+    __export int fs_async_fd(fs_async_t *self);
+}
@@ -0,0 +1,249 @@
+﻿#include "channel.hpp"
+#include <cstring>
+#include <climits>
+#include <chrono>
+
+#ifdef __linux__
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <time.h>
+#elif defined(_WINDOWS)
+    #pragma comment(lib, "synchronization.lib")
+#else
+    #include <thread>
+#endif
+
+/// @private max size of the message stored inline in the cell
+static const size_t __CHANNEL_INLINE = sizeof(((channel_cell_t*)nullptr)->data);
+
+/*** ================================================== ***/
+/*** @private futex helpers ***/
+
+/// @private park the thread while the word equals to expected (spurious wakeup is allowed)
+static void __futexwait(std::atomic<uint32_t> *word, uint32_t expected, int timeout) {
+    #ifdef __linux__
+        struct timespec ts = {timeout / 1000, (long)(timeout % 1000) * 1000000L};
+        syscall(SYS_futex, (uint32_t*)word, FUTEX_WAIT_PRIVATE, expected, timeout < 0 ? nullptr : &ts, nullptr, 0);
+    #elif defined(_WINDOWS)
+        WaitOnAddress((volatile VOID*)word, &expected, sizeof(uint32_t), timeout < 0 ? INFINITE : (DWORD)timeout);
+    #else
+        // no futex: poll the word
+        if (word->load(std::memory_order_acquire) == expected) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    #endif
+}
+
+/// @private wake all threads parked on the word
+static void __futexwake(std::atomic<uint32_t> *word) {
+    #ifdef __linux__
+        syscall(SYS_futex, (uint32_t*)word, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    #elif defined(_WINDOWS)
+        WakeByAddressAll((PVOID)word);
+    #endif
+}
+
+/// @private notify the waiters of the word after push / pop
+static void __notify(std::atomic<uint32_t> &word, std::atomic<uint32_t> &waiters) {
+    word.fetch_add(1, std::memory_order_seq_cst);
+    if (waiters.load(std::memory_order_seq_cst) > 0) __futexwake(&word);
+}
+
+/// @private retry the operation until it succeeds, the channel is closed or timed out
+// @param word: futex word which is incremented when the operation may succeed
+template <class Operation>
+static bool __blocking(channel_t *self, std::atomic<uint32_t> &word, std::atomic<uint32_t> &waiters, int timeout, Operation &&operation) {
+    if (operation()) return true;
+    if (timeout == 0) return false;
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+    for (;;) {
+        uint32_t epoch = word.load(std::memory_order_acquire);
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        if (operation()) {
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        int remaining = -1;
+        if (timeout > 0) {
+            auto now = std::chrono::steady_clock::now();
+            remaining = now >= deadline ? 0 : (int)std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count() + 1;
+        }
+        if (remaining == 0 || self->is_closed.load(std::memory_order_acquire)) {
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+            return operation(); // the last chance (e.g. messages remaining in the closed channel)
+        }
+        __futexwait(&word, epoch, remaining);
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+/*** ================================================== ***/
+/*** @private ring buffer helpers ***/
+
+/// @private store the message into the cell
+static void __store(channel_cell_t *cell, const char *data, size_t size) {
+    cell->size = size;
+    if (size <= __CHANNEL_INLINE) {
+        if (size > 0) memcpy(cell->data, data, size);
+        return;
+    }
+    char *heap = (char*)malloc(size);
+    memcpy(heap, data, size);
+    memcpy(cell->data, &heap, sizeof(char*));
+}
+
+/// @private move the message from the cell into dest
+static void __load(channel_cell_t *cell, std::string &dest) {
+    if (cell->size <= __CHANNEL_INLINE) {
+        dest.assign(cell->data, cell->size);
+        return;
+    }
+    char *heap;
+    memcpy(&heap, cell->data, sizeof(char*));
+    dest.assign(heap, cell->size);
+    free(heap);
+}
+
+/// @private try to push the message without blocking
+static bool __trypush(channel_t *self, const char *data, size_t size) {
+    if (self->is_closed.load(std::memory_order_acquire)) return false;
+    if (self->is_spsc) {
+        size_t tail = self->tail.load(std::memory_order_relaxed);
+        if (tail - self->head.load(std::memory_order_acquire) >= self->capacity) return false;
+        __store(&self->arena[tail & self->mask], data, size);
+        self->tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t position = self->tail.load(std::memory_order_relaxed);
+    channel_cell_t *cell;
+    for (;;) {
+        cell = &self->arena[position & self->mask];
+        intptr_t diff = (intptr_t)cell->sequence.load(std::memory_order_acquire) - (intptr_t)position;
+        if (diff == 0) {
+            if (self->tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false; // full
+        } else {
+            position = self->tail.load(std::memory_order_relaxed);
+        }
+    }
+    __store(cell, data, size);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+/// @private try to pop the message without blocking
+static bool __trypop(channel_t *self, std::string &dest) {
+    if (self->is_spsc) {
+        size_t head = self->head.load(std::memory_order_relaxed);
+        if (head == self->tail.load(std::memory_order_acquire)) return false;
+        __load(&self->arena[head & self->mask], dest);
+        self->head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t position = self->head.load(std::memory_order_relaxed);
+    channel_cell_t *cell;
+    for (;;) {
+        cell = &self->arena[position & self->mask];
+        intptr_t diff = (intptr_t)cell->sequence.load(std::memory_order_acquire) - (intptr_t)(position + 1);
+        if (diff == 0) {
+            if (self->head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false; // empty
+        } else {
+            position = self->head.load(std::memory_order_relaxed);
+        }
+    }
+    __load(cell, dest);
+    cell->sequence.store(position + self->mask + 1, std::memory_order_release);
+    return true;
+}
+
+/*** ================================================== ***/
+
+extern "C" {
+    __export channel_t *channel_open(size_t capacity, bool isSPSC) {
+        if (capacity > CHANNEL_CAPACITY_MAX) return nullptr;
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+
+        channel_t *self = new channel_t();
+        self->arena = new channel_cell_t[size];
+        for (size_t i = 0; i < size; ++i) self->arena[i].sequence.store(i, std::memory_order_relaxed);
+        self->capacity = size;
+        self->mask = size - 1;
+        self->is_spsc = isSPSC;
+        self->head = self->tail = 0;
+        self->pushed = self->popped = 0;
+        self->pop_waiters = self->push_waiters = 0;
+        self->is_closed = false;
+        self->refcount = 1;
+        return self;
+    }
+
+    __export void channel_retain(channel_t *self) {
+        self->refcount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    __export void channel_release(channel_t *self) {
+        if (self->refcount.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+        // free the messages remaining in the heap
+        for (size_t position = self->head; position != self->tail; ++position) {
+            channel_cell_t *cell = &self->arena[position & self->mask];
+            if (cell->size > __CHANNEL_INLINE) {
+                char *heap;
+                memcpy(&heap, cell->data, sizeof(char*));
+                free(heap);
+            }
+        }
+        delete[] self->arena;
+        delete self;
+    }
+
+    __export void channel_close(channel_t *self) {
+        self->is_closed.store(true, std::memory_order_release);
+        __notify(self->pushed, self->pop_waiters);
+        __notify(self->popped, self->push_waiters);
+    }
+
+    __export bool channel_is_closed(channel_t *self) {
+        return self->is_closed.load(std::memory_order_acquire);
+    }
+
+    __export bool channel_push(channel_t *self, const char *data, size_t size, int timeout) {
+        if (!__blocking(self, self->popped, self->push_waiters, timeout, [&]() { return __trypush(self, data, size); })) {
+            return false;
+        }
+        __notify(self->pushed, self->pop_waiters);
+        return true;
+    }
+
+    __export const char *channel_pop(channel_t *self, size_t *size, int timeout) {
+        thread_local std::string message;
+        if (!channel_pop(self, message, timeout)) return nullptr;
+        if (size) *size = message.size();
+        return message.c_str();
+    }
+
+    __export size_t channel_size(channel_t *self) {
+        size_t head = self->head.load(std::memory_order_acquire), tail = self->tail.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+}
+
+/*** ================================================== ***/
+/*** utility functions for C++ ***/
+
+bool channel_pop(channel_t *self, std::string &dest, int timeout) {
+    if (!__blocking(self, self->pushed, self->pop_waiters, timeout, [&]() { return __trypop(self, dest); })) {
+        return false;
+    }
+    __notify(self->popped, self->push_waiters);
+    return true;
+}
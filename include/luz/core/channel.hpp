@@ -0,0 +1,72 @@
+﻿#pragma once
+
+#include "os.hpp"
+#include <atomic>
+#include <string>
+
+extern "C" {
+    /// max capacity of the channel
+    enum {
+        CHANNEL_CAPACITY_MAX = 1 << 24,
+    };
+
+    /// cell of the channel arena: length-prefixed message (stored inline if it's small)
+    typedef struct {
+        std::atomic<size_t> sequence; // position of the cell (MPMC)
+        size_t size;                  // length of the message
+        char data[112];               // message, or the pointer to the heap if size > sizeof(data)
+    } channel_cell_t;
+
+    /// structure of bounded channel
+    // * lock-free ring buffer: Vyukov's bounded queue (MPMC), or Lamport's queue (SPSC)
+    // * blocking operations park the thread on the futex (WaitOnAddress on Windows)
+    typedef struct {
+        alignas(64) std::atomic<size_t> head; // position to pop
+        alignas(64) std::atomic<size_t> tail; // position to push
+        alignas(64) std::atomic<uint32_t> pushed, popped; // futex words incremented by push / pop
+        std::atomic<uint32_t> pop_waiters, push_waiters;   // count of threads parked on pushed / popped
+        std::atomic<bool> is_closed;
+        std::atomic<long> refcount;
+        channel_cell_t *arena; // capacity cells
+        size_t capacity, mask;
+        bool is_spsc;
+    } channel_t;
+
+    /// create bounded channel (reference count = 1)
+    // @param capacity: max count of messages (rounded up to the power of 2; CHANNEL_CAPACITY_MAX at most)
+    // @param isSPSC: single producer / single consumer (faster, but the caller must guarantee it)
+    // @return nullptr if capacity is greater than CHANNEL_CAPACITY_MAX
+    __export channel_t *channel_open(size_t capacity, bool isSPSC);
+
+    /// increment the reference count
+    __export void channel_retain(channel_t *self);
+
+    /// decrement the reference count (the channel and the remaining messages are freed at 0)
+    __export void channel_release(channel_t *self);
+
+    /// close the channel: push fails, and pop fails after the remaining messages are popped
+    __export void channel_close(channel_t *self);
+
+    /// identifies if the channel is closed
+    __export bool channel_is_closed(channel_t *self);
+
+    /// push the message
+    // @param timeout: milliseconds to wait while the channel is full (0: no wait, -1: infinite)
+    // @return false if timed out or closed
+    __export bool channel_push(channel_t *self, const char *data, size_t size, int timeout);
+
+    /// pop the message
+    // @param timeout: milliseconds to wait while the channel is empty (0: no wait, -1: infinite)
+    // @return message which is valid until the next pop in the same thread; nullptr if timed out or closed
+    __export const char *channel_pop(channel_t *self, size_t *size, int timeout);
+
+    /// get count of the messages in the channel (approximate while other threads push / pop)
+    __export size_t channel_size(channel_t *self);
+}
+
+/*** ================================================== ***/
+/*** utility functions for C++ ***/
+
+/// pop the message into dest
+// @return false if timed out or closed
+bool channel_pop(channel_t *self, std::string &dest, int timeout);
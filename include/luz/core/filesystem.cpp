@@ -1,17 +1,531 @@
 ﻿#include "filesystem.hpp"
+#include "thread.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 
 #ifdef _WINDOWS
     #include <shlwapi.h>
+    #include <io.h>
+    #include <direct.h>
 #else
     #include <sys/stat.h>
+    #include <sys/uio.h>
+    #include <limits.h>
     #include <dirent.h>
+    #include <fcntl.h>
+    #include <errno.h>
+    #include <sys/mman.h>
+    #ifdef __linux__
+        #include <sys/ioctl.h>
+        #include <sys/sendfile.h>
+        #include <sys/syscall.h>
+        #include <linux/fs.h> // FICLONE
+        
+        /// @private directory entry of getdents64
+        struct __linux_dirent64_t {
+            unsigned long long d_ino;
+            long long d_off;
+            unsigned short d_reclen;
+            unsigned char d_type;
+            char d_name[1];
+        };
+    #endif
+#endif
+
+/*** ================================================== ***/
+/*** @private directory creation helpers ***/
+
+/// @private directories known to exist in this process
+// * it's only a hint to skip mkdir: a cached directory is verified by stat, and it's forgotten if the check fails
+static struct {
+    std::mutex mutex;
+    std::unordered_set<std::string> dirs;
+} __knowndirs;
+
+/// @private max count of the known directories (the cache is cleared when it's full)
+static const size_t __KNOWNDIRS_MAX = 4096;
+
+/// @private remember / forget the directory
+static void __knowndir(const std::string &dir, bool isExisting) {
+    std::lock_guard<std::mutex> lock(__knowndirs.mutex);
+    if (!isExisting) {
+        __knowndirs.dirs.erase(dir);
+        return;
+    }
+    if (__knowndirs.dirs.size() >= __KNOWNDIRS_MAX) __knowndirs.dirs.clear();
+    __knowndirs.dirs.insert(dir);
+}
+
+/// @private identifies if the directory is in the known directories
+static bool __isknowndir(const std::string &dir) {
+    std::lock_guard<std::mutex> lock(__knowndirs.mutex);
+    return __knowndirs.dirs.find(dir) != __knowndirs.dirs.end();
+}
+
+/// @private create a single directory
+// @return 0 if created, otherwise errno
+static int __mkdir(const std::string &dir) {
+    #ifdef _WINDOWS
+        if (0 == _wmkdir(u8towcs(dir).c_str())) return 0;
+    #else
+        if (0 == mkdir(dir.c_str(), S_IRWXU|S_IRGRP|S_IXGRP|S_IROTH|S_IXOTH)) return 0;
+    #endif
+    return errno;
+}
+
+/// @private create the directory recursively
+// * tries mkdir from the deepest directory, walks up while it fails with ENOENT, and then creates the missing descendants
+// * it costs a single mkdir if the parent exists, instead of stat for every ancestor
+static bool __mkdirs(const std::string &dir) {
+    if (dir.empty()) return false;
+    if (__isknowndir(dir)) {
+        if (path_isdir(dir)) return true;
+        __knowndir(dir, false); // removed after cached
+    }
+
+    std::vector<std::string> missings; // deepest first
+    for (std::string current = dir; !current.empty(); current = path_parentdir(current, false)) {
+        int error = __mkdir(current);
+        if (error == 0) break;
+        if (error != ENOENT) {
+            // EEXIST, or EACCES / EROFS for the existing directory (e.g. drive root)
+            if (!path_isdir(current)) return false;
+            break;
+        }
+        missings.push_back(current);
+    }
+    for (long i = (long)missings.size() - 1; i >= 0; --i) {
+        int error = __mkdir(missings[i]);
+        if (error != 0 && (error != EEXIST || !path_isdir(missings[i]))) return false; // EEXIST: created by another thread
+    }
+    __knowndir(dir, true);
+    return true;
+}
+
+/*** ================================================== ***/
+/*** @private file copy helpers ***/
+#ifndef _WINDOWS
+    /// @private copy [offset, offset + size) of in to the same position of out
+    // * tries copy_file_range => sendfile => read/write, and remembers the method that is not supported
+    static bool __copyrange(int in, int out, off_t offset, off_t size, int &method) {
+        off_t end = offset + size;
+        #ifdef __linux__
+            #ifdef SYS_copy_file_range
+                // copy_file_range: copy in the kernel (reflink / server-side copy if the file system supports)
+                while (method == 0 && offset < end) {
+                    loff_t inoff = offset, outoff = offset;
+                    long n = syscall(SYS_copy_file_range, in, &inoff, out, &outoff, (size_t)(end - offset), 0);
+                    if (n > 0) {
+                        offset += n;
+                        continue;
+                    }
+                    if (n == 0) return false; // src was truncated
+                    if (errno == EINTR) continue;
+                    if (errno != ENOSYS && errno != EXDEV && errno != EINVAL && errno != EOPNOTSUPP && errno != EPERM) return false;
+                    method = 1;
+                }
+            #else
+                if (method == 0) method = 1;
+            #endif
+            // sendfile: copy in the kernel through the page cache
+            if (method == 1 && offset < end) {
+                if (lseek(out, offset, SEEK_SET) != offset) return false;
+                while (offset < end) {
+                    off_t inoff = offset;
+                    ssize_t n = sendfile(out, in, &inoff, (size_t)std::min<off_t>(end - offset, 0x7ffff000));
+                    if (n > 0) {
+                        offset += n;
+                        continue;
+                    }
+                    if (n == 0) return false;
+                    if (errno == EINTR) continue;
+                    if (errno != ENOSYS && errno != EINVAL) return false;
+                    method = 2;
+                    break;
+                }
+            }
+        #endif
+        // read/write: copy through the user space buffer
+        if (offset < end) {
+            std::vector<char> buffer((size_t)std::min<off_t>(std::max<off_t>(end - offset, 4096), 1024 * 1024));
+            while (offset < end) {
+                ssize_t n = pread(in, &buffer[0], (size_t)std::min<off_t>(end - offset, buffer.size()), offset);
+                if (n < 0 && errno == EINTR) continue;
+                if (n <= 0) return false;
+                for (ssize_t written = 0; written < n;) {
+                    ssize_t w = pwrite(out, &buffer[written], n - written, offset + written);
+                    if (w < 0 && errno == EINTR) continue;
+                    if (w <= 0) return false;
+                    written += w;
+                }
+                offset += n;
+            }
+        }
+        return true;
+    }
+
+    /// @private copy the stream (pipe, character device, etc) until EOF
+    static bool __copystream(int in, int out) {
+        std::vector<char> buffer(64 * 1024);
+        for (;;) {
+            ssize_t n = read(in, &buffer[0], buffer.size());
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0) return false;
+            if (n == 0) return true;
+            for (ssize_t written = 0; written < n;) {
+                ssize_t w = write(out, &buffer[written], n - written);
+                if (w < 0 && errno == EINTR) continue;
+                if (w <= 0) return false;
+                written += w;
+            }
+        }
+    }
+
+    /// @private copy the content of in to out (size: file size of in)
+    static bool __copyfd(int in, int out, off_t size) {
+        if (size == 0) return true;
+        #ifdef FICLONE
+            // reflink: share the data blocks (btrfs, xfs, etc)
+            if (0 == ioctl(out, FICLONE, in)) return true;
+        #endif
+        
+        int method = 0;
+        #ifdef SEEK_DATA
+            // skip holes of sparse file
+            off_t data = lseek(in, 0, SEEK_DATA);
+            if (data >= 0 || errno == ENXIO) {
+                while (data >= 0 && data < size) {
+                    off_t hole = lseek(in, data, SEEK_HOLE);
+                    if (hole < 0 || hole > size) hole = size;
+                    if (!__copyrange(in, out, data, hole - data, method)) return false;
+                    data = lseek(in, hole, SEEK_DATA);
+                }
+                if (data < 0 && errno != ENXIO) return false;
+                return 0 == ftruncate(out, size); // trailing hole
+            }
+        #endif
+        return __copyrange(in, out, 0, size, method);
+    }
+
+    /// @private copy file: src (relative to the directory srcdir) => dest (relative to the directory destdir)
+    // @param srcdir, destdir: file descriptor of the directory, or AT_FDCWD
+    // @param isParentCreated: create parent directories of dest if they don't exist (dest must be path from destdir)
+    static bool __copyfileat(int srcdir, const char *src, int destdir, const char *dest, bool isOverwrite, bool isModePreserved, bool isMtimePreserved, bool isParentCreated) {
+        int in = openat(srcdir, src, O_RDONLY | O_CLOEXEC);
+        if (in < 0) return false;
+
+        struct stat st;
+        if (0 != fstat(in, &st) || S_ISDIR(st.st_mode)) {
+            close(in);
+            return false;
+        }
+
+        int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | (isOverwrite ? 0 : O_EXCL);
+        mode_t mode = isModePreserved ? (st.st_mode & 07777) : 0666;
+        int out = openat(destdir, dest, flags, mode);
+        if (out < 0 && errno == ENOENT && isParentCreated && fs_mkparents(dest)) { // auto create parent directories
+            out = openat(destdir, dest, flags, mode);
+        }
+        if (out < 0) {
+            close(in);
+            return false;
+        }
+
+        bool result = S_ISREG(st.st_mode) ? __copyfd(in, out, st.st_size) : __copystream(in, out);
+        if (result && isModePreserved) result = 0 == fchmod(out, st.st_mode & 07777); // the file might exist before
+        if (result && isMtimePreserved) {
+            struct timespec times[2] = {st.st_atim, st.st_mtim};
+            result = 0 == futimens(out, times);
+        }
+        close(in);
+        return 0 == close(out) && result;
+    }
+
+    /// @private get the file type of the directory entry
+    // @param isLinkFollowed: if true, get the type of the symbolic link target
+    // @return DT_* (DT_UNKNOWN if failed)
+    static unsigned char __entrytype(int dirfd, const struct dirent *dent, bool isLinkFollowed) {
+        if (dent->d_type != DT_UNKNOWN && !(dent->d_type == DT_LNK && isLinkFollowed)) return dent->d_type;
+
+        struct stat st;
+        if (0 != fstatat(dirfd, dent->d_name, &st, isLinkFollowed ? 0 : AT_SYMLINK_NOFOLLOW)) return DT_UNKNOWN;
+        if (S_ISDIR(st.st_mode)) return DT_DIR;
+        if (S_ISLNK(st.st_mode)) return DT_LNK;
+        return S_ISREG(st.st_mode) ? DT_REG : DT_UNKNOWN;
+    }
+
+    /// @private open the directory relative to the directory fd
+    static DIR *__opendirat(int dirfd, const char *name, int flags = 0) {
+        int fd = openat(dirfd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC | flags);
+        if (fd < 0) return nullptr;
+        
+        DIR *dir = fdopendir(fd);
+        if (!dir) close(fd);
+        return dir;
+    }
+
+    /// @private copy the directory recursively: src (relative to srcdir) => dest (relative to destdir)
+    // * each entry is resolved from the directory fd, so the cost doesn't depend on the depth of the tree
+    static bool __copydirat(int srcdir, const char *src, int destdir, const char *dest) {
+        DIR *in = __opendirat(srcdir, src);
+        if (!in) return false;
+        if (0 != mkdirat(destdir, dest, S_IRWXU|S_IRGRP|S_IXGRP|S_IROTH|S_IXOTH) && errno != EEXIST) {
+            closedir(in);
+            return false;
+        }
+
+        int outfd = openat(destdir, dest, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (outfd < 0) {
+            closedir(in);
+            return false;
+        }
+        
+        bool result = true;
+        int infd = dirfd(in);
+        for (struct dirent *dent = readdir(in); result && dent; dent = readdir(in)) {
+            if (strcmp(dent->d_name, ".") == 0 || strcmp(dent->d_name, "..") == 0) continue;
+            if (__entrytype(infd, dent, true) == DT_DIR) result = __copydirat(infd, dent->d_name, outfd, dent->d_name);
+            else result = __copyfileat(infd, dent->d_name, outfd, dent->d_name, true, false, false, false);
+        }
+        close(outfd);
+        closedir(in);
+        return result;
+    }
+
+    /// @private remove the directory recursively: name (relative to parent directory fd)
+    // * symbolic links are removed, not followed
+    static bool __rmdirat(int parent, const char *name) {
+        DIR *dir = __opendirat(parent, name, O_NOFOLLOW);
+        if (!dir) return false;
+
+        bool result = true;
+        int fd = dirfd(dir);
+        for (struct dirent *dent = readdir(dir); result && dent; dent = readdir(dir)) {
+            if (strcmp(dent->d_name, ".") == 0 || strcmp(dent->d_name, "..") == 0) continue;
+            if (__entrytype(fd, dent, false) == DT_DIR) result = __rmdirat(fd, dent->d_name);
+            else result = 0 == unlinkat(fd, dent->d_name, 0);
+        }
+        closedir(dir);
+        return result && 0 == unlinkat(parent, name, AT_REMOVEDIR);
+    }
+#endif
+
+/*** ================================================== ***/
+/*** @private parallel directory operation helpers ***/
+
+/// @private directory entry
+struct __entry_t {
+    std::string name;
+    bool isdir, islink;
+};
+
+/// @private list entries (except "." and "..") in the directory
+// @param isLinkFollowed: if true, the symbolic link to directory is treated as directory
+#ifdef _WINDOWS
+    static bool __listdir(const std::string &dir, std::vector<__entry_t> &entries, bool isLinkFollowed) {
+        WIN32_FIND_DATAW info;
+        HANDLE handle = FindFirstFileW((u8towcs(path_append_slash(dir)) + L"*.*").c_str(), &info);
+        
+        if (handle == INVALID_HANDLE_VALUE) return false;
+        do {
+            if (wcscmp(info.cFileName, L".") == 0 || wcscmp(info.cFileName, L"..") == 0) continue;
+            bool islink = 0 != (info.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT),
+                isdir = 0 != (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY);
+            entries.push_back({wcstou8(info.cFileName), isdir && (isLinkFollowed || !islink), islink});
+        } while (FindNextFileW(handle, &info));
+        FindClose(handle);
+        return true;
+    }
+#else
+    static bool __listdir(const std::string &dir, std::vector<__entry_t> &entries, bool isLinkFollowed) {
+        DIR *handle = opendir(dir.c_str());
+        if (!handle) return false;
+        
+        std::string prefix = path_append_slash(dir);
+        for (struct dirent *dent = readdir(handle); dent; dent = readdir(handle)) {
+            if (strcmp(dent->d_name, ".") == 0 || strcmp(dent->d_name, "..") == 0) continue;
+
+            bool isdir = dent->d_type == DT_DIR, islink = dent->d_type == DT_LNK;
+            if (dent->d_type == DT_UNKNOWN || (islink && isLinkFollowed)) { // file system which doesn't support d_type
+                struct stat st;
+                if (0 != lstat((prefix + dent->d_name).c_str(), &st)) continue; // removed while listing
+                islink = S_ISLNK(st.st_mode);
+                if (islink && isLinkFollowed && 0 != stat((prefix + dent->d_name).c_str(), &st)) continue; // broken link
+                isdir = S_ISDIR(st.st_mode);
+            }
+            entries.push_back({dent->d_name, isdir, islink});
+        }
+        closedir(handle);
+        return true;
+    }
+#endif
+
+/// @private count of files processed by one task
+static const size_t __FILES_PER_TASK = 64;
+
+/// @private identifies if the contents of the files are the same
+static bool __samecontent(const std::string &a, const std::string &b) {
+    bool isSame = false;
+    fs_readfile(a, -1, [&](const char *adata, size_t asize) {
+        fs_readfile(b, -1, [&](const char *bdata, size_t bsize) {
+            isSame = asize == bsize && (asize == 0 || 0 == memcmp(adata, bdata, asize));
+        });
+    });
+    return isSame;
+}
+
+/// @private copy src to the temporary file in the directory of dest, and rename it to dest
+// * dest is replaced atomically (readers never see the half-written file), even if dest is read-only
+// @param destprefix: directory of dest ending with the separator
+static bool __replacefile(const std::string &src, const std::string &destprefix, const std::string &name) {
+    #ifdef _WINDOWS
+        static std::atomic<unsigned int> counter(0);
+        std::string temp = destprefix + ".luz-sync." + std::to_string(GetCurrentProcessId()) + "." + std::to_string(counter++);
+        std::wstring wtemp = u8towcs(temp), wdest = u8towcs(destprefix + name);
+        if (!fs_copyfile_ex(src.c_str(), temp.c_str(), false, true, true)) {
+            DeleteFileW(wtemp.c_str());
+            return false;
+        }
+        SetFileAttributesW(wdest.c_str(), FILE_ATTRIBUTE_NORMAL); // the read-only file cannot be replaced
+        if (MoveFileExW(wtemp.c_str(), wdest.c_str(), MOVEFILE_REPLACE_EXISTING)) return true;
+        DeleteFileW(wtemp.c_str());
+        return false;
+    #else
+        std::string temp = destprefix + ".luz-sync.XXXXXX";
+        int fd = mkstemp(&temp[0]);
+        if (fd < 0) return false;
+        close(fd);
+        bool result = __copyfileat(AT_FDCWD, src.c_str(), AT_FDCWD, temp.c_str(), true, true, true, false)
+            && 0 == rename(temp.c_str(), (destprefix + name).c_str());
+        if (!result) unlink(temp.c_str());
+        return result;
+    #endif
+}
+
+/// @private read all entries (except "." and "..") in the directory for fs_walk_t
+static bool __walk_readentries(const std::string &dir, std::vector<std::pair<std::string, unsigned char>> &entries) {
+    fs_dirent_t *dirent = fs_opendir(dir.c_str());
+    if (dirent == nullptr) return false;
+
+    fs_entry_t batch[128];
+    char pool[16 * 1024];
+    size_t n;
+    while ((n = fs_readdir_batch(dirent, batch, 128, pool, sizeof(pool))) > 0) {
+        for (size_t i = 0; i < n; ++i) entries.push_back({pool + batch[i].name_offset, batch[i].type});
+    }
+    fs_closedir(dirent);
+    return true;
+}
+
+/// @private identifies if the path matches any of the globs (in a single pass)
+static bool __walk_matchany(const glob_matcher_t *globs, const std::string &path, bool isPartial) {
+    if (globs == nullptr) return false;
+    return isPartial ? glob_match_partial(globs, path.c_str()) : glob_match(globs, path.c_str());
+}
+
+/*** ================================================== ***/
+/*** @private buffered reader helpers ***/
+
+/// @private default buffer size of fs_reader_t
+static const size_t __READER_BUFSIZE = 64 * 1024;
+
+/// @private read data from the source directly
+// @return read size (0: EOF or error, -1: no data available for non-blocking descriptor)
+static long long __reader_readsource(fs_reader_t *self, char *dest, size_t size) {
+    if (self->fp) return (long long)fread(dest, 1, size, self->fp);
+    while (true) {
+        #ifdef _WINDOWS
+            long long n = _read(self->fd, dest, (unsigned int)(size < 0x7fffffff ? size : 0x7fffffff));
+        #else
+            long long n = read(self->fd, dest, size);
+        #endif
+        if (n >= 0) return n;
+        if (errno == EINTR) continue;
+        #ifndef _WINDOWS
+            if (errno == EAGAIN || errno == EWOULDBLOCK) return -1;
+        #endif
+        return 0;
+    }
+}
+
+/// @private read data from the source into the free space of the buffer
+// @return read size (0: EOF, or no data available for non-blocking descriptor)
+static size_t __reader_fill(fs_reader_t *self) {
+    if (self->begin > 0) { // move unread data to the front
+        memmove(&self->buffer[0], &self->buffer[self->begin], self->end - self->begin);
+        self->end -= self->begin;
+        self->begin = 0;
+    }
+    if (self->end == self->buffer.size()) self->buffer.resize(self->buffer.size() * 2);
+
+    long long n = __reader_readsource(self, &self->buffer[self->end], self->buffer.size() - self->end);
+    if (n <= 0) {
+        if (n == 0) self->is_eof = true;
+        return 0;
+    }
+    self->end += (size_t)n;
+    return (size_t)n;
+}
+
+/*** ================================================== ***/
+/*** @private buffered writer helpers ***/
+
+/// @private default buffer size of fs_writer_t
+static const size_t __WRITER_BUFSIZE = 1024 * 1024;
+
+#ifdef _WINDOWS
+    /// @private data to be written (same as struct iovec)
+    struct __iovec_t {
+        void *iov_base;
+        size_t iov_len;
+    };
+#else
+    typedef struct iovec __iovec_t;
 #endif
 
+/// @private write all the data of iovecs in order
+static bool __writevall(int fd, __iovec_t *iov, size_t count) {
+    while (count > 0) {
+        #ifdef _WINDOWS
+            int n = _write(fd, iov->iov_base, (unsigned int)std::min(iov->iov_len, (size_t)0x7fffffff));
+        #else
+            ssize_t n = writev(fd, iov, (int)std::min(count, (size_t)IOV_MAX));
+        #endif
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        // skip written iovecs
+        size_t written = (size_t)n;
+        while (count > 0 && written >= iov->iov_len) {
+            written -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+        if (count > 0) {
+            iov->iov_base = (char*)iov->iov_base + written;
+            iov->iov_len -= written;
+        }
+    }
+    return true;
+}
+
 extern "C" {
     __export FILE *fs_fopen(const char *filename, const char *mode) {
-        if (*mode == 'w') fs_mkdir(path_parentdir(filename).c_str()); // auto create parent directories
         #ifdef _WINDOWS
-            return _wfopen(u8towcs(filename).c_str(), u8towcs(mode).c_str());
+            std::wstring wfilename = u8towcs(filename), wmode = u8towcs(mode);
+            FILE *fp = _wfopen(wfilename.c_str(), wmode.c_str());
+        #else
+            FILE *fp = fopen(filename, mode);
+        #endif
+        if (fp != nullptr || errno != ENOENT || (*mode != 'w' && *mode != 'a') || !fs_mkparents(filename)) return fp;
+
+        // auto create parent directories, and retry
+        #ifdef _WINDOWS
+            return _wfopen(wfilename.c_str(), wmode.c_str());
         #else
             return fopen(filename, mode);
         #endif
@@ -28,7 +542,7 @@ extern "C" {
         #ifdef _WINDOWS
             return _wpopen(u8towcs(procname).c_str(), u8towcs(mode).c_str());
         #else
-            return fopen(procname, mode);
+            return popen(procname, mode);
         #endif
     }
 
@@ -44,26 +558,41 @@ extern "C" {
     }
 
     __export bool fs_copyfile(const char *src, const char *dest, bool isOverwrite) {
-        if (!isOverwrite && path_isfile(dest)) return false;
-        
-        FILE *in = fs_fopen(src, "rb"), *out = fs_fopen(dest, "wb");
-        if (!in || !out) {
-            if (in) fclose(in);
-            if (out) fclose(out);
-            return false;
-        }
-        
-        bool result = true;
-        for (int c = fgetc(in); !feof(in); c = fgetc(in)) {
-            if (EOF == fputc(c, out)) {
-                result = false;
-                break;
+        return fs_copyfile_ex(src, dest, isOverwrite, false, false);
+    }
+
+    #ifdef _WINDOWS
+        __export bool fs_copyfile_ex(const char *src, const char *dest, bool isOverwrite, bool isModePreserved, bool isMtimePreserved) {
+            std::wstring wsrc = u8towcs(src), wdest = u8towcs(dest);
+            // CopyFile always copies the attributes and the last modified time
+            if (!CopyFileW(wsrc.c_str(), wdest.c_str(), !isOverwrite)) {
+                if (GetLastError() != ERROR_PATH_NOT_FOUND) return false;
+                // auto create parent directories
+                if (!fs_mkparents(dest) || !CopyFileW(wsrc.c_str(), wdest.c_str(), !isOverwrite)) return false;
             }
+            if (!isModePreserved) {
+                // the read-only attribute is the only permission bit Windows has
+                DWORD attrs = GetFileAttributesW(wdest.c_str());
+                if (attrs != INVALID_FILE_ATTRIBUTES && (attrs & FILE_ATTRIBUTE_READONLY)) {
+                    SetFileAttributesW(wdest.c_str(), attrs & ~FILE_ATTRIBUTE_READONLY);
+                }
+            }
+            if (!isMtimePreserved) {
+                HANDLE handle = CreateFileW(wdest.c_str(), FILE_WRITE_ATTRIBUTES, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (handle != INVALID_HANDLE_VALUE) {
+                    FILETIME now;
+                    GetSystemTimeAsFileTime(&now);
+                    SetFileTime(handle, nullptr, &now, &now);
+                    CloseHandle(handle);
+                }
+            }
+            return true;
         }
-        if (in) fclose(in);
-        if (out) fclose(out);    
-        return true;
-    }
+    #else
+        __export bool fs_copyfile_ex(const char *src, const char *dest, bool isOverwrite, bool isModePreserved, bool isMtimePreserved) {
+            return __copyfileat(AT_FDCWD, src, AT_FDCWD, dest, isOverwrite, isModePreserved, isMtimePreserved, true);
+        }
+    #endif
 
     __export bool fs_rmfile(const char *filename) {
         #ifdef _WINDOWS
@@ -73,71 +602,47 @@ extern "C" {
         #endif
     }
 
+    __export bool fs_mkdir(const char *dir) {
+        return __mkdirs(dir);
+    }
+    
     #ifdef _WINDOWS
-        __export bool fs_mkdir(const char *dir) {
-            std::wstring wdir = u8towcs(dir);
-            wchar_t *p = (wchar_t*)wdir.c_str();
-            unsigned long i = 0;
-            // create directories in order from the upper level directory
-            while (*p != '\0') {
-                if ((*p == '/' || *p == '\\') && i > 0) {
-                    std::wstring name = wdir.substr(0, i);
-                    if (!PathIsDirectory(name.c_str()) && !CreateDirectory(name.c_str(), nullptr)) return false;
-                }
-                ++p;
-                ++i;
+        __export bool fs_copydir(const char *src, const char *dest) {
+            fs_dirent_t *dirent = fs_opendir(src);
+            if (dirent == nullptr) return false;
+            if (!path_isdir(dest) && !fs_mkdir(dest)){
+                fs_closedir(dirent);
+                return false;
             }
-            if (!PathIsDirectory(wdir.c_str()) && !CreateDirectory(wdir.c_str(), nullptr)) return false;
+
+            std::string dir = path_append_slash(dest);
+            do {
+                if (dirent->current_name != "." && dirent->current_name != "..") {
+                    if (path_isdir(dirent->current_path)) { // copy directory recursively
+                        if (!fs_copydir(dirent->current_path.c_str(), (dir + dirent->current_name).c_str())){
+                            fs_closedir(dirent);
+                            return false;
+                        }
+                    } else { // copy file
+                        if (!fs_copyfile(dirent->current_path.c_str(), (dir + dirent->current_name).c_str(), true)) {
+                            fs_closedir(dirent);
+                            return false;
+                        }
+                    }
+                }
+            } while (fs_seekdir(dirent));
+
+            fs_closedir(dirent);
             return true;
         }
     #else
-        __export bool fs_mkdir(const char *_dir) {
-            std::string dir = _dir;
-            char *p = (char*)dir.c_str();
-            unsigned long i = 0;
-            // create directories in order from the upper level directory
-            while (*p != '\0') {
-                if ((*p == '/') && i > 0) {
-                    std::string name = dir.substr(0, i);
-                    if (!path_isdir(name.c_str()) && 0 != mkdir(name.c_str(), S_IRWXU|S_IRGRP|S_IXGRP|S_IROTH|S_IXOTH)) return false;
-                }
-                ++p;
-                ++i;
-            }
-            if (!path_isdir(dir.c_str()) && 0 != mkdir(dir.c_str(), S_IRWXU|S_IRGRP|S_IXGRP|S_IROTH|S_IXOTH)) return false;
-            return true;
+        __export bool fs_copydir(const char *src, const char *dest) {
+            if (!path_isdir(src)) return false;
+            if (!path_isdir(dest) && !fs_mkdir(dest)) return false;
+            return __copydirat(AT_FDCWD, src, AT_FDCWD, dest);
         }
     #endif
     
-    __export bool fs_copydir(const char *src, const char *dest) {
-        fs_dirent_t *dirent = fs_opendir(src);
-        if (dirent == nullptr) return false;
-        if (!path_isdir(dest) && !fs_mkdir(dest)){
-            fs_closedir(dirent);
-            return false;
-        }
-
-        std::string dir = path_append_slash(dest);
-        do {
-            if (dirent->current_name != "." && dirent->current_name != "..") {
-                if (path_isdir(dirent->current_path)) { // copy directory recursively
-                    if (!fs_copydir(dirent->current_path.c_str(), (dir + dirent->current_name).c_str())){
-                        fs_closedir(dirent);
-                        return false;
-                    }
-                } else { // copy file
-                    if (!fs_copyfile(dirent->current_path.c_str(), (dir + dirent->current_name).c_str(), true)) {
-                        fs_closedir(dirent);
-                        return false;
-                    }
-                }
-            }
-        } while (fs_seekdir(dirent));
-
-        fs_closedir(dirent);
-        return true;
-    }
-    
     /// @private remove empty directory
     inline bool rmdir_empty(const char *dir) {
         #ifdef _WINDOWS
@@ -147,28 +652,275 @@ extern "C" {
         #endif
     }
     
-    __export bool fs_rmdir(const char *dir) {
-        fs_dirent_t *dirent = fs_opendir(dir);
-        if (dirent == nullptr) return false;
+    #ifdef _WINDOWS
+        __export bool fs_rmdir(const char *dir) {
+            fs_dirent_t *dirent = fs_opendir(dir);
+            if (dirent == nullptr) return false;
 
-        do {
-            if (dirent->current_name != "." && dirent->current_name != "..") {
-                if (path_isdir(dirent->current_path)) { // remove directory recursively
-                    if (!fs_rmdir(dirent->current_path.c_str())) {
-                        fs_closedir(dirent);
-                        return false;
+            do {
+                if (dirent->current_name != "." && dirent->current_name != "..") {
+                    if (path_isdir(dirent->current_path)) { // remove directory recursively
+                        if (!fs_rmdir(dirent->current_path.c_str())) {
+                            fs_closedir(dirent);
+                            return false;
+                        }
+                    } else { // remove file
+                        if (!fs_rmfile(dirent->current_path.c_str())) {
+                            fs_closedir(dirent);
+                            return false;
+                        }
                     }
-                } else { // remove file
-                    if (!fs_rmfile(dirent->current_path.c_str())) {
-                        fs_closedir(dirent);
-                        return false;
+                }
+            } while (fs_seekdir(dirent));
+
+            fs_closedir(dirent);
+            return rmdir_empty(dir); // remove empty directory
+        }
+    #else
+        __export bool fs_rmdir(const char *dir) {
+            return __rmdirat(AT_FDCWD, dir);
+        }
+    #endif
+
+    __export bool fs_copydir_parallel(const char *src, const char *dest, size_t threads) {
+        if (!path_isdir(src)) return false;
+
+        thread_pool_t pool(threads);
+        std::atomic<bool> result(true);
+        
+        // copy files in the directory
+        auto copyfiles = [&result](const std::string &src, const std::string &dest, const std::vector<std::string> &files) {
+            for (auto &name: files) {
+                if (!result) return;
+                if (!fs_copyfile((src + name).c_str(), (dest + name).c_str(), true)) result = false;
+            }
+        };
+        // directory node task: create the directory, then push the sub directories and the batches of files as tasks
+        std::function<void(const std::string &, const std::string &)> copydir = [&](const std::string &srcdir, const std::string &destdir) {
+            std::vector<__entry_t> entries;
+            if (!result) return;
+            if (!__listdir(srcdir, entries, true) || (!path_isdir(destdir) && !fs_mkdir(destdir.c_str()))) {
+                result = false;
+                return;
+            }
+
+            std::string srcprefix = path_append_slash(srcdir), destprefix = path_append_slash(destdir);
+            std::vector<std::string> files;
+            for (auto &entry: entries) {
+                if (entry.isdir) {
+                    pool.push([&copydir, src = srcprefix + entry.name, dest = destprefix + entry.name] { copydir(src, dest); });
+                    continue;
+                }
+                files.push_back(entry.name);
+                if (files.size() == __FILES_PER_TASK) {
+                    pool.push([&copyfiles, srcprefix, destprefix, files = std::move(files)] { copyfiles(srcprefix, destprefix, files); });
+                    files.clear();
+                }
+            }
+            copyfiles(srcprefix, destprefix, files);
+        };
+        
+        pool.push([&copydir, src = std::string(src), dest = std::string(dest)] { copydir(src, dest); });
+        return pool.wait() && result;
+    }
+
+    __export bool fs_rmdir_parallel(const char *dir, size_t threads) {
+        if (!path_isdir(dir)) return false;
+
+        // directory node: removed when all the children are completed (post-order)
+        struct node_t {
+            std::string path;
+            std::shared_ptr<node_t> parent;
+            std::atomic<size_t> pending; // count of uncompleted tasks for the children + 1 (listing task)
+        };
+
+        thread_pool_t pool(threads);
+        std::atomic<bool> result(true);
+
+        // complete a task of the node, and remove the directories whose children are all completed
+        auto complete = [&result](std::shared_ptr<node_t> node) {
+            for (; node; node = node->parent) {
+                if (--node->pending > 0) return;
+                if (!rmdir_empty(node->path.c_str())) result = false;
+            }
+        };
+        // remove files in the directory
+        auto rmfiles = [&result](const std::string &prefix, const std::vector<__entry_t> &files) {
+            for (auto &entry: files) {
+                bool removed =
+                    #ifdef _WINDOWS
+                        entry.isdir ? rmdir_empty((prefix + entry.name).c_str()) : // junction / symbolic link to directory
+                    #endif
+                    fs_rmfile((prefix + entry.name).c_str());
+                if (!removed) result = false;
+            }
+        };
+        // directory node task: push the sub directories and the batches of files as tasks
+        std::function<void(std::shared_ptr<node_t>)> rmdir = [&](std::shared_ptr<node_t> node) {
+            std::vector<__entry_t> entries;
+            if (!__listdir(node->path, entries, false)) result = false;
+
+            std::string prefix = path_append_slash(node->path);
+            std::vector<__entry_t> files;
+            for (auto &entry: entries) {
+                if (entry.isdir && !entry.islink) {
+                    auto child = std::make_shared<node_t>();
+                    child->path = prefix + entry.name;
+                    child->parent = node;
+                    child->pending = 1;
+                    ++node->pending;
+                    pool.push([&rmdir, child] { rmdir(child); });
+                    continue;
+                }
+                files.push_back(std::move(entry));
+                if (files.size() == __FILES_PER_TASK) {
+                    ++node->pending;
+                    pool.push([&rmfiles, &complete, node, prefix, files = std::move(files)] {
+                        rmfiles(prefix, files);
+                        complete(node);
+                    });
+                    files.clear();
+                }
+            }
+            rmfiles(prefix, files);
+            complete(node);
+        };
+
+        auto root = std::make_shared<node_t>();
+        root->path = dir;
+        root->pending = 1;
+        pool.push([&rmdir, root] { rmdir(root); });
+        root = nullptr;
+        return pool.wait() && result;
+    }
+
+    /*** ================================================== ***/
+    /*** incremental directory sync ***/
+
+    __export fs_sync_t *fs_sync(const char *src, const char *dest, int compare, bool isDeleted, size_t threads) {
+        if (!path_isdir(src) || (!path_isdir(dest) && !fs_mkdir(dest))) return nullptr;
+
+        fs_sync_t *self = new fs_sync_t;
+        thread_pool_t pool(threads);
+        std::mutex mutex; // guards self
+        const char sep =
+            #ifdef _WINDOWS
+                '\\';
+            #else
+                '/';
+            #endif
+
+        self->skipped = self->bytes = 0;
+        auto record = [self, &mutex](int kind, const std::string &relpath, unsigned long long size = 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (kind == FS_SYNC_SKIPPED) {
+                ++self->skipped;
+                return;
+            }
+            self->paths[kind].push_back(relpath);
+            if (kind == FS_SYNC_COPIED) self->bytes += size;
+        };
+        // copy changed files in the directory
+        auto syncfiles = [&record, compare](const std::string &srcprefix, const std::string &destprefix, const std::string &relprefix, const std::vector<std::string> &files) {
+            for (auto &name: files) {
+                std::string srcpath = srcprefix + name, destpath = destprefix + name;
+                path_stat_t srcstat, deststat;
+
+                if (!path_stat(&srcstat, srcpath.c_str())) {
+                    record(FS_SYNC_FAILED, relprefix + name);
+                    continue;
+                }
+                if (path_stat(&deststat, destpath.c_str()) && srcstat.size == deststat.size) {
+                    bool isSame = compare == FS_SYNC_CONTENT
+                        ? __samecontent(srcpath, destpath)
+                        : srcstat.last_modified_seconds == deststat.last_modified_seconds;
+                    if (isSame) {
+                        record(FS_SYNC_SKIPPED, "");
+                        continue;
                     }
                 }
+                if (__replacefile(srcpath, destprefix, name)) record(FS_SYNC_COPIED, relprefix + name, srcstat.size);
+                else record(FS_SYNC_FAILED, relprefix + name);
+            }
+        };
+        // directory node task: remove extraneous entries, then push the sub directories and the batches of files as tasks
+        std::function<void(const std::string &, const std::string &, const std::string &)> syncdir = [&](const std::string &srcdir, const std::string &destdir, const std::string &relprefix) {
+            std::vector<__entry_t> srcentries, destentries;
+            if (!__listdir(srcdir, srcentries, true) || !__listdir(destdir, destentries, false)) {
+                record(FS_SYNC_FAILED, relprefix.empty() ? "." : relprefix);
+                return;
             }
-        } while (fs_seekdir(dirent));
 
-        fs_closedir(dirent);
-        return rmdir_empty(dir); // remove empty directory
+            std::string srcprefix = path_append_slash(srcdir), destprefix = path_append_slash(destdir);
+            std::unordered_map<std::string, bool> srcdirs; // name => is directory
+            for (auto &entry: srcentries) srcdirs[entry.name] = entry.isdir;
+            for (auto &entry: destentries) {
+                auto it = srcdirs.find(entry.name);
+                bool isDestDir = entry.isdir && !entry.islink;
+                if (it != srcdirs.end() && it->second == isDestDir) continue;
+                if (it == srcdirs.end() && !isDeleted) continue;
+
+                // extraneous entry, or the type is different from src
+                std::string destpath = destprefix + entry.name;
+                bool isRemoved = isDestDir ? fs_rmdir(destpath.c_str()) : fs_rmfile(destpath.c_str());
+                if (it == srcdirs.end()) record(isRemoved ? FS_SYNC_DELETED : FS_SYNC_FAILED, relprefix + entry.name);
+                else if (!isRemoved) record(FS_SYNC_FAILED, relprefix + entry.name);
+            }
+
+            std::vector<std::string> files;
+            for (auto &entry: srcentries) {
+                if (entry.isdir) {
+                    std::string destpath = destprefix + entry.name;
+                    if (!path_isdir(destpath) && !fs_mkdir(destpath.c_str())) {
+                        record(FS_SYNC_FAILED, relprefix + entry.name);
+                        continue;
+                    }
+                    pool.push([&syncdir, src = srcprefix + entry.name, dest = destpath, rel = relprefix + entry.name + sep] { syncdir(src, dest, rel); });
+                    continue;
+                }
+                files.push_back(entry.name);
+                if (files.size() == __FILES_PER_TASK) {
+                    pool.push([&syncfiles, srcprefix, destprefix, relprefix, files = std::move(files)] { syncfiles(srcprefix, destprefix, relprefix, files); });
+                    files.clear();
+                }
+            }
+            syncfiles(srcprefix, destprefix, relprefix, files);
+        };
+
+        pool.push([&syncdir, src = std::string(src), dest = std::string(dest)] { syncdir(src, dest, ""); });
+        if (!pool.wait()) { // e.g. out of memory: the result is incomplete
+            delete self;
+            return nullptr;
+        }
+        for (auto &paths: self->paths) std::sort(paths.begin(), paths.end());
+        return self;
+    }
+
+    __export void fs_sync_free(fs_sync_t *self) {
+        delete self;
+    }
+
+    __export size_t fs_sync_count(fs_sync_t *self, int kind) {
+        if (kind == FS_SYNC_SKIPPED) return (size_t)self->skipped;
+        return kind >= 0 && kind < 3 ? self->paths[kind].size() : 0;
+    }
+
+    __export const char *fs_sync_get(fs_sync_t *self, int kind, size_t index) {
+        if (kind < 0 || kind >= 3 || index >= self->paths[kind].size()) return nullptr;
+        return self->paths[kind][index].c_str();
+    }
+
+    __export unsigned long long fs_sync_bytes(fs_sync_t *self) {
+        return self->bytes;
+    }
+
+    __export size_t fs_writefile(const char *filename, const char *data, size_t size) {
+        FILE *fp = fs_fopen(filename, "wb");
+        if (fp == nullptr) return 0;
+
+        size_t written = fwrite(data, 1, size, fp);
+        if (0 != fclose(fp)) return 0;
+        return written;
     }
 
     /// @private rename file / directory
@@ -219,12 +971,45 @@ extern "C" {
         __export bool fs_seekdir(fs_dirent_t *self) {
             WIN32_FIND_DATA info;
             
-            if (!self->handler) return false;
+            if (!self->handler || self->is_batch) return false;
             if (!FindNextFile((HANDLE)self->handler, &info)) return false;
             self->current_name = wcstou8(info.cFileName);
             self->current_path = self->directory + self->current_name;
             return true;
         }
+
+        __export size_t fs_readdir_batch(fs_dirent_t *self, fs_entry_t *out, size_t cap, char *pool, size_t poolcap) {
+            if (!self->handler) return 0;
+
+            // self->buffer: find data of the pending entry, self->buffer_len: 1 if there is the pending entry
+            if (!self->is_batch) {
+                // restart the enumeration to get the find data of the first entry
+                self->is_batch = true;
+                self->buffer.resize(sizeof(WIN32_FIND_DATAW));
+                FindClose((HANDLE)self->handler);
+                
+                HANDLE handle = FindFirstFileW((u8towcs(self->directory) + L"*.*").c_str(), (WIN32_FIND_DATAW*)&self->buffer[0]);
+                self->handler = handle == INVALID_HANDLE_VALUE ? 0 : (unsigned long)handle;
+                self->buffer_len = self->handler ? 1 : 0;
+            }
+
+            WIN32_FIND_DATAW *info = (WIN32_FIND_DATAW*)&self->buffer[0];
+            size_t n = 0, used = 0;
+            while (n < cap && self->buffer_len > 0) {
+                if (wcscmp(info->cFileName, L".") != 0 && wcscmp(info->cFileName, L"..") != 0) {
+                    std::string name = wcstou8(info->cFileName);
+                    if (used + name.size() + 1 > poolcap) break;
+
+                    unsigned char type = (info->dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) ? FS_TYPE_LNK
+                        : (info->dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? FS_TYPE_DIR : FS_TYPE_REG;
+                    memcpy(pool + used, name.c_str(), name.size() + 1);
+                    out[n++] = {used, 0, type};
+                    used += name.size() + 1;
+                }
+                self->buffer_len = FindNextFileW((HANDLE)self->handler, info) ? 1 : 0;
+            }
+            return n;
+        }
     #else
         __export fs_dirent_t *fs_opendir(const char *_dir) {
             std::string dir = path_append_slash(_dir);
@@ -253,7 +1038,7 @@ extern "C" {
         }
         
         __export bool fs_seekdir(fs_dirent_t *self) {
-            if (!self->handler) return false;
+            if (!self->handler || self->is_batch) return false;
             
             struct dirent* dent = readdir((DIR*)self->handler);
             if (!dent) return false;
@@ -261,6 +1046,62 @@ extern "C" {
             self->current_path = self->directory + self->current_name;
             return true;
         }
+
+        __export size_t fs_readdir_batch(fs_dirent_t *self, fs_entry_t *out, size_t cap, char *pool, size_t poolcap) {
+            if (!self->handler) return 0;
+
+            DIR *dir = (DIR*)self->handler;
+            size_t n = 0, used = 0;
+            #ifdef __linux__
+                // read the entries by the kernel interface with the large buffer (the buffer of DIR is not used any more)
+                int fd = dirfd(dir);
+                if (!self->is_batch) {
+                    self->is_batch = true;
+                    self->buffer.resize(64 * 1024);
+                    self->buffer_pos = self->buffer_len = 0;
+                    if (lseek(fd, 0, SEEK_SET) != 0) return 0;
+                }
+                while (n < cap) {
+                    if (self->buffer_pos >= self->buffer_len) {
+                        long size = syscall(SYS_getdents64, fd, &self->buffer[0], self->buffer.size());
+                        if (size <= 0) break;
+                        self->buffer_pos = 0;
+                        self->buffer_len = size;
+                    }
+
+                    __linux_dirent64_t *dent = (__linux_dirent64_t*)&self->buffer[self->buffer_pos];
+                    if (strcmp(dent->d_name, ".") != 0 && strcmp(dent->d_name, "..") != 0) {
+                        size_t len = strlen(dent->d_name) + 1;
+                        if (used + len > poolcap) break; // keep the entry for the next call
+                        memcpy(pool + used, dent->d_name, len);
+                        out[n++] = {used, dent->d_ino, dent->d_type};
+                        used += len;
+                    }
+                    self->buffer_pos += dent->d_reclen;
+                }
+            #else
+                if (!self->is_batch) {
+                    self->is_batch = true;
+                    rewinddir(dir);
+                }
+                while (n < cap) {
+                    long pos = telldir(dir);
+                    struct dirent *dent = readdir(dir);
+                    if (!dent) break;
+                    if (strcmp(dent->d_name, ".") == 0 || strcmp(dent->d_name, "..") == 0) continue;
+
+                    size_t len = strlen(dent->d_name) + 1;
+                    if (used + len > poolcap) { // keep the entry for the next call
+                        seekdir(dir, pos);
+                        break;
+                    }
+                    memcpy(pool + used, dent->d_name, len);
+                    out[n++] = {used, dent->d_ino, dent->d_type};
+                    used += len;
+                }
+            #endif
+            return n;
+        }
     #endif
 
     __export const char *fs_readdir_name(fs_dirent_t *self) {
@@ -270,4 +1111,433 @@ extern "C" {
     __export const char *fs_readdir_path(fs_dirent_t *self) {
         return self->current_path.c_str();
     }
-}
\ No newline at end of file
+
+    /*** ================================================== ***/
+    /*** recursive file walker ***/
+
+    __export fs_walk_t *fs_walk_open(const char *dir, const char **include, size_t ninclude, const char **exclude, size_t nexclude, int maxdepth, unsigned char type) {
+        fs_walk_t *self = new fs_walk_t {path_append_slash(dir), nullptr, nullptr, maxdepth, type};
+        bool isCompiled = true;
+
+        if (ninclude > 0) isCompiled = (self->include = glob_compile_set(include, ninclude)) != nullptr;
+        if (nexclude > 0 && isCompiled) isCompiled = (self->exclude = glob_compile_set(exclude, nexclude)) != nullptr;
+
+        self->stack.push_back({"", 0, {}, 0});
+        if (!isCompiled || !__walk_readentries(self->root, self->stack.back().entries)) {
+            fs_walk_close(self);
+            return nullptr;
+        }
+        return self;
+    }
+
+    __export void fs_walk_close(fs_walk_t *self) {
+        glob_free(self->include);
+        glob_free(self->exclude);
+        delete self;
+    }
+
+    __export const char *fs_walk_next(fs_walk_t *self, unsigned char *type) {
+        while (!self->stack.empty()) {
+            fs_walk_t::frame_t &frame = self->stack.back();
+            if (frame.index >= frame.entries.size()) {
+                self->stack.pop_back();
+                continue;
+            }
+
+            const auto &entry = frame.entries[frame.index++];
+            std::string relpath = frame.relpath + entry.first, path = self->root + relpath;
+            unsigned char entrytype = entry.second;
+            int depth = frame.depth;
+            bool isLink = entrytype == FS_TYPE_LNK;
+
+            if (__walk_matchany(self->exclude, relpath, false)) continue; // pruned
+            if (isLink || entrytype == FS_TYPE_UNKNOWN) { // resolve the link target
+                if (path_isdir(path)) entrytype = FS_TYPE_DIR;
+                else if (path_isfile(path)) entrytype = FS_TYPE_REG;
+            }
+            if (entrytype == FS_TYPE_DIR && !isLink && (self->maxdepth < 0 || depth < self->maxdepth)) {
+                std::string subdir = path_append_slash(relpath);
+                if (self->include == nullptr || __walk_matchany(self->include, subdir, true)) {
+                    // frame is invalidated by push_back
+                    self->stack.push_back({subdir, depth + 1, {}, 0});
+                    if (!__walk_readentries(self->root + subdir, self->stack.back().entries)) self->stack.pop_back();
+                }
+            }
+
+            if (self->type != 0 && self->type != entrytype) continue;
+            if (self->include != nullptr && !__walk_matchany(self->include, relpath, false)) continue;
+
+            self->current_path = path;
+            if (type) *type = entrytype;
+            return self->current_path.c_str();
+        }
+        return nullptr;
+    }
+
+    /*** ================================================== ***/
+    /*** memory-mapped file ***/
+
+    #ifdef _WINDOWS
+        __export fs_mmap_t *fs_mmap_open(const char *path, bool isWritable, int advice) {
+            HANDLE file = CreateFileW(
+                u8towcs(path).c_str(), isWritable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+            );
+            LARGE_INTEGER size;
+
+            if (file == INVALID_HANDLE_VALUE) return nullptr;
+            if (!GetFileSizeEx(file, &size)) {
+                CloseHandle(file);
+                return nullptr;
+            }
+
+            fs_mmap_t *self = new fs_mmap_t {nullptr, (unsigned long long)size.QuadPart, (unsigned long long)file, 0, isWritable};
+            if (self->size == 0) return self; // empty file cannot be mapped
+
+            HANDLE mapping = CreateFileMappingW(file, nullptr, isWritable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr) {
+                self->mapping = (unsigned long long)mapping;
+                self->ptr = (char*)MapViewOfFile(mapping, isWritable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0);
+            }
+            if (self->ptr == nullptr) {
+                fs_mmap_close(self);
+                return nullptr;
+            }
+            return self;
+        }
+
+        __export bool fs_mmap_advise(fs_mmap_t *self, int advice) {
+            return true;
+        }
+
+        __export bool fs_mmap_sync(fs_mmap_t *self) {
+            if (self->ptr == nullptr) return true;
+            return FlushViewOfFile(self->ptr, 0) && FlushFileBuffers((HANDLE)self->handler);
+        }
+
+        __export void fs_mmap_close(fs_mmap_t *self) {
+            if (self == nullptr) return;
+            if (self->ptr) UnmapViewOfFile(self->ptr);
+            if (self->mapping) CloseHandle((HANDLE)self->mapping);
+            CloseHandle((HANDLE)self->handler);
+            delete self;
+        }
+    #else
+        __export fs_mmap_t *fs_mmap_open(const char *path, bool isWritable, int advice) {
+            int fd = open(path, (isWritable ? O_RDWR : O_RDONLY) | O_CLOEXEC);
+            struct stat st;
+
+            if (fd < 0) return nullptr;
+            if (0 != fstat(fd, &st)) {
+                close(fd);
+                return nullptr;
+            }
+
+            fs_mmap_t *self = new fs_mmap_t {nullptr, (unsigned long long)st.st_size, (unsigned long long)fd, 0, isWritable};
+            if (self->size == 0) return self; // empty file cannot be mapped
+
+            void *ptr = mmap(nullptr, self->size, isWritable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+            if (ptr == MAP_FAILED) {
+                fs_mmap_close(self);
+                return nullptr;
+            }
+            self->ptr = (char*)ptr;
+            fs_mmap_advise(self, advice);
+            return self;
+        }
+
+        __export bool fs_mmap_advise(fs_mmap_t *self, int advice) {
+            bool result = true;
+
+            if (self->ptr == nullptr) return true;
+            if (advice & FS_MMAP_SEQUENTIAL) result = 0 == posix_madvise(self->ptr, self->size, POSIX_MADV_SEQUENTIAL) && result;
+            if (advice & FS_MMAP_RANDOM) result = 0 == posix_madvise(self->ptr, self->size, POSIX_MADV_RANDOM) && result;
+            if (advice & FS_MMAP_WILLNEED) result = 0 == posix_madvise(self->ptr, self->size, POSIX_MADV_WILLNEED) && result;
+            #ifdef MADV_HUGEPAGE
+                // the file system may not support huge pages: it's just a hint
+                if (advice & FS_MMAP_HUGEPAGE) madvise(self->ptr, self->size, MADV_HUGEPAGE);
+            #endif
+            return result;
+        }
+
+        __export bool fs_mmap_sync(fs_mmap_t *self) {
+            if (self->ptr == nullptr) return true;
+            return 0 == msync(self->ptr, self->size, MS_SYNC);
+        }
+
+        __export void fs_mmap_close(fs_mmap_t *self) {
+            if (self == nullptr) return;
+            if (self->ptr) munmap(self->ptr, self->size);
+            close((int)self->handler);
+            delete self;
+        }
+    #endif
+
+    /*** ================================================== ***/
+    /*** buffered reader ***/
+
+    __export fs_reader_t *fs_reader_open(FILE *fp, size_t bufsize) {
+        if (fp == nullptr) return nullptr;
+        return new fs_reader_t {fp, -1, std::vector<char>(bufsize > 0 ? bufsize : __READER_BUFSIZE), 0, 0, false};
+    }
+
+    __export fs_reader_t *fs_reader_openfd(int fd, size_t bufsize) {
+        if (fd < 0) return nullptr;
+        return new fs_reader_t {nullptr, fd, std::vector<char>(bufsize > 0 ? bufsize : __READER_BUFSIZE), 0, 0, false};
+    }
+
+    __export void fs_reader_close(fs_reader_t *self) {
+        delete self;
+    }
+
+    __export const char *fs_reader_readline(fs_reader_t *self, size_t *len) {
+        size_t scanned = 0; // size of unread data already scanned for "\n"
+        while (true) {
+            char *line = &self->buffer[0] + self->begin;
+            size_t size = self->end - self->begin;
+            char *lf = (char*)memchr(line + scanned, '\n', size - scanned);
+
+            if (lf) {
+                size_t n = lf - line;
+                self->begin += n + 1;
+                *len = n > 0 && line[n - 1] == '\r' ? n - 1 : n;
+                return line;
+            }
+            scanned = size;
+            if (self->is_eof || __reader_fill(self) == 0) {
+                if (!self->is_eof || size == 0) return nullptr;
+                // the last line without the line separator
+                self->begin = self->end;
+                *len = line[size - 1] == '\r' ? size - 1 : size;
+                return line;
+            }
+        }
+    }
+
+    __export size_t fs_reader_read(fs_reader_t *self, char *dest, size_t size) {
+        size_t read = 0;
+        while (read < size) {
+            if (self->begin == self->end) {
+                if (size - read >= self->buffer.size()) { // large data: read into dest directly
+                    long long n = __reader_readsource(self, dest + read, size - read);
+                    if (n <= 0) break;
+                    read += (size_t)n;
+                    continue;
+                }
+                if (__reader_fill(self) == 0) break;
+            }
+            size_t n = std::min(size - read, self->end - self->begin);
+            memcpy(dest + read, &self->buffer[self->begin], n);
+            self->begin += n;
+            read += n;
+        }
+        return read;
+    }
+
+    __export int fs_reader_getc(fs_reader_t *self) {
+        if (self->begin == self->end && __reader_fill(self) == 0) return -1;
+        return (unsigned char)self->buffer[self->begin++];
+    }
+
+    __export size_t fs_reader_fill(fs_reader_t *self) {
+        return self->is_eof ? 0 : __reader_fill(self);
+    }
+
+    __export bool fs_reader_sync(fs_reader_t *self) {
+        long long unread = (long long)(self->end - self->begin);
+        if (unread > 0) {
+            bool isSeeked = self->fp ? 0 == fseek(self->fp, -(long)unread, SEEK_CUR)
+                #ifdef _WINDOWS
+                    : _lseeki64(self->fd, -unread, SEEK_CUR) >= 0;
+                #else
+                    : lseek(self->fd, -(off_t)unread, SEEK_CUR) >= 0;
+                #endif
+            if (!isSeeked) return false;
+        }
+        self->begin = self->end = 0;
+        self->is_eof = false;
+        return true;
+    }
+
+    /*** ================================================== ***/
+    /*** buffered writer ***/
+
+    __export fs_writer_t *fs_writer_open(const char *filename, bool isAppended, size_t bufsize) {
+        int flags = O_WRONLY | O_CREAT | (isAppended ? O_APPEND : O_TRUNC);
+        #ifdef _WINDOWS
+            std::wstring wfilename = u8towcs(filename);
+            int fd = _wopen(wfilename.c_str(), flags | _O_BINARY, _S_IREAD | _S_IWRITE);
+            if (fd < 0 && errno == ENOENT && fs_mkparents(filename)) { // auto create parent directories
+                fd = _wopen(wfilename.c_str(), flags | _O_BINARY, _S_IREAD | _S_IWRITE);
+            }
+        #else
+            int fd = open(filename, flags | O_CLOEXEC, S_IRUSR|S_IWUSR|S_IRGRP|S_IWGRP|S_IROTH|S_IWOTH);
+            if (fd < 0 && errno == ENOENT && fs_mkparents(filename)) { // auto create parent directories
+                fd = open(filename, flags | O_CLOEXEC, S_IRUSR|S_IWUSR|S_IRGRP|S_IWGRP|S_IROTH|S_IWOTH);
+            }
+        #endif
+        if (fd < 0) return nullptr;
+
+        fs_writer_t *self = fs_writer_openfd(fd, bufsize);
+        self->is_owned = true;
+        return self;
+    }
+
+    __export fs_writer_t *fs_writer_openfd(int fd, size_t bufsize) {
+        if (fd < 0) return nullptr;
+        return new fs_writer_t {fd, false, std::vector<char>(bufsize > 0 ? bufsize : __WRITER_BUFSIZE), 0, false};
+    }
+
+    __export bool fs_writer_write(fs_writer_t *self, const char *data, size_t size) {
+        return fs_writer_writev(self, &data, &size, 1);
+    }
+
+    __export bool fs_writer_writev(fs_writer_t *self, const char **data, const size_t *sizes, size_t n) {
+        static thread_local std::vector<__iovec_t> iov; // buffered data and large data to be written in order
+        size_t capacity = self->buffer.size();
+
+        if (self->is_failed) return false;
+        iov.clear();
+        for (size_t i = 0; i < n; ++i) {
+            if (sizes[i] == 0) continue;
+            if (iov.empty() && self->size + sizes[i] <= capacity) { // gather into the buffer
+                memcpy(&self->buffer[self->size], data[i], sizes[i]);
+                self->size += sizes[i];
+                continue;
+            }
+            if (sizes[i] < capacity / 2) { // write out pending data, and gather into the buffer
+                if (iov.empty()) iov.push_back({&self->buffer[0], self->size});
+                if (!__writevall(self->fd, &iov[0], iov.size())) {
+                    self->is_failed = true;
+                    return false;
+                }
+                iov.clear();
+                memcpy(&self->buffer[0], data[i], sizes[i]);
+                self->size = sizes[i];
+                continue;
+            }
+            // large data: write with the buffered data by one system call
+            if (iov.empty() && self->size > 0) iov.push_back({&self->buffer[0], self->size});
+            iov.push_back({(void*)data[i], sizes[i]});
+        }
+        if (!iov.empty()) { // the pointers of data are not valid after returning
+            if (!__writevall(self->fd, &iov[0], iov.size())) {
+                self->is_failed = true;
+                return false;
+            }
+            self->size = 0;
+        }
+        return true;
+    }
+
+    __export bool fs_writer_flush(fs_writer_t *self) {
+        if (self->is_failed) return false;
+        if (self->size == 0) return true;
+
+        __iovec_t iov = {&self->buffer[0], self->size};
+        if (!__writevall(self->fd, &iov, 1)) {
+            self->is_failed = true;
+            return false;
+        }
+        self->size = 0;
+        return true;
+    }
+
+    __export bool fs_writer_close(fs_writer_t *self) {
+        if (self == nullptr) return false;
+
+        bool result = fs_writer_flush(self);
+        if (self->is_owned) {
+            #ifdef _WINDOWS
+                result = 0 == _close(self->fd) && result;
+            #else
+                result = 0 == close(self->fd) && result;
+            #endif
+        }
+        delete self;
+        return result;
+    }
+}
+
+/*** ================================================== ***/
+/*** utility functions for C++ ***/
+
+bool fs_mkparents(const std::string &filename) {
+    std::string dir = path_parentdir(filename, false);
+    return dir.empty() || __mkdirs(dir);
+}
+
+#ifdef _WINDOWS
+    bool fs_readfile(const std::string &filename, long long size, const std::function<void(const char *data, size_t size)> &callback) {
+        FILE *fp = fs_fopen(filename.c_str(), "rb");
+        struct _stat64 st;
+
+        if (fp == nullptr) return false;
+        if (0 != _fstat64(_fileno(fp), &st) || (st.st_mode & _S_IFDIR)) {
+            fclose(fp);
+            return false;
+        }
+
+        std::string data;
+        if ((st.st_mode & _S_IFREG) && st.st_size > 0) { // read at once
+            data.resize(size >= 0 && size < st.st_size ? (size_t)size : (size_t)st.st_size);
+            data.resize(fread(&data[0], 1, data.size(), fp));
+        } else { // unknown size: read until EOF
+            char buffer[64 * 1024];
+            size_t n;
+            while ((size < 0 || (long long)data.size() < size) && (n = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+                data.append(buffer, size < 0 ? n : std::min(n, (size_t)(size - data.size())));
+            }
+        }
+        fclose(fp);
+        callback(data.c_str(), data.size());
+        return true;
+    }
+#else
+    /// @private read the designated size of data from the file descriptor
+    static size_t __readfull(int fd, char *dest, size_t size) {
+        size_t read = 0;
+        while (read < size) {
+            ssize_t n = ::read(fd, dest + read, size - read);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) break;
+            read += n;
+        }
+        return read;
+    }
+
+    bool fs_readfile(const std::string &filename, long long size, const std::function<void(const char *data, size_t size)> &callback) {
+        int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        struct stat st;
+
+        if (fd < 0) return false;
+        if (0 != fstat(fd, &st) || S_ISDIR(st.st_mode)) {
+            close(fd);
+            return false;
+        }
+
+        if (S_ISREG(st.st_mode) && st.st_size > 0) {
+            // the file is not mapped into memory: the process would get SIGBUS if the file is truncated while reading
+            size_t n = size >= 0 && size < st.st_size ? (size_t)size : (size_t)st.st_size;
+            std::unique_ptr<char[]> data(new char[n]); // released even if the callback raises the error
+            n = __readfull(fd, data.get(), n);
+            close(fd);
+            callback(data.get(), n);
+            return true;
+        }
+
+        // unknown size (pipe, character device, procfs, etc): read until EOF
+        std::string data;
+        char buffer[64 * 1024];
+        ssize_t n;
+        while (size < 0 || (long long)data.size() < size) {
+            n = ::read(fd, buffer, sizeof(buffer));
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) break;
+            data.append(buffer, size < 0 ? (size_t)n : std::min((size_t)n, (size_t)(size - data.size())));
+        }
+        close(fd);
+        callback(data.c_str(), data.size());
+        return true;
+    }
+#endif
@@ -1,6 +1,9 @@
 ﻿#pragma once
 
 #include "path.hpp"
+#include "glob.hpp"
+#include <vector>
+#include <functional>
 
 extern "C" {
     /// open file (supports UTF-8 in Windows)
@@ -18,6 +21,13 @@ extern "C" {
     /// copy file
     __export bool fs_copyfile(const char *src, const char *dest, bool isOverwrite);
 
+    /// copy file with options
+    // * uses the fastest way the file system supports: reflink (FICLONE), copy_file_range, sendfile, read/write
+    // * holes of sparse file are kept
+    // @param isModePreserved: copy the permission bits of src
+    // @param isMtimePreserved: copy the last accessed / modified time of src
+    __export bool fs_copyfile_ex(const char *src, const char *dest, bool isOverwrite, bool isModePreserved, bool isMtimePreserved);
+
     /// remove file
     __export bool fs_rmfile(const char *filename);
 
@@ -30,9 +40,69 @@ extern "C" {
     /// remove directory (recursively)
     __export bool fs_rmdir(const char *dir);
 
+    /// copy directory (recursively) in parallel on the work-stealing thread pool
+    // @param threads: count of worker threads (0: count of hardware threads)
+    __export bool fs_copydir_parallel(const char *src, const char *dest, size_t threads);
+
+    /// remove directory (recursively) in parallel on the work-stealing thread pool
+    // @param threads: count of worker threads (0: count of hardware threads)
+    __export bool fs_rmdir_parallel(const char *dir, size_t threads);
+
+    /// write data into the file by one open / write / close (parent directories are created automatically)
+    // @return written size
+    __export size_t fs_writefile(const char *filename, const char *data, size_t size);
+
     /// rename (move) file / directory
     __export bool fs_rename(const char *src, const char *dest, bool isOverwrite);
 
+    /*** ================================================== ***/
+    /*** incremental directory sync ***/
+
+    /// how fs_sync detects unchanged files
+    enum {
+        FS_SYNC_MTIME_SIZE = 0, // same size and last modified time (copied files keep the mtime of src)
+        FS_SYNC_CONTENT = 1,    // same contents (compared byte by byte)
+    };
+
+    /// kinds of fs_sync result
+    enum {
+        FS_SYNC_COPIED = 0,  // files copied from src (new or changed)
+        FS_SYNC_DELETED = 1, // extraneous files / directories removed from dest
+        FS_SYNC_FAILED = 2,  // files / directories which could not be copied or removed
+        FS_SYNC_SKIPPED = 3, // unchanged files (count only)
+    };
+
+    /// result of fs_sync
+    typedef struct {
+        std::vector<std::string> paths[3]; // FS_SYNC_COPIED, FS_SYNC_DELETED, FS_SYNC_FAILED: relative paths
+        unsigned long long skipped; // count of unchanged files
+        unsigned long long bytes;   // total size of copied files
+    } fs_sync_t;
+
+    /// make dest the same as src: copy only new or changed files in parallel on the work-stealing thread pool
+    // * files are copied by fs_copyfile_ex (the fastest way the file system supports) keeping the permission and mtime
+    // * changed files are written to the temporary files in dest, and renamed over the old files (replaced atomically)
+    // @param compare: FS_SYNC_MTIME_SIZE | FS_SYNC_CONTENT
+    // @param isDeleted: remove files / directories in dest which do not exist in src
+    // @param threads: count of worker threads (0: count of hardware threads)
+    // @return nullptr if src is not a directory, dest cannot be created or a task has failed with an exception
+    __export fs_sync_t *fs_sync(const char *src, const char *dest, int compare, bool isDeleted, size_t threads);
+
+    /// free the result of fs_sync
+    __export void fs_sync_free(fs_sync_t *self);
+
+    /// get count of the results
+    // @param kind: FS_SYNC_*
+    __export size_t fs_sync_count(fs_sync_t *self, int kind);
+
+    /// get the relative path of the result
+    // @param kind: FS_SYNC_COPIED | FS_SYNC_DELETED | FS_SYNC_FAILED
+    // @return nullptr if index is out of range
+    __export const char *fs_sync_get(fs_sync_t *self, int kind, size_t index);
+
+    /// get total size of copied files
+    __export unsigned long long fs_sync_bytes(fs_sync_t *self);
+
     /*** ================================================== ***/
     /*** file enumerator ***/
 
@@ -42,8 +112,24 @@ extern "C" {
         std::string directory,    // opening directory path
                     current_name, // current file / directory name
                     current_path; // current file / directory path
+        std::vector<char> buffer; // buffer for fs_readdir_batch
+        size_t buffer_pos, buffer_len;
+        bool is_batch; // true if fs_readdir_batch has been called
     } fs_dirent_t;
 
+    /// file type of directory entry (same as DT_* of dirent.h)
+    enum {
+        FS_TYPE_UNKNOWN = 0, FS_TYPE_FIFO = 1, FS_TYPE_CHR = 2, FS_TYPE_DIR = 4,
+        FS_TYPE_BLK = 6, FS_TYPE_REG = 8, FS_TYPE_LNK = 10, FS_TYPE_SOCK = 12,
+    };
+
+    /// structure of directory entry for fs_readdir_batch
+    typedef struct {
+        size_t name_offset;       // offset of the null-terminated file name in the name pool
+        unsigned long long inode; // inode number (0 on Windows)
+        unsigned char type;       // FS_TYPE_*
+    } fs_entry_t;
+
     /// open directory for enumerating files
     __export fs_dirent_t *fs_opendir(const char *dir);
 
@@ -59,4 +145,186 @@ extern "C" {
 
     /// get current file / directory path
     __export const char *fs_readdir_path(fs_dirent_t *self);
-}
\ No newline at end of file
+
+    /// read entries in the directory by a batch (except "." and "..")
+    // * the enumeration restarts from the beginning at the first call, and fs_seekdir cannot be used after that
+    // @param out: array of entries to be filled
+    // @param cap: count of elements of out
+    // @param pool: buffer to store the null-terminated file names
+    // @param poolcap: size of pool (must be larger than the max length of file name: 256 bytes on Linux, 780 bytes on Windows)
+    // @return count of filled entries (0: no entry any more)
+    __export size_t fs_readdir_batch(fs_dirent_t *self, fs_entry_t *out, size_t cap, char *pool, size_t poolcap);
+
+    /*** ================================================== ***/
+    /*** recursive file walker ***/
+
+    /// structure for walking files in directory tree with glob filters
+    typedef struct {
+        /// directory being walked
+        struct frame_t {
+            std::string relpath; // relative path from the root directory (with trailing separator)
+            int depth;
+            std::vector<std::pair<std::string, unsigned char>> entries; // (name, FS_TYPE_*)
+            size_t index;
+        };
+
+        std::string root; // root directory (with trailing separator)
+        glob_matcher_t *include, *exclude; // all globs merged into one set (nullptr: no glob)
+        int maxdepth; // -1: infinite
+        unsigned char type; // FS_TYPE_REG | FS_TYPE_DIR (0: all)
+        std::vector<frame_t> stack;
+        std::string current_path;
+    } fs_walk_t;
+
+    /// open directory tree for walking files recursively
+    // * globs are matched to the relative path from dir (e.g. "sub/test.lua"), see glob_compile for the syntax
+    // * directories matching exclude are not descended into, nor are directories which never contain paths matching include
+    // * symbolic links to directories are yielded but not descended into, unreadable directories are skipped
+    // @param include: globs of paths to be yielded (ninclude = 0: all paths)
+    // @param exclude: globs of paths to be skipped
+    // @param maxdepth: max depth of recursion (-1: infinite, 0: only entries in dir)
+    // @param type: FS_TYPE_REG (files only) | FS_TYPE_DIR (directories only) | 0 (all)
+    // @return nullptr if dir cannot be opened or any glob is invalid
+    __export fs_walk_t *fs_walk_open(const char *dir, const char **include, size_t ninclude, const char **exclude, size_t nexclude, int maxdepth, unsigned char type);
+
+    /// close walker
+    __export void fs_walk_close(fs_walk_t *self);
+
+    /// get next path (pre-order)
+    // @param type: FS_TYPE_* of the path (symbolic links are resolved if possible)
+    // @return nullptr if no path any more
+    __export const char *fs_walk_next(fs_walk_t *self, unsigned char *type);
+
+    /*** ================================================== ***/
+    /*** memory-mapped file ***/
+
+    /// structure of memory-mapped file
+    typedef struct {
+        char *ptr; // mapped memory (nullptr if the file is empty)
+        unsigned long long size; // file size
+        unsigned long long handler, mapping; // file descriptor (file handle and file mapping handle on Windows)
+        bool is_writable;
+    } fs_mmap_t;
+
+    /// access pattern hints for fs_mmap_open / fs_mmap_advise (bit flags)
+    enum {
+        FS_MMAP_NORMAL = 0,
+        FS_MMAP_SEQUENTIAL = 1, // MADV_SEQUENTIAL
+        FS_MMAP_RANDOM = 2,     // MADV_RANDOM
+        FS_MMAP_WILLNEED = 4,   // MADV_WILLNEED: start reading ahead now
+        FS_MMAP_HUGEPAGE = 8,   // MADV_HUGEPAGE: back the mapping with transparent huge pages if possible
+    };
+
+    /// map the whole file into memory
+    // @param isWritable: false => read-only (changes of the file are visible), true => read-write (writes go to the file)
+    // @param advice: FS_MMAP_* (ignored on Windows)
+    // @return nullptr if the file cannot be opened or mapped
+    __export fs_mmap_t *fs_mmap_open(const char *path, bool isWritable, int advice);
+
+    /// give access pattern hints for the mapped memory
+    // @param advice: FS_MMAP_* (ignored on Windows)
+    __export bool fs_mmap_advise(fs_mmap_t *self, int advice);
+
+    /// flush the changes of the mapped memory into the file
+    __export bool fs_mmap_sync(fs_mmap_t *self);
+
+    /// unmap the file
+    __export void fs_mmap_close(fs_mmap_t *self);
+
+    /*** ================================================== ***/
+    /*** buffered reader ***/
+
+    /// structure of buffered reader
+    typedef struct {
+        FILE *fp; // source stream (nullptr: fd is used)
+        int fd;   // source file descriptor
+        std::vector<char> buffer;
+        size_t begin, end; // unread data: buffer[begin, end)
+        bool is_eof;
+    } fs_reader_t;
+
+    /// create buffered reader of the stream
+    // * the data is read ahead into the buffer, so call fs_reader_sync before accessing fp directly
+    // @param bufsize: initial buffer size (0: 64 KiB), the buffer grows for longer lines
+    __export fs_reader_t *fs_reader_open(FILE *fp, size_t bufsize);
+
+    /// create buffered reader of the file descriptor (non-blocking descriptor is supported)
+    __export fs_reader_t *fs_reader_openfd(int fd, size_t bufsize);
+
+    /// free buffered reader (the source is not closed)
+    __export void fs_reader_close(fs_reader_t *self);
+
+    /// read one line (separated by "\n" or "\r\n")
+    // @param len: length of the line (without the line separator)
+    // @return pointer to the line in the buffer (valid until the next call), nullptr if no line any more
+    //         (for non-blocking descriptor, nullptr is also returned if a whole line is not available yet: check is_eof)
+    __export const char *fs_reader_readline(fs_reader_t *self, size_t *len);
+
+    /// read the designated size of data
+    // @return read size
+    __export size_t fs_reader_read(fs_reader_t *self, char *dest, size_t size);
+
+    /// read 1 byte
+    // @return byte-code (-1: EOF)
+    __export int fs_reader_getc(fs_reader_t *self);
+
+    /// read the available data from the source into the buffer without consuming it
+    // @return read size (0: EOF, or no data available for non-blocking descriptor: check is_eof)
+    __export size_t fs_reader_fill(fs_reader_t *self);
+
+    /// move the position of the source back to the first unread byte and discard the buffer
+    // @return false if the source cannot seek (e.g. pipe)
+    __export bool fs_reader_sync(fs_reader_t *self);
+
+    /*** ================================================== ***/
+    /*** buffered writer ***/
+
+    /// structure of buffered writer
+    typedef struct {
+        int fd;
+        bool is_owned;  // the file descriptor is closed by fs_writer_close
+        std::vector<char> buffer;
+        size_t size;    // size of buffered data
+        bool is_failed; // true if writing has failed
+    } fs_writer_t;
+
+    /// open the file for buffered writing (parent directories are created automatically)
+    // @param isAppended: false => truncate the file, true => append to the file
+    // @param bufsize: buffer size (0: 1 MiB)
+    __export fs_writer_t *fs_writer_open(const char *filename, bool isAppended, size_t bufsize);
+
+    /// create buffered writer of the file descriptor (the descriptor is not closed by fs_writer_close)
+    __export fs_writer_t *fs_writer_openfd(int fd, size_t bufsize);
+
+    /// write data
+    // * small data is gathered into the buffer, large data is written with the buffered data by one writev
+    // @return false if writing has failed
+    __export bool fs_writer_write(fs_writer_t *self, const char *data, size_t size);
+
+    /// write multiple data in order
+    // @param data: array of n pointers
+    // @param sizes: array of n sizes
+    __export bool fs_writer_writev(fs_writer_t *self, const char **data, const size_t *sizes, size_t n);
+
+    /// write the buffered data into the file
+    __export bool fs_writer_flush(fs_writer_t *self);
+
+    /// flush and free buffered writer
+    // @return false if writing has failed
+    __export bool fs_writer_close(fs_writer_t *self);
+}
+
+/*** ================================================== ***/
+/*** utility functions for C++ ***/
+
+/// create parent directories of the file (recursively)
+// * call it after opening the file has failed with ENOENT: it tries mkdir from the deepest directory
+// @return true if the parent directory exists or it's not included in filename
+bool fs_mkparents(const std::string &filename);
+
+/// read the file and pass the whole data to the callback
+// * the size of regular file is taken by fstat and the data is read at once into the buffer (not mapped into memory, so truncating the file never raises SIGBUS)
+// * the data is valid only in the callback
+// @param size: max size to read (-1: whole file)
+// @return false if the file cannot be opened or it's a directory
+bool fs_readfile(const std::string &filename, long long size, const std::function<void(const char *data, size_t size)> &callback);
@@ -0,0 +1,398 @@
+﻿#include "glob.hpp"
+#include <cstring>
+#include <algorithm>
+
+/// @private opcodes of glob_matcher_t::inst_t
+enum {
+    __GLOB_CHAR,  // match the code point (arg)
+    __GLOB_ANY,   // match any code point except separator
+    __GLOB_ALL,   // match any code point including separator
+    __GLOB_CLASS, // match the character class (arg)
+    __GLOB_SPLIT, // branch to x and y
+    __GLOB_JMP,   // jump to x
+    __GLOB_MATCH, // accept
+};
+
+/// @private identifies if the character is a separator
+static inline bool __glob_issep(unsigned int c) {
+    #ifdef _WINDOWS
+        return c == '/' || c == '\\';
+    #else
+        return c == '/';
+    #endif
+}
+
+/// @private decode one UTF-8 code point and advance the pointer (invalid byte is decoded as it is)
+static inline unsigned int __glob_nextchar(const char *&s) {
+    const unsigned char *p = (const unsigned char*)s;
+    unsigned int c = p[0];
+    size_t n = c < 0x80 ? 0 : (c & 0xe0) == 0xc0 ? 1 : (c & 0xf0) == 0xe0 ? 2 : (c & 0xf8) == 0xf0 ? 3 : 0;
+
+    if (n > 0) c &= 0x3f >> n;
+    for (size_t i = 1; i <= n; ++i) {
+        if ((p[i] & 0xc0) != 0x80) { // invalid sequence
+            s += 1;
+            return p[0];
+        }
+        c = (c << 6) | (p[i] & 0x3f);
+    }
+    s += n + 1;
+    return c;
+}
+
+/// @private recursive descent compiler of glob pattern
+class __glob_compiler_t {
+public:
+    __glob_compiler_t(glob_matcher_t *dest, const char *pattern): dest(dest), p(pattern), isSegmentStart(true) {}
+
+    /// @param index: index of the pattern in the set
+    bool compile(unsigned int index = 0) {
+        if (!sequence(0) || *p != '\0') return false;
+        emit(__GLOB_MATCH, index);
+        return true;
+    }
+
+private:
+    glob_matcher_t *dest;
+    const char *p;
+    bool isSegmentStart; // current position is the beginning of a path segment
+
+    int emit(unsigned char op, unsigned int arg = 0, int x = 0, int y = 0) {
+        dest->program.push_back({op, arg, x, y});
+        return (int)dest->program.size() - 1;
+    }
+
+    int here() const {
+        return (int)dest->program.size();
+    }
+
+    bool isterm(int depth, char c) const {
+        return c == '\0' || (depth > 0 && (c == ',' || c == '}'));
+    }
+
+    unsigned int nextchar() {
+        #ifndef _WINDOWS
+            if (*p == '\\' && p[1] != '\0') ++p; // escape
+        #endif
+        return __glob_nextchar(p);
+    }
+
+    /// compile the sequence until the end of pattern (or ',' / '}' in braces)
+    bool sequence(int depth) {
+        while (!isterm(depth, *p)) {
+            if (*p == '*') {
+                if (p[1] == '*' && isSegmentStart && (__glob_issep(p[2]) || isterm(depth, p[2]))) {
+                    p += 2;
+                    int split = emit(__GLOB_SPLIT, 0, here() + 1);
+                    if (__glob_issep(*p)) { // "**/": zero or more directories
+                        ++p;
+                        int loop = emit(__GLOB_ALL);
+                        emit(__GLOB_SPLIT, 0, loop, here() + 1);
+                        emit(__GLOB_CHAR, '/');
+                    } else { // "**" at the end: anything
+                        emit(__GLOB_ALL);
+                        emit(__GLOB_JMP, 0, split);
+                        isSegmentStart = false;
+                    }
+                    dest->program[split].y = here();
+                    continue;
+                }
+                while (*p == '*') ++p; // consecutive "*" are the same as "*"
+                int split = emit(__GLOB_SPLIT, 0, here() + 1);
+                emit(__GLOB_ANY);
+                emit(__GLOB_JMP, 0, split);
+                dest->program[split].y = here();
+                isSegmentStart = false;
+            } else if (*p == '?') {
+                ++p;
+                emit(__GLOB_ANY);
+                isSegmentStart = false;
+            } else if (*p == '[') {
+                if (!charclass()) return false;
+            } else if (*p == '{') {
+                if (!alternatives(depth + 1)) return false;
+            } else {
+                unsigned int c = nextchar();
+                isSegmentStart = __glob_issep(c);
+                emit(__GLOB_CHAR, isSegmentStart ? '/' : c);
+            }
+        }
+        return true;
+    }
+
+    /// compile "[...]"
+    bool charclass() {
+        glob_matcher_t::class_t cls = {false, {}};
+
+        ++p; // '['
+        if (*p == '!' || *p == '^') {
+            cls.isNegated = true;
+            ++p;
+        }
+        for (bool isFirst = true; isFirst || *p != ']'; isFirst = false) { // "]" at first is a normal character
+            if (*p == '\0') return false;
+
+            unsigned int lo = nextchar(), hi = lo;
+            if (*p == '-' && p[1] != ']' && p[1] != '\0') {
+                ++p;
+                hi = nextchar();
+            }
+            cls.ranges.push_back({lo, hi});
+        }
+        ++p; // ']'
+        emit(__GLOB_CLASS, (unsigned int)dest->classes.size());
+        dest->classes.push_back(std::move(cls));
+        isSegmentStart = false;
+        return true;
+    }
+
+    /// compile "{a,b,...}"
+    bool alternatives(int depth) {
+        std::vector<int> jumps;
+        bool isStart = isSegmentStart;
+
+        ++p; // '{'
+        while (true) {
+            int split = emit(__GLOB_SPLIT, 0, here() + 1);
+            isSegmentStart = isStart;
+            if (!sequence(depth)) return false;
+
+            if (*p == ',') { // jump to the end, or try the next alternative
+                ++p;
+                jumps.push_back(emit(__GLOB_JMP));
+                dest->program[split].y = here();
+            } else if (*p == '}') { // the last alternative does not branch
+                ++p;
+                dest->program[split] = {__GLOB_JMP, 0, split + 1, 0};
+                break;
+            } else {
+                return false; // not closed
+            }
+        }
+        for (int jump : jumps) dest->program[jump].x = here();
+        isSegmentStart = false;
+        return true;
+    }
+};
+
+/// @private add the state and the states reachable without consuming characters
+static void __glob_addstate(const glob_matcher_t *self, std::vector<int> &states, std::vector<unsigned int> &marks, unsigned int generation, int pc) {
+    if (marks[pc] == generation) return;
+    marks[pc] = generation;
+
+    const glob_matcher_t::inst_t &inst = self->program[pc];
+    if (inst.op == __GLOB_JMP) {
+        __glob_addstate(self, states, marks, generation, inst.x);
+    } else if (inst.op == __GLOB_SPLIT) {
+        __glob_addstate(self, states, marks, generation, inst.x);
+        __glob_addstate(self, states, marks, generation, inst.y);
+    } else {
+        states.push_back(pc);
+    }
+}
+
+/// @private identifies if the instruction consumes the character
+static inline bool __glob_accepts(const glob_matcher_t *self, const glob_matcher_t::inst_t &inst, unsigned int c) {
+    switch (inst.op) {
+    case __GLOB_CHAR:
+        return inst.arg == c;
+    case __GLOB_ANY:
+        return c != '/';
+    case __GLOB_ALL:
+        return true;
+    case __GLOB_CLASS:
+        if (c == '/') return false;
+        for (const auto &range : self->classes[inst.arg].ranges) {
+            if (range.first <= c && c <= range.second) return !self->classes[inst.arg].isNegated;
+        }
+        return self->classes[inst.arg].isNegated;
+    }
+    return false;
+}
+
+/// @private max count of DFA states (the NFA is simulated for the rest of the path beyond it)
+static const size_t __GLOB_DFA_MAX = 4096;
+
+/// @private compute the next NFA states by the character
+static void __glob_step(const glob_matcher_t *self, const std::vector<int> &current, unsigned int c, std::vector<int> &next) {
+    static thread_local std::vector<unsigned int> marks;
+    static thread_local unsigned int generation = 0;
+
+    if (marks.size() < self->program.size()) marks.resize(self->program.size(), 0);
+    if (++generation == 0) { // wrapped around
+        std::fill(marks.begin(), marks.end(), 0);
+        generation = 1;
+    }
+    next.clear();
+    for (int pc : current) {
+        if (__glob_accepts(self, self->program[pc], c)) __glob_addstate(self, next, marks, generation, pc + 1);
+    }
+}
+
+/// @private get the result of the final NFA states
+// @return bit flags: 1 = matched, 2 = longer paths may match
+static int __glob_result(const glob_matcher_t *self, const std::vector<int> &states, bool *matched) {
+    int result = 0;
+    for (int pc : states) {
+        if (self->program[pc].op != __GLOB_MATCH) {
+            result |= 2;
+            continue;
+        }
+        result |= 1;
+        if (matched) matched[self->program[pc].arg] = true;
+    }
+    return result;
+}
+
+/// @private simulate the NFA over the rest of the path
+static int __glob_runnfa(const glob_matcher_t *self, std::vector<int> current, const char *path, bool *matched) {
+    static thread_local std::vector<int> next;
+
+    while (*path != '\0') {
+        if (current.empty()) return 0;
+
+        unsigned int c = __glob_nextchar(path);
+        __glob_step(self, current, __glob_issep(c) ? '/' : c, next);
+        current.swap(next);
+    }
+    return __glob_result(self, current, matched);
+}
+
+/// @private get the DFA state of the NFA states (sorted)
+// @return -1 if the count of DFA states has reached the limit
+static int __glob_dfastate(glob_matcher_t::dfa_t *dfa, const std::vector<int> &nfa) {
+    auto it = dfa->index.find(nfa);
+    if (it != dfa->index.end()) return it->second;
+    if (dfa->states.size() >= __GLOB_DFA_MAX) return -1;
+
+    std::unique_ptr<glob_matcher_t::dfa_t::state_t> state(new glob_matcher_t::dfa_t::state_t);
+    state->nfa = nfa;
+    std::fill(state->next, state->next + 128, -1);
+    dfa->states.push_back(std::move(state));
+    return dfa->index[nfa] = (int)dfa->states.size() - 1;
+}
+
+/// @private run the lazily built DFA over the path
+static int __glob_rundfa(const glob_matcher_t *self, const char *path, bool *matched) {
+    static thread_local std::vector<int> next;
+    glob_matcher_t::dfa_t *dfa = self->dfa.get();
+
+    if (dfa->states.empty()) {
+        std::vector<unsigned int> marks(self->program.size(), 0);
+        std::vector<int> initial;
+        __glob_addstate(self, initial, marks, 1, 0);
+        std::sort(initial.begin(), initial.end());
+        __glob_dfastate(dfa, initial);
+    }
+
+    int id = 0;
+    while (*path != '\0') {
+        if (dfa->states[id]->nfa.empty()) return 0;
+
+        unsigned int c = __glob_nextchar(path);
+        if (__glob_issep(c)) c = '/';
+
+        int nextid = c < 128 ? dfa->states[id]->next[c] : -1;
+        if (nextid < 0) {
+            __glob_step(self, dfa->states[id]->nfa, c, next);
+            std::sort(next.begin(), next.end());
+            nextid = __glob_dfastate(dfa, next);
+            if (nextid < 0) return __glob_runnfa(self, next, path, matched); // too many states
+            if (c < 128) dfa->states[id]->next[c] = nextid;
+        }
+        id = nextid;
+    }
+    return __glob_result(self, dfa->states[id]->nfa, matched);
+}
+
+/// @private run the program over the path in a single pass
+// @param matched: flags of the matched patterns to be filled (nullptr: not required)
+// @return bit flags: 1 = matched, 2 = longer paths may match
+static int __glob_run(const glob_matcher_t *self, const char *path, bool *matched = nullptr) {
+    if (self->program.empty()) return 0; // empty set
+
+    if (self->dfa && self->dfa->mutex.try_lock()) {
+        int result = __glob_rundfa(self, path, matched);
+        self->dfa->mutex.unlock();
+        return result;
+    }
+
+    // the DFA is being used by another thread
+    std::vector<unsigned int> marks(self->program.size(), 0);
+    std::vector<int> initial;
+    __glob_addstate(self, initial, marks, 1, 0);
+    return __glob_runnfa(self, initial, path, matched);
+}
+
+extern "C" {
+    __export glob_matcher_t *glob_compile(const char *pattern) {
+        glob_matcher_t *self = new glob_matcher_t;
+        __glob_compiler_t compiler(self, pattern);
+
+        self->patterns = 1;
+        self->dfa.reset(new glob_matcher_t::dfa_t);
+        if (!compiler.compile()) {
+            delete self;
+            return nullptr;
+        }
+        return self;
+    }
+
+    __export glob_matcher_t *glob_compile_set(const char **patterns, size_t n) {
+        glob_matcher_t *self = new glob_matcher_t;
+
+        // SPLIT instructions branching to each pattern: patterns are relocated after them
+        self->patterns = n;
+        self->dfa.reset(new glob_matcher_t::dfa_t);
+        for (size_t i = 0; i + 1 < n; ++i) self->program.push_back({__GLOB_SPLIT, 0, 0, (int)i + 1});
+        for (size_t i = 0; i < n; ++i) {
+            glob_matcher_t pattern;
+            __glob_compiler_t compiler(&pattern, patterns[i]);
+            if (!compiler.compile((unsigned int)i)) {
+                delete self;
+                return nullptr;
+            }
+
+            int offset = (int)self->program.size();
+            unsigned int classOffset = (unsigned int)self->classes.size();
+            if (i + 1 < n) self->program[i].x = offset;
+            else if (i > 0) self->program[i - 1].y = offset;
+            for (auto inst : pattern.program) {
+                if (inst.op == __GLOB_SPLIT || inst.op == __GLOB_JMP) {
+                    inst.x += offset;
+                    inst.y += offset;
+                } else if (inst.op == __GLOB_CLASS) {
+                    inst.arg += classOffset;
+                }
+                self->program.push_back(inst);
+            }
+            for (auto &cls : pattern.classes) self->classes.push_back(std::move(cls));
+        }
+        return self;
+    }
+
+    __export void glob_free(glob_matcher_t *self) {
+        delete self;
+    }
+
+    __export bool glob_match(const glob_matcher_t *self, const char *path) {
+        return (__glob_run(self, path) & 1) != 0;
+    }
+
+    __export bool glob_match_partial(const glob_matcher_t *self, const char *path) {
+        return __glob_run(self, path) != 0;
+    }
+
+    __export size_t glob_match_set(const glob_matcher_t *self, const char *path, bool *matched) {
+        size_t count = 0;
+
+        memset(matched, 0, self->patterns * sizeof(bool));
+        __glob_run(self, path, matched);
+        for (size_t i = 0; i < self->patterns; ++i) count += matched[i] ? 1 : 0;
+        return count;
+    }
+
+    __export size_t glob_count(const glob_matcher_t *self) {
+        return self->patterns;
+    }
+}
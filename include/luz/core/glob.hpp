@@ -0,0 +1,75 @@
+﻿#pragma once
+
+#include "config.hpp"
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+
+/// compiled glob pattern
+// * syntax: "*" (any characters except separator), "?" (any one character except separator),
+//           "**" (zero or more directories when it is a whole path segment), "[a-z]" / "[!a-z]" (character class),
+//           "{a,b}" (alternatives: may be nested and contain other syntax), "\\*" (escape: not available on Windows)
+// * pattern matches the whole path; "/" and "\\" are the same separator on Windows
+// * characters are compared by UTF-8 code points
+struct glob_matcher_t {
+    /// instruction of the matching program (Thompson NFA)
+    struct inst_t {
+        unsigned char op;
+        unsigned int arg; // code point or index of the character class
+        int x, y; // branch targets
+    };
+
+    /// character class
+    struct class_t {
+        bool isNegated;
+        std::vector<std::pair<unsigned int, unsigned int>> ranges;
+    };
+
+    /// DFA built lazily while matching (cache of the NFA state sets and the transitions by ASCII characters)
+    struct dfa_t {
+        struct state_t {
+            std::vector<int> nfa; // sorted NFA states
+            int next[128]; // index of the next state (-1: not computed yet)
+        };
+        std::vector<std::unique_ptr<state_t>> states; // states[0]: initial state
+        std::map<std::vector<int>, int> index;
+        std::mutex mutex; // held while matching: other threads simulate the NFA instead
+    };
+
+    std::vector<inst_t> program;
+    std::vector<class_t> classes;
+    size_t patterns; // count of merged patterns (MATCH instruction has the index of the pattern as arg)
+    std::unique_ptr<dfa_t> dfa;
+};
+
+extern "C" {
+    /// compile glob pattern
+    // @return nullptr if the pattern is invalid (e.g. "[" or "{" is not closed)
+    __export glob_matcher_t *glob_compile(const char *pattern);
+
+    /// free compiled glob pattern
+    __export void glob_free(glob_matcher_t *self);
+
+    /// identifies if the path matches the pattern
+    __export bool glob_match(const glob_matcher_t *self, const char *path);
+
+    /// identifies if the path can be a prefix of matching paths
+    // e.g. pattern "src/**/*.cpp": "src/sub/" => true, "test/" => false
+    // * used to prune directories which never contain matching paths
+    __export bool glob_match_partial(const glob_matcher_t *self, const char *path);
+
+    /// compile multiple glob patterns into one program
+    // * glob_match / glob_match_partial of the set identify if any of the patterns matches, in a single pass over the path
+    // @return nullptr if any pattern is invalid
+    __export glob_matcher_t *glob_compile_set(const char **patterns, size_t n);
+
+    /// identifies which patterns of the set match the path (in a single pass)
+    // @param matched: array of glob_count(self) flags to be filled (matched[i]: patterns[i] matches)
+    // @return count of matched patterns
+    __export size_t glob_match_set(const glob_matcher_t *self, const char *path, bool *matched);
+
+    /// get count of the patterns compiled into the matcher
+    __export size_t glob_count(const glob_matcher_t *self);
+}
@@ -0,0 +1,467 @@
+﻿#include "hash.hpp"
+#include "thread.hpp"
+#include <algorithm>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+/*** ================================================== ***/
+/*** @private XXH3 (64-bit, seed = 0) ***/
+// https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+
+static const unsigned long long __XXH_PRIME32_1 = 0x9E3779B1ULL, __XXH_PRIME32_2 = 0x85EBCA77ULL, __XXH_PRIME32_3 = 0xC2B2AE3DULL;
+static const unsigned long long __XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL, __XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL,
+    __XXH_PRIME64_3 = 0x165667B19E3779F9ULL, __XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL, __XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+static const unsigned long long __XXH_PRIME_MX1 = 0x165667919E3779F9ULL, __XXH_PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+/// @private default secret of XXH3
+static const unsigned char __XXH3_SECRET[192] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+/// @private read little-endian integers
+static inline unsigned int __read32(const unsigned char *p) {
+    return (unsigned int)p[0] | ((unsigned int)p[1] << 8) | ((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static inline unsigned long long __read64(const unsigned char *p) {
+    return (unsigned long long)__read32(p) | ((unsigned long long)__read32(p + 4) << 32);
+}
+
+static inline unsigned long long __rotl64(unsigned long long x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline unsigned long long __swap64(unsigned long long x) {
+    return ((x << 56) & 0xff00000000000000ULL) | ((x << 40) & 0x00ff000000000000ULL) | ((x << 24) & 0x0000ff0000000000ULL)
+        | ((x << 8) & 0x000000ff00000000ULL) | ((x >> 8) & 0x00000000ff000000ULL) | ((x >> 24) & 0x0000000000ff0000ULL)
+        | ((x >> 40) & 0x000000000000ff00ULL) | ((x >> 56) & 0x00000000000000ffULL);
+}
+
+/// @private 64 x 64 => 128 bit multiplication, folded into 64 bit (low ^ high)
+static inline unsigned long long __mul128_fold64(unsigned long long lhs, unsigned long long rhs) {
+    #ifdef _MSC_VER
+        unsigned long long high;
+        unsigned long long low = _umul128(lhs, rhs, &high);
+        return low ^ high;
+    #else
+        unsigned __int128 product = (unsigned __int128)lhs * rhs;
+        return (unsigned long long)product ^ (unsigned long long)(product >> 64);
+    #endif
+}
+
+static inline unsigned long long __xxh64_avalanche(unsigned long long h) {
+    h ^= h >> 33;
+    h *= __XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= __XXH_PRIME64_3;
+    return h ^ (h >> 32);
+}
+
+static inline unsigned long long __xxh3_avalanche(unsigned long long h) {
+    h ^= h >> 37;
+    h *= __XXH_PRIME_MX1;
+    return h ^ (h >> 32);
+}
+
+static inline unsigned long long __xxh3_rrmxmx(unsigned long long h, unsigned long long len) {
+    h ^= __rotl64(h, 49) ^ __rotl64(h, 24);
+    h *= __XXH_PRIME_MX2;
+    h ^= (h >> 35) + len;
+    h *= __XXH_PRIME_MX2;
+    return h ^ (h >> 28);
+}
+
+static inline unsigned long long __xxh3_mix16(const unsigned char *input, const unsigned char *secret) {
+    return __mul128_fold64(__read64(input) ^ __read64(secret), __read64(input + 8) ^ __read64(secret + 8));
+}
+
+/// @private accumulate 64 bytes of input
+static inline void __xxh3_accumulate512(unsigned long long *acc, const unsigned char *input, const unsigned char *secret) {
+    for (int i = 0; i < 8; ++i) {
+        unsigned long long value = __read64(input + 8 * i), key = value ^ __read64(secret + 8 * i);
+        acc[i ^ 1] += value;
+        acc[i] += (key & 0xffffffffULL) * (key >> 32);
+    }
+}
+
+static inline void __xxh3_scramble(unsigned long long *acc, const unsigned char *secret) {
+    for (int i = 0; i < 8; ++i) {
+        unsigned long long a = acc[i];
+        a ^= a >> 47;
+        a ^= __read64(secret + 8 * i);
+        acc[i] = a * __XXH_PRIME32_1;
+    }
+}
+
+/// @private size of the default secret, count of the stripes in a block
+static const size_t __XXH3_SECRET_SIZE = sizeof(__XXH3_SECRET), __XXH3_STRIPES = (__XXH3_SECRET_SIZE - 64) / 8;
+
+/// @private initial accumulators of XXH3 for the long input
+static inline void __xxh3_init(unsigned long long *acc) {
+    static const unsigned long long init[8] = {
+        __XXH_PRIME32_3, __XXH_PRIME64_1, __XXH_PRIME64_2, __XXH_PRIME64_3,
+        __XXH_PRIME64_4, __XXH_PRIME32_2, __XXH_PRIME64_5, __XXH_PRIME32_1,
+    };
+    memcpy(acc, init, sizeof(init));
+}
+
+/// @private accumulate the last stripe (last 64 bytes of the input), and merge the accumulators
+static unsigned long long __xxh3_merge(unsigned long long *acc, const unsigned char *lastStripe, unsigned long long len) {
+    const unsigned char *secret = __XXH3_SECRET;
+    __xxh3_accumulate512(acc, lastStripe, secret + __XXH3_SECRET_SIZE - 64 - 7);
+
+    unsigned long long result = len * __XXH_PRIME64_1;
+    for (int i = 0; i < 4; ++i) {
+        result += __mul128_fold64(acc[2 * i] ^ __read64(secret + 11 + 16 * i), acc[2 * i + 1] ^ __read64(secret + 11 + 16 * i + 8));
+    }
+    return __xxh3_avalanche(result);
+}
+
+/// @private XXH3 for input longer than 240 bytes
+static unsigned long long __xxh3_long(const unsigned char *input, size_t len) {
+    const unsigned char *secret = __XXH3_SECRET;
+    const size_t blockLen = 64 * __XXH3_STRIPES;
+    unsigned long long acc[8];
+    __xxh3_init(acc);
+    size_t blocks = (len - 1) / blockLen;
+
+    for (size_t n = 0; n < blocks; ++n) {
+        for (size_t s = 0; s < __XXH3_STRIPES; ++s) __xxh3_accumulate512(acc, input + n * blockLen + s * 64, secret + s * 8);
+        __xxh3_scramble(acc, secret + __XXH3_SECRET_SIZE - 64);
+    }
+    // last partial block and last stripe
+    size_t lastStripes = ((len - 1) - blockLen * blocks) / 64;
+    for (size_t s = 0; s < lastStripes; ++s) __xxh3_accumulate512(acc, input + blocks * blockLen + s * 64, secret + s * 8);
+    return __xxh3_merge(acc, input + len - 64, len);
+}
+
+/// @private XXH3 64-bit with the default secret and seed = 0
+static unsigned long long __xxh3(const unsigned char *input, size_t len) {
+    const unsigned char *secret = __XXH3_SECRET;
+
+    if (len == 0) return __xxh64_avalanche(__read64(secret + 56) ^ __read64(secret + 64));
+    if (len <= 3) {
+        unsigned int combined = ((unsigned int)input[0] << 16) | ((unsigned int)input[len >> 1] << 24)
+            | (unsigned int)input[len - 1] | ((unsigned int)len << 8);
+        return __xxh64_avalanche((unsigned long long)combined ^ (unsigned long long)(__read32(secret) ^ __read32(secret + 4)));
+    }
+    if (len <= 8) {
+        unsigned long long value = (unsigned long long)__read32(input + len - 4) + ((unsigned long long)__read32(input) << 32);
+        return __xxh3_rrmxmx(value ^ (__read64(secret + 8) ^ __read64(secret + 16)), len);
+    }
+    if (len <= 16) {
+        unsigned long long low = __read64(input) ^ (__read64(secret + 24) ^ __read64(secret + 32));
+        unsigned long long high = __read64(input + len - 8) ^ (__read64(secret + 40) ^ __read64(secret + 48));
+        return __xxh3_avalanche(len + __swap64(low) + high + __mul128_fold64(low, high));
+    }
+    if (len <= 128) {
+        unsigned long long acc = len * __XXH_PRIME64_1;
+        if (len > 32) {
+            if (len > 64) {
+                if (len > 96) {
+                    acc += __xxh3_mix16(input + 48, secret + 96);
+                    acc += __xxh3_mix16(input + len - 64, secret + 112);
+                }
+                acc += __xxh3_mix16(input + 32, secret + 64);
+                acc += __xxh3_mix16(input + len - 48, secret + 80);
+            }
+            acc += __xxh3_mix16(input + 16, secret + 32);
+            acc += __xxh3_mix16(input + len - 32, secret + 48);
+        }
+        acc += __xxh3_mix16(input, secret);
+        acc += __xxh3_mix16(input + len - 16, secret + 16);
+        return __xxh3_avalanche(acc);
+    }
+    if (len <= 240) {
+        unsigned long long acc = len * __XXH_PRIME64_1;
+        size_t rounds = len / 16;
+        for (size_t i = 0; i < 8; ++i) acc += __xxh3_mix16(input + 16 * i, secret + 16 * i);
+        acc = __xxh3_avalanche(acc);
+        for (size_t i = 8; i < rounds; ++i) acc += __xxh3_mix16(input + 16 * i, secret + 16 * (i - 8) + 3);
+        acc += __xxh3_mix16(input + len - 16, secret + 136 - 17);
+        return __xxh3_avalanche(acc);
+    }
+    return __xxh3_long(input, len);
+}
+
+/*** ================================================== ***/
+/*** @private SHA-256 ***/
+
+static const unsigned int __SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+static inline unsigned int __rotr32(unsigned int x, int r) {
+    return (x >> r) | (x << (32 - r));
+}
+
+/// @private process one 64 bytes block
+static void __sha256_block(unsigned int *state, const unsigned char *block) {
+    unsigned int w[64];
+    for (int i = 0; i < 16; ++i) {
+        w[i] = ((unsigned int)block[4 * i] << 24) | ((unsigned int)block[4 * i + 1] << 16) | ((unsigned int)block[4 * i + 2] << 8) | block[4 * i + 3];
+    }
+    for (int i = 16; i < 64; ++i) {
+        unsigned int s0 = __rotr32(w[i - 15], 7) ^ __rotr32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        unsigned int s1 = __rotr32(w[i - 2], 17) ^ __rotr32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    unsigned int a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int i = 0; i < 64; ++i) {
+        unsigned int t1 = h + (__rotr32(e, 6) ^ __rotr32(e, 11) ^ __rotr32(e, 25)) + ((e & f) ^ (~e & g)) + __SHA256_K[i] + w[i];
+        unsigned int t2 = (__rotr32(a, 2) ^ __rotr32(a, 13) ^ __rotr32(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+/// @private SHA-256 fed by the chunks in order
+struct __sha256_t {
+    unsigned int state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    unsigned char block[64]; // partial block
+    unsigned long long len = 0;
+
+    void update(const unsigned char *input, size_t size) {
+        size_t rest = len % 64;
+        len += size;
+        if (rest > 0) { // fill the partial block
+            size_t n = std::min(size, 64 - rest);
+            memcpy(block + rest, input, n);
+            input += n;
+            size -= n;
+            if (rest + n < 64) return;
+            __sha256_block(state, block);
+        }
+        for (; size >= 64; input += 64, size -= 64) __sha256_block(state, input);
+        memcpy(block, input, size);
+    }
+
+    void final(unsigned char *digest) {
+        // padding: 0x80, zeros, and bit length (big-endian)
+        unsigned char tail[128] = {0};
+        size_t rest = len % 64, tailLen = rest < 56 ? 64 : 128;
+        unsigned long long bits = len * 8;
+        memcpy(tail, block, rest);
+        tail[rest] = 0x80;
+        for (int i = 0; i < 8; ++i) tail[tailLen - 1 - i] = (unsigned char)(bits >> (8 * i));
+        for (size_t i = 0; i < tailLen; i += 64) __sha256_block(state, tail + i);
+
+        for (int i = 0; i < 8; ++i) {
+            for (int j = 0; j < 4; ++j) digest[4 * i + j] = (unsigned char)(state[i] >> (24 - 8 * j));
+        }
+    }
+};
+
+static void __sha256(const unsigned char *input, size_t len, unsigned char *digest) {
+    __sha256_t sha;
+    sha.update(input, len);
+    sha.final(digest);
+}
+
+/*** ================================================== ***/
+
+/// @private write the bytes as lowercase hex
+static size_t __tohex(char *dest, const unsigned char *bytes, size_t size) {
+    static const char digits[] = "0123456789abcdef";
+    for (size_t i = 0; i < size; ++i) {
+        dest[2 * i] = digits[bytes[i] >> 4];
+        dest[2 * i + 1] = digits[bytes[i] & 15];
+    }
+    dest[2 * size] = '\0';
+    return 2 * size;
+}
+
+/// @private write the integer as big-endian hex (canonical representation)
+static size_t __tohex(char *dest, unsigned long long value, size_t size) {
+    unsigned char bytes[8];
+    for (size_t i = 0; i < size; ++i) bytes[i] = (unsigned char)(value >> (8 * (size - 1 - i)));
+    return __tohex(dest, bytes, size);
+}
+
+/*** ================================================== ***/
+/*** @private streaming digest ***/
+
+/// @private digest fed by the chunks in order (the result equals hash_digest of the whole data)
+class __hasher_t {
+public:
+    explicit __hasher_t(int algo): algo(algo), crc(0xffffffff), len(0), consumed(0), stripe(0) {
+        if (algo == HASH_XXH3) __xxh3_init(acc);
+    }
+
+    void update(const char *data, size_t size) {
+        len += size;
+        switch (algo) {
+        case HASH_CRC32:
+            crc = ~get_crc32(data, size, crc) & 0xffffffffUL; // continue from the register before the final inversion
+            break;
+        case HASH_SHA256:
+            sha.update((const unsigned char*)data, size);
+            break;
+        case HASH_XXH3:
+            buffer.append(data, size);
+            if (len <= 240) return; // short input is hashed at once
+            // a stripe is accumulated only if any byte follows it (the last stripe is merged by final)
+            for (; buffer.size() - consumed > 64; consumed += 64) {
+                __xxh3_accumulate512(acc, (const unsigned char*)buffer.data() + consumed, __XXH3_SECRET + stripe * 8);
+                if (++stripe == __XXH3_STRIPES) {
+                    __xxh3_scramble(acc, __XXH3_SECRET + __XXH3_SECRET_SIZE - 64);
+                    stripe = 0;
+                }
+            }
+            // keep the last 64 bytes for the last stripe
+            if (consumed > 64) {
+                buffer.erase(0, consumed - 64);
+                consumed = 64;
+            }
+            break;
+        }
+    }
+
+    /// @param dest: buffer of HASH_DIGEST_MAX + 1 bytes at least
+    // @return length of the hex digest
+    size_t final(char *dest) {
+        switch (algo) {
+        case HASH_CRC32:
+            return __tohex(dest, ~crc & 0xffffffffUL, 4);
+        case HASH_SHA256: {
+            unsigned char digest[32];
+            sha.final(digest);
+            return __tohex(dest, digest, 32);
+        }
+        case HASH_XXH3:
+            if (len <= 240) return __tohex(dest, __xxh3((const unsigned char*)buffer.data(), buffer.size()), 8);
+            return __tohex(dest, __xxh3_merge(acc, (const unsigned char*)buffer.data() + buffer.size() - 64, len), 8);
+        default:
+            return 0;
+        }
+    }
+
+private:
+    int algo;
+    unsigned long crc; // CRC-32 register
+    __sha256_t sha;
+    unsigned long long len, acc[8]; // total length, XXH3 accumulators
+    std::string buffer; // XXH3: input which is not accumulated yet, following the last 64 bytes accumulated
+    size_t consumed, stripe; // XXH3: accumulated bytes in buffer, stripe index in the block
+};
+
+/// @private size of the chunk read from the file
+static const size_t __HASH_CHUNK_SIZE = 64 * 1024;
+
+/// @private get the hex digest of the file by reading it in chunks ("" if the file cannot be read)
+static std::string __hashfile(int algo, const std::string &path, char *chunk) {
+    FILE *fp = fs_fopen(path.c_str(), "rb");
+    if (fp == nullptr) return "";
+
+    __hasher_t hasher(algo);
+    size_t n;
+    while ((n = fread(chunk, 1, __HASH_CHUNK_SIZE, fp)) > 0) hasher.update(chunk, n);
+    bool isFailed = ferror(fp) != 0;
+    fclose(fp);
+    if (isFailed) return "";
+
+    char digest[HASH_DIGEST_MAX + 1];
+    return std::string(digest, hasher.final(digest));
+}
+
+extern "C" {
+    __export size_t hash_digest(int algo, const char *data, size_t size, char *dest) {
+        switch (algo) {
+        case HASH_CRC32:
+            return __tohex(dest, get_crc32(data, size, 0xffffffff) & 0xffffffffUL, 4);
+        case HASH_XXH3:
+            return __tohex(dest, __xxh3((const unsigned char*)data, size), 8);
+        case HASH_SHA256: {
+            unsigned char digest[32];
+            __sha256((const unsigned char*)data, size, digest);
+            return __tohex(dest, digest, 32);
+        }
+        default:
+            return 0;
+        }
+    }
+
+    /*** ================================================== ***/
+    /*** file tree hashing ***/
+
+    __export fs_hashtree_t *fs_hashtree_open(const char *dir, int algo, size_t threads) {
+        char digest[HASH_DIGEST_MAX + 1];
+        if (hash_digest(algo, "", 0, digest) == 0) return nullptr;
+
+        fs_walk_t *walker = fs_walk_open(dir, nullptr, 0, nullptr, 0, -1, FS_TYPE_REG);
+        if (walker == nullptr) return nullptr;
+
+        fs_hashtree_t *self = new fs_hashtree_t;
+        size_t rootlen = walker->root.size();
+        const char *path;
+        while ((path = fs_walk_next(walker, nullptr)) != nullptr) self->entries.push_back({path + rootlen, ""});
+        fs_walk_close(walker);
+        std::sort(self->entries.begin(), self->entries.end());
+
+        // each task hashes one file: the pool balances large and small files by work stealing
+        // * files are read in chunks, so the memory doesn't depend on the file size
+        std::string root = path_append_slash(std::string(dir));
+        thread_pool_t pool(threads);
+        for (auto &entry : self->entries) {
+            pool.push([&root, &entry, algo] {
+                std::unique_ptr<char[]> chunk(new char[__HASH_CHUNK_SIZE]);
+                entry.second = __hashfile(algo, root + entry.first, chunk.get());
+            });
+        }
+        if (!pool.wait()) { // e.g. out of memory: the digests are incomplete
+            delete self;
+            return nullptr;
+        }
+
+        // unreadable files
+        auto end = std::remove_if(self->entries.begin(), self->entries.end(), [](const std::pair<std::string, std::string> &entry) { return entry.second.empty(); });
+        self->entries.erase(end, self->entries.end());
+        return self;
+    }
+
+    __export void fs_hashtree_close(fs_hashtree_t *self) {
+        delete self;
+    }
+
+    __export size_t fs_hashtree_count(fs_hashtree_t *self) {
+        return self->entries.size();
+    }
+
+    __export const char *fs_hashtree_get(fs_hashtree_t *self, size_t index, const char **digest) {
+        if (index >= self->entries.size()) return nullptr;
+        *digest = self->entries[index].second.c_str();
+        return self->entries[index].first.c_str();
+    }
+}
+
+/*** ================================================== ***/
+/*** utility functions for C++ ***/
+
+std::string hash_digest(int algo, const char *data, size_t size) {
+    char digest[HASH_DIGEST_MAX + 1];
+    size_t len = hash_digest(algo, data, size, digest);
+    return std::string(digest, len);
+}
@@ -0,0 +1,53 @@
+﻿#pragma once
+
+#include "filesystem.hpp"
+
+extern "C" {
+    /// hash algorithms
+    enum {
+        HASH_CRC32 = 1,  // CRC-32 (same as get_crc32 / zlib): 8 hex digits
+        HASH_XXH3 = 2,   // XXH3 64-bit (seed = 0): 16 hex digits, non-cryptographic and fastest
+        HASH_SHA256 = 3, // SHA-256: 64 hex digits
+    };
+
+    /// max length of hex digest (without null terminator)
+    #define HASH_DIGEST_MAX 64
+
+    /// get hex digest of the data
+    // @param algo: HASH_*
+    // @param dest: buffer to store the null-terminated lowercase hex digest (HASH_DIGEST_MAX + 1 bytes at least)
+    // @return length of the digest (0: unknown algorithm)
+    __export size_t hash_digest(int algo, const char *data, size_t size, char *dest);
+
+    /*** ================================================== ***/
+    /*** file tree hashing ***/
+
+    /// manifest of file digests in the directory tree
+    typedef struct {
+        std::vector<std::pair<std::string, std::string>> entries; // (relative path, hex digest) sorted by path
+    } fs_hashtree_t;
+
+    /// get hex digests of all files in the directory tree on the thread pool
+    // * files are read in 64 KiB chunks and the digests are computed incrementally, unreadable files are skipped
+    // @param algo: HASH_*
+    // @param threads: count of worker threads (0: count of hardware threads)
+    // @return nullptr if dir cannot be opened, algo is unknown or a task has failed with an exception
+    __export fs_hashtree_t *fs_hashtree_open(const char *dir, int algo, size_t threads);
+
+    /// free the manifest
+    __export void fs_hashtree_close(fs_hashtree_t *self);
+
+    /// get count of files in the manifest
+    __export size_t fs_hashtree_count(fs_hashtree_t *self);
+
+    /// get the file in the manifest
+    // @param digest: hex digest of the file
+    // @return relative path from dir, nullptr if index is out of range
+    __export const char *fs_hashtree_get(fs_hashtree_t *self, size_t index, const char **digest);
+}
+
+/*** ================================================== ***/
+/*** utility functions for C++ ***/
+
+/// get hex digest of the data ("" if algo is unknown)
+std::string hash_digest(int algo, const char *data, size_t size);
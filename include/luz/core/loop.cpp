@@ -0,0 +1,252 @@
+﻿#include "loop.hpp"
+#include <algorithm>
+#include <functional>
+#include <errno.h>
+
+#ifdef __linux__
+    #include <sys/epoll.h>
+    #include <sys/timerfd.h>
+#elif !defined(_WINDOWS)
+    #include <thread>
+    #include <chrono>
+#endif
+
+/// @private max count of the descriptor events handled by one epoll_wait
+static const int __LOOP_EVENTS_MAX = 64;
+
+/// @private order of the timer heap (the earliest deadline first)
+typedef std::greater<std::pair<unsigned long long, unsigned int>> __timerorder;
+
+/*** ================================================== ***/
+/*** @private loop helpers ***/
+
+#ifdef __linux__
+    /// @private register the union of the waited events of the descriptor into epoll
+    static bool __update(loop_t *self, int fd) {
+        auto it = self->fds.find(fd);
+        if (it == self->fds.end()) return true;
+        if (it->second.empty()) {
+            epoll_ctl(self->epfd, EPOLL_CTL_DEL, fd, nullptr);
+            self->fds.erase(it);
+            return true;
+        }
+        struct epoll_event ev = {0, {0}};
+        ev.data.fd = fd;
+        for (auto &waiter: it->second) {
+            if (waiter.events & LOOP_READ) ev.events |= EPOLLIN;
+            if (waiter.events & LOOP_WRITE) ev.events |= EPOLLOUT;
+        }
+        if (0 == epoll_ctl(self->epfd, EPOLL_CTL_MOD, fd, &ev)) return true;
+        // the descriptor has been closed and reopened after registration
+        return errno == ENOENT && 0 == epoll_ctl(self->epfd, EPOLL_CTL_ADD, fd, &ev);
+    }
+
+    /// @private arm the timerfd at the earliest deadline
+    static void __arm(loop_t *self, unsigned long long deadline) {
+        if (deadline == self->armed) return;
+        struct itimerspec spec = {{0, 0}, {(time_t)(deadline / 1000000000ULL), (long)(deadline % 1000000000ULL)}};
+        timerfd_settime(self->timerfd, TFD_TIMER_ABSTIME, &spec, nullptr); // deadline = 0: disarm
+        self->armed = deadline;
+    }
+#endif
+
+/// @private remove the wait from the active waits (the entry in the timer heap is skipped when it expires)
+static void __release(loop_t *self, std::unordered_map<unsigned int, int>::iterator it) {
+    #ifdef __linux__
+        int fd = it->second;
+        if (fd >= 0) {
+            auto &waiters = self->fds[fd];
+            waiters.erase(std::remove_if(waiters.begin(), waiters.end(), [&](const loop_t::waiter_t &waiter) {
+                return waiter.id == it->first;
+            }), waiters.end());
+            __update(self, fd);
+        }
+    #endif
+    self->active.erase(it);
+}
+
+/// @private get the earliest deadline of the active timers (0: no timers)
+static unsigned long long __deadline(loop_t *self) {
+    auto &timers = self->timers;
+    // drop the released waits, and compact the heap if it's filled with them
+    while (!timers.empty() && self->active.find(timers.front().second) == self->active.end()) {
+        std::pop_heap(timers.begin(), timers.end(), __timerorder());
+        timers.pop_back();
+    }
+    if (timers.size() > 64 && timers.size() > self->active.size() * 2) {
+        timers.erase(std::remove_if(timers.begin(), timers.end(), [&](const std::pair<unsigned long long, unsigned int> &timer) {
+            return self->active.find(timer.second) == self->active.end();
+        }), timers.end());
+        std::make_heap(timers.begin(), timers.end(), __timerorder());
+    }
+    return timers.empty() ? 0 : timers.front().first;
+}
+
+/// @private complete the expired timers and the timed out watches
+static size_t __expire(loop_t *self, loop_event_t *events, size_t capacity) {
+    size_t count = 0;
+    unsigned long long now = os_clock_ns();
+    for (unsigned long long deadline = __deadline(self); count < capacity && deadline != 0 && deadline <= now; deadline = __deadline(self)) {
+        unsigned int id = self->timers.front().second;
+        std::pop_heap(self->timers.begin(), self->timers.end(), __timerorder());
+        self->timers.pop_back();
+        __release(self, self->active.find(id));
+        events[count++] = {id, 0};
+    }
+    return count;
+}
+
+/// @private issue a new id of the wait
+static unsigned int __issue(loop_t *self, int fd, double timeout) {
+    unsigned int id = ++self->next_id;
+    if (id == 0) id = ++self->next_id; // 0 means failure
+    self->active[id] = fd;
+    if (timeout >= 0) {
+        self->timers.push_back({os_clock_ns() + (unsigned long long)(timeout * 1000000.0), id});
+        std::push_heap(self->timers.begin(), self->timers.end(), __timerorder());
+    }
+    #ifdef __linux__
+        __arm(self, __deadline(self)); // loop_fd becomes readable at the deadline
+    #endif
+    return id;
+}
+
+extern "C" {
+    __export loop_t *loop_open() {
+        loop_t *self = new loop_t;
+        self->next_id = 0;
+        #ifdef _WINDOWS
+            self->port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+            if (self->port == nullptr) {
+                delete self;
+                return nullptr;
+            }
+        #elif defined(__linux__)
+            self->armed = 0;
+            self->epfd = epoll_create1(EPOLL_CLOEXEC);
+            self->timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+            struct epoll_event ev = {EPOLLIN, {0}};
+            ev.data.fd = self->timerfd;
+            if (self->epfd < 0 || self->timerfd < 0 || 0 != epoll_ctl(self->epfd, EPOLL_CTL_ADD, self->timerfd, &ev)) {
+                if (self->epfd >= 0) close(self->epfd);
+                if (self->timerfd >= 0) close(self->timerfd);
+                delete self;
+                return nullptr;
+            }
+        #endif
+        return self;
+    }
+
+    __export void loop_close(loop_t *self) {
+        if (self == nullptr) return;
+        #ifdef _WINDOWS
+            CloseHandle(self->port);
+        #elif defined(__linux__)
+            close(self->epfd);
+            close(self->timerfd);
+        #endif
+        delete self;
+    }
+
+    __export unsigned int loop_timer(loop_t *self, double msec) {
+        return __issue(self, -1, msec < 0 ? 0 : msec);
+    }
+
+    __export unsigned int loop_watch(loop_t *self, int fd, int events, double timeout) {
+        #ifdef __linux__
+            if (fd < 0 || (events & (LOOP_READ | LOOP_WRITE)) == 0) {
+                errno = EINVAL;
+                return 0;
+            }
+            if (self->fds.find(fd) == self->fds.end()) {
+                struct epoll_event ev = {0, {0}};
+                ev.data.fd = fd;
+                if (0 != epoll_ctl(self->epfd, EPOLL_CTL_ADD, fd, &ev)) return 0; // EPERM: regular file
+                self->fds[fd];
+            }
+            unsigned int id = __issue(self, fd, timeout);
+            self->fds[fd].push_back({id, events & (LOOP_READ | LOOP_WRITE)});
+            if (!__update(self, fd)) {
+                __release(self, self->active.find(id));
+                return 0;
+            }
+            return id;
+        #else
+            errno = ENOSYS;
+            return 0;
+        #endif
+    }
+
+    __export void loop_cancel(loop_t *self, unsigned int id) {
+        auto it = self->active.find(id);
+        if (it != self->active.end()) __release(self, it);
+    }
+
+    __export size_t loop_pending(loop_t *self) {
+        return self->active.size();
+    }
+
+    __export size_t loop_wait(loop_t *self, int timeout, loop_event_t *events, size_t capacity) {
+        size_t count = __expire(self, events, capacity);
+        if (count > 0 || capacity == 0 || self->active.empty()) return count;
+
+        #ifdef __linux__
+            struct epoll_event evs[__LOOP_EVENTS_MAX];
+            for (;;) {
+                __arm(self, __deadline(self));
+                int n = epoll_wait(self->epfd, evs, __LOOP_EVENTS_MAX, timeout);
+                for (int i = 0; i < n && count < capacity; ++i) {
+                    int fd = evs[i].data.fd;
+                    if (fd == self->timerfd) {
+                        unsigned long long expirations;
+                        while (read(self->timerfd, &expirations, sizeof(expirations)) > 0);
+                        self->armed = 0; // one-shot timer has been disarmed
+                        continue;
+                    }
+                    auto it = self->fds.find(fd);
+                    if (it == self->fds.end()) continue;
+
+                    int flags = ((evs[i].events & EPOLLIN) ? LOOP_READ : 0) | ((evs[i].events & EPOLLOUT) ? LOOP_WRITE : 0)
+                        | ((evs[i].events & (EPOLLERR | EPOLLHUP)) ? LOOP_ERROR : 0);
+                    auto &waiters = it->second;
+                    // the waiters left by the capacity are completed by the next call (epoll is level-triggered)
+                    for (size_t j = 0; j < waiters.size() && count < capacity; ) {
+                        int result = (flags & LOOP_ERROR) ? waiters[j].events | LOOP_ERROR : flags & waiters[j].events;
+                        if (result == 0) {
+                            ++j;
+                            continue;
+                        }
+                        events[count++] = {waiters[j].id, result};
+                        self->active.erase(waiters[j].id);
+                        waiters.erase(waiters.begin() + j);
+                    }
+                    __update(self, fd);
+                }
+                count += __expire(self, events + count, capacity - count);
+                // woken by the stale expiration of the timerfd: wait again if the caller waits infinitely
+                if (count > 0 || timeout >= 0 || (n < 0 && errno != EINTR) || self->active.empty()) return count;
+            }
+        #else
+            unsigned long long deadline = __deadline(self), now = os_clock_ns();
+            long long remaining = deadline == 0 ? -1 : deadline <= now ? 0 : (long long)((deadline - now + 999999ULL) / 1000000ULL);
+            if (timeout >= 0 && (remaining < 0 || timeout < remaining)) remaining = timeout;
+            #ifdef _WINDOWS
+                DWORD size;
+                ULONG_PTR key;
+                OVERLAPPED *overlapped;
+                GetQueuedCompletionStatus(self->port, &size, &key, &overlapped, remaining < 0 ? INFINITE : (DWORD)remaining);
+            #else
+                if (remaining > 0) std::this_thread::sleep_for(std::chrono::milliseconds(remaining));
+            #endif
+            return __expire(self, events, capacity);
+        #endif
+    }
+
+    __export int loop_fd(loop_t *self) {
+        #ifdef __linux__
+            return self->epfd;
+        #else
+            return -1;
+        #endif
+    }
+}
@@ -0,0 +1,71 @@
+﻿#pragma once
+
+#include "os.hpp"
+#include <vector>
+#include <unordered_map>
+
+extern "C" {
+    /// readiness of the descriptor (bit flags)
+    enum {
+        LOOP_READ = 1,  // readable
+        LOOP_WRITE = 2, // writable
+        LOOP_ERROR = 4, // error or hang up (reported with the waited flags)
+    };
+
+    /// completed wait
+    typedef struct {
+        unsigned int id; // id returned by loop_timer / loop_watch
+        int result;      // LOOP_* flags of the descriptor (0: timer expired / the wait timed out)
+    } loop_event_t;
+
+    /// structure of event loop
+    typedef struct {
+        /// waiter for the readiness of the descriptor
+        struct waiter_t {
+            unsigned int id;
+            int events; // LOOP_READ | LOOP_WRITE
+        };
+        #ifdef _WINDOWS
+            HANDLE port; // I/O completion port (only timers can be waited for)
+        #elif defined(__linux__)
+            int epfd, timerfd; // timerfd is armed at the earliest deadline, so epfd can be nested into another loop
+            std::unordered_map<int, std::vector<waiter_t>> fds; // descriptor => waiters
+            unsigned long long armed; // deadline the timerfd is armed at (0: disarmed)
+        #endif
+        std::vector<std::pair<unsigned long long, unsigned int>> timers; // min-heap of (deadline [ns], id)
+        std::unordered_map<unsigned int, int> active; // id => descriptor of loop_watch (-1: loop_timer)
+        unsigned int next_id;
+    } loop_t;
+
+    /// create event loop (epoll + timerfd on Linux, I/O completion port on Windows)
+    // * only timers are supported on the other platforms
+    __export loop_t *loop_open();
+
+    /// close event loop (pending waits are discarded)
+    __export void loop_close(loop_t *self);
+
+    /// start one-shot timer
+    // @return id of the wait (completed with result = 0)
+    __export unsigned int loop_timer(loop_t *self, double msec);
+
+    /// wait for the readiness of the descriptor once
+    // @param events: LOOP_READ | LOOP_WRITE
+    // @param timeout: milliseconds to wait (-1: infinite), completed with result = 0 if timed out
+    // @return id of the wait, 0 if the descriptor cannot be waited for (e.g. regular file, or not Linux)
+    __export unsigned int loop_watch(loop_t *self, int fd, int events, double timeout);
+
+    /// cancel the wait (it's never completed)
+    __export void loop_cancel(loop_t *self, unsigned int id);
+
+    /// get count of the waits not completed yet
+    __export size_t loop_pending(loop_t *self);
+
+    /// wait for the completion of the waits
+    // @param timeout: milliseconds to wait for the first completion (-1: infinite)
+    // @return count of the completed waits written into events (0: timed out)
+    __export size_t loop_wait(loop_t *self, int timeout, loop_event_t *events, size_t capacity);
+
+    /// get the descriptor which becomes readable when any wait can be completed (-1 if not Linux)
+    // * it can be nested into another event loop
+    __export int loop_fd(loop_t *self);
+}
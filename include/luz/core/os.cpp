@@ -1,11 +1,36 @@
 ﻿#include "os.hpp"
+#include <thread>
 
-#ifdef _WINDOWS
-    #include <mmsystem.h>
-#else
-    #include <sys/time.h>
+#ifndef _WINDOWS
+    #include <time.h>
 #endif
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define __OS_RDTSC() __rdtsc()
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define __OS_RDTSC() __rdtsc()
+#endif
+
+/// @private calibrate the frequency of os_rdtsc
+static unsigned long long __rdtsc_calibrate() {
+    #if defined(__aarch64__) && defined(__GNUC__)
+        unsigned long long hz;
+        asm volatile("mrs %0, cntfrq_el0" : "=r"(hz));
+        return hz;
+    #elif defined(__OS_RDTSC)
+        // count ticks while 20 ms elapse (invariant TSC runs at a constant rate regardless of the CPU frequency)
+        unsigned long long ns = os_clock_ns(), ticks = __OS_RDTSC();
+        os_sleep(20);
+        unsigned long long elapsed = os_clock_ns() - ns;
+        ticks = __OS_RDTSC() - ticks;
+        return elapsed > 0 ? (unsigned long long)((double)ticks * 1e9 / (double)elapsed) : 0;
+    #else
+        return 1000000000ULL; // os_rdtsc == os_clock_ns
+    #endif
+}
+
 extern "C" {
     __export long os_execute(const char *cmd) {
         #ifdef _WINDOWS
@@ -23,16 +48,64 @@ extern "C" {
         #endif
     }
 
-    __export unsigned long os_gettime() {
+    __export unsigned long long os_gettime() {
+        #ifdef _WINDOWS
+            return GetTickCount64();
+        #else
+            return os_clock_ns() / 1000000ULL;
+        #endif
+    }
+
+    __export unsigned long long os_clock_ns() {
+        #ifdef _WINDOWS
+            static const unsigned long long frequency = []() {
+                LARGE_INTEGER f;
+                QueryPerformanceFrequency(&f);
+                return (unsigned long long)f.QuadPart;
+            }();
+            LARGE_INTEGER counter;
+            QueryPerformanceCounter(&counter);
+            // split to avoid overflow of counter * 1e9
+            unsigned long long c = (unsigned long long)counter.QuadPart;
+            return (c / frequency) * 1000000000ULL + (c % frequency) * 1000000000ULL / frequency;
+        #else
+            struct timespec ts;
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+        #endif
+    }
+
+    __export unsigned long long os_clock_cpu() {
         #ifdef _WINDOWS
-            return timeGetTime();
+            FILETIME creation, exit, kernel, user;
+            if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) return 0;
+            // 100 ns units
+            return ((((unsigned long long)kernel.dwHighDateTime << 32) | kernel.dwLowDateTime)
+                + (((unsigned long long)user.dwHighDateTime << 32) | user.dwLowDateTime)) * 100ULL;
         #else
-            struct timeval tv;
-            gettimeofday(&tv, nullptr);
-            return tv.tv_sec * 1000 + tv.tv_usec / 1000;
+            struct timespec ts;
+            if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts)) return 0;
+            return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
         #endif
     }
 
+    __export unsigned long long os_rdtsc() {
+        #if defined(__aarch64__) && defined(__GNUC__)
+            unsigned long long ticks;
+            asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+            return ticks;
+        #elif defined(__OS_RDTSC)
+            return __OS_RDTSC();
+        #else
+            return os_clock_ns();
+        #endif
+    }
+
+    __export unsigned long long os_rdtsc_hz() {
+        static const unsigned long long hz = __rdtsc_calibrate(); // thread-safe initialization
+        return hz;
+    }
+
     __export bool os_setenv(const char *name, const char *val) {
         #ifdef _WINDOWS
             return FALSE != SetEnvironmentVariableW(u8towcs(name).c_str(), u8towcs(val).c_str());
@@ -78,4 +151,9 @@ extern "C" {
             return getcwd(dest, size);
         #endif
     }
+
+    __export unsigned long os_cpucount() {
+        unsigned long count = std::thread::hardware_concurrency();
+        return count > 0 ? count : 1;
+    }
 }
@@ -10,8 +10,23 @@ extern "C" {
     /// sleep [milli seconds]
     __export void os_sleep(unsigned long msec);
 
-    /// get current os time [milli seconds]
-    __export unsigned long os_gettime();
+    /// get monotonic time [milli seconds]
+    // * it's not affected by the system clock adjustment (the origin is unspecified)
+    __export unsigned long long os_gettime();
+
+    /// get monotonic time [nano seconds] (CLOCK_MONOTONIC / QueryPerformanceCounter)
+    __export unsigned long long os_clock_ns();
+
+    /// get CPU time consumed by the current thread [nano seconds]
+    __export unsigned long long os_clock_cpu();
+
+    /// read the CPU cycle counter (TSC on x86, CNTVCT on ARM64, os_clock_ns on the other architectures)
+    // * convert ticks into seconds by os_rdtsc_hz
+    __export unsigned long long os_rdtsc();
+
+    /// get the frequency of os_rdtsc [ticks per second]
+    // * calibrated against os_clock_ns at the first call (it takes about 20 ms)
+    __export unsigned long long os_rdtsc_hz();
 
     /// set system environmental value
     __export bool os_setenv(const char *name, const char *val);
@@ -24,6 +39,9 @@ extern "C" {
     
     /// get current working directory
     __export const char *os_getcwd(char *dest, size_t size);
+
+    /// get count of logical processors (1 if unknown)
+    __export unsigned long os_cpucount();
 }
 
 /*** ================================================== ***/
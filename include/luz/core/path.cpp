@@ -1,5 +1,10 @@
 ﻿#include "path.hpp"
 
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+
 #ifdef _WINDOWS
     #include <shlwapi.h>
     #include <sys/stat.h>
@@ -7,6 +12,14 @@
     #include <sys/stat.h>
 #endif
 
+/// @private memoized results of path_complete (LRU)
+static struct {
+    std::mutex mutex;
+    size_t capacity = 0; // 0: disabled
+    std::list<std::pair<std::string, std::string>> entries; // (key, full path): most recently used first
+    std::unordered_map<std::string, std::list<std::pair<std::string, std::string>>::iterator> index;
+} __pathcache;
+
 extern "C" {
     __export const char *path_basename(char *dest, const char *path) {
         return strcpy(dest, path_basename(path).c_str());
@@ -23,6 +36,12 @@ extern "C" {
     __export const char *path_parentdir(char *dest, const char *path) {
         return strcpy(dest, path_parentdir(path).c_str());
     }
+
+    __export size_t path_parentdir_s(char *dest, size_t size, const char *path, bool isFullPathRequired) {
+        std::string parentdir = path_parentdir(path, isFullPathRequired);
+        if (parentdir.size() < size) memcpy(dest, parentdir.c_str(), parentdir.size() + 1);
+        return parentdir.size();
+    }
     
     __export bool path_isfile(const char *path) {
         return path_isfile(std::string(path));
@@ -36,6 +55,31 @@ extern "C" {
         return strcpy(dest, path_complete(path).c_str());
     }
 
+    __export size_t path_complete_s(char *dest, size_t size, const char *path) {
+        std::string fullpath = path_complete(path);
+        if (fullpath.size() < size) memcpy(dest, fullpath.c_str(), fullpath.size() + 1);
+        return fullpath.size();
+    }
+
+    __export const char *path_normalize(char *dest, const char *path) {
+        return strcpy(dest, path_normalize(path).c_str());
+    }
+
+    __export void path_cache_enable(size_t capacity) {
+        std::lock_guard<std::mutex> lock(__pathcache.mutex);
+        __pathcache.capacity = capacity;
+        while (__pathcache.entries.size() > capacity) {
+            __pathcache.index.erase(__pathcache.entries.back().first);
+            __pathcache.entries.pop_back();
+        }
+    }
+
+    __export void path_cache_clear() {
+        std::lock_guard<std::mutex> lock(__pathcache.mutex);
+        __pathcache.entries.clear();
+        __pathcache.index.clear();
+    }
+
     __export bool path_stat(path_stat_t *dest, const char *path) {
         std::unique_ptr<path_stat_t> stat = path_stat(path);
         if (!stat) return false;
@@ -86,6 +130,42 @@ static long __firstdot(const std::string &path, size_t size, long start = -1) {
     return -1;
 }
 
+/// @private identifies if the character is path separator
+inline bool __issep(char c) {
+    return c == '/'
+        #ifdef _WINDOWS
+            || c == '\\'
+        #endif
+    ;
+}
+
+/// @private identifies if the path is absolute path
+static bool __isabsolute(const std::string &path) {
+    #ifdef _WINDOWS
+        if (path.size() >= 2 && path[1] == ':') return path.size() >= 3 && __issep(path[2]);
+    #endif
+    return path.size() > 0 && __issep(path[0]);
+}
+
+/// @private get full path by the os api
+// @return false if the path cannot be resolved
+static bool __fullpath(std::string &dest, const std::string &path);
+
+/// @private get the key of path_complete cache: relative path depends on current working directory
+static std::string __pathcache_key(const std::string &path) {
+    if (__isabsolute(path)) return path;
+    
+    #ifdef _WINDOWS
+        wchar_t cwd[MAX_PATH];
+        if (0 == GetCurrentDirectory(MAX_PATH, cwd)) return "";
+        return wcstou8(cwd) + '\0' + path;
+    #else
+        char cwd[1024 * 4];
+        if (nullptr == getcwd(cwd, sizeof(cwd))) return "";
+        return std::string(cwd) + '\0' + path;
+    #endif
+}
+
 std::string path_basename(const std::string &path) {
     size_t size = path.size();
     return size > 0 ? std::move(path.substr(__parentsep(path, size) + 1)) : "";
@@ -116,6 +196,83 @@ std::string path_parentdir(const std::string &path, bool isFullPathRequired) {
     return p > 0 ? std::move(targetpath.substr(0, p)) : "";
 }
 
+std::string path_complete(const std::string &path) {
+    std::string key, fullpath;
+    {
+        std::lock_guard<std::mutex> lock(__pathcache.mutex);
+        if (__pathcache.capacity > 0 && !(key = __pathcache_key(path)).empty()) {
+            auto it = __pathcache.index.find(key);
+            if (it != __pathcache.index.end()) {
+                __pathcache.entries.splice(__pathcache.entries.begin(), __pathcache.entries, it->second);
+                return it->second->second;
+            }
+        }
+    }
+    if (!__fullpath(fullpath, path)) return path;
+    if (key.empty()) return fullpath;
+
+    // memoize only resolved path: the file may be created later
+    std::lock_guard<std::mutex> lock(__pathcache.mutex);
+    if (__pathcache.capacity == 0 || __pathcache.index.count(key) > 0) return fullpath;
+    __pathcache.entries.emplace_front(key, fullpath);
+    __pathcache.index[key] = __pathcache.entries.begin();
+    if (__pathcache.entries.size() > __pathcache.capacity) {
+        __pathcache.index.erase(__pathcache.entries.back().first);
+        __pathcache.entries.pop_back();
+    }
+    return fullpath;
+}
+
+std::string path_normalize(const std::string &path) {
+    const char sep =
+        #ifdef _WINDOWS
+            '\\';
+        #else
+            '/';
+        #endif
+    size_t size = path.size(), i = 0;
+    std::string dest;
+
+    // root: "C:", "/", "C:/", "//server" (UNC)
+    #ifdef _WINDOWS
+        if (size >= 2 && path[1] == ':') {
+            dest = path.substr(0, 2);
+            i = 2;
+        } else if (size >= 2 && __issep(path[0]) && __issep(path[1])) {
+            dest = {sep, sep};
+            i = 2;
+        }
+    #endif
+    bool absolute = i < size && __issep(path[i]);
+    if (absolute) dest += sep;
+    
+    size_t base = dest.size();
+    std::vector<size_t> marks; // start positions of each directory names in dest
+    while (i < size) {
+        while (i < size && __issep(path[i])) ++i;
+        if (i == size) break;
+
+        size_t head = i;
+        while (i < size && !__issep(path[i])) ++i;
+        size_t len = i - head;
+
+        if (len == 1 && path[head] == '.') continue;
+        if (len == 2 && path[head] == '.' && path[head + 1] == '.') {
+            if (!marks.empty() && dest.compare(marks.back(), std::string::npos, "..") != 0) {
+                // remove the last directory name
+                dest.resize(marks.back() > base ? marks.back() - 1 : base);
+                marks.pop_back();
+                continue;
+            }
+            if (absolute) continue; // "/.." => "/"
+        }
+        if (dest.size() > base) dest += sep;
+        marks.push_back(dest.size());
+        dest.append(path, head, len);
+    }
+    return dest.empty() ? "." : dest;
+}
+
 #ifdef _WINDOWS
     bool path_isfile(const std::string &path) {
         std::wstring p = u8towcs(path);
@@ -126,10 +283,15 @@ std::string path_parentdir(const std::string &path, bool isFullPathRequired) {
         return FALSE != PathIsDirectory(u8towcs(path).c_str());
     }
     
-    std::string path_complete(const std::string &path) {
-        wchar_t dest[1024];
-        if (0 == GetFullPathName(u8towcs(path).c_str(), 1024, dest, nullptr)) return std::move(path);
-        return std::move(wcstou8(dest));
+    static bool __fullpath(std::string &dest, const std::string &path) {
+        std::wstring wpath = u8towcs(path), buf;
+        unsigned long size = GetFullPathName(wpath.c_str(), 0, nullptr, nullptr);
+        
+        if (0 == size) return false;
+        buf.resize(size);
+        if (0 == GetFullPathName(wpath.c_str(), size, (wchar_t*)buf.c_str(), nullptr)) return false;
+        dest = wcstou8(buf);
+        return true;
     }
 
     std::unique_ptr<path_stat_t> path_stat(const std::string &path) {
@@ -152,10 +314,11 @@ std::string path_parentdir(const std::string &path, bool isFullPathRequired) {
         return 0 == stat(path.c_str(), &buf) && S_ISDIR(buf.st_mode);
     }
     
-    std::string path_complete(const std::string &path) {
+    static bool __fullpath(std::string &dest, const std::string &path) {
         char buf[1024 * 4];
-        if (nullptr == realpath(path.c_str(), buf)) return path;
-        return buf;
+        if (nullptr == realpath(path.c_str(), buf)) return false;
+        dest = buf;
+        return true;
     }
 
     std::unique_ptr<path_stat_t> path_stat(const std::string &path) {
@@ -31,6 +31,11 @@ extern "C" {
     /// get parent directory
     // e.g. "/path/to/sample.txt" => "/path/to"
     __export const char *path_parentdir(char *dest, const char *path);
+
+    /// get parent directory into the buffer which has the designated size
+    // @param isFullPathRequired: false if path is already the full path
+    // @return length of the parent directory (dest is not filled if size <= length)
+    __export size_t path_parentdir_s(char *dest, size_t size, const char *path, bool isFullPathRequired);
     
     /// identifies if the path is file
     __export bool path_isfile(const char *path);
@@ -41,6 +46,22 @@ extern "C" {
     /// get full path
     __export const char *path_complete(char *dest, const char *path);
 
+    /// get full path into the buffer which has the designated size
+    // @return length of the full path (dest is not filled if size <= length)
+    __export size_t path_complete_s(char *dest, size_t size, const char *path);
+
+    /// normalize path lexically (resolve ".", ".." and duplicate separators without accessing the file system)
+    // e.g. "/path//to/./sub/../sample.txt" => "/path/to/sample.txt"
+    __export const char *path_normalize(char *dest, const char *path);
+
+    /// enable the memoization of path_complete (0: disable and clear the cache)
+    // @param capacity: max count of cached paths (least recently used path will be removed)
+    // * the cache is keyed by (current working directory, path), so call path_cache_clear() after renaming files
+    __export void path_cache_enable(size_t capacity);
+
+    /// clear the cache of path_complete
+    __export void path_cache_clear();
+
     /// get the file / directory status
     __export bool path_stat(path_stat_t *dest, const char *path);
 
@@ -75,6 +96,9 @@ bool path_isdir(const std::string &path);
 /// get full path
 std::string path_complete(const std::string &path);
 
+/// normalize path lexically
+std::string path_normalize(const std::string &path);
+
 /// get the file / directory status
 std::unique_ptr<path_stat_t> path_stat(const std::string &path);
 
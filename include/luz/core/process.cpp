@@ -0,0 +1,742 @@
+﻿#include "process.hpp"
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <errno.h>
+
+#ifdef _WINDOWS
+    #include <io.h>
+    #include <fcntl.h>
+#else
+    #include <spawn.h>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <sys/wait.h>
+    #include <pthread.h>
+    #include <thread>
+    #include <system_error>
+    #ifdef __linux__
+        #include <sys/syscall.h>
+    #endif
+
+    extern char **environ;
+
+    // posix_spawn_file_actions_addchdir_np: glibc 2.29+, macOS 10.15+
+    #if defined(__APPLE__) || (defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29)))
+        #define __SPAWN_CHDIR
+    #endif
+#endif
+
+/// @private max milliseconds to sleep between polls when the exit of the process cannot be waited for with a descriptor
+static const int __PROCESS_POLL_INTERVAL = 10;
+
+/// @private size of the pending input from which os_process_write blocks until it's written
+static const size_t __PROCESS_INPUT_MAX = 1024 * 1024;
+
+/// @private get the remaining milliseconds (-1: infinite)
+static int __remaining(const std::chrono::steady_clock::time_point &start, int timeout) {
+    if (timeout < 0) return -1;
+    long long elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    return elapsed >= timeout ? 0 : (int)(timeout - elapsed);
+}
+
+#ifdef _WINDOWS
+    /*** ================================================== ***/
+    /*** @private Windows process helpers ***/
+
+    /// @private quote the argument for CommandLineToArgvW / the C runtime
+    static void __quotearg(std::wstring &cmdline, const std::wstring &arg) {
+        if (!cmdline.empty()) cmdline += L' ';
+        if (!arg.empty() && arg.find_first_of(L" \t\n\v\"") == std::wstring::npos) {
+            cmdline += arg;
+            return;
+        }
+        cmdline += L'"';
+        for (size_t i = 0; ; ++i) {
+            size_t backslashes = 0;
+            while (i < arg.size() && arg[i] == L'\\') {
+                ++i;
+                ++backslashes;
+            }
+            if (i == arg.size()) { // escape the backslashes before the closing quote
+                cmdline.append(backslashes * 2, L'\\');
+                break;
+            }
+            if (arg[i] == L'"') cmdline.append(backslashes * 2 + 1, L'\\');
+            else cmdline.append(backslashes, L'\\');
+            cmdline += arg[i];
+        }
+        cmdline += L'"';
+    }
+
+    /// @private create the environment block: the current environment + "NAME=VALUE" entries
+    static std::wstring __envblock(const char **env, size_t nenv) {
+        std::vector<std::wstring> entries;
+        wchar_t *current = GetEnvironmentStringsW();
+        for (wchar_t *p = current; p && *p; p += wcslen(p) + 1) entries.push_back(p);
+        if (current) FreeEnvironmentStringsW(current);
+
+        for (size_t i = 0; i < nenv; ++i) {
+            std::wstring entry = u8towcs(env[i]);
+            size_t eq = entry.find(L'=', 1); // "=C:=C:\\" style entry starts with '='
+            std::wstring name = entry.substr(0, eq);
+            auto it = std::find_if(entries.begin(), entries.end(), [&name](const std::wstring &e) {
+                return e.size() > name.size() && e[name.size()] == L'=' && 0 == _wcsnicmp(e.c_str(), name.c_str(), name.size());
+            });
+            if (it != entries.end()) *it = entry;
+            else entries.push_back(entry);
+        }
+
+        std::wstring block;
+        for (auto &entry: entries) {
+            block += entry;
+            block += L'\0';
+        }
+        block += L'\0';
+        return block;
+    }
+
+    /// @private collect the output of the pipe (thread procedure)
+    static void __collect(os_process_t *self, HANDLE pipe, int index) {
+        char buffer[16 * 1024];
+        DWORD n;
+        while (ReadFile(pipe, buffer, sizeof(buffer), &n, nullptr) && n > 0) {
+            std::lock_guard<std::mutex> lock(self->mutex);
+            self->outputs[index].append(buffer, n);
+            self->arrived.notify_all();
+        }
+        CloseHandle(pipe);
+        std::lock_guard<std::mutex> lock(self->mutex);
+        self->is_closed[index] = true;
+        self->arrived.notify_all();
+    }
+
+    /// @private set the exit code of the exited process, and wait for the collecting threads of OS_SPAWN_CAPTURE
+    static void __setexited(os_process_t *self) {
+        DWORD code = 0;
+        GetExitCodeProcess(self->handle, &code);
+        self->exitcode = (int)code;
+        self->is_exited = true;
+        for (int i = 1; i < 3; ++i) {
+            if (self->modes[i] == OS_SPAWN_CAPTURE && self->collectors[i].joinable()) self->collectors[i].join();
+        }
+    }
+
+    /// @private wait for the output of OS_SPAWN_PIPE
+    // @return false if timed out
+    static bool __waitoutput(os_process_t *self, std::unique_lock<std::mutex> &lock, int index, size_t size, const std::chrono::steady_clock::time_point &start, int timeout) {
+        auto isArrived = [self, index, size]() { return self->is_closed[index] || self->outputs[index].size() > size; };
+        if (timeout < 0) {
+            self->arrived.wait(lock, isArrived);
+            return true;
+        }
+        return self->arrived.wait_until(lock, start + std::chrono::milliseconds(timeout), isArrived);
+    }
+
+    /// @private consume the output of OS_SPAWN_PIPE (the read data is discarded when it becomes large)
+    static void __consume(os_process_t *self, int index, size_t size) {
+        self->offsets[index] += size;
+        if (self->offsets[index] >= 64 * 1024 && self->offsets[index] * 2 >= self->outputs[index].size()) {
+            self->outputs[index].erase(0, self->offsets[index]);
+            self->offsets[index] = 0;
+        }
+    }
+#else
+    /*** ================================================== ***/
+    /*** @private POSIX process helpers ***/
+
+    /// @private create the environment: the current environment + "NAME=VALUE" entries
+    static std::vector<std::string> __environment(const char **env, size_t nenv) {
+        std::vector<std::string> entries;
+        for (char **p = environ; p && *p; ++p) entries.push_back(*p);
+        for (size_t i = 0; i < nenv; ++i) {
+            const char *eq = strchr(env[i], '=');
+            size_t size = eq ? eq - env[i] + 1 : strlen(env[i]);
+            auto it = std::find_if(entries.begin(), entries.end(), [&](const std::string &e) {
+                return 0 == e.compare(0, size, env[i], size);
+            });
+            if (it != entries.end()) *it = env[i];
+            else entries.push_back(env[i]);
+        }
+        return entries;
+    }
+
+    /// @private read the available output of the OS_SPAWN_CAPTURE pipe (the pipe is closed at EOF)
+    static void __collect(os_process_t *self, int index) {
+        char buffer[16 * 1024];
+        while (self->fds[index] >= 0) {
+            ssize_t n = read(self->fds[index], buffer, sizeof(buffer));
+            if (n > 0) {
+                self->outputs[index].append(buffer, n);
+                continue;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0 && errno == EAGAIN) break;
+            close(self->fds[index]);
+            self->fds[index] = -1;
+        }
+    }
+
+    /// @private read the available output of the OS_SPAWN_PIPE into the buffered reader
+    // @return true if any data has arrived or the pipe has reached EOF
+    static bool __fill(os_process_t *self, int index) {
+        size_t read = 0, n;
+        while ((n = fs_reader_fill(self->readers[index])) > 0) read += n;
+        return read > 0 || self->readers[index]->is_eof;
+    }
+
+    /// @private write the pending input into the stdin without blocking
+    // * the stdin is closed if the child has closed it (SIGPIPE is not raised)
+    static void __writeinput(os_process_t *self) {
+        if (self->fds[0] < 0) {
+            self->input.clear();
+            return;
+        }
+        #ifndef F_SETNOSIGPIPE
+            // block SIGPIPE in this thread while writing, and discard it if raised
+            sigset_t pipeset, oldset;
+            sigemptyset(&pipeset);
+            sigaddset(&pipeset, SIGPIPE);
+            pthread_sigmask(SIG_BLOCK, &pipeset, &oldset);
+        #endif
+        size_t written = 0;
+        int error = 0;
+        while (written < self->input.size()) {
+            ssize_t n = write(self->fds[0], self->input.data() + written, self->input.size() - written);
+            if (n > 0) {
+                written += n;
+                continue;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0 && errno != EAGAIN) error = errno;
+            break;
+        }
+        #ifndef F_SETNOSIGPIPE
+            if (error == EPIPE) {
+                struct timespec zero = {0, 0};
+                sigtimedwait(&pipeset, nullptr, &zero);
+            }
+            pthread_sigmask(SIG_SETMASK, &oldset, nullptr);
+        #endif
+        if (error == 0) {
+            self->input.erase(0, written);
+            return;
+        }
+        self->input.clear();
+        close(self->fds[0]);
+        self->fds[0] = -1;
+    }
+
+    /// @private check the exit of the process without blocking
+    static bool __reap(os_process_t *self) {
+        if (self->is_exited) return true;
+
+        int status;
+        pid_t pid;
+        while ((pid = waitpid((pid_t)self->pid, &status, WNOHANG)) < 0 && errno == EINTR);
+        if (pid == 0) return false;
+        if (pid < 0) self->exitcode = -1; // reaped by someone else (e.g. SIGCHLD is ignored)
+        else self->exitcode = WIFEXITED(status) ? WEXITSTATUS(status) : WIFSIGNALED(status) ? -WTERMSIG(status) : status;
+        self->is_exited = true;
+        if (self->pidfd >= 0) {
+            close(self->pidfd);
+            self->pidfd = -1;
+        }
+        for (int i = 1; i < 3; ++i) {
+            if (self->modes[i] == OS_SPAWN_CAPTURE) __collect(self, i);
+        }
+        return true;
+    }
+
+    /// @private write the pending input and read the outputs until the event arrives
+    // * the outputs are always read into the buffers, so the children never block on the full pipes
+    // @param event: -1 => exit of any process, 0 => all the pending input is written, 1 / 2 => data or EOF of stdout / stderr
+    // @return index of the process on which the event has arrived (-1: timed out)
+    static long __pump(os_process_t **procs, size_t n, int event, int timeout) {
+        if (n == 0) return -1;
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<struct pollfd> fds;
+        std::vector<std::pair<size_t, int>> targets; // (index of procs, stream index) of fds (-1: pidfd)
+        bool isFirst = true; // poll at least once even if timeout = 0
+
+        for (;;) {
+            bool isPolled = true; // the event can be waited for by the descriptors
+            fds.clear();
+            targets.clear();
+            for (size_t i = 0; i < n; ++i) {
+                os_process_t *self = procs[i];
+                if (!self->input.empty()) __writeinput(self);
+                if (event == -1 && __reap(self)) return (long)i;
+                if (event == 0 && self->input.empty()) return (long)i;
+                if (event > 0 && (self->readers[event] == nullptr || self->readers[event]->is_eof)) return (long)i;
+
+                if (!self->input.empty()) {
+                    fds.push_back({self->fds[0], POLLOUT, 0});
+                    targets.push_back({i, 0});
+                }
+                for (int j = 1; j < 3; ++j) {
+                    bool isReadable = self->modes[j] == OS_SPAWN_PIPE ? self->readers[j] && !self->readers[j]->is_eof : self->modes[j] == OS_SPAWN_CAPTURE && self->fds[j] >= 0;
+                    if (!isReadable) continue;
+                    fds.push_back({self->fds[j], POLLIN, 0});
+                    targets.push_back({i, j});
+                }
+                if (event != -1) continue;
+                if (self->pidfd < 0) isPolled = false;
+                else {
+                    fds.push_back({self->pidfd, POLLIN, 0});
+                    targets.push_back({i, -1});
+                }
+            }
+
+            int remaining = __remaining(start, timeout);
+            if (remaining == 0 && !isFirst) return -1;
+            isFirst = false;
+
+            int slice = isPolled ? remaining : remaining < 0 ? __PROCESS_POLL_INTERVAL : std::min(remaining, __PROCESS_POLL_INTERVAL);
+            int result = poll(fds.data(), fds.size(), slice);
+            if (result < 0 && errno != EINTR) return -1;
+            for (size_t i = 0; result > 0 && i < fds.size(); ++i) {
+                if (fds[i].revents == 0 || targets[i].second <= 0) continue;
+                os_process_t *self = procs[targets[i].first];
+                int index = targets[i].second;
+                if (self->modes[index] == OS_SPAWN_CAPTURE) __collect(self, index);
+                else if (__fill(self, index) && event == index) return (long)targets[i].first;
+            }
+        }
+    }
+#endif
+
+extern "C" {
+    #ifdef _WINDOWS
+        __export os_process_t *os_spawn(const char **argv, size_t argc, const char **env, size_t nenv, const char *cwd, const int *modes) {
+            if (argc == 0) {
+                errno = EINVAL;
+                return nullptr;
+            }
+            std::wstring cmdline, envblock = env ? __envblock(env, nenv) : L"";
+            for (size_t i = 0; i < argc; ++i) __quotearg(cmdline, u8towcs(argv[i]));
+
+            os_process_t *self = new os_process_t;
+            self->handle = nullptr;
+            self->pid = 0;
+            self->is_exited = false;
+            self->exitcode = 0;
+
+            SECURITY_ATTRIBUTES sa = {sizeof(SECURITY_ATTRIBUTES), nullptr, TRUE};
+            HANDLE children[3] = {GetStdHandle(STD_INPUT_HANDLE), GetStdHandle(STD_OUTPUT_HANDLE), GetStdHandle(STD_ERROR_HANDLE)},
+                parents[3] = {nullptr, nullptr, nullptr};
+            bool isCreated[3] = {false, false, false}; // children[i] must be closed after spawning
+            for (int i = 0; i < 3; ++i) {
+                self->fds[i] = -1;
+                self->modes[i] = modes ? modes[i] : OS_SPAWN_INHERIT;
+                self->is_closed[i] = true;
+                self->offsets[i] = 0;
+                switch (self->modes[i]) {
+                case OS_SPAWN_PIPE:
+                case OS_SPAWN_CAPTURE:
+                    if (i == 0 ? CreatePipe(&children[i], &parents[i], &sa, 0) : CreatePipe(&parents[i], &children[i], &sa, 0)) {
+                        SetHandleInformation(parents[i], HANDLE_FLAG_INHERIT, 0); // parent side is not inherited
+                        isCreated[i] = true;
+                    }
+                    break;
+                case OS_SPAWN_NULL:
+                    children[i] = CreateFileW(L"NUL", i == 0 ? GENERIC_READ : GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, &sa, OPEN_EXISTING, 0, nullptr);
+                    isCreated[i] = children[i] != INVALID_HANDLE_VALUE;
+                    break;
+                case OS_SPAWN_STDOUT:
+                    if (i == 2) children[i] = children[1];
+                    break;
+                }
+            }
+
+            STARTUPINFOW si;
+            PROCESS_INFORMATION pi;
+            ZeroMemory(&si, sizeof(si));
+            si.cb = sizeof(si);
+            si.dwFlags = STARTF_USESTDHANDLES;
+            si.hStdInput = children[0];
+            si.hStdOutput = children[1];
+            si.hStdError = children[2];
+            BOOL isSpawned = CreateProcessW(
+                nullptr, (wchar_t*)cmdline.c_str(), nullptr, nullptr, TRUE, CREATE_UNICODE_ENVIRONMENT,
+                env ? (void*)envblock.c_str() : nullptr, cwd ? u8towcs(cwd).c_str() : nullptr, &si, &pi
+            );
+            for (int i = 0; i < 3; ++i) {
+                if (isCreated[i]) CloseHandle(children[i]);
+            }
+            if (!isSpawned) {
+                for (int i = 0; i < 3; ++i) {
+                    if (parents[i]) CloseHandle(parents[i]);
+                }
+                delete self;
+                errno = GetLastError() == ERROR_FILE_NOT_FOUND || GetLastError() == ERROR_PATH_NOT_FOUND ? ENOENT : EACCES;
+                return nullptr;
+            }
+            CloseHandle(pi.hThread);
+            self->handle = pi.hProcess;
+            self->pid = (long)pi.dwProcessId;
+
+            for (int i = 0; i < 3; ++i) {
+                if (!parents[i]) continue;
+                if (i == 0) self->fds[i] = _open_osfhandle((intptr_t)parents[i], _O_WRONLY | _O_BINARY);
+                else {
+                    self->is_closed[i] = false;
+                    self->collectors[i] = std::thread(__collect, self, parents[i], i);
+                }
+            }
+            return self;
+        }
+
+        __export void os_process_close(os_process_t *self) {
+            if (self == nullptr) return;
+            for (int i = 0; i < 3; ++i) os_process_closefd(self, i);
+            for (int i = 0; i < 3; ++i) {
+                if (!self->collectors[i].joinable()) continue;
+                CancelSynchronousIo(self->collectors[i].native_handle()); // the pipe may be held by the running process
+                self->collectors[i].join();
+            }
+            if (self->handle) CloseHandle(self->handle);
+            delete self;
+        }
+
+        __export bool os_process_wait(os_process_t *self, int timeout) {
+            if (self->is_exited) return true;
+            if (WAIT_OBJECT_0 != WaitForSingleObject(self->handle, timeout < 0 ? INFINITE : (DWORD)timeout)) return false;
+            __setexited(self);
+            return true;
+        }
+
+        __export long os_process_waitany(os_process_t **procs, size_t n, int timeout) {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < n; ++i) {
+                if (procs[i]->is_exited) return (long)i;
+            }
+            if (n == 0) return -1;
+            for (;;) {
+                // WaitForMultipleObjects can wait for MAXIMUM_WAIT_OBJECTS handles: wait for the chunks in turn
+                int remaining = __remaining(start, timeout);
+                for (size_t offset = 0; offset < n; offset += MAXIMUM_WAIT_OBJECTS) {
+                    HANDLE handles[MAXIMUM_WAIT_OBJECTS];
+                    DWORD count = (DWORD)std::min(n - offset, (size_t)MAXIMUM_WAIT_OBJECTS);
+                    for (DWORD i = 0; i < count; ++i) handles[i] = procs[offset + i]->handle;
+
+                    DWORD wait = n <= MAXIMUM_WAIT_OBJECTS ? (remaining < 0 ? INFINITE : (DWORD)remaining)
+                        : (DWORD)std::min(remaining < 0 ? __PROCESS_POLL_INTERVAL : remaining, __PROCESS_POLL_INTERVAL);
+                    DWORD result = WaitForMultipleObjects(count, handles, FALSE, wait);
+                    if (result < WAIT_OBJECT_0 + count) {
+                        __setexited(procs[offset + result - WAIT_OBJECT_0]);
+                        return (long)(offset + result - WAIT_OBJECT_0);
+                    }
+                    if (result == WAIT_FAILED) return -1;
+                }
+                if (__remaining(start, timeout) == 0) return -1;
+            }
+        }
+
+        __export bool os_process_kill(os_process_t *self, int signal) {
+            return !self->is_exited && FALSE != TerminateProcess(self->handle, 1);
+        }
+
+        __export void os_process_closefd(os_process_t *self, int index) {
+            if (self->fds[index] >= 0) {
+                _close(self->fds[index]);
+                self->fds[index] = -1;
+            }
+        }
+
+        __export bool os_process_write(os_process_t *self, const char *data, size_t size, int timeout) {
+            // the outputs are read by the collectors, so the blocking write never deadlocks
+            while (size > 0 && self->fds[0] >= 0) {
+                int n = _write(self->fds[0], data, (unsigned int)std::min(size, (size_t)0x7fffffff));
+                if (n <= 0) {
+                    os_process_closefd(self, 0);
+                    return false;
+                }
+                data += n;
+                size -= n;
+            }
+            return self->fds[0] >= 0;
+        }
+
+        __export bool os_process_flush(os_process_t *self, int timeout) {
+            return self->fds[0] >= 0;
+        }
+
+        __export const char *os_process_readline(os_process_t *self, int index, size_t *len, int timeout) {
+            auto start = std::chrono::steady_clock::now();
+            std::unique_lock<std::mutex> lock(self->mutex);
+            if (self->modes[index] != OS_SPAWN_PIPE) return nullptr;
+
+            std::string &output = self->outputs[index];
+            size_t scanned = self->offsets[index]; // position searched for "\n"
+            for (;;) {
+                size_t lf = output.find('\n', scanned);
+                size_t end = lf != std::string::npos ? lf : self->is_closed[index] && output.size() > self->offsets[index] ? output.size() : std::string::npos;
+                if (end != std::string::npos) {
+                    std::string &line = self->lines[index];
+                    line.assign(output, self->offsets[index], end - self->offsets[index]);
+                    __consume(self, index, end - self->offsets[index] + (lf != std::string::npos ? 1 : 0));
+                    *len = !line.empty() && line.back() == '\r' ? line.size() - 1 : line.size();
+                    return line.c_str();
+                }
+                if (self->is_closed[index]) return nullptr;
+                scanned = output.size();
+                if (!__waitoutput(self, lock, index, output.size(), start, timeout)) return nullptr;
+            }
+        }
+
+        __export long long os_process_read(os_process_t *self, int index, char *dest, size_t size, int timeout) {
+            auto start = std::chrono::steady_clock::now();
+            std::unique_lock<std::mutex> lock(self->mutex);
+            if (self->modes[index] != OS_SPAWN_PIPE) return 0;
+
+            std::string &output = self->outputs[index];
+            if (output.size() == self->offsets[index] && !__waitoutput(self, lock, index, output.size(), start, timeout)) return -1;
+            size_t n = std::min(size, output.size() - self->offsets[index]);
+            memcpy(dest, output.data() + self->offsets[index], n);
+            __consume(self, index, n);
+            return (long long)n;
+        }
+
+        __export bool os_process_eof(os_process_t *self, int index) {
+            std::lock_guard<std::mutex> lock(self->mutex);
+            return self->is_closed[index] && self->offsets[index] == self->outputs[index].size();
+        }
+
+        __export int os_process_pollfds(os_process_t *self, int *fds, bool *isWritable) {
+            return -1;
+        }
+
+        __export const char *os_process_output(os_process_t *self, int index, size_t *size) {
+            std::lock_guard<std::mutex> lock(self->mutex);
+            *size = self->outputs[index].size();
+            return self->outputs[index].c_str();
+        }
+    #else
+        __export os_process_t *os_spawn(const char **argv, size_t argc, const char **env, size_t nenv, const char *cwd, const int *modes) {
+            if (argc == 0) {
+                errno = EINVAL;
+                return nullptr;
+            }
+            #ifndef __SPAWN_CHDIR
+                if (cwd) {
+                    errno = ENOTSUP;
+                    return nullptr;
+                }
+            #endif
+            std::vector<char*> args, envp;
+            std::vector<std::string> environment;
+            for (size_t i = 0; i < argc; ++i) args.push_back((char*)argv[i]);
+            args.push_back(nullptr);
+            if (env) {
+                environment = __environment(env, nenv);
+                for (auto &entry: environment) envp.push_back((char*)entry.c_str());
+                envp.push_back(nullptr);
+            }
+
+            os_process_t *self = new os_process_t;
+            self->pid = 0;
+            self->pidfd = -1;
+            self->readers[0] = self->readers[1] = self->readers[2] = nullptr;
+            self->is_exited = false;
+            self->exitcode = 0;
+
+            posix_spawn_file_actions_t actions;
+            posix_spawn_file_actions_init(&actions);
+            int pipes[3][2] = {{-1, -1}, {-1, -1}, {-1, -1}}, error = 0;
+            for (int i = 0; i < 3 && error == 0; ++i) {
+                self->fds[i] = -1;
+                self->modes[i] = modes ? modes[i] : OS_SPAWN_INHERIT;
+                switch (self->modes[i]) {
+                case OS_SPAWN_PIPE:
+                case OS_SPAWN_CAPTURE:
+                    #ifdef __linux__
+                        if (0 != pipe2(pipes[i], O_CLOEXEC)) error = errno;
+                    #else
+                        if (0 != pipe(pipes[i])) error = errno;
+                        else for (int fd: pipes[i]) fcntl(fd, F_SETFD, FD_CLOEXEC);
+                    #endif
+                    // dup2 clears FD_CLOEXEC of the child side
+                    if (error == 0) posix_spawn_file_actions_adddup2(&actions, pipes[i][i == 0 ? 0 : 1], i);
+                    break;
+                case OS_SPAWN_NULL:
+                    posix_spawn_file_actions_addopen(&actions, i, "/dev/null", i == 0 ? O_RDONLY : O_WRONLY, 0);
+                    break;
+                case OS_SPAWN_STDOUT:
+                    if (i == 2) posix_spawn_file_actions_adddup2(&actions, 1, 2);
+                    break;
+                }
+            }
+            #ifdef __SPAWN_CHDIR
+                if (cwd) posix_spawn_file_actions_addchdir_np(&actions, cwd);
+            #endif
+
+            // reset the signal mask and SIGPIPE (it may be ignored by the parent process)
+            posix_spawnattr_t attr;
+            sigset_t mask, defaults;
+            sigemptyset(&mask);
+            sigemptyset(&defaults);
+            sigaddset(&defaults, SIGPIPE);
+            posix_spawnattr_init(&attr);
+            posix_spawnattr_setsigmask(&attr, &mask);
+            posix_spawnattr_setsigdefault(&attr, &defaults);
+            posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
+
+            pid_t pid = 0;
+            if (error == 0) error = posix_spawnp(&pid, argv[0], &actions, &attr, args.data(), env ? envp.data() : environ);
+            posix_spawnattr_destroy(&attr);
+            posix_spawn_file_actions_destroy(&actions);
+
+            for (int i = 0; i < 3; ++i) {
+                if (pipes[i][0] < 0) continue;
+                close(pipes[i][i == 0 ? 0 : 1]); // child side
+                if (error != 0) close(pipes[i][i == 0 ? 1 : 0]);
+                else {
+                    int fd = self->fds[i] = pipes[i][i == 0 ? 1 : 0];
+                    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+                    #ifdef F_SETNOSIGPIPE
+                        if (i == 0) fcntl(fd, F_SETNOSIGPIPE, 1);
+                    #endif
+                    if (i > 0 && self->modes[i] == OS_SPAWN_PIPE) self->readers[i] = fs_reader_openfd(fd, 0);
+                }
+            }
+            if (error != 0) {
+                delete self;
+                errno = error;
+                return nullptr;
+            }
+            self->pid = (long)pid;
+            #if defined(__linux__) && defined(SYS_pidfd_open)
+                self->pidfd = (int)syscall(SYS_pidfd_open, pid, 0); // -1 if the kernel is older than 5.3
+            #endif
+            return self;
+        }
+
+        __export void os_process_close(os_process_t *self) {
+            if (self == nullptr) return;
+            self->input.clear(); // discard the pending input
+            for (int i = 0; i < 3; ++i) os_process_closefd(self, i);
+            if (!__reap(self)) {
+                // the running process is left alive: reap it in the background when it exits, otherwise it remains as a zombie
+                pid_t pid = (pid_t)self->pid;
+                try {
+                    std::thread([pid] {
+                        while (waitpid(pid, nullptr, 0) < 0 && errno == EINTR);
+                    }).detach();
+                } catch (const std::system_error &) {} // cannot start the thread: the zombie remains until this process exits
+            }
+            if (self->pidfd >= 0) close(self->pidfd);
+            delete self;
+        }
+
+        __export bool os_process_wait(os_process_t *self, int timeout) {
+            return __pump(&self, 1, -1, timeout) == 0;
+        }
+
+        __export long os_process_waitany(os_process_t **procs, size_t n, int timeout) {
+            return __pump(procs, n, -1, timeout);
+        }
+
+        __export bool os_process_kill(os_process_t *self, int signal) {
+            return !__reap(self) && 0 == kill((pid_t)self->pid, signal);
+        }
+
+        __export void os_process_closefd(os_process_t *self, int index) {
+            if (index == 0 && !self->input.empty()) __pump(&self, 1, 0, -1);
+            if (self->readers[index]) {
+                fs_reader_close(self->readers[index]);
+                self->readers[index] = nullptr;
+            }
+            if (self->fds[index] >= 0) {
+                close(self->fds[index]);
+                self->fds[index] = -1;
+            }
+        }
+
+        __export bool os_process_write(os_process_t *self, const char *data, size_t size, int timeout) {
+            if (self->modes[0] != OS_SPAWN_PIPE || self->fds[0] < 0) return false;
+            self->input.append(data, size);
+            __writeinput(self);
+            if (self->input.size() > __PROCESS_INPUT_MAX && __pump(&self, 1, 0, timeout) < 0) return false; // backpressure
+            return self->fds[0] >= 0;
+        }
+
+        __export bool os_process_flush(os_process_t *self, int timeout) {
+            return __pump(&self, 1, 0, timeout) == 0 && self->fds[0] >= 0;
+        }
+
+        __export const char *os_process_readline(os_process_t *self, int index, size_t *len, int timeout) {
+            fs_reader_t *reader = self->readers[index];
+            if (reader == nullptr) return nullptr;
+
+            auto start = std::chrono::steady_clock::now();
+            for (;;) {
+                const char *line = fs_reader_readline(reader, len);
+                if (line || reader->is_eof) return line;
+                if (__pump(&self, 1, index, __remaining(start, timeout)) < 0) return nullptr;
+            }
+        }
+
+        __export long long os_process_read(os_process_t *self, int index, char *dest, size_t size, int timeout) {
+            fs_reader_t *reader = self->readers[index];
+            if (reader == nullptr) return 0;
+
+            auto start = std::chrono::steady_clock::now();
+            for (;;) {
+                size_t n = fs_reader_read(reader, dest, size);
+                if (n > 0 || size == 0 || reader->is_eof) return (long long)n;
+                if (__pump(&self, 1, index, __remaining(start, timeout)) < 0) return -1;
+            }
+        }
+
+        __export bool os_process_eof(os_process_t *self, int index) {
+            fs_reader_t *reader = self->readers[index];
+            return reader == nullptr || (reader->is_eof && reader->begin == reader->end);
+        }
+
+        __export int os_process_pollfds(os_process_t *self, int *fds, bool *isWritable) {
+            if (!self->is_exited && self->pidfd < 0) return -1;
+
+            int count = 0;
+            if (!self->input.empty() && self->fds[0] >= 0) {
+                fds[count] = self->fds[0];
+                isWritable[count++] = true;
+            }
+            for (int i = 1; i < 3; ++i) {
+                bool isReadable = self->modes[i] == OS_SPAWN_PIPE ? self->readers[i] && !self->readers[i]->is_eof : self->modes[i] == OS_SPAWN_CAPTURE && self->fds[i] >= 0;
+                if (!isReadable) continue;
+                fds[count] = self->fds[i];
+                isWritable[count++] = false;
+            }
+            if (!self->is_exited) {
+                fds[count] = self->pidfd;
+                isWritable[count++] = false;
+            }
+            return count;
+        }
+
+        __export const char *os_process_output(os_process_t *self, int index, size_t *size) {
+            if (self->modes[index] == OS_SPAWN_CAPTURE) __collect(self, index);
+            *size = self->outputs[index].size();
+            return self->outputs[index].c_str();
+        }
+    #endif
+
+    __export bool os_process_poll(os_process_t *self) {
+        return os_process_wait(self, 0);
+    }
+
+    __export int os_process_exitcode(os_process_t *self) {
+        return self->exitcode;
+    }
+
+    __export long os_process_pid(os_process_t *self) {
+        return self->pid;
+    }
+
+    __export int os_process_fd(os_process_t *self, int index) {
+        return self->modes[index] == OS_SPAWN_PIPE ? self->fds[index] : -1;
+    }
+}
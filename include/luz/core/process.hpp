@@ -0,0 +1,127 @@
+﻿#pragma once
+
+#include "filesystem.hpp"
+#include <string>
+
+#ifdef _WINDOWS
+    #include <thread>
+    #include <mutex>
+    #include <condition_variable>
+#endif
+
+extern "C" {
+    /// how the standard stream of the child process is connected
+    enum {
+        OS_SPAWN_INHERIT = 0, // share the stream of the parent process
+        OS_SPAWN_PIPE = 1,    // create a pipe (os_process_write / os_process_read / os_process_readline)
+        OS_SPAWN_NULL = 2,    // connect to the null device
+        OS_SPAWN_CAPTURE = 3, // create a pipe, and collect the output while polling / waiting (os_process_output)
+        OS_SPAWN_STDOUT = 4,  // (stderr only) redirect into the stdout
+    };
+
+    /// structure of child process
+    typedef struct {
+        #ifdef _WINDOWS
+            HANDLE handle;
+            std::thread collectors[3]; // threads reading stdout / stderr (anonymous pipe cannot be polled)
+            std::mutex mutex; // lock of outputs, is_closed
+            std::condition_variable arrived; // notified when the output arrives
+            bool is_closed[3]; // the collector has reached EOF
+            size_t offsets[3]; // read position of outputs for OS_SPAWN_PIPE
+            std::string lines[3]; // the last line returned by os_process_readline
+        #else
+            int pidfd; // -1 if pidfd_open is not supported
+            fs_reader_t *readers[3]; // buffered readers of OS_SPAWN_PIPE (the descriptors are non-blocking)
+        #endif
+        long pid;
+        int fds[3];   // pipes of stdin, stdout, stderr (-1: not piped)
+        int modes[3]; // OS_SPAWN_*
+        std::string outputs[3]; // collected output of OS_SPAWN_CAPTURE (and unread output of OS_SPAWN_PIPE on Windows)
+        std::string input; // data waiting to be written into the stdin
+        bool is_exited;
+        int exitcode;
+    } os_process_t;
+
+    /// spawn the child process without shell
+    // * the executable is searched in the PATH environment variable if argv[0] has no directory separator
+    // @param env: "NAME=VALUE" entries which are added to the environment of the current process (nullptr: inherit)
+    // @param cwd: working directory of the child process (nullptr: current directory)
+    // @param modes: OS_SPAWN_* of stdin, stdout, stderr (nullptr: inherit all)
+    // @return nullptr if the process cannot be spawned (errno is set)
+    __export os_process_t *os_spawn(const char **argv, size_t argc, const char **env, size_t nenv, const char *cwd, const int *modes);
+
+    /// close the pipes and release the process handle
+    // * the process is not killed: use os_process_kill before closing if required
+    // * POSIX: the running process is reaped by a background thread when it exits (no zombie remains)
+    __export void os_process_close(os_process_t *self);
+
+    /// check whether the process has exited without blocking
+    __export bool os_process_poll(os_process_t *self);
+
+    /// wait for the process to exit
+    // * the pending input is written, and the outputs of OS_SPAWN_PIPE are read into the buffers while waiting
+    // @param timeout: milliseconds to wait (-1: infinite)
+    // @return false if timed out
+    __export bool os_process_wait(os_process_t *self, int timeout);
+
+    /// wait for any of the processes to exit
+    // @param timeout: milliseconds to wait (-1: infinite)
+    // @return index of the exited process (-1: timed out or all processes have exited before)
+    __export long os_process_waitany(os_process_t **procs, size_t n, int timeout);
+
+    /// get the exit code of the exited process
+    // @return exit status, or -(signal number) if the process is terminated by the signal
+    __export int os_process_exitcode(os_process_t *self);
+
+    /// get the process id
+    __export long os_process_pid(os_process_t *self);
+
+    /// send the signal to the process (the process is terminated on Windows)
+    __export bool os_process_kill(os_process_t *self, int signal);
+
+    /// get the pipe of the standard stream (0: stdin, 1: stdout, 2: stderr)
+    // * the descriptor is non-blocking on POSIX, and the output may have been read into the buffer already: use it only to wait for readiness
+    // @return -1 if the stream is not OS_SPAWN_PIPE
+    __export int os_process_fd(os_process_t *self, int index);
+
+    /// get the descriptors to wait for the progress of the process in an event loop
+    // * wait for any of them to be ready (writable if isWritable[i], otherwise readable), then call os_process_poll / os_process_readline with timeout = 0
+    // @param fds, isWritable: arrays which have 4 elements (pending stdin, stdout, stderr, exit of the process)
+    // @return count of the descriptors, -1 if the exit cannot be waited for with a descriptor (Windows, or Linux older than 5.3): poll periodically instead
+    __export int os_process_pollfds(os_process_t *self, int *fds, bool *isWritable);
+
+    /// flush the pending input, and close the pipe of the standard stream (e.g. close the stdin to send EOF)
+    // * blocks until the child reads all the pending input: call os_process_flush with timeout before it if the child may not read
+    __export void os_process_closefd(os_process_t *self, int index);
+
+    /// write the data into the stdin without blocking on the child
+    // * the data is queued and written while reading / waiting; it blocks only while more than 1 MiB is pending (backpressure)
+    // * the outputs are read into the buffers while blocking, so the child never blocks on the full stdout / stderr
+    // * Windows: the data is written synchronously (timeout is not supported)
+    // @param timeout: milliseconds to block while more than 1 MiB is pending (-1: infinite)
+    // @return false if the stdin is not OS_SPAWN_PIPE, the child has closed it, or timed out (the data remains queued)
+    __export bool os_process_write(os_process_t *self, const char *data, size_t size, int timeout);
+
+    /// write all the pending input into the stdin
+    // @param timeout: milliseconds to wait (-1: infinite)
+    // @return false if timed out or the child has closed the stdin
+    __export bool os_process_flush(os_process_t *self, int timeout);
+
+    /// read one line (separated by "\n" or "\r\n") from the stdout / stderr of OS_SPAWN_PIPE
+    // * the pending input is written and the other output is buffered while waiting
+    // @param timeout: milliseconds to wait for a whole line (-1: infinite)
+    // @return pointer to the line (valid until the next call), nullptr if timed out or EOF (check os_process_eof)
+    __export const char *os_process_readline(os_process_t *self, int index, size_t *len, int timeout);
+
+    /// read the available data (at most size) from the stdout / stderr of OS_SPAWN_PIPE
+    // @param timeout: milliseconds to wait for any data (-1: infinite)
+    // @return read size (0: EOF, -1: timed out)
+    __export long long os_process_read(os_process_t *self, int index, char *dest, size_t size, int timeout);
+
+    /// identifies if all the output of the stdout / stderr has been read
+    __export bool os_process_eof(os_process_t *self, int index);
+
+    /// get the collected output of OS_SPAWN_CAPTURE
+    // * the output is complete after the process has exited
+    __export const char *os_process_output(os_process_t *self, int index, size_t *size);
+}
@@ -0,0 +1,176 @@
+﻿#include "shared.hpp"
+#include <mutex>
+#include <atomic>
+#include <list>
+#include <unordered_map>
+
+/// @private count of the shards (each shard has own lock)
+static const size_t __SHARED_SHARDS = 64;
+
+/// @private bytes counted for each entry in addition to the key and the blob
+static const size_t __SHARED_OVERHEAD = sizeof(double);
+
+/// @private entry of the shard
+struct __shared_entry_t {
+    shared_value_t value;
+    std::list<std::string>::iterator order; // position in the LRU list
+};
+
+/// @private shard of the store
+struct __shared_shard_t {
+    std::mutex mutex;
+    std::unordered_map<std::string, __shared_entry_t> entries;
+    std::list<std::string> order; // keys (the most recently used first)
+};
+
+/// @private shards, total bytes and byte budget of the store
+static __shared_shard_t __shards[__SHARED_SHARDS];
+static std::atomic<size_t> __bytes(0), __count(0), __budget(0);
+
+/// @private next shard to evict the entry (round robin)
+static std::atomic<size_t> __cursor(0);
+
+/*** ================================================== ***/
+/*** @private shared store helpers ***/
+
+/// @private get the shard of the key
+static __shared_shard_t &__shard(const std::string &key) {
+    return __shards[std::hash<std::string>()(key) % __SHARED_SHARDS];
+}
+
+/// @private bytes of the entry
+static size_t __sizeof(const std::string &key, const shared_value_t &value) {
+    return key.size() + value.blob.size() + __SHARED_OVERHEAD;
+}
+
+/// @private remove the entry (the shard must be locked)
+static void __erase(__shared_shard_t &shard, std::unordered_map<std::string, __shared_entry_t>::iterator it) {
+    __bytes -= __sizeof(it->first, it->second.value);
+    --__count;
+    shard.order.erase(it->second.order);
+    shard.entries.erase(it);
+}
+
+/// @private store the value (the shard must be locked)
+// * the existing entry remains if the value is larger than the budget
+static bool __store(__shared_shard_t &shard, const std::string &key, shared_value_t &&value) {
+    size_t size = __sizeof(key, value), budget = __budget;
+    if (value.type != SHARED_NONE && budget > 0 && size > budget) return false;
+
+    auto it = shard.entries.find(key);
+    if (it != shard.entries.end()) __erase(shard, it);
+    if (value.type == SHARED_NONE) return true;
+
+    shard.order.push_front(key);
+    shard.entries.emplace(key, __shared_entry_t{std::move(value), shard.order.begin()});
+    __bytes += size;
+    ++__count;
+    return true;
+}
+
+/// @private evict the least recently used entries of the shards in turn while the store is beyond the budget
+// @param keep: key not to be evicted (just stored)
+// * must be called without locking any shard
+static void __evict(const std::string &keep) {
+    for (size_t misses = 0; misses < __SHARED_SHARDS;) {
+        size_t budget = __budget;
+        if (budget == 0 || __bytes <= budget) return;
+
+        __shared_shard_t &shard = __shards[__cursor++ % __SHARED_SHARDS];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.order.empty() || (shard.order.back() == keep && shard.order.size() == 1)) {
+            ++misses;
+            continue;
+        }
+        misses = 0;
+        auto it = shard.entries.find(shard.order.back() == keep ? *std::prev(shard.order.end(), 2) : shard.order.back());
+        __erase(shard, it);
+    }
+}
+
+/*** ================================================== ***/
+
+extern "C" {
+    __export void shared_budget(size_t bytes) {
+        __budget = bytes;
+        __evict("");
+    }
+
+    __export size_t shared_bytes() {
+        return __bytes;
+    }
+
+    __export size_t shared_count() {
+        return __count;
+    }
+
+    __export bool shared_remove(const char *key, size_t keysize) {
+        std::string name(key, keysize);
+        __shared_shard_t &shard = __shard(name);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.entries.find(name);
+        if (it == shard.entries.end()) return false;
+        __erase(shard, it);
+        return true;
+    }
+
+    __export void shared_clear() {
+        for (auto &shard : __shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            while (!shard.entries.empty()) __erase(shard, shard.entries.begin());
+        }
+    }
+}
+
+/*** ================================================== ***/
+/*** utility functions for C++ ***/
+
+bool shared_get(const std::string &key, shared_value_t &dest) {
+    __shared_shard_t &shard = __shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) return false;
+    shard.order.splice(shard.order.begin(), shard.order, it->second.order);
+    dest = it->second.value;
+    return true;
+}
+
+bool shared_set(const std::string &key, shared_value_t value) {
+    __shared_shard_t &shard = __shard(key);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (!__store(shard, key, std::move(value))) return false;
+    }
+    __evict(key);
+    return true;
+}
+
+bool shared_cas(const std::string &key, const shared_value_t &expected, shared_value_t value) {
+    __shared_shard_t &shard = __shard(key);
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end() ? expected.type != SHARED_NONE : !(it->second.value == expected)) return false;
+    bool isStored = __store(shard, key, std::move(value));
+    lock.unlock();
+    if (isStored) __evict(key);
+    return isStored;
+}
+
+bool shared_incr(const std::string &key, double delta, double &result) {
+    __shared_shard_t &shard = __shard(key);
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        shared_value_t value;
+        value.type = SHARED_NUMBER;
+        value.number = result = delta;
+        bool isStored = __store(shard, key, std::move(value));
+        lock.unlock();
+        if (isStored) __evict(key);
+        return isStored;
+    }
+    if (it->second.value.type != SHARED_NUMBER) return false;
+    shard.order.splice(shard.order.begin(), shard.order, it->second.order);
+    result = it->second.value.number += delta;
+    return true;
+}
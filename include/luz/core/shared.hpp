@@ -0,0 +1,63 @@
+﻿#pragma once
+
+#include "os.hpp"
+#include <string>
+
+extern "C" {
+    /// type of the shared value
+    enum {
+        SHARED_NONE = 0,   // not stored
+        SHARED_NUMBER = 1, // number (incremented atomically)
+        SHARED_BLOB = 2,   // immutable bytes (e.g. serialized Lua values)
+    };
+
+    /// set the byte budget of the shared store
+    // @param bytes: max bytes of the keys and values (0: unlimited)
+    // * least recently used entries are evicted beyond the budget (approximately: LRU order is kept in each shard, and the shards are evicted in turn)
+    __export void shared_budget(size_t bytes);
+
+    /// get the bytes of the keys and values stored in the shared store
+    __export size_t shared_bytes();
+
+    /// get the count of the entries in the shared store
+    __export size_t shared_count();
+
+    /// remove the entry of the shared store
+    // @return false if not stored
+    __export bool shared_remove(const char *key, size_t keysize);
+
+    /// remove all the entries of the shared store
+    __export void shared_clear();
+}
+
+/*** ================================================== ***/
+/*** utility functions and classes for C++ ***/
+
+/// value of the shared store
+struct shared_value_t {
+    int type = SHARED_NONE;
+    double number = 0;
+    std::string blob;
+
+    bool operator==(const shared_value_t &other) const {
+        if (type != other.type) return false;
+        if (type == SHARED_NUMBER) return number == other.number;
+        return type == SHARED_NONE || blob == other.blob;
+    }
+};
+
+/// get the value from the process-global store shared by all threads
+// @return false if not stored
+bool shared_get(const std::string &key, shared_value_t &dest);
+
+/// set the value (SHARED_NONE: remove)
+// @return false if the value is larger than the byte budget (not stored)
+bool shared_set(const std::string &key, shared_value_t value);
+
+/// set the value only if the current value equals to expected (SHARED_NONE: not stored)
+// @return false if the current value is different, or the value is larger than the byte budget
+bool shared_cas(const std::string &key, const shared_value_t &expected, shared_value_t value);
+
+/// add delta to the number atomically (the entry which is not stored starts from 0)
+// @return false if the value is not a number
+bool shared_incr(const std::string &key, double delta, double &result);
@@ -198,10 +198,33 @@ extern "C" {
         0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
     };
 
+    /// crc32 tables for slicing-by-8: __crc32slices()[k][i] = crc of byte i followed by k zero bytes
+    static const unsigned long (*__crc32slices())[256] {
+        static unsigned long tables[8][256];
+        static bool isInitialized = [] {
+            for (int i = 0; i < 256; ++i) tables[0][i] = __crc32table[i];
+            for (int k = 1; k < 8; ++k) {
+                for (int i = 0; i < 256; ++i) tables[k][i] = (tables[k - 1][i] >> 8) ^ __crc32table[tables[k - 1][i] & 0xFF];
+            }
+            return true;
+        }();
+        (void)isInitialized;
+        return tables;
+    }
+
     __export unsigned long get_crc32(const char *data, size_t datasize, unsigned long start) {
+        const unsigned long (*t)[256] = __crc32slices();
         unsigned long result = start;
         unsigned char *p = (unsigned char*)data;
         
+        // 8 bytes per step
+        if (((unsigned long long)result >> 32) == 0) { // crc fits in 32 bits (start is usually 0xffffffff)
+            for (; datasize >= 8; datasize -= 8, p += 8) {
+                unsigned long one = result ^ ((unsigned long)p[0] | ((unsigned long)p[1] << 8) | ((unsigned long)p[2] << 16) | ((unsigned long)p[3] << 24));
+                result = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][(one >> 24) & 0xFF]
+                    ^ t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+            }
+        }
         for (; datasize-- > 0; ++p) {
             result = (result >> 8) ^ __crc32table[(*p) ^ (result & 0xFF)];
         }
@@ -0,0 +1,118 @@
+﻿#include "thread.hpp"
+
+/// @private worker index of the current thread in the pool
+static thread_local const thread_pool_t *__current_pool = nullptr;
+static thread_local size_t __current_index = 0;
+
+size_t thread_pool_t::hardware_threads() {
+    size_t n = std::thread::hardware_concurrency();
+    return n > 0 ? n : 1;
+}
+
+thread_pool_t::thread_pool_t(size_t threads): queued(0), pending(0), next(0), stopping(false) {
+    if (threads == 0) threads = hardware_threads();
+    for (size_t i = 0; i < threads; ++i) queues.emplace_back(new queue_t);
+    for (size_t i = 0; i < threads; ++i) workers.emplace_back(&thread_pool_t::run, this, i);
+}
+
+thread_pool_t::~thread_pool_t() {
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeup.notify_all();
+    for (auto &worker: workers) worker.join();
+}
+
+void thread_pool_t::push(std::function<void()> task) {
+    // push into own queue if the task is pushed from the worker, otherwise distribute in round robin
+    size_t index = __current_pool == this ? __current_index : next++ % workers.size();
+    
+    ++pending;
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    {
+        // lock to avoid lost wakeup between checking `queued` and sleeping
+        std::lock_guard<std::mutex> lock(mutex);
+        ++queued;
+    }
+    wakeup.notify_one();
+}
+
+bool thread_pool_t::pop(size_t index, std::function<void()> &task) {
+    size_t count = queues.size();
+    if (index < count) { // own queue: LIFO
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        auto &tasks = queues[index]->tasks;
+        if (!tasks.empty()) {
+            task = std::move(tasks.back());
+            tasks.pop_back();
+            --queued;
+            return true;
+        }
+    }
+    for (size_t i = 1; i <= count; ++i) { // steal: FIFO (older tasks tend to be larger)
+        size_t victim = (index + i) % count;
+        std::lock_guard<std::mutex> lock(queues[victim]->mutex);
+        auto &tasks = queues[victim]->tasks;
+        if (!tasks.empty()) {
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            --queued;
+            return true;
+        }
+    }
+    return false;
+}
+
+void thread_pool_t::execute(std::function<void()> &task) {
+    try {
+        task();
+    } catch (...) {
+        // keep the counters consistent, and report the first exception by wait
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!firstexception) firstexception = std::current_exception();
+    }
+    task = nullptr;
+    if (--pending == 0) {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished.notify_all();
+    }
+}
+
+void thread_pool_t::run(size_t index) {
+    __current_pool = this;
+    __current_index = index;
+
+    std::function<void()> task;
+    for (;;) {
+        if (pop(index, task)) {
+            execute(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        wakeup.wait(lock, [this] { return stopping || queued > 0; });
+        if (stopping && queued == 0) return;
+    }
+}
+
+bool thread_pool_t::wait() {
+    std::function<void()> task;
+    size_t index = __current_pool == this ? __current_index : workers.size();
+    
+    while (pending > 0) {
+        if (pop(index, task)) {
+            execute(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this] { return pending == 0 || queued > 0; });
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    lastexception = std::move(firstexception);
+    firstexception = nullptr;
+    return !lastexception;
+}
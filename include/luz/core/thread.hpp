@@ -0,0 +1,70 @@
+﻿#pragma once
+
+#include "config.hpp"
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <exception>
+
+/*** ================================================== ***/
+/*** utility classes for C++ ***/
+
+/// work-stealing thread pool
+// * each worker has own task queue: the worker pops tasks from the back (LIFO) and steals tasks of other workers from the front (FIFO)
+// * tasks pushed from a worker thread go into the worker's queue, so recursive tasks (e.g. directory tree traversal) stay local
+class thread_pool_t {
+public:
+    /// @param threads: count of worker threads (0: count of hardware threads)
+    explicit thread_pool_t(size_t threads = 0);
+    ~thread_pool_t();
+
+    thread_pool_t(const thread_pool_t &) = delete;
+    thread_pool_t &operator =(const thread_pool_t &) = delete;
+
+    /// push a task
+    void push(std::function<void()> task);
+
+    /// wait until all tasks (including tasks pushed by the tasks) are completed
+    // * the calling thread also executes the queued tasks while waiting
+    // @return false if any task has thrown an exception since the last wait (get it by exception())
+    bool wait();
+
+    /// get the first exception thrown by the tasks since the last wait (nullptr if none)
+    std::exception_ptr exception() const { return lastexception; }
+
+    /// get count of worker threads
+    size_t size() const { return workers.size(); }
+
+    /// get count of hardware threads (at least 1)
+    static size_t hardware_threads();
+
+private:
+    struct queue_t {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<queue_t>> queues; // queues[i]: task queue of workers[i]
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeup, finished;
+    std::atomic<size_t> queued, pending; // count of tasks in the queues / count of uncompleted tasks
+    std::atomic<size_t> next; // round robin index for pushing from outside
+    std::exception_ptr firstexception, lastexception; // recorded by the tasks (guarded by mutex) / taken by wait
+    bool stopping;
+
+    /// pop a task from the queue of `index`, or steal a task from other queues
+    // * index >= size(): steal only (the thread is not a worker)
+    bool pop(size_t index, std::function<void()> &task);
+
+    /// execute the task and update counters
+    void execute(std::function<void()> &task);
+
+    /// worker thread main loop
+    void run(size_t index);
+};
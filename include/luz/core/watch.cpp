@@ -0,0 +1,288 @@
+﻿#include "watch.hpp"
+#include <chrono>
+#include <algorithm>
+
+#ifdef __linux__
+    #include <sys/inotify.h>
+    #include <poll.h>
+    #include <errno.h>
+#endif
+
+/// @private add the change into the batch (coalescing the changes of the same path)
+static void __watch_push(fs_watch_t *self, const std::string &path, int action) {
+    auto it = self->indices.find(path);
+    if (it == self->indices.end()) {
+        self->indices[path] = self->changes.size();
+        self->changes.push_back({path, action});
+        return;
+    }
+
+    int &flags = self->changes[it->second].second;
+    if (action == FS_WATCH_REMOVED) flags = (flags & FS_WATCH_CREATED) ? 0 : FS_WATCH_REMOVED; // 0: temporary file
+    else if (action == FS_WATCH_CREATED && (flags & FS_WATCH_REMOVED)) flags = (flags & ~FS_WATCH_REMOVED) | FS_WATCH_MODIFIED; // replaced
+    else if (action == FS_WATCH_MODIFIED && (flags & FS_WATCH_CREATED)) return;
+    else flags |= action;
+}
+
+/// @private remove the changes cancelled each other
+static size_t __watch_compact(fs_watch_t *self) {
+    auto end = std::remove_if(self->changes.begin(), self->changes.end(), [](const std::pair<std::string, int> &change) { return change.second == 0; });
+    self->changes.erase(end, self->changes.end());
+    self->indices.clear();
+    return self->changes.size();
+}
+
+#ifdef _WINDOWS
+    /// @private notification filter of ReadDirectoryChangesW
+    static const DWORD __WATCH_FILTER = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_ATTRIBUTES
+        | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_CREATION;
+
+    /// @private start reading changes of the directory
+    static bool __watch_arm(fs_watch_t *self, fs_watch_t::dir_t *dir) {
+        ResetEvent(dir->overlapped.hEvent);
+        return FALSE != ReadDirectoryChangesW(
+            dir->handle, &dir->buffer[0], (DWORD)(dir->buffer.size() * sizeof(DWORD)), self->is_recursive ? TRUE : FALSE,
+            __WATCH_FILTER, nullptr, &dir->overlapped, nullptr
+        );
+    }
+
+    /// @private close the directory handle
+    static void __watch_closedir(fs_watch_t::dir_t *dir) {
+        if (dir->handle != INVALID_HANDLE_VALUE) {
+            CancelIo(dir->handle);
+            CloseHandle(dir->handle);
+        }
+        if (dir->overlapped.hEvent != nullptr) CloseHandle(dir->overlapped.hEvent);
+    }
+
+    /// @private read the changes of the signaled directories into the batch
+    // @return false if no directory is signaled
+    static bool __watch_read(fs_watch_t *self, DWORD timeout) {
+        std::vector<HANDLE> events;
+        for (auto &dir : self->dirs) events.push_back(dir->overlapped.hEvent);
+
+        DWORD result = WaitForMultipleObjects((DWORD)events.size(), &events[0], FALSE, timeout);
+        if (result < WAIT_OBJECT_0 || result >= WAIT_OBJECT_0 + events.size()) return false;
+
+        for (auto &dir : self->dirs) {
+            DWORD size = 0;
+            if (WAIT_OBJECT_0 != WaitForSingleObject(dir->overlapped.hEvent, 0)) continue;
+            if (!GetOverlappedResult(dir->handle, &dir->overlapped, &size, FALSE) || size == 0) {
+                __watch_push(self, path_remove_slash(dir->root), FS_WATCH_OVERFLOW); // the buffer has overflowed
+            } else {
+                const char *p = (const char*)&dir->buffer[0];
+                while (true) {
+                    const FILE_NOTIFY_INFORMATION *info = (const FILE_NOTIFY_INFORMATION*)p;
+                    std::string path = dir->root + wcstou8(std::wstring(info->FileName, info->FileNameLength / sizeof(WCHAR)));
+                    switch (info->Action) {
+                    case FILE_ACTION_ADDED:
+                    case FILE_ACTION_RENAMED_NEW_NAME:
+                        __watch_push(self, path, FS_WATCH_CREATED);
+                        break;
+                    case FILE_ACTION_REMOVED:
+                    case FILE_ACTION_RENAMED_OLD_NAME:
+                        __watch_push(self, path, FS_WATCH_REMOVED);
+                        break;
+                    default:
+                        __watch_push(self, path, FS_WATCH_MODIFIED);
+                        break;
+                    }
+                    if (info->NextEntryOffset == 0) break;
+                    p += info->NextEntryOffset;
+                }
+            }
+            __watch_arm(self, dir.get());
+        }
+        return true;
+    }
+#elif defined(__linux__)
+    /// @private events of inotify to be watched
+    static const uint32_t __WATCH_MASK = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB
+        | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+
+    /// @private watch the directory (and the sub directories if recursive)
+    // @param isReported: true => report the entries in the directory as created (the directory has been created after starting)
+    static bool __watch_add(fs_watch_t *self, const std::string &dir, bool isReported) {
+        int wd = inotify_add_watch(self->fd, dir.c_str(), __WATCH_MASK);
+        if (wd < 0) return false;
+        self->dirs[wd] = dir;
+        if (!self->is_recursive && !isReported) return true;
+
+        // watch the directory first, and then list the entries: entries created in the meantime are not missed
+        fs_dirent_t *dirent = fs_opendir(dir.c_str());
+        if (dirent == nullptr) return true;
+
+        std::vector<std::pair<std::string, unsigned char>> entries;
+        fs_entry_t batch[128];
+        char pool[16 * 1024];
+        size_t n;
+        while ((n = fs_readdir_batch(dirent, batch, 128, pool, sizeof(pool))) > 0) {
+            for (size_t i = 0; i < n; ++i) entries.push_back({pool + batch[i].name_offset, batch[i].type});
+        }
+        fs_closedir(dirent);
+
+        for (auto &entry : entries) {
+            std::string path = dir + entry.first;
+            if (isReported) __watch_push(self, path, FS_WATCH_CREATED);
+            if (self->is_recursive && entry.second == FS_TYPE_DIR) __watch_add(self, path + "/", isReported);
+        }
+        return true;
+    }
+
+    /// @private read all available events into the batch
+    static void __watch_read(fs_watch_t *self) {
+        while (true) {
+            ssize_t size = read(self->fd, &self->buffer[0], self->buffer.size());
+            if (size <= 0) return; // EAGAIN: no event any more
+
+            for (char *p = &self->buffer[0]; p < &self->buffer[0] + size; ) {
+                const struct inotify_event *event = (const struct inotify_event*)p;
+                p += sizeof(struct inotify_event) + event->len;
+
+                if (event->mask & IN_Q_OVERFLOW) {
+                    for (auto &root : self->roots) __watch_push(self, path_remove_slash(root), FS_WATCH_OVERFLOW);
+                    continue;
+                }
+                auto it = self->dirs.find(event->wd);
+                if (it == self->dirs.end()) continue;
+                if (event->mask & IN_IGNORED) { // the directory has been removed
+                    self->dirs.erase(it);
+                    continue;
+                }
+                if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF)) {
+                    // changes of sub directories are reported by the parent directories
+                    if (std::find(self->roots.begin(), self->roots.end(), it->second) != self->roots.end()) {
+                        __watch_push(self, path_remove_slash(it->second), FS_WATCH_REMOVED);
+                    }
+                    continue;
+                }
+
+                std::string path = it->second + event->name;
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                    __watch_push(self, path, FS_WATCH_CREATED);
+                    if (self->is_recursive && (event->mask & IN_ISDIR)) __watch_add(self, path + "/", true);
+                } else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                    __watch_push(self, path, FS_WATCH_REMOVED);
+                } else {
+                    __watch_push(self, path, FS_WATCH_MODIFIED);
+                }
+            }
+        }
+    }
+
+    /// @private wait until the inotify descriptor becomes readable
+    static bool __watch_poll(fs_watch_t *self, int timeout) {
+        struct pollfd fd = {self->fd, POLLIN, 0};
+        int result;
+        while ((result = poll(&fd, 1, timeout)) < 0 && errno == EINTR) {}
+        return result > 0;
+    }
+#endif
+
+extern "C" {
+    __export fs_watch_t *fs_watch_open(const char **dirs, size_t ndirs, bool isRecursive) {
+        #if !defined(_WINDOWS) && !defined(__linux__)
+            return nullptr;
+        #else
+            fs_watch_t *self = new fs_watch_t;
+
+            self->is_recursive = isRecursive;
+            for (size_t i = 0; i < ndirs; ++i) self->roots.push_back(path_append_slash(std::string(dirs[i])));
+            #ifdef _WINDOWS
+                for (auto &root : self->roots) {
+                    std::unique_ptr<fs_watch_t::dir_t> dir(new fs_watch_t::dir_t);
+                    memset(&dir->overlapped, 0, sizeof(dir->overlapped));
+                    dir->root = root;
+                    dir->buffer.resize(16 * 1024);
+                    dir->handle = CreateFileW(
+                        u8towcs(root).c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                        nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr
+                    );
+                    dir->overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+                    bool isArmed = dir->handle != INVALID_HANDLE_VALUE && dir->overlapped.hEvent != nullptr && __watch_arm(self, dir.get());
+                    self->dirs.push_back(std::move(dir));
+                    if (!isArmed) {
+                        fs_watch_close(self);
+                        return nullptr;
+                    }
+                }
+            #else
+                self->buffer.resize(64 * 1024);
+                self->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+                if (self->fd < 0) {
+                    delete self;
+                    return nullptr;
+                }
+                for (auto &root : self->roots) {
+                    if (!__watch_add(self, root, false)) {
+                        fs_watch_close(self);
+                        return nullptr;
+                    }
+                }
+            #endif
+            return self;
+        #endif
+    }
+
+    __export void fs_watch_close(fs_watch_t *self) {
+        if (self == nullptr) return;
+        #ifdef _WINDOWS
+            for (auto &dir : self->dirs) __watch_closedir(dir.get());
+        #elif defined(__linux__)
+            close(self->fd);
+        #endif
+        delete self;
+    }
+
+    __export size_t fs_watch_next(fs_watch_t *self, int timeout, int debounce) {
+        #if !defined(_WINDOWS) && !defined(__linux__)
+            return 0;
+        #else
+            auto start = std::chrono::steady_clock::now();
+
+            self->changes.clear();
+            self->indices.clear();
+            while (true) {
+                // wait for the first change
+                int remaining = timeout;
+                if (timeout > 0) {
+                    remaining = timeout - (int)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+                    if (remaining < 0) remaining = 0;
+                }
+                #ifdef _WINDOWS
+                    if (!__watch_read(self, remaining < 0 ? INFINITE : (DWORD)remaining)) return 0;
+                #else
+                    if (!__watch_poll(self, remaining)) return 0;
+                    __watch_read(self);
+                #endif
+
+                // collect changes until no change arrives for debounce milliseconds
+                auto limit = std::chrono::steady_clock::now() + std::chrono::milliseconds(debounce * 10);
+                while (debounce > 0 && std::chrono::steady_clock::now() < limit) {
+                    #ifdef _WINDOWS
+                        if (!__watch_read(self, (DWORD)debounce)) break;
+                    #else
+                        if (!__watch_poll(self, debounce)) break;
+                        __watch_read(self);
+                    #endif
+                }
+                if (__watch_compact(self) > 0 || timeout == 0) return self->changes.size();
+                // all changes have been cancelled: wait again
+            }
+        #endif
+    }
+
+    __export const char *fs_watch_get(fs_watch_t *self, size_t index, int *action) {
+        if (index >= self->changes.size()) return nullptr;
+        *action = self->changes[index].second;
+        return self->changes[index].first.c_str();
+    }
+
+    __export int fs_watch_fd(fs_watch_t *self) {
+        #if defined(__linux__)
+            return self->fd;
+        #else
+            return -1;
+        #endif
+    }
+}
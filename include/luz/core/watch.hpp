@@ -0,0 +1,61 @@
+﻿#pragma once
+
+#include "filesystem.hpp"
+#include <unordered_map>
+#include <memory>
+
+extern "C" {
+    /// kinds of change (bit flags)
+    enum {
+        FS_WATCH_CREATED = 1,  // created or moved into the watched directory
+        FS_WATCH_MODIFIED = 2, // data or attributes changed (or removed and created again)
+        FS_WATCH_REMOVED = 4,  // removed or moved out of the watched directory
+        FS_WATCH_OVERFLOW = 8, // events were lost: the path is the watched directory, rescan it
+    };
+
+    /// structure of file system watcher
+    typedef struct {
+        #ifdef _WINDOWS
+            /// watched directory tree
+            struct dir_t {
+                HANDLE handle;
+                OVERLAPPED overlapped;
+                std::vector<DWORD> buffer; // FILE_NOTIFY_INFORMATION (DWORD-aligned)
+                std::string root; // with trailing separator
+            };
+            std::vector<std::unique_ptr<dir_t>> dirs;
+        #else
+            int fd; // inotify descriptor
+            std::unordered_map<int, std::string> dirs; // watch descriptor => directory (with trailing separator)
+            std::vector<char> buffer;
+        #endif
+        std::vector<std::string> roots; // watched directories (with trailing separator)
+        bool is_recursive;
+        std::vector<std::pair<std::string, int>> changes; // (path, FS_WATCH_*) of the last batch
+        std::unordered_map<std::string, size_t> indices;  // path => index of changes
+    } fs_watch_t;
+
+    /// start watching the directories
+    // * on Linux, new sub directories are watched automatically and the entries in them are reported as created
+    // @param isRecursive: true => watch the sub directories too
+    // @return nullptr if any directory cannot be watched (or the platform is not supported)
+    __export fs_watch_t *fs_watch_open(const char **dirs, size_t ndirs, bool isRecursive);
+
+    /// stop watching
+    __export void fs_watch_close(fs_watch_t *self);
+
+    /// wait for changes, and collect them into one batch
+    // * changes of the same path are coalesced (created and removed => not reported, created and modified => created, modified and removed => removed)
+    // @param timeout: milliseconds to wait for the first change (-1: infinite, 0: no wait)
+    // @param debounce: milliseconds to keep collecting after the last change (the batch is closed after 10 x debounce at most)
+    // @return count of changes in the batch (0: timed out)
+    __export size_t fs_watch_next(fs_watch_t *self, int timeout, int debounce);
+
+    /// get the change in the last batch
+    // @param action: FS_WATCH_*
+    // @return path (the watched directory + relative path), nullptr if index is out of range
+    __export const char *fs_watch_get(fs_watch_t *self, size_t index, int *action);
+
+    /// get the descriptor which becomes readable when changes arrive (-1 on Windows)
+    __export int fs_watch_fd(fs_watch_t *self);
+}
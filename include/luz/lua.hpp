@@ -19,9 +19,152 @@ bool lua_registlib(sol::state &lua, std::string *errorMessage);
 /// Execute interactive lua
 void lua_dotty(sol::state &lua, const std::string &progname = "luz");
 
+/// Serialize the values of the stack [first, last] into dest (appended)
+// * nil, boolean, number, string, table (the metatable is dropped), light userdata and cdata (encoded by the luz library) are supported
+// * the table which has `__pack` method is serialized as `kind, value = table:__pack()`, and restored by the luz library (e.g. luz.channel)
+//   only if isTransfer: __pack moves the reference into the data, so the data must be deserialized exactly once (e.g. luz.thread, luz.channel)
+// * raises the Lua error if any value cannot be serialized (e.g. function, recursive table)
+// @return count of the objects moved into dest (deserialize dest to release them if it's discarded)
+size_t lua_serialize(lua_State *L, int first, int last, std::string &dest, bool isTransfer = false);
+
+/// Push the values serialized by lua_serialize
+// * raises the Lua error if the data is broken
+// @return count of the pushed values
+int lua_deserialize(lua_State *L, const char *data, size_t size);
+
+
+/*** ================================================== ***/
+/*** utility classes for C++ ***/
+
+/// pool of worker threads which have own Lua state initialized by lua_registlib
+// * jobs are distributed by the work-stealing thread pool, and the state of the worker is reused by the jobs (globals remain)
+// * arguments and results cross threads as the data serialized by lua_serialize (moved, not copied)
+class lua_thread_pool_t {
+public:
+    /// job which runs the chunk in the worker
+    struct job_t {
+        std::string code, chunkname; // Lua source or bytecode (string.dump)
+        std::string args, results;   // serialized values (results: error message if isError)
+        bool isError, isDone, isReleased;
+    };
+
+    /// @param threads: count of worker threads (0: count of hardware threads)
+    explicit lua_thread_pool_t(size_t threads = 0);
+
+    /// the queued jobs are cancelled, and the running jobs are waited for
+    ~lua_thread_pool_t();
+
+    lua_thread_pool_t(const lua_thread_pool_t &) = delete;
+    lua_thread_pool_t &operator =(const lua_thread_pool_t &) = delete;
+
+    /// start the job: the chunk is called with the arguments in the worker
+    // @return job id
+    unsigned int submit(std::string code, std::string chunkname, std::string args);
+
+    /// wait for the job to finish
+    // @param timeout: milliseconds (-1: infinite)
+    // @return false if timed out
+    bool wait(unsigned int id, int timeout);
+
+    /// take the finished job (nullptr if it's not finished or unknown)
+    std::unique_ptr<job_t> take(unsigned int id);
+
+    /// release the job without taking the results (it's freed when finished)
+    void release(unsigned int id);
+
+    /// get count of worker threads
+    size_t size() const { return pool->size(); }
+
+private:
+    std::unique_ptr<thread_pool_t> pool;
+    std::unordered_map<unsigned int, std::unique_ptr<job_t>> jobs;
+    std::mutex mutex; // lock of jobs, isStopping
+    std::condition_variable finished;
+    unsigned int nextid;
+    bool isStopping;
+
+    /// run the job in the state of the current worker
+    void execute(job_t *job);
+};
+
+/// pool of Lua states initialized by lua_registlib (hosts running many short scripts skip the initialization)
+// * the state is reset to the baseline snapshot taken after the initialization when the lease is returned:
+//   globals, fields of the global tables (e.g. string.*) and package.loaded which are added / replaced are restored
+// * metatables and upvalues of the libraries are not restored
+// e.g.
+//     lua_state_pool_t pool(4);
+//     {
+//         auto lease = pool.acquire();
+//         lease->safe_script("print(fs.path.normalize'a/../b')");
+//     } // returned into the pool
+class lua_state_pool_t {
+public:
+    /// RAII lease of the state: returned into the pool by the destructor
+    class lease_t {
+    public:
+        lease_t(): pool(nullptr) {}
+        lease_t(lease_t &&other) noexcept: pool(other.pool), state(std::move(other.state)) { other.pool = nullptr; }
+        lease_t &operator =(lease_t &&other) noexcept;
+        ~lease_t() { release(); }
+
+        lease_t(const lease_t &) = delete;
+        lease_t &operator =(const lease_t &) = delete;
+
+        sol::state &operator *() const { return *state; }
+        sol::state *operator ->() const { return state.get(); }
+        lua_State *lua_state() const { return state->lua_state(); }
+        explicit operator bool() const { return state != nullptr; }
+
+        /// return the state into the pool (reset to the baseline)
+        void release();
+
+        /// close the state instead of returning it (e.g. the state is broken by the script)
+        void discard() { state.reset(); }
+
+    private:
+        friend class lua_state_pool_t;
+        lease_t(lua_state_pool_t *pool, std::unique_ptr<sol::state> state): pool(pool), state(std::move(state)) {}
+
+        lua_state_pool_t *pool;
+        std::unique_ptr<sol::state> state;
+    };
+
+    /// @param states: count of the states initialized in advance, and max count of the idle states kept in the pool
+    // @param errorMessage: error message of lua_registlib (no state is kept if it fails)
+    explicit lua_state_pool_t(size_t states, std::string *errorMessage = nullptr);
+
+    /// the leases must be released before the pool is destroyed
+    ~lua_state_pool_t() = default;
+
+    lua_state_pool_t(const lua_state_pool_t &) = delete;
+    lua_state_pool_t &operator =(const lua_state_pool_t &) = delete;
+
+    /// lease the idle state (a new state is initialized if no state is idle)
+    // @param errorMessage: error message of lua_registlib
+    // @return empty lease if the initialization fails
+    lease_t acquire(std::string *errorMessage = nullptr);
+
+    /// get count of the idle states
+    size_t idle();
+
+private:
+    std::vector<std::unique_ptr<sol::state>> states; // idle states
+    std::mutex mutex; // lock of states
+    size_t capacity;
+
+    /// initialize the state, and take the baseline snapshot
+    static std::unique_ptr<sol::state> create(std::string *errorMessage);
+
+    /// reset the state to the baseline, and keep it if the pool is not full
+    void restore(std::unique_ptr<sol::state> state);
+};
+
 
 /*** include source files macro ***/
 #ifdef _USE_LUZ_LUA
     #include "lua/registlib.cpp"
     #include "lua/dotty.cpp"
+    #include "lua/serialize.cpp"
+    #include "lua/thread.cpp"
+    #include "lua/statepool.cpp"
 #endif
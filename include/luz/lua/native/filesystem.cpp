@@ -0,0 +1,31 @@
+﻿/*** native functions of the filesystem library (Lua C API) ***/
+
+/// @private fs.readfile(filename, size)
+static int luz_fs_readfile(lua_State *L) {
+    const char *filename = luaL_checkstring(L, 1);
+    long long size = (long long)luaL_optnumber(L, 2, -1);
+
+    bool isRead = fs_readfile(filename, size, [L](const char *data, size_t size) {
+        lua_pushlstring(L, data, size);
+    });
+    if (!isRead) lua_pushliteral(L, "");
+    return 1;
+}
+
+/// register native functions into the global `fs` table
+static void luaopen_luz_filesystem(lua_State *L) {
+    static const luaL_Reg functions[] = {
+        {"readfile", luz_fs_readfile},
+        {nullptr, nullptr},
+    };
+
+    lua_getglobal(L, "fs");
+    if (!lua_istable(L, -1)) {
+        lua_pop(L, 1);
+        lua_newtable(L);
+        lua_pushvalue(L, -1);
+        lua_setglobal(L, "fs");
+    }
+    luaL_register(L, nullptr, functions);
+    lua_pop(L, 1);
+}
@@ -0,0 +1,331 @@
+﻿/*** native functions of the luz library (Lua C API) ***/
+
+/// @private luz.serialize(...)
+static int luz_serialize(lua_State *L) {
+    std::string data;
+    lua_serialize(L, 1, lua_gettop(L), data);
+    lua_pushlstring(L, data.data(), data.size());
+    return 1;
+}
+
+/// @private luz.deserialize(data)
+static int luz_deserialize(lua_State *L) {
+    size_t size;
+    const char *data = luaL_checklstring(L, 1, &size);
+    lua_settop(L, 1);
+    return lua_deserialize(L, data, size);
+}
+
+/// @private get the thread pool of the first argument
+static lua_thread_pool_t *__checkpool(lua_State *L) {
+    luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+    return (lua_thread_pool_t*)lua_touserdata(L, 1);
+}
+
+/// @private thread_open(threads) => pool
+static int luz_thread_open(lua_State *L) {
+    lua_pushlightuserdata(L, new lua_thread_pool_t((size_t)luaL_optnumber(L, 1, 0)));
+    return 1;
+}
+
+/// @private thread_close(pool)
+static int luz_thread_close(lua_State *L) {
+    delete __checkpool(L);
+    return 0;
+}
+
+/// @private thread_size(pool) => count of worker threads
+static int luz_thread_size(lua_State *L) {
+    lua_pushnumber(L, (lua_Number)__checkpool(L)->size());
+    return 1;
+}
+
+/// @private thread_submit(pool, code, chunkname, ...) => job id
+// * the arguments are serialized from the stack directly
+static int luz_thread_submit(lua_State *L) {
+    lua_thread_pool_t *pool = __checkpool(L);
+    size_t size;
+    const char *code = luaL_checklstring(L, 2, &size);
+    std::string args, chunkname = luaL_checkstring(L, 3);
+    lua_serialize(L, 4, lua_gettop(L), args, true);
+    lua_pushnumber(L, pool->submit(std::string(code, size), std::move(chunkname), std::move(args)));
+    return 1;
+}
+
+/// @private thread_wait(pool, id, timeout) => true if finished
+static int luz_thread_wait(lua_State *L) {
+    lua_pushboolean(L, __checkpool(L)->wait((unsigned int)luaL_checknumber(L, 2), (int)luaL_optnumber(L, 3, -1)));
+    return 1;
+}
+
+/// @private thread_take(pool, id) => true, results... | false, error message
+static int luz_thread_take(lua_State *L) {
+    auto job = __checkpool(L)->take((unsigned int)luaL_checknumber(L, 2));
+    if (!job) return luaL_error(L, "the job is not finished");
+    if (job->isError) {
+        lua_pushboolean(L, 0);
+        lua_pushlstring(L, job->results.data(), job->results.size());
+        return 2;
+    }
+    lua_settop(L, 0);
+    lua_pushboolean(L, 1);
+    return 1 + lua_deserialize(L, job->results.data(), job->results.size());
+}
+
+/// @private thread_release(pool, id)
+static int luz_thread_release(lua_State *L) {
+    __checkpool(L)->release((unsigned int)luaL_checknumber(L, 2));
+    return 0;
+}
+
+/// @private get the channel of the first argument
+static channel_t *__checkchannel(lua_State *L) {
+    luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+    return (channel_t*)lua_touserdata(L, 1);
+}
+
+/// @private channel_open(capacity, isSPSC) => channel
+static int luz_channel_open(lua_State *L) {
+    lua_Number capacity = luaL_checknumber(L, 1);
+    channel_t *self = capacity >= 1 ? channel_open((size_t)capacity, lua_toboolean(L, 2) != 0) : nullptr;
+    if (self == nullptr) return luaL_argerror(L, 1, "capacity must be 1 .. CHANNEL_CAPACITY_MAX");
+    lua_pushlightuserdata(L, self);
+    return 1;
+}
+
+/// @private channel_retain(channel)
+static int luz_channel_retain(lua_State *L) {
+    channel_retain(__checkchannel(L));
+    return 0;
+}
+
+/// @private channel_release(channel)
+static int luz_channel_release(lua_State *L) {
+    channel_release(__checkchannel(L));
+    return 0;
+}
+
+/// @private channel_close(channel)
+static int luz_channel_close(lua_State *L) {
+    channel_close(__checkchannel(L));
+    return 0;
+}
+
+/// @private channel_is_closed(channel) => boolean
+static int luz_channel_is_closed(lua_State *L) {
+    lua_pushboolean(L, channel_is_closed(__checkchannel(L)));
+    return 1;
+}
+
+/// @private channel_size(channel) => count of the messages
+static int luz_channel_size(lua_State *L) {
+    lua_pushnumber(L, (lua_Number)channel_size(__checkchannel(L)));
+    return 1;
+}
+
+/// @private release the references of the objects moved into the message which is not pushed
+static void __discard(lua_State *L, const std::string &message) {
+    int top = lua_gettop(L);
+    lua_deserialize(L, message.data(), message.size()); // the restored objects release the references when collected
+    lua_settop(L, top);
+}
+
+/// @private channel_push(channel, timeout, value) => false if timed out or closed
+// * the value is serialized from the stack directly into the buffer reused by the thread
+static int luz_channel_push(lua_State *L) {
+    channel_t *self = __checkchannel(L);
+    int timeout = (int)luaL_checknumber(L, 2);
+    if (lua_isnoneornil(L, 3)) return luaL_argerror(L, 3, "nil cannot be pushed");
+
+    thread_local std::string message;
+    message.clear();
+    size_t objects = lua_serialize(L, 3, 3, message, true);
+    bool isPushed = channel_push(self, message.data(), message.size(), timeout);
+    if (!isPushed && objects > 0) __discard(L, message);
+    lua_pushboolean(L, isPushed);
+    return 1;
+}
+
+/// @private channel_encode(value) => message, true if any object is moved into the message
+// * the message is pushed by channel_send repeatedly, and must be released by luz.deserialize if it's not pushed
+static int luz_channel_encode(lua_State *L) {
+    if (lua_isnoneornil(L, 1)) return luaL_argerror(L, 1, "nil cannot be pushed");
+    std::string message;
+    size_t objects = lua_serialize(L, 1, 1, message, true);
+    lua_pushlstring(L, message.data(), message.size());
+    lua_pushboolean(L, objects > 0);
+    return 2;
+}
+
+/// @private channel_send(channel, timeout, message) => false if timed out or closed
+static int luz_channel_send(lua_State *L) {
+    channel_t *self = __checkchannel(L);
+    int timeout = (int)luaL_checknumber(L, 2);
+    size_t size;
+    const char *message = luaL_checklstring(L, 3, &size);
+    lua_pushboolean(L, channel_push(self, message, size, timeout));
+    return 1;
+}
+
+/// @private channel_pop(channel, timeout) => value | nil if timed out or closed
+static int luz_channel_pop(lua_State *L) {
+    channel_t *self = __checkchannel(L);
+    int timeout = (int)luaL_checknumber(L, 2);
+
+    thread_local std::string message;
+    if (!channel_pop(self, message, timeout)) return 0;
+    lua_settop(L, 0);
+    return lua_deserialize(L, message.data(), message.size());
+}
+
+/// @private get the shared value of the stack (number or serialized value)
+static void __toshared(lua_State *L, int index, shared_value_t &dest) {
+    if (lua_isnoneornil(L, index)) {
+        dest.type = SHARED_NONE;
+    } else if (lua_type(L, index) == LUA_TNUMBER) {
+        dest.type = SHARED_NUMBER;
+        dest.number = lua_tonumber(L, index);
+    } else {
+        dest.type = SHARED_BLOB;
+        lua_serialize(L, index, index, dest.blob);
+    }
+}
+
+/// @private luz.shared.get(key) => value | nil
+static int luz_shared_get(lua_State *L) {
+    size_t size;
+    const char *key = luaL_checklstring(L, 1, &size);
+    shared_value_t value;
+    if (!shared_get(std::string(key, size), value)) return 0;
+    if (value.type == SHARED_NUMBER) {
+        lua_pushnumber(L, value.number);
+        return 1;
+    }
+    lua_settop(L, 0);
+    return lua_deserialize(L, value.blob.data(), value.blob.size());
+}
+
+/// @private luz.shared.set(key, value) => false if the value is larger than the byte budget
+static int luz_shared_set(lua_State *L) {
+    size_t size;
+    const char *key = luaL_checklstring(L, 1, &size);
+    shared_value_t value;
+    __toshared(L, 2, value);
+    lua_pushboolean(L, shared_set(std::string(key, size), std::move(value)));
+    return 1;
+}
+
+/// @private luz.shared.cas(key, expected, value) => true if swapped
+static int luz_shared_cas(lua_State *L) {
+    size_t size;
+    const char *key = luaL_checklstring(L, 1, &size);
+    luaL_checkany(L, 2);
+    shared_value_t expected, value;
+    __toshared(L, 2, expected);
+    __toshared(L, 3, value);
+    lua_pushboolean(L, shared_cas(std::string(key, size), expected, std::move(value)));
+    return 1;
+}
+
+/// @private luz.shared.incr(key, delta) => incremented number
+static int luz_shared_incr(lua_State *L) {
+    size_t size;
+    const char *key = luaL_checklstring(L, 1, &size);
+    double result;
+    if (!shared_incr(std::string(key, size), luaL_optnumber(L, 2, 1), result)) {
+        return luaL_error(L, "the shared value of '%s' is not a number", key);
+    }
+    lua_pushnumber(L, result);
+    return 1;
+}
+
+/// @private luz.shared.remove(key) => false if not stored
+static int luz_shared_remove(lua_State *L) {
+    size_t size;
+    const char *key = luaL_checklstring(L, 1, &size);
+    lua_pushboolean(L, shared_remove(key, size));
+    return 1;
+}
+
+/// @private luz.shared.clear()
+static int luz_shared_clear(lua_State *L) {
+    shared_clear();
+    return 0;
+}
+
+/// @private luz.shared.budget(bytes)
+static int luz_shared_budget(lua_State *L) {
+    lua_Number bytes = luaL_checknumber(L, 1);
+    if (!(bytes >= 0 && bytes <= 9007199254740992.0)) return luaL_argerror(L, 1, "bytes must be 0 .. 2^53");
+    shared_budget((size_t)bytes);
+    return 0;
+}
+
+/// @private luz.shared.bytes() => bytes of the keys and values
+static int luz_shared_bytes(lua_State *L) {
+    lua_pushnumber(L, (lua_Number)shared_bytes());
+    return 1;
+}
+
+/// @private luz.shared.count() => count of the entries
+static int luz_shared_count(lua_State *L) {
+    lua_pushnumber(L, (lua_Number)shared_count());
+    return 1;
+}
+
+/// register native functions into the global `luz` table
+// * the private functions are registered into `luz.__native` (taken by the luz library)
+// * luz.shared.* are registered as they are (documented in the luz library)
+static void luaopen_luz(lua_State *L) {
+    static const luaL_Reg functions[] = {
+        {"serialize", luz_serialize},
+        {"deserialize", luz_deserialize},
+        {nullptr, nullptr},
+    }, natives[] = {
+        {"thread_open", luz_thread_open},
+        {"thread_close", luz_thread_close},
+        {"thread_size", luz_thread_size},
+        {"thread_submit", luz_thread_submit},
+        {"thread_wait", luz_thread_wait},
+        {"thread_take", luz_thread_take},
+        {"thread_release", luz_thread_release},
+        {"channel_open", luz_channel_open},
+        {"channel_retain", luz_channel_retain},
+        {"channel_release", luz_channel_release},
+        {"channel_close", luz_channel_close},
+        {"channel_is_closed", luz_channel_is_closed},
+        {"channel_size", luz_channel_size},
+        {"channel_push", luz_channel_push},
+        {"channel_encode", luz_channel_encode},
+        {"channel_send", luz_channel_send},
+        {"channel_pop", luz_channel_pop},
+        {nullptr, nullptr},
+    }, shared[] = {
+        {"get", luz_shared_get},
+        {"set", luz_shared_set},
+        {"cas", luz_shared_cas},
+        {"incr", luz_shared_incr},
+        {"remove", luz_shared_remove},
+        {"clear", luz_shared_clear},
+        {"budget", luz_shared_budget},
+        {"bytes", luz_shared_bytes},
+        {"count", luz_shared_count},
+        {nullptr, nullptr},
+    };
+
+    lua_getglobal(L, "luz");
+    if (!lua_istable(L, -1)) {
+        lua_pop(L, 1);
+        lua_newtable(L);
+        lua_pushvalue(L, -1);
+        lua_setglobal(L, "luz");
+    }
+    luaL_register(L, nullptr, functions);
+    lua_newtable(L);
+    luaL_register(L, nullptr, natives);
+    lua_setfield(L, -2, "__native");
+    lua_newtable(L);
+    luaL_register(L, nullptr, shared);
+    lua_setfield(L, -2, "shared");
+    lua_pop(L, 1);
+}
@@ -7,6 +7,9 @@
 #include "lpeg-1.0.0/lptree.c"
 #include "lpeg-1.0.0/lpvm.c"
 
+#include "native/filesystem.cpp"
+#include "native/luz.cpp"
+
 /* Lua extended standard libraries */
 static unsigned char core_lib_code[] = {
     #include "stdlib/core.cpp"
@@ -22,6 +25,8 @@ static unsigned char core_lib_code[] = {
     #include "stdlib/zip.cpp"
 }, lpeg_lib_code[] = {
     #include "stdlib/lpeg.cpp"
+}, luz_lib_code[] = {
+    #include "stdlib/luz.cpp"
 };
 
 /// @private execute lua byte-code
@@ -58,6 +63,7 @@ static bool regist_lua_stdlib(sol::state &lua, std::string *errorMessage) {
     if (!exec_lua_buffer(lua, (const char *)filesystem_lib_code, sizeof(filesystem_lib_code), "@stdlib://filesystem", errorMessage)) return false;
     if (!exec_lua_buffer(lua, (const char *)zip_lib_code, sizeof(zip_lib_code), "@stdlib://zip", errorMessage)) return false;
     if (!exec_lua_buffer(lua, (const char *)lpeg_lib_code, sizeof(lpeg_lib_code), "@stdlib://lpeg", errorMessage)) return false;
+    if (!exec_lua_buffer(lua, (const char *)luz_lib_code, sizeof(luz_lib_code), "@stdlib://luz", errorMessage)) return false;
     return true;
 }
 
@@ -81,6 +87,9 @@ bool lua_registlib(sol::state &lua, std::string *errorMessage) {
     lua_setglobal(lua, "utf8"); // set to global `utf8` table
     // LPEG support
     luaopen_lpeg(lua); // to use `require"ffi"`
+    // native functions of Luz core library (extended by the standard libraries)
+    luaopen_luz_filesystem(lua);
+    luaopen_luz(lua);
     // register lua extended standard libraries
     return regist_lua_stdlib(lua, errorMessage);
 }
\ No newline at end of file
@@ -0,0 +1,224 @@
+﻿#include "../lua.hpp"
+#include <algorithm>
+
+/// @private type tags of the serialized values
+enum {
+    __SERIAL_NIL = 'n',
+    __SERIAL_FALSE = 'f',
+    __SERIAL_TRUE = 't',
+    __SERIAL_NUMBER = 'd',  // + lua_Number
+    __SERIAL_STRING = 's',  // + size_t length + bytes
+    __SERIAL_TABLE = 'T',   // + (key, value)... + __SERIAL_END
+    __SERIAL_END = 'e',
+    __SERIAL_CDATA = 'c',   // + size_t length + bytes encoded by registry["luz.codec"].encode
+    __SERIAL_OBJECT = 'o',  // + kind + value returned by object:__pack() (restored by registry["luz.codec"].unpack)
+    __SERIAL_POINTER = 'p', // + light userdata
+};
+
+/// @private type of cdata (LuaJIT extension)
+static const int __LUA_TCDATA = 10;
+
+/// @private max depth of the nested tables
+static const size_t __SERIAL_DEPTH_MAX = 128;
+
+/*** ================================================== ***/
+/*** @private serialization helpers ***/
+
+/// @private append the length-prefixed bytes
+static void __putbytes(std::string &dest, char tag, const char *data, size_t size) {
+    dest += tag;
+    dest.append((const char*)&size, sizeof(size));
+    dest.append(data, size);
+}
+
+/// @private call the codec of the luz library: registry["luz.codec"][name](values on the top)
+// @param count: count of the values on the top (replaced with the result)
+static void __callcodec(lua_State *L, const char *name, int count) {
+    lua_getfield(L, LUA_REGISTRYINDEX, "luz.codec");
+    if (!lua_istable(L, -1)) luaL_error(L, "cdata and objects cannot be serialized without the luz library");
+    lua_getfield(L, -1, name);
+    lua_remove(L, -2);
+    lua_insert(L, -1 - count);
+    lua_call(L, count, 1);
+}
+
+/// @private state of the serialization
+struct __serial_context_t {
+    std::vector<const void*> tables; // tables being serialized (to detect the recursion)
+    bool isTransfer;                 // the objects which have `__pack` method are allowed
+    size_t objects;                  // count of the objects moved into the data
+};
+
+/// @private append the value at the absolute index
+static void __serialize(lua_State *L, int index, std::string &dest, __serial_context_t &context) {
+    switch (lua_type(L, index)) {
+    case LUA_TNIL:
+        dest += (char)__SERIAL_NIL;
+        return;
+    case LUA_TBOOLEAN:
+        dest += (char)(lua_toboolean(L, index) ? __SERIAL_TRUE : __SERIAL_FALSE);
+        return;
+    case LUA_TNUMBER: {
+        lua_Number value = lua_tonumber(L, index);
+        dest += (char)__SERIAL_NUMBER;
+        dest.append((const char*)&value, sizeof(value));
+        return;
+    }
+    case LUA_TSTRING: {
+        size_t size;
+        const char *data = lua_tolstring(L, index, &size);
+        __putbytes(dest, __SERIAL_STRING, data, size);
+        return;
+    }
+    case LUA_TTABLE: {
+        // object which can be shared between the Lua states (e.g. luz.channel)
+        lua_getfield(L, index, "__pack");
+        if (lua_isfunction(L, -1)) {
+            if (!context.isTransfer) luaL_error(L, "cannot serialize the object shared by reference (pass it to luz.thread or luz.channel)");
+            lua_pushvalue(L, index);
+            lua_call(L, 1, 2);
+            if (!lua_isstring(L, -2)) luaL_error(L, "__pack must return the kind of the object");
+            int top = lua_gettop(L);
+            dest += (char)__SERIAL_OBJECT;
+            ++context.objects;
+            __serialize(L, top - 1, dest, context);
+            __serialize(L, top, dest, context);
+            lua_pop(L, 2);
+            return;
+        }
+        lua_pop(L, 1);
+
+        std::vector<const void*> &tables = context.tables;
+        const void *table = lua_topointer(L, index);
+        if (std::find(tables.begin(), tables.end(), table) != tables.end()) luaL_error(L, "cannot serialize the table referenced recursively");
+        if (tables.size() >= __SERIAL_DEPTH_MAX) luaL_error(L, "cannot serialize the table nested too deeply");
+        luaL_checkstack(L, 4, "too many nested tables");
+
+        tables.push_back(table);
+        dest += (char)__SERIAL_TABLE;
+        lua_pushnil(L);
+        while (lua_next(L, index)) {
+            int top = lua_gettop(L);
+            __serialize(L, top - 1, dest, context);
+            __serialize(L, top, dest, context);
+            lua_pop(L, 1);
+        }
+        dest += (char)__SERIAL_END;
+        tables.pop_back();
+        return;
+    }
+    case LUA_TLIGHTUSERDATA: {
+        void *pointer = lua_touserdata(L, index);
+        dest += (char)__SERIAL_POINTER;
+        dest.append((const char*)&pointer, sizeof(pointer));
+        return;
+    }
+    case __LUA_TCDATA: {
+        lua_pushvalue(L, index);
+        __callcodec(L, "encode", 1);
+        size_t size;
+        const char *data = lua_tolstring(L, -1, &size);
+        if (data == nullptr) luaL_error(L, "cdata codec must return a string");
+        __putbytes(dest, __SERIAL_CDATA, data, size);
+        lua_pop(L, 1);
+        return;
+    }
+    default:
+        luaL_error(L, "cannot serialize %s value", luaL_typename(L, index));
+    }
+}
+
+/// @private read the length-prefixed bytes
+static const char *__getbytes(lua_State *L, const char *&p, const char *end, size_t *size) {
+    if ((size_t)(end - p) < sizeof(size_t)) luaL_error(L, "broken serialized data");
+    memcpy(size, p, sizeof(size_t));
+    p += sizeof(size_t);
+    if ((size_t)(end - p) < *size) luaL_error(L, "broken serialized data");
+    const char *data = p;
+    p += *size;
+    return data;
+}
+
+/// @private push the value at p
+static void __deserialize(lua_State *L, const char *&p, const char *end, size_t depth) {
+    if (p >= end || depth > __SERIAL_DEPTH_MAX) luaL_error(L, "broken serialized data");
+    luaL_checkstack(L, 3, "too many nested tables");
+
+    size_t size;
+    switch (*p++) {
+    case __SERIAL_NIL:
+        lua_pushnil(L);
+        return;
+    case __SERIAL_FALSE:
+        lua_pushboolean(L, 0);
+        return;
+    case __SERIAL_TRUE:
+        lua_pushboolean(L, 1);
+        return;
+    case __SERIAL_NUMBER: {
+        lua_Number value;
+        if ((size_t)(end - p) < sizeof(value)) luaL_error(L, "broken serialized data");
+        memcpy(&value, p, sizeof(value));
+        p += sizeof(value);
+        lua_pushnumber(L, value);
+        return;
+    }
+    case __SERIAL_STRING: {
+        const char *data = __getbytes(L, p, end, &size);
+        lua_pushlstring(L, data, size);
+        return;
+    }
+    case __SERIAL_TABLE:
+        lua_newtable(L);
+        for (;;) {
+            if (p >= end) luaL_error(L, "broken serialized data");
+            if (*p == __SERIAL_END) {
+                ++p;
+                return;
+            }
+            __deserialize(L, p, end, depth + 1);
+            __deserialize(L, p, end, depth + 1);
+            lua_rawset(L, -3);
+        }
+    case __SERIAL_CDATA: {
+        const char *data = __getbytes(L, p, end, &size);
+        lua_pushlstring(L, data, size);
+        __callcodec(L, "decode", 1);
+        return;
+    }
+    case __SERIAL_OBJECT:
+        __deserialize(L, p, end, depth + 1);
+        __deserialize(L, p, end, depth + 1);
+        __callcodec(L, "unpack", 2);
+        return;
+    case __SERIAL_POINTER: {
+        void *pointer;
+        if ((size_t)(end - p) < sizeof(pointer)) luaL_error(L, "broken serialized data");
+        memcpy(&pointer, p, sizeof(pointer));
+        p += sizeof(pointer);
+        lua_pushlightuserdata(L, pointer);
+        return;
+    }
+    default:
+        luaL_error(L, "broken serialized data");
+    }
+}
+
+/*** ================================================== ***/
+/*** utility functions for C++ ***/
+
+size_t lua_serialize(lua_State *L, int first, int last, std::string &dest, bool isTransfer) {
+    __serial_context_t context = {{}, isTransfer, 0};
+    for (int i = first; i <= last; ++i) __serialize(L, i, dest, context);
+    return context.objects;
+}
+
+int lua_deserialize(lua_State *L, const char *data, size_t size) {
+    const char *p = data, *end = data + size;
+    int count = 0;
+    for (; p < end; ++count) {
+        luaL_checkstack(L, 1, "too many values");
+        __deserialize(L, p, end, 0);
+    }
+    return count;
+}
@@ -0,0 +1,159 @@
+﻿#include "../lua.hpp"
+
+/// @private registry key of the baseline snapshot
+static const char *__BASELINE = "luz.baseline";
+
+/*** ================================================== ***/
+/*** @private snapshot helpers ***/
+
+/// @private push the shallow copy of the table at the absolute index
+static void __copytable(lua_State *L, int index) {
+    lua_newtable(L);
+    lua_pushnil(L);
+    while (lua_next(L, index)) {
+        lua_pushvalue(L, -2);
+        lua_insert(L, -2);
+        lua_rawset(L, -4);
+    }
+}
+
+/// @private restore the fields of the table at the absolute index from the copy (the added fields are removed)
+static void __restoretable(lua_State *L, int index, int copy) {
+    lua_pushnil(L);
+    while (lua_next(L, index)) {
+        lua_pop(L, 1);
+        lua_pushvalue(L, -1);
+        lua_rawget(L, copy);
+        bool isAdded = lua_isnil(L, -1);
+        lua_pop(L, 1);
+        if (isAdded) {
+            lua_pushvalue(L, -1);
+            lua_pushnil(L);
+            lua_rawset(L, index); // assigning nil to the existing field is allowed while traversing
+        }
+    }
+    lua_pushnil(L);
+    while (lua_next(L, copy)) {
+        lua_pushvalue(L, -2);
+        lua_insert(L, -2);
+        lua_rawset(L, index);
+    }
+}
+
+/// @private take the baseline snapshot: registry[__BASELINE] = {globals, loaded, tables = {[global table] = copy}}
+static void __snapshot(lua_State *L) {
+    lua_newtable(L);
+    int baseline = lua_gettop(L);
+
+    lua_pushvalue(L, LUA_GLOBALSINDEX);
+    __copytable(L, lua_gettop(L));
+    lua_setfield(L, baseline, "globals");
+    lua_pop(L, 1);
+
+    lua_newtable(L);
+    int tables = lua_gettop(L);
+    lua_pushnil(L);
+    while (lua_next(L, LUA_GLOBALSINDEX)) {
+        if (lua_istable(L, -1) && !lua_rawequal(L, -1, LUA_GLOBALSINDEX)) {
+            __copytable(L, lua_gettop(L));
+            lua_rawset(L, tables); // tables[global table] = copy
+        } else {
+            lua_pop(L, 1);
+        }
+    }
+    lua_setfield(L, baseline, "tables");
+
+    lua_getfield(L, LUA_REGISTRYINDEX, "_LOADED");
+    if (lua_istable(L, -1)) {
+        __copytable(L, lua_gettop(L));
+        lua_setfield(L, baseline, "loaded");
+    }
+    lua_pop(L, 1);
+
+    lua_setfield(L, LUA_REGISTRYINDEX, __BASELINE);
+}
+
+/// @private reset the state to the baseline snapshot
+static void __reset(lua_State *L) {
+    lua_settop(L, 0);
+    lua_getfield(L, LUA_REGISTRYINDEX, __BASELINE);
+    if (!lua_istable(L, 1)) return;
+
+    lua_getfield(L, 1, "tables");
+    lua_pushnil(L);
+    while (lua_next(L, 2)) {
+        __restoretable(L, lua_gettop(L) - 1, lua_gettop(L));
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 1);
+
+    lua_pushvalue(L, LUA_GLOBALSINDEX);
+    lua_getfield(L, 1, "globals");
+    __restoretable(L, 2, 3);
+    lua_settop(L, 1);
+
+    lua_getfield(L, LUA_REGISTRYINDEX, "_LOADED");
+    lua_getfield(L, 1, "loaded");
+    if (lua_istable(L, 2) && lua_istable(L, 3)) __restoretable(L, 2, 3);
+    lua_settop(L, 0);
+    lua_gc(L, LUA_GCSTEP, 0);
+}
+
+/*** ================================================== ***/
+/*** Lua state pool ***/
+
+lua_state_pool_t::lease_t &lua_state_pool_t::lease_t::operator =(lease_t &&other) noexcept {
+    if (this != &other) {
+        release();
+        pool = other.pool;
+        state = std::move(other.state);
+        other.pool = nullptr;
+    }
+    return *this;
+}
+
+void lua_state_pool_t::lease_t::release() {
+    if (pool && state) pool->restore(std::move(state));
+    state.reset();
+    pool = nullptr;
+}
+
+lua_state_pool_t::lua_state_pool_t(size_t states, std::string *errorMessage): capacity(states) {
+    for (size_t i = 0; i < states; ++i) {
+        auto state = create(errorMessage);
+        if (!state) break;
+        this->states.push_back(std::move(state));
+    }
+}
+
+lua_state_pool_t::lease_t lua_state_pool_t::acquire(std::string *errorMessage) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!states.empty()) {
+            auto state = std::move(states.back());
+            states.pop_back();
+            return lease_t(this, std::move(state));
+        }
+    }
+    auto state = create(errorMessage);
+    if (!state) return lease_t();
+    return lease_t(this, std::move(state));
+}
+
+size_t lua_state_pool_t::idle() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return states.size();
+}
+
+std::unique_ptr<sol::state> lua_state_pool_t::create(std::string *errorMessage) {
+    std::unique_ptr<sol::state> state(new sol::state);
+    if (!lua_registlib(*state, errorMessage)) return nullptr;
+    __snapshot(state->lua_state());
+    return state;
+}
+
+void lua_state_pool_t::restore(std::unique_ptr<sol::state> state) {
+    __reset(state->lua_state()); // outside of the lock: the states are independent
+    std::lock_guard<std::mutex> lock(mutex);
+    if (states.size() < capacity) states.push_back(std::move(state));
+}
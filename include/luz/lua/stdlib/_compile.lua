@@ -27,6 +27,7 @@ compile("os.lua", "os.cpp", "@stdlib://os")
 compile("filesystem.lua", "filesystem.cpp", "@stdlib://filesystem")
 compile("zip.lua", "zip.cpp", "@stdlib://zip")
 compile("lpeg.lua", "lpeg.cpp", "@stdlib://lpeg")
+compile("luz.lua", "luz.cpp", "@stdlib://luz")
 
 -- loading order of libraries
 --[[
@@ -37,4 +38,5 @@ compile("lpeg.lua", "lpeg.cpp", "@stdlib://lpeg")
     5. filesystem
     6. zip
     7. lpeg
+    8. luz
 ]]
\ No newline at end of file
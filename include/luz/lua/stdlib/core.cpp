@@ -1 +1 @@
-27,76,74,2,0,14,64,115,116,100,108,105,98,58,47,47,99,111,114,101,135,1,0,2,8,0,3,0,15,48,7,5,18,3,1,0,57,2,0,1,39,4,1,0,66,2,3,4,88,5,6,128,6,5,2,0,88,6,2,128,5,0,5,0,88,6,2,128,43,6,2,0,76,6,2,0,69,5,3,2,82,5,248,127,43,2,1,0,76,2,2,0,8,97,110,121,10,91,94,124,93,43,11,103,109,97,116,99,104,1,1,1,1,1,2,2,2,2,2,2,1,1,4,4,116,121,112,101,110,97,109,101,0,0,16,116,121,112,101,115,0,0,16,4,5,9,5,0,9,6,0,9,116,0,1,6,0,191,3,2,1,15,1,13,3,46,95,16,17,54,1,0,0,57,1,1,1,41,2,2,0,39,3,2,0,66,1,3,2,57,1,3,1,52,2,3,0,71,3,1,0,63,3,0,0,41,3,1,0,24,4,1,0,23,4,2,4,41,5,2,0,77,3,27,128,54,7,4,0,56,8,6,2,66,7,2,2,45,8,0,0,18,9,7,0,22,10,2,6,56,10,10,2,66,8,3,2,14,0,8,0,88,8,16,128,54,8,5,0,54,9,6,0,57,9,7,9,39,10,8,0,18,11,1,0,54,12,9,0,57,12,10,12,23,13,2,6,25,13,1,13,66,12,2,2,22,12,2,12,22,13,2,6,56,13,13,2,18,14,7,0,66,9,6,0,65,8,0,1,79,3,229,127,54,3,11,0,39,4,12,0,41,5,100,0,66,3,3,1,75,0,1,0,0,192,9,115,116,101,112,19,99,111,108,108,101,99,116,103,97,114,98,97,103,101,10,102,108,111,111,114,9,109,97,116,104,75,102,117,110,99,116,105,111,110,32,97,114,103,117,109,101,110,116,32,116,121,112,101,32,101,114,114,111,114,58,32,39,37,115,39,32,97,114,103,117,109,101,110,116,32,37,100,32,101,120,112,101,99,116,101,100,32,37,115,44,32,98,117,116,32,103,111,116,32,37,115,11,102,111,114,109,97,116,11,115,116,114,105,110,103,10,101,114,114,111,114,9,116,121,112,101,9,110,97,109,101,6,110,12,103,101,116,105,110,102,111,10,100,101,98,117,103,3,128,128,192,153,4,4,2,1,1,1,1,1,1,2,2,2,4,4,4,4,4,5,5,5,6,6,6,6,6,6,6,7,7,7,8,9,10,10,10,10,10,10,11,11,13,7,7,4,16,16,16,16,17,116,121,112,101,115,97,109,101,0,110,0,0,47,102,117,110,99,110,97,109,101,0,7,40,97,114,103,115,0,3,37,1,4,28,2,0,28,3,0,28,105,0,1,26,116,0,3,23,0,126,0,1,5,0,6,0,12,18,48,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,66,1,2,1,75,0,1,0,18,105,111,95,115,101,116,117,49,54,109,111,100,101,6,67,8,102,102,105,19,99,100,97,116,97,124,117,115,101,114,100,97,116,97,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,3,102,112,0,0,13,0,198,1,0,1,7,0,9,1,22,44,55,6,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,18,2,0,0,57,1,3,0,66,1,2,2,54,2,4,0,57,2,5,2,39,3,6,0,22,4,0,1,66,2,3,2,54,3,4,0,57,3,7,3,57,3,8,3,18,4,2,0,18,5,0,0,18,6,1,0,66,3,4,1,76,2,2,0,12,117,56,116,111,119,99,115,6,67,15,119,99,104,97,114,95,116,91,63,93,8,110,101,119,8,102,102,105,8,108,101,110,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,3,3,3,3,3,4,4,4,4,4,4,4,5,115,101,108,102,0,0,23,115,105,122,101,0,10,13,100,101,115,116,0,5,8,0,228,1,0,1,7,0,9,2,28,49,64,6,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,66,1,2,2,24,1,0,1,54,2,3,0,57,2,6,2,39,3,7,0,22,4,1,1,66,2,3,2,54,3,3,0,57,3,4,3,57,3,8,3,18,4,2,0,18,5,0,0,18,6,1,0,66,3,4,1,54,3,3,0,57,3,2,3,18,4,2,0,68,3,2,0,12,119,99,115,116,111,117,56,12,99,104,97,114,91,63,93,8,110,101,119,11,119,99,115,108,101,110,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,6,2,1,1,1,1,1,1,2,2,2,2,2,2,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,115,114,99,0,0,29,115,105,122,101,0,13,16,100,101,115,116,0,5,11,0,202,4,2,1,15,0,16,3,85,138,1,78,20,52,1,3,0,71,2,1,0,63,2,0,0,41,2,0,0,54,3,0,0,18,4,1,0,66,3,2,4,72,6,59,128,41,8,0,0,1,8,2,0,88,8,9,128,54,8,1,0,57,8,2,8,57,8,3,8,54,9,4,0,57,9,5,9,39,10,6,0,66,9,2,2,18,10,0,0,66,8,3,1,22,8,1,2,1,8,6,0,88,8,15,128,41,8,1,0,33,9,2,6,23,9,1,9,41,10,1,0,77,8,10,128,54,12,1,0,57,12,2,12,57,12,3,12,54,13,4,0,57,13,5,13,39,14,7,0,66,13,2,2,18,14,0,0,66,12,3,1,79,8,246,127,54,8,1,0,57,8,2,8,57,8,3,8,54,9,4,0,57,9,5,9,54,10,8,0,56,11,6,1,66,10,2,2,7,10,9,0,88,10,12,128,54,10,9,0,57,10,10,10,15,0,10,0,88,11,8,128,54,10,9,0,57,10,11,10,56,11,6,1,41,12,2,0,43,13,2,0,66,10,4,2,14,0,10,0,88,11,3,128,54,10,12,0,56,11,6,1,66,10,2,2,66,9,2,2,18,10,0,0,66,8,3,1,18,2,6,0,70,6,3,3,82,6,195,127,54,3,1,0,57,3,2,3,57,3,3,3,54,4,4,0,57,4,5,4,9,2,2,0,88,5,2,128,39,5,13,0,88,6,1,128,39,5,14,0,39,6,15,0,38,5,6,5,66,4,2,2,18,5,0,0,66,3,3,1,75,0,1,0,6,10,5,8,110,105,108,13,116,111,115,116,114,105,110,103,14,115,101,114,105,97,108,105,122,101,15,112,114,105,110,116,95,102,108,97,103,10,116,97,98,108,101,9,116,121,112,101,9,110,105,108,9,6,9,12,117,56,116,111,119,99,115,11,115,116,114,105,110,103,11,102,112,117,116,119,115,6,67,8,102,102,105,10,112,97,105,114,115,3,128,128,192,153,4,2,0,1,1,1,2,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,7,7,7,7,7,8,8,8,8,8,8,8,8,8,7,11,11,11,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,12,16,11,17,4,4,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,20,115,116,100,111,117,116,0,0,86,108,105,115,116,0,4,82,107,101,121,0,1,81,4,3,62,5,0,62,6,0,62,107,0,1,59,118,0,0,59,1,19,11,2,0,11,3,0,11,105,0,1,9,0,60,2,0,3,1,2,0,6,14,101,2,45,0,0,0,54,1,0,0,57,1,1,1,71,2,0,0,65,0,1,1,75,0,1,0,1,192,11,115,116,100,111,117,116,7,105,111,1,1,1,1,1,2,102,112,114,105,110,116,0,0,180,1,2,1,5,0,10,0,20,30,106,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,3,0,0,57,2,6,0,71,4,1,0,65,2,1,2,18,3,2,0,57,2,7,2,66,2,2,2,54,3,8,0,57,3,9,3,66,1,3,1,75,0,1,0,11,115,116,100,111,117,116,7,105,111,12,117,56,116,111,119,99,115,11,102,111,114,109,97,116,11,102,112,117,116,119,115,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,3,102,111,114,109,97,116,0,0,21,0,60,2,0,3,1,2,0,6,14,112,2,45,0,0,0,54,1,0,0,57,1,1,1,71,2,0,0,65,0,1,1,75,0,1,0,1,192,11,115,116,100,101,114,114,7,105,111,1,1,1,1,1,2,102,112,114,105,110,116,0,0,175,1,2,1,5,0,10,0,19,29,116,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,3,0,0,57,2,6,0,66,2,2,2,18,3,2,0,57,2,7,2,66,2,2,2,54,3,8,0,57,3,9,3,66,1,3,1,75,0,1,0,11,115,116,100,101,114,114,7,105,111,12,117,56,116,111,119,99,115,11,102,111,114,109,97,116,11,102,112,117,116,119,115,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,3,102,111,114,109,97,116,0,0,20,0,115,2,1,5,0,5,0,12,22,122,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,18,3,0,0,57,2,4,0,71,4,1,0,65,2,1,0,67,1,0,0,11,102,111,114,109,97,116,10,101,114,114,111,114,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,102,111,114,109,97,116,0,0,13,0,189,2,0,2,9,0,14,1,39,63,128,1,8,54,2,0,0,18,3,0,0,66,2,2,2,7,2,1,0,88,2,9,128,54,2,2,0,57,2,3,2,57,2,4,2,18,4,0,0,57,3,5,0,66,3,2,2,54,4,6,0,57,4,7,4,66,2,3,1,14,0,1,0,88,2,1,128,41,1,0,4,54,2,2,0,57,2,8,2,39,3,9,0,22,4,0,1,66,2,3,2,54,3,2,0,57,3,1,3,54,4,1,0,57,4,10,4,54,5,2,0,57,5,3,5,57,5,11,5,18,6,2,0,18,7,1,0,54,8,6,0,57,8,12,8,66,5,4,0,65,4,0,0,65,3,0,2,18,4,3,0,57,3,13,3,68,3,2,0,11,114,101,109,111,118,101,10,115,116,100,105,110,11,102,103,101,116,119,115,12,119,99,115,116,111,117,56,15,119,99,104,97,114,95,116,91,63,93,8,110,101,119,11,115,116,100,111,117,116,7,105,111,12,117,56,116,111,119,99,115,11,102,112,117,116,119,115,6,67,8,102,102,105,11,115,116,114,105,110,103,9,116,121,112,101,2,1,1,1,1,1,2,2,2,2,2,2,2,2,2,5,5,5,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,109,101,115,115,97,103,101,0,0,40,115,105,122,101,0,0,40,98,117,102,0,23,17,0,180,5,3,0,3,0,32,0,39,60,0,137,1,51,0,0,0,54,1,1,0,51,2,3,0,61,2,2,1,54,1,4,0,57,1,5,1,39,2,6,0,66,1,2,1,54,1,4,0,57,1,7,1,7,1,8,0,88,1,3,128,54,1,9,0,51,2,11,0,61,2,10,1,54,1,12,0,51,2,14,0,61,2,13,1,54,1,12,0,51,2,16,0,61,2,15,1,54,1,17,0,43,2,2,0,61,2,18,1,51,1,19,0,51,2,20,0,55,2,21,0,51,2,22,0,55,2,23,0,51,2,24,0,55,2,25,0,51,2,26,0,55,2,27,0,51,2,28,0,55,2,29,0,51,2,30,0,55,2,31,0,50,0,0,128,75,0,1,0,11,114,101,97,100,108,110,0,11,101,114,114,111,114,102,0,12,101,112,114,105,110,116,102,0,11,101,112,114,105,110,116,0,11,112,114,105,110,116,102,0,10,112,114,105,110,116,0,0,15,112,114,105,110,116,95,102,108,97,103,10,116,97,98,108,101,0,12,119,99,115,116,111,117,56,0,12,117,56,116,111,119,99,115,11,115,116,114,105,110,103,0,15,115,101,116,117,49,54,109,111,100,101,7,105,111,12,87,105,110,100,111,119,115,7,111,115,197,2,118,111,105,100,32,105,111,95,115,101,116,117,49,54,109,111,100,101,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,32,47,47,32,87,105,110,100,111,119,115,32,111,110,108,121,10,98,111,111,108,32,117,56,116,111,119,99,115,40,119,99,104,97,114,95,116,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,115,111,117,114,99,101,44,32,115,105,122,101,95,116,32,115,105,122,101,41,59,10,98,111,111,108,32,119,99,115,116,111,117,56,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,119,99,104,97,114,95,116,32,42,115,111,117,114,99,101,44,32,115,105,122,101,95,116,32,115,105,122,101,41,59,10,115,105,122,101,95,116,32,119,99,115,108,101,110,40,99,111,110,115,116,32,119,99,104,97,114,95,116,32,42,115,116,114,41,59,10,105,110,116,32,102,112,117,116,119,115,40,99,111,110,115,116,32,119,99,104,97,114,95,116,32,42,115,116,114,44,32,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,119,99,104,97,114,95,116,32,42,102,103,101,116,119,115,40,119,99,104,97,114,95,116,32,42,100,101,115,116,44,32,115,105,122,101,95,116,32,110,44,32,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,9,99,100,101,102,8,102,102,105,0,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,0,12,16,33,16,37,37,44,44,46,46,46,46,48,51,48,55,61,55,64,70,64,73,73,73,98,103,101,109,106,114,112,119,116,125,122,136,128,136,136,116,121,112,101,115,97,109,101,0,2,38,102,112,114,105,110,116,0,24,14,0,0,
\ No newline at end of file
+27,76,74,2,0,14,64,115,116,100,108,105,98,58,47,47,99,111,114,101,135,1,0,2,8,0,3,0,15,48,7,5,18,3,1,0,57,2,0,1,39,4,1,0,66,2,3,4,88,5,6,128,6,5,2,0,88,6,2,128,5,0,5,0,88,6,2,128,43,6,2,0,76,6,2,0,69,5,3,2,82,5,248,127,43,2,1,0,76,2,2,0,8,97,110,121,10,91,94,124,93,43,11,103,109,97,116,99,104,1,1,1,1,1,2,2,2,2,2,2,1,1,4,4,116,121,112,101,110,97,109,101,0,0,16,116,121,112,101,115,0,0,16,4,5,9,5,0,9,6,0,9,116,0,1,6,0,191,3,2,1,15,1,13,3,46,95,16,17,54,1,0,0,57,1,1,1,41,2,2,0,39,3,2,0,66,1,3,2,57,1,3,1,52,2,3,0,71,3,1,0,63,3,0,0,41,3,1,0,24,4,1,0,23,4,2,4,41,5,2,0,77,3,27,128,54,7,4,0,56,8,6,2,66,7,2,2,45,8,0,0,18,9,7,0,22,10,2,6,56,10,10,2,66,8,3,2,14,0,8,0,88,8,16,128,54,8,5,0,54,9,6,0,57,9,7,9,39,10,8,0,18,11,1,0,54,12,9,0,57,12,10,12,23,13,2,6,25,13,1,13,66,12,2,2,22,12,2,12,22,13,2,6,56,13,13,2,18,14,7,0,66,9,6,0,65,8,0,1,79,3,229,127,54,3,11,0,39,4,12,0,41,5,100,0,66,3,3,1,75,0,1,0,0,192,9,115,116,101,112,19,99,111,108,108,101,99,116,103,97,114,98,97,103,101,10,102,108,111,111,114,9,109,97,116,104,75,102,117,110,99,116,105,111,110,32,97,114,103,117,109,101,110,116,32,116,121,112,101,32,101,114,114,111,114,58,32,39,37,115,39,32,97,114,103,117,109,101,110,116,32,37,100,32,101,120,112,101,99,116,101,100,32,37,115,44,32,98,117,116,32,103,111,116,32,37,115,11,102,111,114,109,97,116,11,115,116,114,105,110,103,10,101,114,114,111,114,9,116,121,112,101,9,110,97,109,101,6,110,12,103,101,116,105,110,102,111,10,100,101,98,117,103,3,128,128,192,153,4,4,2,1,1,1,1,1,1,2,2,2,4,4,4,4,4,5,5,5,6,6,6,6,6,6,6,7,7,7,8,9,10,10,10,10,10,10,11,11,13,7,7,4,16,16,16,16,17,116,121,112,101,115,97,109,101,0,110,0,0,47,102,117,110,99,110,97,109,101,0,7,40,97,114,103,115,0,3,37,1,4,28,2,0,28,3,0,28,105,0,1,26,116,0,3,23,0,126,0,1,5,0,6,0,12,18,49,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,66,1,2,1,75,0,1,0,18,105,111,95,115,101,116,117,49,54,109,111,100,101,6,67,8,102,102,105,19,99,100,97,116,97,124,117,115,101,114,100,97,116,97,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,3,102,112,0,0,13,0,198,1,0,1,7,0,9,1,22,44,56,6,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,18,2,0,0,57,1,3,0,66,1,2,2,54,2,4,0,57,2,5,2,39,3,6,0,22,4,0,1,66,2,3,2,54,3,4,0,57,3,7,3,57,3,8,3,18,4,2,0,18,5,0,0,18,6,1,0,66,3,4,1,76,2,2,0,12,117,56,116,111,119,99,115,6,67,15,119,99,104,97,114,95,116,91,63,93,8,110,101,119,8,102,102,105,8,108,101,110,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,3,3,3,3,3,4,4,4,4,4,4,4,5,115,101,108,102,0,0,23,115,105,122,101,0,10,13,100,101,115,116,0,5,8,0,228,1,0,1,7,0,9,2,28,49,65,6,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,66,1,2,2,24,1,0,1,54,2,3,0,57,2,6,2,39,3,7,0,22,4,1,1,66,2,3,2,54,3,3,0,57,3,4,3,57,3,8,3,18,4,2,0,18,5,0,0,18,6,1,0,66,3,4,1,54,3,3,0,57,3,2,3,18,4,2,0,68,3,2,0,12,119,99,115,116,111,117,56,12,99,104,97,114,91,63,93,8,110,101,119,11,119,99,115,108,101,110,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,6,2,1,1,1,1,1,1,2,2,2,2,2,2,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,115,114,99,0,0,29,115,105,122,101,0,13,16,100,101,115,116,0,5,11,0,193,2,0,2,10,2,11,0,34,75,80,5,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,45,2,0,0,12,3,1,0,88,3,1,128,39,3,4,0,56,2,3,2,11,2,0,0,88,3,7,128,54,3,5,0,39,4,6,0,54,5,7,0,18,6,1,0,66,5,2,2,38,4,5,4,66,3,2,1,54,3,8,0,57,3,2,3,45,4,1,0,54,5,8,0,57,5,9,5,57,5,10,5,18,6,2,0,18,7,0,0,21,8,0,0,45,9,1,0,66,5,5,0,67,3,1,0,1,192,2,192,16,104,97,115,104,95,100,105,103,101,115,116,6,67,8,102,102,105,13,116,111,115,116,114,105,110,103,29,117,110,107,110,111,119,110,32,104,97,115,104,32,97,108,103,111,114,105,116,104,109,58,32,10,101,114,114,111,114,9,120,120,104,51,15,110,105,108,124,115,116,114,105,110,103,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,2,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,104,97,115,104,97,108,103,111,115,0,104,97,115,104,100,105,103,101,115,116,0,115,101,108,102,0,0,35,97,108,103,111,0,0,35,105,100,0,14,21,0,202,4,2,1,15,0,16,3,85,138,1,93,20,52,1,3,0,71,2,1,0,63,2,0,0,41,2,0,0,54,3,0,0,18,4,1,0,66,3,2,4,72,6,59,128,41,8,0,0,1,8,2,0,88,8,9,128,54,8,1,0,57,8,2,8,57,8,3,8,54,9,4,0,57,9,5,9,39,10,6,0,66,9,2,2,18,10,0,0,66,8,3,1,22,8,1,2,1,8,6,0,88,8,15,128,41,8,1,0,33,9,2,6,23,9,1,9,41,10,1,0,77,8,10,128,54,12,1,0,57,12,2,12,57,12,3,12,54,13,4,0,57,13,5,13,39,14,7,0,66,13,2,2,18,14,0,0,66,12,3,1,79,8,246,127,54,8,1,0,57,8,2,8,57,8,3,8,54,9,4,0,57,9,5,9,54,10,8,0,56,11,6,1,66,10,2,2,7,10,9,0,88,10,12,128,54,10,9,0,57,10,10,10,15,0,10,0,88,11,8,128,54,10,9,0,57,10,11,10,56,11,6,1,41,12,2,0,43,13,2,0,66,10,4,2,14,0,10,0,88,11,3,128,54,10,12,0,56,11,6,1,66,10,2,2,66,9,2,2,18,10,0,0,66,8,3,1,18,2,6,0,70,6,3,3,82,6,195,127,54,3,1,0,57,3,2,3,57,3,3,3,54,4,4,0,57,4,5,4,9,2,2,0,88,5,2,128,39,5,13,0,88,6,1,128,39,5,14,0,39,6,15,0,38,5,6,5,66,4,2,2,18,5,0,0,66,3,3,1,75,0,1,0,6,10,5,8,110,105,108,13,116,111,115,116,114,105,110,103,14,115,101,114,105,97,108,105,122,101,15,112,114,105,110,116,95,102,108,97,103,10,116,97,98,108,101,9,116,121,112,101,9,110,105,108,9,6,9,12,117,56,116,111,119,99,115,11,115,116,114,105,110,103,11,102,112,117,116,119,115,6,67,8,102,102,105,10,112,97,105,114,115,3,128,128,192,153,4,2,0,1,1,1,2,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,7,7,7,7,7,8,8,8,8,8,8,8,8,8,7,11,11,11,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,12,16,11,17,4,4,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,20,115,116,100,111,117,116,0,0,86,108,105,115,116,0,4,82,107,101,121,0,1,81,4,3,62,5,0,62,6,0,62,107,0,1,59,118,0,0,59,1,19,11,2,0,11,3,0,11,105,0,1,9,0,60,2,0,3,1,2,0,6,14,116,2,45,0,0,0,54,1,0,0,57,1,1,1,71,2,0,0,65,0,1,1,75,0,1,0,3,192,11,115,116,100,111,117,116,7,105,111,1,1,1,1,1,2,102,112,114,105,110,116,0,0,180,1,2,1,5,0,10,0,20,30,121,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,3,0,0,57,2,6,0,71,4,1,0,65,2,1,2,18,3,2,0,57,2,7,2,66,2,2,2,54,3,8,0,57,3,9,3,66,1,3,1,75,0,1,0,11,115,116,100,111,117,116,7,105,111,12,117,56,116,111,119,99,115,11,102,111,114,109,97,116,11,102,112,117,116,119,115,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,3,102,111,114,109,97,116,0,0,21,0,60,2,0,3,1,2,0,6,14,127,2,45,0,0,0,54,1,0,0,57,1,1,1,71,2,0,0,65,0,1,1,75,0,1,0,3,192,11,115,116,100,101,114,114,7,105,111,1,1,1,1,1,2,102,112,114,105,110,116,0,0,176,1,2,1,5,0,10,0,19,29,131,1,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,3,0,0,57,2,6,0,66,2,2,2,18,3,2,0,57,2,7,2,66,2,2,2,54,3,8,0,57,3,9,3,66,1,3,1,75,0,1,0,11,115,116,100,101,114,114,7,105,111,12,117,56,116,111,119,99,115,11,102,111,114,109,97,116,11,102,112,117,116,119,115,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,3,102,111,114,109,97,116,0,0,20,0,116,2,1,5,0,5,0,12,22,137,1,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,18,3,0,0,57,2,4,0,71,4,1,0,65,2,1,0,67,1,0,0,11,102,111,114,109,97,116,10,101,114,114,111,114,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,102,111,114,109,97,116,0,0,13,0,189,2,0,2,9,0,14,1,39,63,143,1,8,54,2,0,0,18,3,0,0,66,2,2,2,7,2,1,0,88,2,9,128,54,2,2,0,57,2,3,2,57,2,4,2,18,4,0,0,57,3,5,0,66,3,2,2,54,4,6,0,57,4,7,4,66,2,3,1,14,0,1,0,88,2,1,128,41,1,0,4,54,2,2,0,57,2,8,2,39,3,9,0,22,4,0,1,66,2,3,2,54,3,2,0,57,3,1,3,54,4,1,0,57,4,10,4,54,5,2,0,57,5,3,5,57,5,11,5,18,6,2,0,18,7,1,0,54,8,6,0,57,8,12,8,66,5,4,0,65,4,0,0,65,3,0,2,18,4,3,0,57,3,13,3,68,3,2,0,11,114,101,109,111,118,101,10,115,116,100,105,110,11,102,103,101,116,119,115,12,119,99,115,116,111,117,56,15,119,99,104,97,114,95,116,91,63,93,8,110,101,119,11,115,116,100,111,117,116,7,105,111,12,117,56,116,111,119,99,115,11,102,112,117,116,119,115,6,67,8,102,102,105,11,115,116,114,105,110,103,9,116,121,112,101,2,1,1,1,1,1,2,2,2,2,2,2,2,2,2,5,5,5,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,109,101,115,115,97,103,101,0,0,40,115,105,122,101,0,0,40,98,117,102,0,23,17,0,236,6,3,0,5,0,37,0,47,93,0,152,1,51,0,0,0,54,1,1,0,51,2,3,0,61,2,2,1,54,1,4,0,57,1,5,1,39,2,6,0,66,1,2,1,54,1,4,0,57,1,7,1,7,1,8,0,88,1,3,128,54,1,9,0,51,2,11,0,61,2,10,1,54,1,12,0,51,2,14,0,61,2,13,1,54,1,12,0,51,2,16,0,61,2,15,1,53,1,17,0,54,2,4,0,57,2,18,2,39,3,19,0,66,2,2,2,54,3,12,0,51,4,21,0,61,4,20,3,54,3,22,0,43,4,2,0,61,4,23,3,51,3,24,0,51,4,25,0,55,4,26,0,51,4,27,0,55,4,28,0,51,4,29,0,55,4,30,0,51,4,31,0,55,4,32,0,51,4,33,0,55,4,34,0,51,4,35,0,55,4,36,0,50,0,0,128,75,0,1,0,11,114,101,97,100,108,110,0,11,101,114,114,111,114,102,0,12,101,112,114,105,110,116,102,0,11,101,112,114,105,110,116,0,11,112,114,105,110,116,102,0,10,112,114,105,110,116,0,0,15,112,114,105,110,116,95,102,108,97,103,10,116,97,98,108,101,0,9,104,97,115,104,13,99,104,97,114,91,54,53,93,8,110,101,119,1,0,3,9,120,120,104,51,3,2,11,115,104,97,50,53,54,3,3,10,99,114,99,51,50,3,1,0,12,119,99,115,116,111,117,56,0,12,117,56,116,111,119,99,115,11,115,116,114,105,110,103,0,15,115,101,116,117,49,54,109,111,100,101,7,105,111,12,87,105,110,100,111,119,115,7,111,115,142,3,118,111,105,100,32,105,111,95,115,101,116,117,49,54,109,111,100,101,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,32,47,47,32,87,105,110,100,111,119,115,32,111,110,108,121,10,98,111,111,108,32,117,56,116,111,119,99,115,40,119,99,104,97,114,95,116,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,115,111,117,114,99,101,44,32,115,105,122,101,95,116,32,115,105,122,101,41,59,10,98,111,111,108,32,119,99,115,116,111,117,56,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,119,99,104,97,114,95,116,32,42,115,111,117,114,99,101,44,32,115,105,122,101,95,116,32,115,105,122,101,41,59,10,115,105,122,101,95,116,32,119,99,115,108,101,110,40,99,111,110,115,116,32,119,99,104,97,114,95,116,32,42,115,116,114,41,59,10,105,110,116,32,102,112,117,116,119,115,40,99,111,110,115,116,32,119,99,104,97,114,95,116,32,42,115,116,114,44,32,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,119,99,104,97,114,95,116,32,42,102,103,101,116,119,115,40,119,99,104,97,114,95,116,32,42,100,101,115,116,44,32,115,105,122,101,95,116,32,110,44,32,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,115,105,122,101,95,116,32,104,97,115,104,95,100,105,103,101,115,116,40,105,110,116,32,97,108,103,111,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,97,116,97,44,32,115,105,122,101,95,116,32,115,105,122,101,44,32,99,104,97,114,32,42,100,101,115,116,41,59,10,9,99,100,101,102,8,102,102,105,0,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,0,12,16,33,16,37,37,45,45,47,47,47,47,49,52,49,56,62,56,65,71,65,74,75,75,75,75,80,85,80,88,88,88,113,118,116,124,121,129,127,134,131,140,137,151,143,151,151,116,121,112,101,115,97,109,101,0,2,46,104,97,115,104,97,108,103,111,115,0,21,25,104,97,115,104,100,105,103,101,115,116,0,4,21,102,112,114,105,110,116,0,7,14,0,0,
\ No newline at end of file
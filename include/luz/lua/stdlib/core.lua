@@ -41,6 +41,7 @@ bool wcstou8(char *dest, const wchar_t *source, size_t size);
 size_t wcslen(const wchar_t *str);
 int fputws(const wchar_t *str, struct FILE *fp);
 wchar_t *fgetws(wchar_t *dest, size_t n, struct FILE *fp);
+size_t hash_digest(int algo, const char *data, size_t size, char *dest);
 ]]
 
 if ffi.os == "Windows" then
@@ -69,6 +70,20 @@ function string.wcstou8(src)
     return ffi.string(dest)
 end
 
+-- @private hash algorithm name => HASH_*
+local hashalgos = {crc32 = 1, xxh3 = 2, sha256 = 3}
+local hashdigest = ffi.new("char[65]")
+
+-- Get hex digest of the string
+-- @param {string} algo: "xxh3"(default, fastest) | "crc32" | "sha256"
+-- @returns {string} lowercase hex digest
+function string:hash(algo)
+    debug.checkarg(2, self, "string", algo, "nil|string")
+    local id = hashalgos[algo or "xxh3"]
+    if id == nil then error("unknown hash algorithm: " .. tostring(algo)) end
+    return ffi.string(hashdigest, ffi.C.hash_digest(id, self, #self, hashdigest))
+end
+
 -- Flag for serialization when printing table
 table.print_flag = true -- true: print(tbl) => table.serialize(tbl, 2, true)
 
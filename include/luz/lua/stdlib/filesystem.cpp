@@ -1 +1 @@
-27,76,74,2,0,20,64,115,116,100,108,105,98,58,47,47,102,105,108,101,115,121,115,116,101,109,199,1,0,1,6,0,9,1,23,38,56,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,18,112,97,116,104,95,98,97,115,101,110,97,109,101,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,195,1,0,1,6,0,9,1,23,38,64,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,14,112,97,116,104,95,115,116,101,109,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,194,1,0,1,6,0,9,1,23,38,72,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,13,112,97,116,104,95,101,120,116,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,200,1,0,1,6,0,9,1,23,38,80,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,19,112,97,116,104,95,112,97,114,101,110,116,100,105,114,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,113,0,1,5,0,6,0,11,19,87,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,16,112,97,116,104,95,105,115,102,105,108,101,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,112,97,116,104,0,0,12,0,112,0,1,5,0,6,0,11,19,93,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,15,112,97,116,104,95,105,115,100,105,114,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,112,97,116,104,0,0,12,0,179,1,0,1,6,0,8,0,20,35,99,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,41,3,0,4,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,6,3,57,3,7,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,18,112,97,116,104,95,99,111,109,112,108,101,116,101,6,67,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,21,100,101,115,116,0,12,9,0,186,3,0,1,5,0,20,0,44,59,107,17,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,66,1,2,2,54,2,3,0,57,2,6,2,57,2,7,2,18,3,1,0,18,4,0,0,66,2,3,2,14,0,2,0,88,2,2,128,43,2,0,0,76,2,2,0,53,2,9,0,57,3,8,1,61,3,8,2,57,3,10,1,61,3,10,2,57,3,11,1,61,3,11,2,57,3,12,1,61,3,12,2,57,3,13,1,61,3,13,2,57,3,14,1,61,3,14,2,57,3,15,1,61,3,15,2,57,3,16,1,61,3,16,2,57,3,17,1,61,3,17,2,57,3,18,1,61,3,18,2,57,3,19,1,61,3,19,2,76,2,2,0,25,108,97,115,116,95,99,104,97,110,103,101,100,95,115,101,99,111,110,100,115,26,108,97,115,116,95,109,111,100,105,102,105,101,100,95,115,101,99,111,110,100,115,26,108,97,115,116,95,97,99,99,101,115,115,101,100,95,115,101,99,111,110,100,115,9,115,105,122,101,22,115,112,101,99,105,97,108,95,100,101,118,105,99,101,95,105,100,13,103,114,111,117,112,95,105,100,12,117,115,101,114,95,105,100,11,110,108,105,110,107,115,16,97,99,99,101,115,115,95,109,111,100,101,10,105,110,111,100,101,1,0,0,14,100,101,118,105,99,101,95,105,100,14,112,97,116,104,95,115,116,97,116,6,67,16,112,97,116,104,95,115,116,97,116,95,116,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,3,3,3,3,3,3,3,3,3,3,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15,16,112,97,116,104,0,0,45,115,116,97,116,0,11,34,0,203,1,0,1,6,0,9,1,23,38,127,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,22,112,97,116,104,95,97,112,112,101,110,100,95,115,108,97,115,104,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,4,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,204,1,0,1,6,0,9,1,23,38,134,1,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,22,112,97,116,104,95,114,101,109,111,118,101,95,115,108,97,115,104,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,174,1,0,3,9,0,6,0,19,47,141,1,3,54,3,0,0,57,3,1,3,41,4,2,0,18,5,0,0,39,6,2,0,18,7,1,0,39,8,2,0,66,3,6,1,54,3,3,0,57,3,4,3,57,3,5,3,18,4,0,0,18,5,1,0,11,2,0,0,88,6,2,128,43,6,2,0,88,7,1,128,18,6,2,0,68,3,4,0,16,102,115,95,99,111,112,121,102,105,108,101,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,115,114,99,0,0,20,100,101,115,116,0,0,20,105,115,79,118,101,114,119,114,105,116,101,0,0,20,0,116,0,1,5,0,6,0,11,23,147,1,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,14,102,115,95,114,109,102,105,108,101,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,102,105,108,101,110,97,109,101,0,0,12,0,110,0,1,5,0,6,0,11,18,153,1,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,13,102,115,95,109,107,100,105,114,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,100,105,114,0,0,12,0,134,1,0,2,8,0,6,0,14,28,159,1,3,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,2,0,66,2,6,1,54,2,3,0,57,2,4,2,57,2,5,2,18,3,0,0,18,4,1,0,68,2,3,0,15,102,115,95,99,111,112,121,100,105,114,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,2,2,115,114,99,0,0,15,100,101,115,116,0,0,15,0,110,0,1,5,0,6,0,11,18,165,1,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,13,102,115,95,114,109,100,105,114,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,100,105,114,0,0,12,0,172,1,0,3,9,0,6,0,19,47,171,1,3,54,3,0,0,57,3,1,3,41,4,2,0,18,5,0,0,39,6,2,0,18,7,1,0,39,8,2,0,66,3,6,1,54,3,3,0,57,3,4,3,57,3,5,3,18,4,0,0,18,5,1,0,11,2,0,0,88,6,2,128,43,6,2,0,88,7,1,128,18,6,2,0,68,3,4,0,14,102,115,95,114,101,110,97,109,101,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,115,114,99,0,0,20,100,101,115,116,0,0,20,105,115,79,118,101,114,119,114,105,116,101,0,0,20,0,98,0,1,3,0,4,0,11,19,197,1,5,57,1,0,0,10,1,0,0,88,1,7,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,1,43,1,0,0,61,1,0,0,75,0,1,0,14,102,115,95,112,99,108,111,115,101,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,2,2,2,2,2,3,3,5,115,101,108,102,0,0,12,0,98,0,1,3,0,4,0,11,19,213,1,5,57,1,0,0,15,0,1,0,88,2,7,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,1,43,1,0,0,61,1,0,0,75,0,1,0,14,102,115,95,102,99,108,111,115,101,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,2,2,2,2,2,3,3,5,115,101,108,102,0,0,12,0,188,3,1,3,7,0,22,0,59,85,192,1,28,54,3,0,0,57,3,1,3,41,4,1,0,18,5,1,0,39,6,2,0,66,3,4,1,14,0,2,0,88,3,1,128,39,2,3,0,18,4,2,0,57,3,4,2,39,5,5,0,66,3,3,2,15,0,3,0,88,4,11,128,51,3,7,0,61,3,6,0,54,3,9,0,57,3,10,3,57,3,11,3,18,4,1,0,57,5,12,2,41,6,2,0,66,5,2,0,65,3,1,2,61,3,8,0,18,4,2,0,57,3,4,2,39,5,13,0,66,3,3,2,15,0,3,0,88,4,8,128,54,3,14,0,57,3,15,3,54,4,14,0,57,4,16,4,57,4,17,4,18,5,1,0,66,4,2,0,65,3,0,1,18,4,2,0,57,3,18,2,39,5,19,0,66,3,3,2,11,3,0,0,88,3,3,128,18,3,2,0,39,4,19,0,38,2,4,3,51,3,20,0,61,3,6,0,54,3,9,0,57,3,10,3,57,3,21,3,18,4,1,0,18,5,2,0,66,3,3,2,61,3,8,0,75,0,1,0,13,102,115,95,102,111,112,101,110,0,6,98,9,102,105,110,100,14,112,97,114,101,110,116,100,105,114,9,112,97,116,104,10,109,107,100,105,114,7,102,115,7,94,119,8,115,117,98,13,102,115,95,112,111,112,101,110,6,67,8,102,102,105,12,104,97,110,100,108,101,114,0,10,99,108,111,115,101,7,94,112,10,109,97,116,99,104,7,114,98,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,4,4,4,4,4,4,10,10,11,11,11,11,11,11,11,11,11,14,14,14,14,14,14,15,15,15,15,15,15,15,15,18,18,18,18,18,18,19,19,19,26,26,27,27,27,27,27,27,27,28,115,101,108,102,0,0,60,102,105,108,101,110,97,109,101,0,0,60,109,111,100,101,0,0,60,0,60,0,1,3,0,1,0,7,15,222,1,2,57,1,0,0,15,0,1,0,88,2,3,128,18,2,0,0,57,1,0,0,66,1,2,1,75,0,1,0,10,99,108,111,115,101,1,1,1,1,1,1,2,115,101,108,102,0,0,8,0,169,1,0,1,7,0,6,0,21,42,228,1,7,18,2,0,0,57,1,0,0,66,1,2,2,18,3,0,0,57,2,1,0,41,4,0,0,54,5,2,0,57,5,3,5,57,5,4,5,66,2,4,1,18,3,0,0,57,2,0,0,66,2,2,2,18,4,0,0,57,3,1,0,18,5,1,0,54,6,2,0,57,6,3,6,57,6,5,6,66,3,4,1,76,2,2,0,9,104,101,97,100,9,116,97,105,108,14,115,101,101,107,95,102,114,111,109,7,102,115,9,115,101,101,107,8,112,111,115,1,1,1,2,2,2,2,2,2,2,4,4,4,5,5,5,5,5,5,5,6,115,101,108,102,0,0,22,99,117,114,0,4,18,115,105,122,101,0,10,8,0,145,2,0,1,7,0,9,3,37,57,239,1,14,52,1,0,0,18,3,0,0,57,2,0,0,66,2,2,2,54,3,1,0,57,3,2,3,4,2,3,0,88,3,23,128,85,3,22,128,9,2,0,0,88,3,9,128,18,4,0,0,57,3,3,0,41,5,1,0,54,6,1,0,57,6,4,6,57,6,5,6,66,3,4,1,88,3,12,128,88,3,3,128,9,2,1,0,88,3,1,128,88,3,8,128,21,3,1,0,22,3,2,3,60,2,3,1,18,4,0,0,57,3,0,0,66,3,2,2,18,2,3,0,88,3,229,127,54,3,6,0,57,3,7,3,54,4,8,0,18,5,1,0,66,4,2,0,67,3,0,0,11,117,110,112,97,99,107,9,99,104,97,114,11,115,116,114,105,110,103,8,99,117,114,14,115,101,101,107,95,102,114,111,109,9,115,101,101,107,8,101,111,102,7,102,115,13,114,101,97,100,99,104,97,114,26,20,2,1,2,2,2,3,3,3,3,3,4,4,5,5,5,5,5,5,5,6,6,7,7,8,10,10,10,11,11,11,11,11,13,13,13,13,13,13,115,101,108,102,0,0,38,98,121,116,101,115,0,2,36,99,0,3,33,0,64,0,1,3,0,4,0,5,13,129,2,2,54,1,0,0,57,1,1,1,57,1,2,1,57,2,3,0,68,1,2,0,12,104,97,110,100,108,101,114,10,102,103,101,116,99,6,67,8,102,102,105,1,1,1,1,1,115,101,108,102,0,0,6,0,130,2,0,2,8,0,11,1,31,60,136,2,5,54,2,0,0,57,2,1,2,41,3,1,0,18,4,1,0,39,5,2,0,66,2,4,1,54,2,3,0,57,2,4,2,39,3,5,0,22,4,0,1,66,2,3,2,54,3,3,0,57,3,6,3,57,3,7,3,18,4,2,0,41,5,1,0,18,6,1,0,57,7,8,0,66,3,5,2,41,4,0,0,1,4,3,0,88,4,7,128,54,4,3,0,57,4,9,4,18,5,2,0,18,6,3,0,66,4,3,2,14,0,4,0,88,5,1,128,39,4,10,0,76,4,2,0,5,11,115,116,114,105,110,103,12,104,97,110,100,108,101,114,10,102,114,101,97,100,6,67,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,115,101,108,102,0,0,32,115,105,122,101,0,0,32,100,97,116,97,0,12,20,114,101,97,100,0,8,12,0,207,1,0,3,8,0,10,0,22,44,147,2,3,54,3,0,0,57,3,1,3,41,4,1,0,18,5,1,0,39,6,2,0,66,3,4,1,54,3,3,0,57,3,4,3,57,3,5,3,54,4,3,0,57,4,6,4,39,5,7,0,18,6,1,0,66,4,3,2,41,5,1,0,12,6,2,0,88,6,3,128,18,7,1,0,57,6,8,1,66,6,2,2,57,7,9,0,68,3,5,0,12,104,97,110,100,108,101,114,8,108,101,110,16,99,111,110,115,116,32,99,104,97,114,42,9,99,97,115,116,11,102,119,114,105,116,101,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,115,101,108,102,0,0,23,100,97,116,97,0,0,23,115,105,122,101,0,0,23,0,172,1,0,2,6,0,9,0,20,32,155,2,3,54,2,0,0,57,2,1,2,41,3,1,0,18,4,1,0,39,5,2,0,66,2,4,1,54,2,3,0,57,2,4,2,54,3,5,0,57,3,6,3,57,3,7,3,18,4,1,0,57,5,8,0,66,3,3,2,5,2,3,0,88,2,2,128,43,2,1,0,88,3,1,128,43,2,2,0,76,2,2,0,12,104,97,110,100,108,101,114,10,102,112,117,116,99,6,67,8,102,102,105,8,101,111,102,7,102,115,11,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,115,101,108,102,0,0,21,99,0,0,21,0,211,1,0,3,7,0,10,1,23,47,164,2,3,54,3,0,0,57,3,1,3,41,4,1,0,18,5,1,0,39,6,2,0,66,3,4,1,54,3,3,0,57,3,4,3,57,3,5,3,57,4,6,0,18,5,1,0,12,6,2,0,88,6,3,128,54,6,7,0,57,6,8,6,57,6,9,6,66,3,4,2,8,3,0,0,88,3,2,128,43,3,1,0,88,4,1,128,43,3,2,0,76,3,2,0,9,104,101,97,100,14,115,101,101,107,95,102,114,111,109,7,102,115,12,104,97,110,100,108,101,114,10,102,115,101,101,107,6,67,8,102,102,105,11,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,0,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,115,101,108,102,0,0,24,111,102,102,115,101,116,0,0,24,102,114,111,109,0,0,24,0,83,0,1,4,0,5,0,7,15,171,2,2,54,1,0,0,54,2,1,0,57,2,2,2,57,2,3,2,57,3,4,0,66,2,2,0,67,1,0,0,12,104,97,110,100,108,101,114,10,102,116,101,108,108,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,1,1,1,1,1,1,1,115,101,108,102,0,0,8,0,96,0,1,3,0,4,1,11,19,177,2,2,54,1,0,0,57,1,1,1,57,1,2,1,57,2,3,0,66,1,2,2,8,1,0,0,88,1,2,128,43,1,1,0,88,2,1,128,43,1,2,0,76,1,2,0,12,104,97,110,100,108,101,114,11,102,102,108,117,115,104,6,67,8,102,102,105,0,1,1,1,1,1,1,1,1,1,1,1,115,101,108,102,0,0,12,0,113,0,2,5,1,2,0,11,44,188,2,5,45,2,0,0,57,2,0,2,18,3,0,0,18,4,1,0,66,2,3,2,57,3,1,2,11,3,0,0,88,3,2,128,43,3,0,0,76,3,2,0,76,2,2,0,0,192,12,104,97,110,100,108,101,114,8,110,101,119,1,1,1,1,1,3,3,3,3,3,4,102,105,108,101,114,119,0,102,105,108,101,110,97,109,101,0,0,12,109,111,100,101,0,0,12,102,105,108,101,0,6,6,0,239,1,0,2,6,0,10,0,29,62,196,2,10,54,2,0,0,57,2,1,2,41,3,1,0,18,4,0,0,39,5,2,0,66,2,4,1,54,2,3,0,57,2,4,2,18,3,0,0,39,4,5,0,66,2,3,2,11,2,0,0,88,3,2,128,39,3,6,0,76,3,2,0,14,0,1,0,88,3,4,128,18,4,2,0,57,3,7,2,66,3,2,2,18,1,3,0,18,4,2,0,57,3,8,2,18,5,1,0,66,3,3,2,18,5,2,0,57,4,9,2,66,4,2,1,76,3,2,0,10,99,108,111,115,101,9,114,101,97,100,9,115,105,122,101,5,7,114,98,9,111,112,101,110,7,102,115,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,3,3,3,3,3,4,4,4,4,6,6,6,6,6,6,7,7,7,7,8,8,8,9,102,105,108,101,110,97,109,101,0,0,30,115,105,122,101,0,0,30,102,105,108,101,0,12,18,100,97,116,97,0,14,4,0,230,1,0,3,9,0,9,0,26,69,209,2,9,54,3,0,0,57,3,1,3,41,4,2,0,18,5,0,0,39,6,2,0,18,7,1,0,39,8,2,0,66,3,6,1,54,3,3,0,57,3,4,3,18,4,0,0,39,5,5,0,66,3,3,2,11,3,0,0,88,4,2,128,39,4,6,0,76,4,2,0,18,5,3,0,57,4,7,3,18,6,1,0,18,7,2,0,66,4,4,2,18,6,3,0,57,5,8,3,66,5,2,1,76,4,2,0,10,99,108,111,115,101,10,119,114,105,116,101,5,7,119,98,9,111,112,101,110,7,102,115,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,3,3,3,3,3,4,4,4,4,6,6,6,6,6,7,7,7,8,102,105,108,101,110,97,109,101,0,0,27,100,97,116,97,0,0,27,115,105,122,101,0,0,27,102,105,108,101,0,14,13,119,114,105,116,116,101,110,0,9,4,0,137,1,0,2,6,0,7,0,13,27,223,2,3,54,2,0,0,57,2,1,2,41,3,1,0,18,4,1,0,39,5,2,0,66,2,4,1,54,2,4,0,57,2,5,2,57,2,6,2,18,3,1,0,66,2,2,2,61,2,3,0,75,0,1,0,15,102,115,95,111,112,101,110,100,105,114,6,67,8,102,102,105,12,104,97,110,100,108,101,114,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,3,115,101,108,102,0,0,14,100,105,114,0,0,14,0,45,0,1,3,0,1,0,4,12,228,2,2,18,2,0,0,57,1,0,0,66,1,2,1,75,0,1,0,10,99,108,111,115,101,1,1,1,2,115,101,108,102,0,0,5,0,100,0,1,3,0,4,0,11,19,233,2,5,57,1,0,0,10,1,0,0,88,1,7,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,1,43,1,0,0,61,1,0,0,75,0,1,0,16,102,115,95,99,108,111,115,101,100,105,114,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,2,2,2,2,2,3,3,5,115,101,108,102,0,0,12,0,69,0,1,3,0,4,0,5,13,242,2,2,54,1,0,0,57,1,1,1,57,1,2,1,57,2,3,0,68,1,2,0,12,104,97,110,100,108,101,114,15,102,115,95,115,101,101,107,100,105,114,6,67,8,102,102,105,1,1,1,1,1,115,101,108,102,0,0,6,0,96,0,1,4,0,5,0,8,16,248,2,2,54,1,0,0,57,1,1,1,54,2,0,0,57,2,2,2,57,2,3,2,57,3,4,0,66,2,2,0,67,1,0,0,12,104,97,110,100,108,101,114,20,102,115,95,114,101,97,100,100,105,114,95,110,97,109,101,6,67,11,115,116,114,105,110,103,8,102,102,105,1,1,1,1,1,1,1,1,115,101,108,102,0,0,9,0,96,0,1,4,0,5,0,8,16,253,2,2,54,1,0,0,57,1,1,1,54,2,0,0,57,2,2,2,57,2,3,2,57,3,4,0,66,2,2,0,67,1,0,0,12,104,97,110,100,108,101,114,20,102,115,95,114,101,97,100,100,105,114,95,112,97,116,104,6,67,11,115,116,114,105,110,103,8,102,102,105,1,1,1,1,1,1,1,1,115,101,108,102,0,0,9,0,102,0,1,3,1,2,0,10,37,133,3,5,45,1,0,0,57,1,0,1,18,2,0,0,66,1,2,2,57,2,1,1,11,2,0,0,88,2,2,128,43,2,0,0,76,2,2,0,76,1,2,0,1,192,12,104,97,110,100,108,101,114,8,110,101,119,1,1,1,1,3,3,3,3,3,4,101,110,117,109,101,114,97,116,111,114,0,100,105,114,0,0,11,100,105,114,101,110,116,0,5,6,0,196,2,2,2,8,0,10,0,43,70,145,3,12,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,54,2,4,0,57,2,5,2,18,3,0,0,66,2,2,2,11,2,0,0,88,3,2,128,43,3,1,0,76,3,2,0,85,3,21,128,18,3,1,0,18,5,2,0,57,4,6,2,66,4,2,2,18,6,2,0,57,5,7,2,66,5,2,2,71,6,2,0,65,3,2,2,14,0,3,0,88,3,5,128,18,4,2,0,57,3,8,2,66,3,2,1,43,3,1,0,76,3,2,0,18,4,2,0,57,3,9,2,66,3,2,2,14,0,3,0,88,3,234,127,18,4,2,0,57,3,8,2,66,3,2,1,43,3,2,0,76,3,2,0,9,115,101,101,107,10,99,108,111,115,101,13,114,101,97,100,112,97,116,104,13,114,101,97,100,110,97,109,101,12,111,112,101,110,100,105,114,7,102,115,13,102,117,110,99,116,105,111,110,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,3,3,3,3,4,5,5,5,5,5,5,5,5,5,5,5,6,6,6,7,7,9,9,9,9,9,10,10,10,11,11,100,105,114,0,0,44,99,97,108,108,98,97,99,107,0,0,44,100,105,114,101,110,116,0,13,31,0,251,2,0,5,12,1,10,2,53,106,160,3,18,6,0,0,0,88,5,2,128,7,0,1,0,88,5,2,128,43,5,2,0,76,5,2,0,53,5,2,0,61,1,3,5,54,6,4,0,57,6,3,6,57,6,5,6,18,7,1,0,66,6,2,2,61,6,5,5,54,6,4,0,57,6,3,6,57,6,6,6,18,7,1,0,66,6,2,2,61,6,6,5,57,6,5,5,15,0,6,0,88,7,6,128,6,4,7,0,88,6,26,128,21,6,2,0,22,6,0,6,60,5,6,2,88,6,22,128,57,6,6,5,15,0,6,0,88,7,19,128,6,4,8,0,88,6,3,128,21,6,2,0,22,6,0,6,60,5,6,2,8,3,1,0,88,6,10,128,54,6,4,0,57,6,9,6,57,7,3,5,45,8,0,0,18,9,2,0,23,10,0,3,18,11,4,0,66,6,6,2,14,0,6,0,88,7,1,128,43,6,2,0,76,6,2,0,43,6,2,0,76,6,2,0,2,192,12,115,99,97,110,100,105,114,9,102,105,108,101,8,100,105,114,10,105,115,100,105,114,11,105,115,102,105,108,101,7,102,115,9,112,97,116,104,1,0,0,6,46,7,46,46,2,0,1,1,1,1,1,1,2,3,4,4,4,4,4,4,5,5,5,5,5,5,7,7,7,8,8,9,9,9,10,11,11,11,12,12,13,13,13,15,15,15,15,15,15,15,15,15,15,15,15,15,15,17,17,101,110,117,109,102,105,108,101,115,0,110,97,109,101,0,0,54,112,97,116,104,0,0,54,100,101,115,116,0,0,54,110,101,115,116,0,0,54,109,111,100,101,0,0,54,105,110,102,111,0,21,33,0,172,1,0,3,10,1,3,0,21,60,185,3,3,52,3,0,0,54,4,0,0,57,4,1,4,18,5,0,0,45,6,0,0,18,7,3,0,11,1,0,0,88,8,2,128,41,8,255,255,88,9,1,128,18,8,1,0,12,9,2,0,88,9,1,128,39,9,2,0,66,4,6,2,15,0,4,0,88,5,2,128,12,4,3,0,88,4,1,128,52,4,0,0,76,4,2,0,2,192,8,97,108,108,12,115,99,97,110,100,105,114,7,102,115,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,101,110,117,109,102,105,108,101,115,0,100,105,114,0,0,22,110,101,115,116,0,0,22,109,111,100,101,0,0,22,102,105,108,101,115,0,2,20,0,183,24,3,0,5,0,87,0,137,1,181,2,0,189,3,54,0,0,0,14,0,0,0,88,1,1,128,52,0,0,0,55,0,0,0,54,0,0,0,52,1,0,0,61,1,1,0,54,0,2,0,57,0,3,0,39,1,4,0,66,0,2,1,54,0,0,0,57,0,1,0,51,1,6,0,61,1,5,0,54,0,0,0,57,0,1,0,51,1,8,0,61,1,7,0,54,0,0,0,57,0,1,0,51,1,10,0,61,1,9,0,54,0,0,0,57,0,1,0,51,1,12,0,61,1,11,0,54,0,0,0,57,0,1,0,51,1,14,0,61,1,13,0,54,0,0,0,57,0,1,0,51,1,16,0,61,1,15,0,54,0,0,0,57,0,1,0,51,1,18,0,61,1,17,0,54,0,0,0,57,0,1,0,51,1,20,0,61,1,19,0,54,0,0,0,57,0,1,0,51,1,22,0,61,1,21,0,54,0,0,0,57,0,1,0,51,1,24,0,61,1,23,0,54,0,0,0,51,1,26,0,61,1,25,0,54,0,0,0,51,1,28,0,61,1,27,0,54,0,0,0,51,1,30,0,61,1,29,0,54,0,0,0,51,1,32,0,61,1,31,0,54,0,0,0,51,1,34,0,61,1,33,0,54,0,0,0,51,1,36,0,61,1,35,0,54,0,0,0,53,1,38,0,61,1,37,0,54,0,0,0,41,1,255,255,61,1,39,0,54,0,40,0,53,1,42,0,51,2,41,0,61,2,43,1,51,2,44,0,61,2,45,1,51,2,46,0,61,2,47,1,51,2,48,0,61,2,49,1,51,2,50,0,61,2,51,1,51,2,52,0,61,2,53,1,51,2,54,0,61,2,55,1,51,2,56,0,61,2,57,1,51,2,58,0,61,2,59,1,51,2,60,0,61,2,61,1,51,2,62,0,61,2,63,1,66,0,2,2,54,1,0,0,51,2,65,0,61,2,64,1,54,1,0,0,51,2,67,0,61,2,66,1,54,1,0,0,51,2,69,0,61,2,68,1,54,1,40,0,53,2,71,0,51,3,70,0,61,3,43,2,51,3,72,0,61,3,45,2,51,3,73,0,61,3,74,2,51,3,75,0,61,3,59,2,51,3,76,0,61,3,77,2,51,3,78,0,61,3,79,2,66,1,2,2,54,2,0,0,51,3,81,0,61,3,80,2,54,2,0,0,51,3,83,0,61,3,82,2,51,2,84,0,54,3,0,0,51,4,86,0,61,4,85,3,50,0,0,128,75,0,1,0,0,14,101,110,117,109,102,105,108,101,115,0,0,12,115,99,97,110,100,105,114,0,12,111,112,101,110,100,105,114,13,114,101,97,100,112,97,116,104,0,13,114,101,97,100,110,97,109,101,0,0,10,99,108,111,115,101,0,0,1,0,0,0,0,14,119,114,105,116,101,102,105,108,101,0,13,114,101,97,100,102,105,108,101,0,9,111,112,101,110,10,102,108,117,115,104,0,8,112,111,115,0,9,115,101,101,107,0,14,119,114,105,116,101,99,104,97,114,0,10,119,114,105,116,101,0,9,114,101,97,100,0,13,114,101,97,100,99,104,97,114,0,13,114,101,97,100,108,105,110,101,0,9,115,105,122,101,0,15,100,101,115,116,114,117,99,116,111,114,0,16,99,111,110,115,116,114,117,99,116,111,114,1,0,0,0,10,99,108,97,115,115,8,101,111,102,1,0,3,8,99,117,114,3,1,9,116,97,105,108,3,2,9,104,101,97,100,3,0,14,115,101,101,107,95,102,114,111,109,0,11,114,101,110,97,109,101,0,10,114,109,100,105,114,0,12,99,111,112,121,100,105,114,0,10,109,107,100,105,114,0,11,114,109,102,105,108,101,0,13,99,111,112,121,102,105,108,101,0,17,114,101,109,111,118,101,95,115,108,97,115,104,0,17,97,112,112,101,110,100,95,115,108,97,115,104,0,9,115,116,97,116,0,13,99,111,109,112,108,101,116,101,0,10,105,115,100,105,114,0,11,105,115,102,105,108,101,0,14,112,97,114,101,110,116,100,105,114,0,8,101,120,116,0,9,115,116,101,109,0,13,98,97,115,101,110,97,109,101,210,14,116,121,112,101,100,101,102,32,115,116,114,117,99,116,32,123,10,32,32,32,32,117,110,115,105,103,110,101,100,32,108,111,110,103,32,100,101,118,105,99,101,95,105,100,44,32,105,110,111,100,101,59,10,32,32,32,32,117,110,115,105,103,110,101,100,32,115,104,111,114,116,32,97,99,99,101,115,115,95,109,111,100,101,59,10,32,32,32,32,115,104,111,114,116,32,110,108,105,110,107,115,44,32,117,115,101,114,95,105,100,44,32,103,114,111,117,112,95,105,100,59,10,32,32,32,32,117,110,115,105,103,110,101,100,32,108,111,110,103,32,115,112,101,99,105,97,108,95,100,101,118,105,99,101,95,105,100,59,10,32,32,32,32,117,110,115,105,103,110,101,100,32,108,111,110,103,32,108,111,110,103,32,115,105,122,101,44,10,32,32,32,32,32,32,32,32,108,97,115,116,95,97,99,99,101,115,115,101,100,95,115,101,99,111,110,100,115,44,10,32,32,32,32,32,32,32,32,108,97,115,116,95,109,111,100,105,102,105,101,100,95,115,101,99,111,110,100,115,44,10,32,32,32,32,32,32,32,32,108,97,115,116,95,99,104,97,110,103,101,100,95,115,101,99,111,110,100,115,59,10,125,32,112,97,116,104,95,115,116,97,116,95,116,59,10,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,98,97,115,101,110,97,109,101,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,115,116,101,109,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,101,120,116,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,112,97,114,101,110,116,100,105,114,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,98,111,111,108,32,112,97,116,104,95,105,115,102,105,108,101,40,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,98,111,111,108,32,112,97,116,104,95,105,115,100,105,114,40,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,99,111,109,112,108,101,116,101,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,98,111,111,108,32,112,97,116,104,95,115,116,97,116,40,112,97,116,104,95,115,116,97,116,95,116,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,97,112,112,101,110,100,95,115,108,97,115,104,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,114,101,109,111,118,101,95,115,108,97,115,104,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,10,115,116,114,117,99,116,32,70,73,76,69,32,42,102,115,95,102,111,112,101,110,40,99,111,110,115,116,32,99,104,97,114,32,42,102,105,108,101,110,97,109,101,44,32,99,111,110,115,116,32,99,104,97,114,32,42,109,111,100,101,41,59,10,115,116,114,117,99,116,32,70,73,76,69,32,42,102,115,95,112,111,112,101,110,40,99,111,110,115,116,32,99,104,97,114,32,42,112,114,111,99,110,97,109,101,44,32,99,111,110,115,116,32,99,104,97,114,32,42,109,111,100,101,41,59,10,118,111,105,100,32,102,115,95,102,99,108,111,115,101,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,118,111,105,100,32,102,115,95,112,99,108,111,115,101,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,105,110,116,32,102,103,101,116,99,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,115,105,122,101,95,116,32,102,114,101,97,100,40,118,111,105,100,32,42,98,117,102,44,32,115,105,122,101,95,116,32,115,105,122,101,44,32,115,105,122,101,95,116,32,110,44,32,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,115,105,122,101,95,116,32,102,119,114,105,116,101,40,99,111,110,115,116,32,118,111,105,100,32,42,98,117,102,44,32,115,105,122,101,95,116,32,115,105,122,101,44,32,115,105,122,101,95,116,32,110,44,32,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,105,110,116,32,102,112,117,116,99,40,105,110,116,32,99,44,32,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,105,110,116,32,102,115,101,101,107,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,44,32,108,111,110,103,32,111,102,102,115,101,116,44,32,105,110,116,32,111,114,105,103,105,110,41,59,10,108,111,110,103,32,105,110,116,32,102,116,101,108,108,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,105,110,116,32,102,102,108,117,115,104,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,10,98,111,111,108,32,102,115,95,99,111,112,121,102,105,108,101,40,99,111,110,115,116,32,99,104,97,114,32,42,115,114,99,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,101,115,116,44,32,98,111,111,108,32,105,115,79,118,101,114,119,114,105,116,101,41,59,10,98,111,111,108,32,102,115,95,114,109,102,105,108,101,40,99,111,110,115,116,32,99,104,97,114,32,42,102,105,108,101,110,97,109,101,41,59,10,98,111,111,108,32,102,115,95,109,107,100,105,114,40,99,111,110,115,116,32,99,104,97,114,32,42,100,105,114,41,59,10,98,111,111,108,32,102,115,95,99,111,112,121,100,105,114,40,99,111,110,115,116,32,99,104,97,114,32,42,115,114,99,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,101,115,116,41,59,10,98,111,111,108,32,102,115,95,114,109,100,105,114,40,99,111,110,115,116,32,99,104,97,114,32,42,100,105,114,41,59,10,98,111,111,108,32,102,115,95,114,101,110,97,109,101,40,99,111,110,115,116,32,99,104,97,114,32,42,115,114,99,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,101,115,116,44,32,98,111,111,108,32,105,115,79,118,101,114,119,114,105,116,101,41,59,10,10,115,116,114,117,99,116,32,102,115,95,100,105,114,101,110,116,95,116,32,42,102,115,95,111,112,101,110,100,105,114,40,99,111,110,115,116,32,99,104,97,114,32,42,100,105,114,41,59,10,118,111,105,100,32,102,115,95,99,108,111,115,101,100,105,114,40,115,116,114,117,99,116,32,102,115,95,100,105,114,101,110,116,95,116,32,42,115,101,108,102,41,59,10,98,111,111,108,32,102,115,95,115,101,101,107,100,105,114,40,115,116,114,117,99,116,32,102,115,95,100,105,114,101,110,116,95,116,32,42,115,101,108,102,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,102,115,95,114,101,97,100,100,105,114,95,110,97,109,101,40,115,116,114,117,99,116,32,102,115,95,100,105,114,101,110,116,95,116,32,42,115,101,108,102,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,102,115,95,114,101,97,100,100,105,114,95,112,97,116,104,40,115,116,114,117,99,116,32,102,115,95,100,105,114,101,110,116,95,116,32,42,115,101,108,102,41,59,10,9,99,100,101,102,8,102,102,105,9,112,97,116,104,7,102,115,2,0,2,0,2,0,2,0,2,0,3,0,3,0,3,0,5,0,5,0,52,0,52,0,56,0,56,0,60,0,56,0,64,0,64,0,68,0,64,0,72,0,72,0,76,0,72,0,80,0,80,0,84,0,80,0,87,0,87,0,90,0,87,0,93,0,93,0,96,0,93,0,99,0,99,0,103,0,99,0,107,0,107,0,124,0,107,0,127,0,127,0,131,0,127,0,134,0,134,0,138,0,134,0,141,0,144,0,141,0,147,0,150,0,147,0,153,0,156,0,153,0,159,0,162,0,159,0,165,0,168,0,165,0,171,0,174,0,171,0,178,0,178,0,182,0,185,0,185,0,185,0,188,0,188,0,220,0,220,0,224,0,224,0,235,0,235,0,253,0,253,0,3,1,3,1,13,1,13,1,22,1,22,1,30,1,30,1,39,1,39,1,45,1,45,1,51,1,51,1,188,0,60,1,65,1,60,1,68,1,78,1,68,1,81,1,90,1,81,1,94,1,94,1,98,1,98,1,102,1,102,1,110,1,110,1,116,1,116,1,122,1,122,1,127,1,127,1,94,1,133,1,138,1,133,1,145,1,157,1,145,1,178,1,185,1,188,1,185,1,188,1,188,1,102,105,108,101,114,119,0,102,36,101,110,117,109,101,114,97,116,111,114,0,24,12,101,110,117,109,102,105,108,101,115,0,7,5,0,0,
\ No newline at end of file
+27,76,74,2,0,20,64,115,116,100,108,105,98,58,47,47,102,105,108,101,115,121,115,116,101,109,200,1,0,1,6,0,9,1,23,38,151,1,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,18,112,97,116,104,95,98,97,115,101,110,97,109,101,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,196,1,0,1,6,0,9,1,23,38,159,1,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,14,112,97,116,104,95,115,116,101,109,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,195,1,0,1,6,0,9,1,23,38,167,1,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,13,112,97,116,104,95,101,120,116,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,152,2,0,1,9,0,12,1,35,50,175,1,6,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,66,1,2,2,18,0,1,0,54,1,6,0,57,1,7,1,39,2,8,0,18,4,0,0,57,3,9,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,6,0,57,2,2,2,18,3,1,0,54,4,6,0,57,4,10,4,57,4,11,4,18,5,1,0,18,7,0,0,57,6,9,0,66,6,2,2,22,6,0,6,18,7,0,0,43,8,1,0,66,4,5,0,67,2,1,0,21,112,97,116,104,95,112,97,114,101,110,116,100,105,114,95,115,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,13,99,111,109,112,108,101,116,101,9,112,97,116,104,7,102,115,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,112,97,116,104,0,0,36,100,101,115,116,0,21,15,0,114,0,1,5,0,6,0,11,19,184,1,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,16,112,97,116,104,95,105,115,102,105,108,101,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,112,97,116,104,0,0,12,0,113,0,1,5,0,6,0,11,19,190,1,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,15,112,97,116,104,95,105,115,100,105,114,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,112,97,116,104,0,0,12,0,194,2,0,1,8,0,9,2,44,72,196,1,12,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,18,2,0,0,57,1,3,0,66,1,2,2,22,1,0,1,54,2,4,0,57,2,5,2,39,3,6,0,18,4,1,0,66,2,3,2,54,3,4,0,57,3,7,3,57,3,8,3,18,4,2,0,18,5,1,0,18,6,0,0,66,3,4,2,3,1,3,0,88,4,15,128,22,1,1,3,54,4,4,0,57,4,5,4,39,5,6,0,18,6,1,0,66,4,3,2,18,2,4,0,54,4,4,0,57,4,7,4,57,4,8,4,18,5,2,0,18,6,1,0,18,7,0,0,66,4,4,2,18,3,4,0,54,4,4,0,57,4,2,4,18,5,2,0,18,6,3,0,68,4,3,0,20,112,97,116,104,95,99,111,109,112,108,101,116,101,95,115,6,67,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,8,108,101,110,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,128,4,2,1,1,1,1,1,1,2,2,2,2,3,3,3,3,3,4,4,4,4,4,4,4,5,5,7,8,8,8,8,8,8,9,9,9,9,9,9,9,9,11,11,11,11,11,112,97,116,104,0,0,45,115,105,122,101,0,11,34,100,101,115,116,0,5,29,108,101,110,0,7,22,0,201,1,0,1,6,0,9,1,23,38,212,1,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,19,112,97,116,104,95,110,111,114,109,97,108,105,122,101,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,4,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,129,1,0,1,5,0,6,0,12,24,222,1,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,66,1,2,1,75,0,1,0,22,112,97,116,104,95,99,97,99,104,101,95,101,110,97,98,108,101,6,67,8,102,102,105,11,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,3,99,97,112,97,99,105,116,121,0,0,13,0,60,0,0,1,0,3,0,5,6,228,1,2,54,0,0,0,57,0,1,0,57,0,2,0,66,0,1,1,75,0,1,0,21,112,97,116,104,95,99,97,99,104,101,95,99,108,101,97,114,6,67,8,102,102,105,1,1,1,1,2,0,154,2,0,1,3,0,12,0,24,32,233,1,14,53,1,1,0,57,2,0,0,61,2,0,1,57,2,2,0,61,2,2,1,57,2,3,0,61,2,3,1,57,2,4,0,61,2,4,1,57,2,5,0,61,2,5,1,57,2,6,0,61,2,6,1,57,2,7,0,61,2,7,1,57,2,8,0,61,2,8,1,57,2,9,0,61,2,9,1,57,2,10,0,61,2,10,1,57,2,11,0,61,2,11,1,76,1,2,0,25,108,97,115,116,95,99,104,97,110,103,101,100,95,115,101,99,111,110,100,115,26,108,97,115,116,95,109,111,100,105,102,105,101,100,95,115,101,99,111,110,100,115,26,108,97,115,116,95,97,99,99,101,115,115,101,100,95,115,101,99,111,110,100,115,9,115,105,122,101,22,115,112,101,99,105,97,108,95,100,101,118,105,99,101,95,105,100,13,103,114,111,117,112,95,105,100,12,117,115,101,114,95,105,100,11,110,108,105,110,107,115,16,97,99,99,101,115,115,95,109,111,100,101,10,105,110,111,100,101,1,0,0,14,100,101,118,105,99,101,95,105,100,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,115,116,97,116,0,0,25,0,207,1,0,1,5,1,8,0,23,48,251,1,5,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,66,1,2,2,54,2,3,0,57,2,6,2,57,2,7,2,18,3,1,0,18,4,0,0,66,2,3,2,14,0,2,0,88,2,2,128,43,2,0,0,76,2,2,0,45,2,0,0,18,3,1,0,68,2,2,0,0,192,14,112,97,116,104,95,115,116,97,116,6,67,16,112,97,116,104,95,115,116,97,116,95,116,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,3,3,3,3,3,3,3,3,3,3,4,4,4,115,116,97,116,116,97,98,108,101,0,112,97,116,104,0,0,24,115,116,97,116,0,11,13,0,204,1,0,1,6,0,9,1,23,38,131,2,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,22,112,97,116,104,95,97,112,112,101,110,100,95,115,108,97,115,104,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,4,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,204,1,0,1,6,0,9,1,23,38,138,2,4,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,39,2,5,0,18,4,0,0,57,3,6,0,66,3,2,2,22,3,0,3,66,1,3,2,54,2,3,0,57,2,2,2,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,18,5,0,0,66,3,3,0,67,2,0,0,22,112,97,116,104,95,114,101,109,111,118,101,95,115,108,97,115,104,6,67,8,108,101,110,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,112,97,116,104,0,0,24,100,101,115,116,0,15,9,0,142,2,0,4,10,0,8,0,34,69,148,2,4,54,4,0,0,57,4,1,4,41,5,2,0,18,6,0,0,39,7,2,0,18,8,1,0,39,9,2,0,66,4,6,1,14,0,3,0,88,4,1,128,52,3,0,0,54,4,3,0,57,4,4,4,57,4,5,4,18,5,0,0,18,6,1,0,11,2,0,0,88,7,2,128,43,7,2,0,88,8,1,128,18,7,2,0,57,8,6,3,10,8,2,0,88,8,2,128,43,8,1,0,88,9,1,128,43,8,2,0,57,9,7,3,10,9,2,0,88,9,2,128,43,9,1,0,88,10,1,128,43,9,2,0,68,4,6,0,10,109,116,105,109,101,9,109,111,100,101,19,102,115,95,99,111,112,121,102,105,108,101,95,101,120,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,115,114,99,0,0,35,100,101,115,116,0,0,35,105,115,79,118,101,114,119,114,105,116,101,0,0,35,111,112,116,115,0,0,35,0,116,0,1,5,0,6,0,11,23,155,2,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,14,102,115,95,114,109,102,105,108,101,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,102,105,108,101,110,97,109,101,0,0,12,0,110,0,1,5,0,6,0,11,18,161,2,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,13,102,115,95,109,107,100,105,114,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,100,105,114,0,0,12,0,183,1,0,2,5,0,4,2,19,38,167,2,5,54,2,0,0,18,3,0,0,66,2,2,2,7,2,1,0,88,2,9,128,41,2,0,0,0,0,2,0,88,2,6,128,26,2,0,0,9,2,1,0,88,2,3,128,41,2,0,4,1,2,0,0,88,2,4,128,54,2,2,0,39,3,3,0,22,4,0,1,66,2,3,1,76,0,2,0,42,116,104,114,101,97,100,115,32,109,117,115,116,32,98,101,32,97,110,32,105,110,116,101,103,101,114,32,105,110,32,48,46,46,49,48,50,52,10,101,114,114,111,114,11,110,117,109,98,101,114,9,116,121,112,101,2,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,4,116,104,114,101,97,100,115,0,0,20,108,101,118,101,108,0,0,20,0,157,2,0,3,9,1,8,1,32,76,177,2,7,54,3,0,0,57,3,1,3,41,4,2,0,18,5,0,0,39,6,2,0,18,7,1,0,39,8,2,0,66,3,6,1,45,3,0,0,15,0,2,0,88,4,3,128,57,4,3,2,14,0,4,0,88,5,1,128,41,4,1,0,41,5,2,0,66,3,3,2,8,3,0,0,88,4,7,128,54,4,4,0,57,4,5,4,57,4,6,4,18,5,0,0,18,6,1,0,18,7,3,0,68,4,4,0,54,4,4,0,57,4,5,4,57,4,7,4,18,5,0,0,18,6,1,0,68,4,3,0,1,192,15,102,115,95,99,111,112,121,100,105,114,24,102,115,95,99,111,112,121,100,105,114,95,112,97,114,97,108,108,101,108,6,67,8,102,102,105,12,116,104,114,101,97,100,115,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,3,3,4,4,4,4,4,4,4,6,6,6,6,6,6,99,104,101,99,107,116,104,114,101,97,100,115,0,115,114,99,0,0,33,100,101,115,116,0,0,33,111,112,116,115,0,0,33,116,104,114,101,97,100,115,0,18,15,0,141,7,0,3,22,2,24,1,110,222,1,207,2,20,54,3,0,0,57,3,1,3,41,4,3,0,18,5,0,0,39,6,2,0,18,7,1,0,39,8,2,0,18,9,2,0,39,10,3,0,66,3,8,1,14,0,2,0,88,3,1,128,52,2,0,0,45,3,0,0,57,4,4,2,14,0,4,0,88,5,1,128,39,4,5,0,56,3,4,3,11,3,0,0,88,4,7,128,54,4,6,0,39,5,7,0,54,6,8,0,57,7,4,2,66,6,2,2,38,5,6,5,66,4,2,1,54,4,9,0,57,4,10,4,57,4,11,4,18,5,0,0,18,6,1,0,18,7,3,0,57,8,12,2,10,8,2,0,88,8,2,128,43,8,1,0,88,9,1,128,43,8,2,0,45,9,1,0,57,10,13,2,14,0,10,0,88,11,1,128,41,10,0,0,41,11,2,0,66,9,3,0,65,4,4,2,11,4,0,0,88,5,2,128,43,5,0,0,76,5,2,0,53,5,16,0,54,6,14,0,54,7,9,0,57,7,10,7,57,7,15,7,18,8,4,0,41,9,3,0,66,7,3,0,65,6,0,2,61,6,17,5,54,6,14,0,54,7,9,0,57,7,10,7,57,7,18,7,18,8,4,0,66,7,2,0,65,6,0,2,61,6,19,5,54,6,20,0,53,7,21,0,66,6,2,4,72,9,28,128,52,11,0,0,60,11,10,5,41,11,0,0,54,12,14,0,54,13,9,0,57,13,10,13,57,13,15,13,18,14,4,0,18,15,9,0,66,13,3,0,65,12,0,2,23,12,0,12,41,13,1,0,77,11,14,128,56,15,10,5,22,16,0,14,54,17,9,0,57,17,2,17,54,18,9,0,57,18,10,18,57,18,22,18,18,19,4,0,18,20,9,0,18,21,14,0,66,18,4,0,65,17,0,2,60,17,16,15,79,11,242,127,70,9,3,3,82,9,226,127,54,6,9,0,57,6,10,6,57,6,23,6,18,7,4,0,66,6,2,1,76,5,2,0,2,192,1,192,17,102,115,95,115,121,110,99,95,102,114,101,101,16,102,115,95,115,121,110,99,95,103,101,116,1,3,0,11,99,111,112,105,101,100,12,100,101,108,101,116,101,100,11,102,97,105,108,101,100,10,112,97,105,114,115,10,98,121,116,101,115,18,102,115,95,115,121,110,99,95,98,121,116,101,115,12,115,107,105,112,112,101,100,1,0,0,18,102,115,95,115,121,110,99,95,99,111,117,110,116,13,116,111,110,117,109,98,101,114,12,116,104,114,101,97,100,115,11,100,101,108,101,116,101,12,102,115,95,115,121,110,99,6,67,8,102,102,105,13,116,111,115,116,114,105,110,103,29,105,110,118,97,108,105,100,32,99,111,109,112,97,114,101,32,111,112,116,105,111,110,58,32,10,101,114,114,111,114,15,109,116,105,109,101,43,115,105,122,101,12,99,111,109,112,97,114,101,14,110,105,108,124,116,97,98,108,101,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,8,9,9,9,9,9,9,9,9,9,10,10,10,10,10,10,10,10,12,12,12,12,13,13,14,14,14,14,14,14,14,14,14,14,14,14,15,15,15,15,15,15,15,15,15,15,15,15,15,14,12,12,18,18,18,18,18,19,115,121,110,99,99,111,109,112,97,114,101,115,0,99,104,101,99,107,116,104,114,101,97,100,115,0,115,114,99,0,0,111,100,101,115,116,0,0,111,111,112,116,115,0,0,111,99,111,109,112,97,114,101,0,20,91,104,97,110,100,108,101,114,0,29,62,115,117,109,109,97,114,121,0,22,40,4,3,31,5,0,31,6,0,31,107,105,110,100,0,1,28,107,101,121,0,0,28,1,13,15,2,0,15,3,0,15,105,0,1,13,0,254,1,0,2,6,1,8,1,28,65,232,2,7,54,2,0,0,57,2,1,2,41,3,1,0,18,4,0,0,39,5,2,0,66,2,4,1,45,2,0,0,15,0,1,0,88,3,3,128,57,3,3,1,14,0,3,0,88,4,1,128,41,3,1,0,41,4,2,0,66,2,3,2,8,2,0,0,88,3,6,128,54,3,4,0,57,3,5,3,57,3,6,3,18,4,0,0,18,5,2,0,68,3,3,0,54,3,4,0,57,3,5,3,57,3,7,3,18,4,0,0,68,3,2,0,1,192,13,102,115,95,114,109,100,105,114,22,102,115,95,114,109,100,105,114,95,112,97,114,97,108,108,101,108,6,67,8,102,102,105,12,116,104,114,101,97,100,115,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,3,3,4,4,4,4,4,4,6,6,6,6,6,99,104,101,99,107,116,104,114,101,97,100,115,0,100,105,114,0,0,29,111,112,116,115,0,0,29,116,104,114,101,97,100,115,0,16,13,0,172,1,0,3,9,0,6,0,19,47,242,2,3,54,3,0,0,57,3,1,3,41,4,2,0,18,5,0,0,39,6,2,0,18,7,1,0,39,8,2,0,66,3,6,1,54,3,3,0,57,3,4,3,57,3,5,3,18,4,0,0,18,5,1,0,11,2,0,0,88,6,2,128,43,6,2,0,88,7,1,128,18,6,2,0,68,3,4,0,14,102,115,95,114,101,110,97,109,101,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,115,114,99,0,0,20,100,101,115,116,0,0,20,105,115,79,118,101,114,119,114,105,116,101,0,0,20,0,125,0,1,3,0,5,0,14,22,140,3,6,18,2,0,0,57,1,0,0,66,1,2,1,57,1,1,0,10,1,0,0,88,1,7,128,54,1,2,0,57,1,3,1,57,1,4,1,57,2,1,0,66,1,2,1,43,1,0,0,61,1,1,0,75,0,1,0,14,102,115,95,112,99,108,111,115,101,6,67,8,102,102,105,12,104,97,110,100,108,101,114,16,99,108,111,115,101,114,101,97,100,101,114,1,1,1,2,2,2,3,3,3,3,3,4,4,6,115,101,108,102,0,0,15,0,125,0,1,3,0,5,0,14,22,154,3,6,18,2,0,0,57,1,0,0,66,1,2,1,57,1,1,0,15,0,1,0,88,2,7,128,54,1,2,0,57,1,3,1,57,1,4,1,57,2,1,0,66,1,2,1,43,1,0,0,61,1,1,0,75,0,1,0,14,102,115,95,102,99,108,111,115,101,6,67,8,102,102,105,12,104,97,110,100,108,101,114,16,99,108,111,115,101,114,101,97,100,101,114,1,1,1,2,2,2,3,3,3,3,3,4,4,6,115,101,108,102,0,0,15,0,234,2,1,3,8,0,17,0,48,74,135,3,27,54,3,0,0,57,3,1,3,41,4,1,0,18,5,1,0,39,6,2,0,66,3,4,1,14,0,2,0,88,3,1,128,39,2,3,0,18,4,2,0,57,3,4,2,39,5,5,0,66,3,3,2,15,0,3,0,88,4,14,128,51,3,7,0,61,3,6,0,54,3,9,0,57,3,10,3,57,3,11,3,18,4,1,0,18,6,2,0,57,5,12,2,41,7,2,0,66,5,3,0,65,3,1,2,61,3,8,0,50,0,0,128,75,0,1,0,18,4,2,0,57,3,13,2,39,5,14,0,66,3,3,2,11,3,0,0,88,3,3,128,18,3,2,0,39,4,14,0,38,2,4,3,51,3,15,0,61,3,6,0,54,3,9,0,57,3,10,3,57,3,16,3,18,4,1,0,18,5,2,0,66,3,3,2,61,3,8,0,75,0,1,0,13,102,115,95,102,111,112,101,110,0,6,98,9,102,105,110,100,8,115,117,98,13,102,115,95,112,111,112,101,110,6,67,8,102,102,105,12,104,97,110,100,108,101,114,0,10,99,108,111,115,101,7,94,112,10,109,97,116,99,104,7,114,98,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,4,4,4,4,4,4,11,11,12,12,12,12,12,12,12,12,12,12,13,13,16,16,16,16,16,16,17,17,17,25,25,26,26,26,26,26,26,26,27,115,101,108,102,0,0,49,102,105,108,101,110,97,109,101,0,0,49,109,111,100,101,0,0,49,0,60,0,1,3,0,1,0,7,15,164,3,2,57,1,0,0,15,0,1,0,88,2,3,128,18,2,0,0,57,1,0,0,66,1,2,1,75,0,1,0,10,99,108,111,115,101,1,1,1,1,1,1,2,115,101,108,102,0,0,8,0,103,0,1,3,0,4,0,11,19,169,3,5,57,1,0,0,10,1,0,0,88,1,7,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,1,43,1,0,0,61,1,0,0,75,0,1,0,20,102,115,95,114,101,97,100,101,114,95,99,108,111,115,101,6,67,8,102,102,105,11,114,101,97,100,101,114,1,1,1,2,2,2,2,2,3,3,5,115,101,108,102,0,0,12,0,92,0,1,3,0,4,0,9,17,177,3,4,57,1,0,0,10,1,0,0,88,1,5,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,1,75,0,1,0,19,102,115,95,114,101,97,100,101,114,95,115,121,110,99,6,67,8,102,102,105,11,114,101,97,100,101,114,1,1,1,2,2,2,2,2,4,115,101,108,102,0,0,10,0,163,1,0,1,4,0,8,0,17,25,184,3,6,57,1,0,0,11,1,0,0,88,1,12,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,4,0,41,3,0,0,66,1,3,2,61,1,0,0,54,1,1,0,57,1,6,1,39,2,7,0,66,1,2,2,61,1,5,0,57,1,0,0,76,1,2,0,14,115,105,122,101,95,116,91,49,93,8,110,101,119,13,108,105,110,101,115,105,122,101,12,104,97,110,100,108,101,114,19,102,115,95,114,101,97,100,101,114,95,111,112,101,110,6,67,8,102,102,105,11,114,101,97,100,101,114,1,1,1,2,2,2,2,2,2,2,3,3,3,3,3,5,5,115,101,108,102,0,0,18,0,169,1,0,1,7,0,6,0,21,42,194,3,7,18,2,0,0,57,1,0,0,66,1,2,2,18,3,0,0,57,2,1,0,41,4,0,0,54,5,2,0,57,5,3,5,57,5,4,5,66,2,4,1,18,3,0,0,57,2,0,0,66,2,2,2,18,4,0,0,57,3,1,0,18,5,1,0,54,6,2,0,57,6,3,6,57,6,5,6,66,3,4,1,76,2,2,0,9,104,101,97,100,9,116,97,105,108,14,115,101,101,107,95,102,114,111,109,7,102,115,9,115,101,101,107,8,112,111,115,1,1,1,2,2,2,2,2,2,2,4,4,4,5,5,5,5,5,5,5,6,115,101,108,102,0,0,22,99,117,114,0,4,18,115,105,122,101,0,10,8,0,168,1,0,1,5,0,7,0,18,33,206,3,4,54,1,0,0,57,1,1,1,57,1,2,1,18,3,0,0,57,2,3,0,66,2,2,2,57,3,4,0,66,1,3,2,11,1,0,0,88,2,2,128,39,2,5,0,76,2,2,0,54,2,0,0,57,2,6,2,18,3,1,0,57,4,4,0,58,4,0,4,68,2,3,0,11,115,116,114,105,110,103,5,13,108,105,110,101,115,105,122,101,14,103,101,116,114,101,97,100,101,114,23,102,115,95,114,101,97,100,101,114,95,114,101,97,100,108,105,110,101,6,67,8,102,102,105,1,1,1,1,1,1,1,1,2,2,2,2,3,3,3,3,3,3,115,101,108,102,0,0,19,108,105,110,101,0,9,10,0,182,1,0,0,4,1,6,0,21,34,216,3,4,54,0,0,0,57,0,1,0,57,0,2,0,45,1,0,0,18,2,1,0,57,1,3,1,66,1,2,2,45,2,0,0,57,2,4,2,66,0,3,2,11,0,0,0,88,1,2,128,43,1,0,0,76,1,2,0,54,1,0,0,57,1,5,1,18,2,0,0,45,3,0,0,57,3,4,3,58,3,0,3,68,1,3,0,0,192,11,115,116,114,105,110,103,13,108,105,110,101,115,105,122,101,14,103,101,116,114,101,97,100,101,114,23,102,115,95,114,101,97,100,101,114,95,114,101,97,100,108,105,110,101,6,67,8,102,102,105,1,1,1,1,1,1,1,1,1,1,2,2,2,2,3,3,3,3,3,3,3,115,101,108,102,0,108,105,110,101,0,11,11,0,35,1,1,2,0,1,0,3,11,215,3,6,51,1,0,0,50,0,0,128,76,1,2,0,0,5,5,5,115,101,108,102,0,0,4,0,126,0,1,3,0,6,0,13,21,225,3,3,57,1,0,0,10,1,0,0,88,1,5,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,68,1,2,0,54,1,1,0,57,1,2,1,57,1,4,1,57,2,5,0,68,1,2,0,12,104,97,110,100,108,101,114,10,102,103,101,116,99,19,102,115,95,114,101,97,100,101,114,95,103,101,116,99,6,67,8,102,102,105,11,114,101,97,100,101,114,1,1,1,1,1,1,1,1,2,2,2,2,2,115,101,108,102,0,0,14,0,212,2,0,2,8,0,13,1,43,72,233,3,5,54,2,0,0,57,2,1,2,41,3,1,0,18,4,1,0,39,5,2,0,66,2,4,1,54,2,3,0,57,2,4,2,39,3,5,0,22,4,0,1,66,2,3,2,57,3,6,0,10,3,0,0,88,3,9,128,54,3,3,0,57,3,7,3,57,3,8,3,57,4,6,0,18,5,2,0,18,6,1,0,66,3,4,2,14,0,3,0,88,4,8,128,54,3,3,0,57,3,7,3,57,3,9,3,18,4,2,0,41,5,1,0,18,6,1,0,57,7,10,0,66,3,5,2,41,4,0,0,1,4,3,0,88,4,7,128,54,4,3,0,57,4,11,4,18,5,2,0,18,6,3,0,66,4,3,2,14,0,4,0,88,5,1,128,39,4,12,0,76,4,2,0,5,11,115,116,114,105,110,103,12,104,97,110,100,108,101,114,10,102,114,101,97,100,19,102,115,95,114,101,97,100,101,114,95,114,101,97,100,6,67,11,114,101,97,100,101,114,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,11,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,115,101,108,102,0,0,44,115,105,122,101,0,0,44,100,97,116,97,0,12,32,114,101,97,100,0,20,12,0,233,1,0,3,8,0,11,0,25,47,244,3,4,54,3,0,0,57,3,1,3,41,4,1,0,18,5,1,0,39,6,2,0,66,3,4,1,18,4,0,0,57,3,3,0,66,3,2,1,54,3,4,0,57,3,5,3,57,3,6,3,54,4,4,0,57,4,7,4,39,5,8,0,18,6,1,0,66,4,3,2,41,5,1,0,12,6,2,0,88,6,3,128,18,7,1,0,57,6,9,1,66,6,2,2,57,7,10,0,68,3,5,0,12,104,97,110,100,108,101,114,8,108,101,110,16,99,111,110,115,116,32,99,104,97,114,42,9,99,97,115,116,11,102,119,114,105,116,101,6,67,8,102,102,105,15,115,121,110,99,114,101,97,100,101,114,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,115,101,108,102,0,0,26,100,97,116,97,0,0,26,115,105,122,101,0,0,26,0,198,1,0,2,6,0,10,0,23,35,253,3,4,54,2,0,0,57,2,1,2,41,3,1,0,18,4,1,0,39,5,2,0,66,2,4,1,18,3,0,0,57,2,3,0,66,2,2,1,54,2,4,0,57,2,5,2,54,3,6,0,57,3,7,3,57,3,8,3,18,4,1,0,57,5,9,0,66,3,3,2,5,2,3,0,88,2,2,128,43,2,1,0,88,3,1,128,43,2,2,0,76,2,2,0,12,104,97,110,100,108,101,114,10,102,112,117,116,99,6,67,8,102,102,105,8,101,111,102,7,102,115,15,115,121,110,99,114,101,97,100,101,114,11,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,115,101,108,102,0,0,24,99,0,0,24,0,237,1,0,3,7,0,11,1,26,50,135,4,4,54,3,0,0,57,3,1,3,41,4,1,0,18,5,1,0,39,6,2,0,66,3,4,1,18,4,0,0,57,3,3,0,66,3,2,1,54,3,4,0,57,3,5,3,57,3,6,3,57,4,7,0,18,5,1,0,12,6,2,0,88,6,3,128,54,6,8,0,57,6,9,6,57,6,10,6,66,3,4,2,8,3,0,0,88,3,2,128,43,3,1,0,88,4,1,128,43,3,2,0,76,3,2,0,9,104,101,97,100,14,115,101,101,107,95,102,114,111,109,7,102,115,12,104,97,110,100,108,101,114,10,102,115,101,101,107,6,67,8,102,102,105,15,115,121,110,99,114,101,97,100,101,114,11,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,0,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,115,101,108,102,0,0,27,111,102,102,115,101,116,0,0,27,102,114,111,109,0,0,27,0,109,0,1,4,0,6,0,10,18,143,4,3,18,2,0,0,57,1,0,0,66,1,2,1,54,1,1,0,54,2,2,0,57,2,3,2,57,2,4,2,57,3,5,0,66,2,2,0,67,1,0,0,12,104,97,110,100,108,101,114,10,102,116,101,108,108,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,15,115,121,110,99,114,101,97,100,101,114,1,1,1,2,2,2,2,2,2,2,115,101,108,102,0,0,11,0,96,0,1,3,0,4,1,11,19,150,4,2,54,1,0,0,57,1,1,1,57,1,2,1,57,2,3,0,66,1,2,2,8,1,0,0,88,1,2,128,43,1,1,0,88,2,1,128,43,1,2,0,76,1,2,0,12,104,97,110,100,108,101,114,11,102,102,108,117,115,104,6,67,8,102,102,105,0,1,1,1,1,1,1,1,1,1,1,1,115,101,108,102,0,0,12,0,113,0,2,5,1,2,0,11,44,162,4,5,45,2,0,0,57,2,0,2,18,3,0,0,18,4,1,0,66,2,3,2,57,3,1,2,11,3,0,0,88,3,2,128,43,3,0,0,76,3,2,0,76,2,2,0,3,192,12,104,97,110,100,108,101,114,8,110,101,119,1,1,1,1,1,3,3,3,3,3,4,102,105,108,101,114,119,0,102,105,108,101,110,97,109,101,0,0,12,109,111,100,101,0,0,12,102,105,108,101,0,6,6,0,196,1,0,3,9,0,8,0,21,47,179,4,3,54,3,0,0,57,3,1,3,41,4,2,0,18,5,0,0,39,6,2,0,18,7,1,0,39,8,2,0,66,3,6,1,54,3,3,0,54,4,4,0,57,4,5,4,57,4,6,4,18,5,0,0,18,6,1,0,12,7,2,0,88,7,3,128,18,8,1,0,57,7,7,1,66,7,2,2,66,4,4,0,67,3,0,0,8,108,101,110,17,102,115,95,119,114,105,116,101,102,105,108,101,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,102,105,108,101,110,97,109,101,0,0,22,100,97,116,97,0,0,22,115,105,122,101,0,0,22,0,84,0,2,3,0,3,0,6,24,186,4,4,61,1,0,0,41,2,0,0,61,2,1,0,52,2,0,0,61,2,2,0,75,0,1,0,12,97,110,99,104,111,114,115,13,99,97,112,97,99,105,116,121,12,104,97,110,100,108,101,114,1,2,2,3,3,4,115,101,108,102,0,0,7,104,97,110,100,108,101,114,0,0,7,0,45,0,1,3,0,1,0,4,12,192,4,2,18,2,0,0,57,1,0,0,66,1,2,1,75,0,1,0,10,99,108,111,115,101,1,1,1,2,115,101,108,102,0,0,5,0,123,0,1,3,0,4,0,13,30,198,4,5,57,1,0,0,11,1,0,0,88,1,2,128,43,1,1,0,76,1,2,0,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,2,43,2,0,0,61,2,0,0,76,1,2,0,20,102,115,95,119,114,105,116,101,114,95,99,108,111,115,101,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,1,1,2,2,2,2,2,3,3,4,115,101,108,102,0,0,14,114,101,115,117,108,116,0,11,3,0,207,4,2,1,13,0,17,2,81,120,209,4,21,57,1,0,0,11,1,0,0,88,1,2,128,43,1,1,0,76,1,2,0,54,1,1,0,39,2,2,0,71,3,1,0,65,1,1,2,9,1,0,0,88,2,17,128,71,2,1,2,54,3,3,0,18,4,2,0,66,3,2,2,6,3,4,0,88,3,4,128,54,3,5,0,18,4,2,0,66,3,2,2,18,2,3,0,54,3,6,0,57,3,7,3,57,3,8,3,57,4,0,0,18,5,2,0,21,6,2,0,68,3,4,0,57,2,9,0,1,2,1,0,88,2,14,128,24,2,1,1,61,2,9,0,54,2,6,0,57,2,12,2,39,3,13,0,57,4,9,0,66,2,3,2,54,3,6,0,57,3,12,3,39,4,14,0,57,5,9,0,66,3,3,2,61,3,11,0,61,2,10,0,41,2,1,0,18,3,1,0,41,4,1,0,77,2,24,128,54,6,1,0,18,7,5,0,71,8,1,0,65,6,1,2,54,7,3,0,18,8,6,0,66,7,2,2,6,7,4,0,88,7,6,128,54,7,5,0,18,8,6,0,66,7,2,2,18,6,7,0,57,7,15,0,60,6,5,7,57,7,10,0,23,8,0,5,57,9,11,0,23,10,0,5,18,11,6,0,21,12,6,0,60,12,10,9,60,11,8,7,79,2,232,127,54,2,6,0,57,2,7,2,57,2,16,2,57,3,0,0,57,4,10,0,57,5,11,0,18,6,1,0,68,2,5,0,21,102,115,95,119,114,105,116,101,114,95,119,114,105,116,101,118,12,97,110,99,104,111,114,115,14,115,105,122,101,95,116,91,63,93,19,99,111,110,115,116,32,99,104,97,114,42,91,63,93,8,110,101,119,10,115,105,122,101,115,9,100,97,116,97,13,99,97,112,97,99,105,116,121,20,102,115,95,119,114,105,116,101,114,95,119,114,105,116,101,6,67,8,102,102,105,13,116,111,115,116,114,105,110,103,11,115,116,114,105,110,103,9,116,121,112,101,6,35,11,115,101,108,101,99,116,12,104,97,110,100,108,101,114,2,4,1,1,1,1,1,2,2,2,2,3,3,4,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,8,8,8,9,9,10,10,10,10,10,10,10,10,10,10,10,10,12,12,12,12,13,13,13,13,14,14,14,14,14,15,15,15,15,16,16,18,18,18,18,18,18,18,18,12,20,20,20,20,20,20,20,20,115,101,108,102,0,0,82,110,0,10,72,100,97,116,97,0,3,16,1,36,25,2,0,25,3,0,25,105,0,1,23,100,97,116,97,0,4,19,0,99,0,1,3,0,4,0,10,18,234,4,3,57,1,0,0,11,1,0,0,88,1,2,128,43,1,1,0,76,1,2,0,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,68,1,2,0,20,102,115,95,119,114,105,116,101,114,95,102,108,117,115,104,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,1,1,2,2,2,2,2,115,101,108,102,0,0,11,0,149,3,0,2,8,1,13,0,50,84,248,4,8,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,14,0,1,0,88,2,1,128,52,1,0,0,54,2,4,0,18,3,0,0,66,2,2,2,7,2,5,0,88,2,11,128,54,2,6,0,57,2,7,2,57,2,8,2,18,3,0,0,57,4,9,1,14,0,4,0,88,5,1,128,41,4,0,0,66,2,3,2,14,0,2,0,88,3,15,128,54,2,6,0,57,2,7,2,57,2,10,2,18,3,0,0,57,4,11,1,10,4,2,0,88,4,2,128,43,4,1,0,88,5,1,128,43,4,2,0,57,5,9,1,14,0,5,0,88,6,1,128,41,5,0,0,66,2,4,2,11,2,0,0,88,3,2,128,43,3,0,0,76,3,2,0,45,3,0,0,57,3,12,3,18,4,2,0,68,3,2,0,4,192,8,110,101,119,11,97,112,112,101,110,100,19,102,115,95,119,114,105,116,101,114,95,111,112,101,110,12,98,117,102,115,105,122,101,21,102,115,95,119,114,105,116,101,114,95,111,112,101,110,102,100,6,67,8,102,102,105,11,110,117,109,98,101,114,9,116,121,112,101,14,110,105,108,124,116,97,98,108,101,18,115,116,114,105,110,103,124,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,3,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,7,7,7,7,119,114,105,116,101,114,0,116,97,114,103,101,116,0,0,51,111,112,116,115,0,0,51,104,97,110,100,108,101,114,0,43,8,0,128,2,0,1,12,1,6,0,27,83,135,5,8,41,1,0,0,54,2,0,0,12,3,0,0,88,3,1,128,52,3,0,0,66,2,2,4,88,5,17,128,45,7,0,0,56,7,6,7,11,7,0,0,88,8,7,128,54,8,1,0,39,9,2,0,54,10,3,0,18,11,6,0,66,10,2,2,38,9,10,9,66,8,2,1,54,8,4,0,57,8,5,8,18,9,1,0,18,10,7,0,66,8,3,2,18,1,8,0,69,5,3,3,82,5,237,127,76,1,2,0,5,192,8,98,111,114,8,98,105,116,13,116,111,115,116,114,105,110,103,26,105,110,118,97,108,105,100,32,109,109,97,112,32,97,100,118,105,99,101,58,32,10,101,114,114,111,114,11,105,112,97,105,114,115,1,2,2,2,2,2,2,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,2,2,7,109,109,97,112,97,100,118,105,99,101,0,97,100,118,105,99,101,0,0,28,102,108,97,103,115,0,2,26,4,5,20,5,0,20,6,0,20,95,0,1,17,110,97,109,101,0,0,17,102,108,97,103,0,2,15,0,178,1,0,2,5,0,8,0,18,36,146,5,4,61,1,0,0,57,2,2,1,15,0,2,0,88,3,3,128,57,2,1,1,14,0,2,0,88,3,5,128,54,2,3,0,57,2,4,2,39,3,5,0,57,4,1,1,66,2,3,2,61,2,1,0,54,2,7,0,57,3,6,1,66,2,2,2,61,2,6,0,75,0,1,0,13,116,111,110,117,109,98,101,114,9,115,105,122,101,16,99,111,110,115,116,32,99,104,97,114,42,9,99,97,115,116,8,102,102,105,16,105,115,95,119,114,105,116,97,98,108,101,8,112,116,114,12,104,97,110,100,108,101,114,1,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,4,115,101,108,102,0,0,19,104,97,110,100,108,101,114,0,0,19,0,45,0,1,3,0,1,0,4,12,152,5,2,18,2,0,0,57,1,0,0,66,1,2,1,75,0,1,0,10,99,108,111,115,101,1,1,1,2,115,101,108,102,0,0,5,0,126,0,1,4,0,6,0,14,22,158,5,5,57,1,0,0,10,1,0,0,88,1,10,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,1,44,1,2,0,41,3,0,0,61,3,5,0,61,2,4,0,61,1,0,0,75,0,1,0,9,115,105,122,101,8,112,116,114,18,102,115,95,109,109,97,112,95,99,108,111,115,101,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,2,2,2,2,2,3,3,3,3,3,5,115,101,108,102,0,0,15,0,136,1,0,2,6,1,4,0,13,42,168,5,3,57,2,0,0,11,2,0,0,88,2,2,128,43,2,1,0,76,2,2,0,54,2,1,0,57,2,2,2,57,2,3,2,57,3,0,0,45,4,0,0,18,5,1,0,66,4,2,0,67,2,1,0,6,192,19,102,115,95,109,109,97,112,95,97,100,118,105,115,101,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,1,1,2,2,2,2,2,2,2,2,109,109,97,112,95,97,100,118,105,99,101,0,115,101,108,102,0,0,14,97,100,118,105,99,101,0,0,14,0,96,0,1,3,0,4,0,10,18,175,5,3,57,1,0,0,11,1,0,0,88,1,2,128,43,1,1,0,76,1,2,0,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,68,1,2,0,17,102,115,95,109,109,97,112,95,115,121,110,99,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,1,1,2,2,2,2,2,115,101,108,102,0,0,11,0,154,3,0,2,8,2,15,0,47,100,189,5,9,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,14,0,1,0,88,2,1,128,52,1,0,0,57,2,4,1,14,0,2,0,88,3,1,128,39,2,5,0,6,2,5,0,88,3,9,128,6,2,6,0,88,3,7,128,54,3,7,0,39,4,8,0,54,5,9,0,18,6,2,0,66,5,2,2,38,4,5,4,66,3,2,1,54,3,10,0,57,3,11,3,57,3,12,3,18,4,0,0,6,2,6,0,88,5,2,128,43,5,1,0,88,6,1,128,43,5,2,0,45,6,0,0,57,7,13,1,66,6,2,0,65,3,2,2,11,3,0,0,88,4,2,128,43,4,0,0,76,4,2,0,45,4,1,0,57,4,14,4,18,5,3,0,68,4,2,0,6,192,7,192,8,110,101,119,11,97,100,118,105,99,101,17,102,115,95,109,109,97,112,95,111,112,101,110,6,67,8,102,102,105,13,116,111,115,116,114,105,110,103,24,105,110,118,97,108,105,100,32,109,109,97,112,32,109,111,100,101,58,32,10,101,114,114,111,114,7,114,119,6,114,9,109,111,100,101,14,110,105,108,124,116,97,98,108,101,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,8,8,8,8,109,109,97,112,95,97,100,118,105,99,101,0,109,109,97,112,102,105,108,101,0,112,97,116,104,0,0,48,111,112,116,115,0,0,48,109,111,100,101,0,16,32,104,97,110,100,108,101,114,0,24,8,0,137,1,0,2,6,0,7,0,13,27,202,5,3,54,2,0,0,57,2,1,2,41,3,1,0,18,4,1,0,39,5,2,0,66,2,4,1,54,2,4,0,57,2,5,2,57,2,6,2,18,3,1,0,66,2,2,2,61,2,3,0,75,0,1,0,15,102,115,95,111,112,101,110,100,105,114,6,67,8,102,102,105,12,104,97,110,100,108,101,114,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,3,115,101,108,102,0,0,14,100,105,114,0,0,14,0,45,0,1,3,0,1,0,4,12,207,5,2,18,2,0,0,57,1,0,0,66,1,2,1,75,0,1,0,10,99,108,111,115,101,1,1,1,2,115,101,108,102,0,0,5,0,100,0,1,3,0,4,0,11,19,212,5,5,57,1,0,0,10,1,0,0,88,1,7,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,1,43,1,0,0,61,1,0,0,75,0,1,0,16,102,115,95,99,108,111,115,101,100,105,114,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,2,2,2,2,2,3,3,5,115,101,108,102,0,0,12,0,69,0,1,3,0,4,0,5,13,221,5,2,54,1,0,0,57,1,1,1,57,1,2,1,57,2,3,0,68,1,2,0,12,104,97,110,100,108,101,114,15,102,115,95,115,101,101,107,100,105,114,6,67,8,102,102,105,1,1,1,1,1,115,101,108,102,0,0,6,0,96,0,1,4,0,5,0,8,16,227,5,2,54,1,0,0,57,1,1,1,54,2,0,0,57,2,2,2,57,2,3,2,57,3,4,0,66,2,2,0,67,1,0,0,12,104,97,110,100,108,101,114,20,102,115,95,114,101,97,100,100,105,114,95,110,97,109,101,6,67,11,115,116,114,105,110,103,8,102,102,105,1,1,1,1,1,1,1,1,115,101,108,102,0,0,9,0,96,0,1,4,0,5,0,8,16,232,5,2,54,1,0,0,57,1,1,1,54,2,0,0,57,2,2,2,57,2,3,2,57,3,4,0,66,2,2,0,67,1,0,0,12,104,97,110,100,108,101,114,20,102,115,95,114,101,97,100,100,105,114,95,112,97,116,104,6,67,11,115,116,114,105,110,103,8,102,102,105,1,1,1,1,1,1,1,1,115,101,108,102,0,0,9,0,102,0,1,3,1,2,0,10,37,240,5,5,45,1,0,0,57,1,0,1,18,2,0,0,66,1,2,2,57,2,1,1,11,2,0,0,88,2,2,128,43,2,0,0,76,2,2,0,76,1,2,0,8,192,12,104,97,110,100,108,101,114,8,110,101,119,1,1,1,1,3,3,3,3,3,4,101,110,117,109,101,114,97,116,111,114,0,100,105,114,0,0,11,100,105,114,101,110,116,0,5,6,0,196,2,2,2,8,0,10,0,43,70,252,5,12,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,54,2,4,0,57,2,5,2,18,3,0,0,66,2,2,2,11,2,0,0,88,3,2,128,43,3,1,0,76,3,2,0,85,3,21,128,18,3,1,0,18,5,2,0,57,4,6,2,66,4,2,2,18,6,2,0,57,5,7,2,66,5,2,2,71,6,2,0,65,3,2,2,14,0,3,0,88,3,5,128,18,4,2,0,57,3,8,2,66,3,2,1,43,3,1,0,76,3,2,0,18,4,2,0,57,3,9,2,66,3,2,2,14,0,3,0,88,3,234,127,18,4,2,0,57,3,8,2,66,3,2,1,43,3,2,0,76,3,2,0,9,115,101,101,107,10,99,108,111,115,101,13,114,101,97,100,112,97,116,104,13,114,101,97,100,110,97,109,101,12,111,112,101,110,100,105,114,7,102,115,13,102,117,110,99,116,105,111,110,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,3,3,3,3,4,5,5,5,5,5,5,5,5,5,5,5,6,6,6,7,7,9,9,9,9,9,10,10,10,11,11,100,105,114,0,0,44,99,97,108,108,98,97,99,107,0,0,44,100,105,114,101,110,116,0,13,31,0,151,3,0,0,7,7,10,2,50,104,165,6,12,45,0,0,0,45,1,1,0,3,1,0,0,88,0,29,128,45,0,2,0,57,0,0,0,11,0,0,0,88,0,2,128,43,0,0,0,76,0,2,0,54,0,1,0,54,1,2,0,57,1,3,1,57,1,4,1,45,2,2,0,57,2,0,2,45,3,3,0,45,4,4,0,45,5,5,0,45,6,6,0,66,1,6,0,65,0,0,2,48,0,0,0,46,1,0,0,45,0,1,0,9,0,0,0,88,0,6,128,45,0,2,0,18,1,0,0,57,0,5,0,66,0,2,1,43,0,0,0,76,0,2,0,45,0,3,0,45,1,0,0,56,0,1,0,45,1,0,0,22,1,1,1,46,0,1,0,54,1,2,0,57,1,6,1,45,2,5,0,57,3,7,0,32,2,3,2,66,1,2,2,57,2,8,0,54,3,1,0,57,4,9,0,66,3,2,0,73,1,2,0,8,128,7,128,2,192,5,192,3,192,6,192,4,192,10,105,110,111,100,101,9,116,121,112,101,16,110,97,109,101,95,111,102,102,115,101,116,11,115,116,114,105,110,103,10,99,108,111,115,101,21,102,115,95,114,101,97,100,100,105,114,95,98,97,116,99,104,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,12,104,97,110,100,108,101,114,0,2,1,1,1,1,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,5,5,5,5,6,6,9,9,9,10,10,10,11,11,11,11,11,11,11,11,11,11,11,105,110,100,101,120,0,99,111,117,110,116,0,100,105,114,101,110,116,0,101,110,116,114,105,101,115,0,99,97,112,0,112,111,111,108,0,112,111,111,108,115,105,122,101,0,101,110,116,114,121,0,37,14,0,248,2,1,2,10,0,11,1,42,120,156,6,22,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,54,2,4,0,57,2,5,2,18,3,0,0,66,2,2,2,11,2,0,0,88,3,2,128,43,3,0,0,50,0,25,128,12,3,1,0,88,3,1,128,41,3,0,1,24,4,0,3,41,5,0,4,1,4,5,0,88,4,2,128,41,4,0,4,88,5,1,128,24,4,0,3,54,5,6,0,57,5,7,5,39,6,8,0,18,7,3,0,66,5,3,2,54,6,6,0,57,6,7,6,39,7,9,0,18,8,4,0,66,6,3,2,41,7,0,0,41,8,0,0,51,9,10,0,50,0,0,128,76,9,2,0,76,3,2,0,0,12,99,104,97,114,91,63,93,18,102,115,95,101,110,116,114,121,95,116,91,63,93,8,110,101,119,8,102,102,105,12,111,112,101,110,100,105,114,7,102,115,15,110,105,108,124,110,117,109,98,101,114,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,128,1,1,1,1,1,1,1,1,1,2,2,2,2,3,3,3,3,5,5,5,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,8,8,21,21,21,3,100,105,114,0,0,42,98,97,116,99,104,115,105,122,101,0,0,42,100,105,114,101,110,116,0,13,29,99,97,112,0,7,22,112,111,111,108,115,105,122,101,0,7,15,101,110,116,114,105,101,115,0,10,5,112,111,111,108,0,0,5,99,111,117,110,116,0,2,3,105,110,100,101,120,0,0,3,0,137,5,0,4,19,1,12,2,91,193,1,181,6,28,54,4,0,0,57,4,1,4,18,5,0,0,66,4,2,2,11,4,0,0,88,5,2,128,43,5,1,0,76,5,2,0,54,5,0,0,57,5,2,5,57,5,3,5,18,6,0,0,66,5,2,2,18,0,5,0,18,5,4,0,44,6,7,0,88,8,70,128,18,10,0,0,18,11,8,0,38,10,11,10,54,11,0,0,57,11,4,11,57,11,5,11,4,9,11,0,88,11,2,128,43,11,1,0,88,12,1,128,43,11,2,0,54,12,0,0,57,12,4,12,57,12,6,12,4,9,12,0,88,12,2,128,43,12,1,0,88,13,1,128,43,12,2,0,54,13,0,0,57,13,4,13,57,13,7,13,4,9,13,0,88,13,5,128,54,13,0,0,57,13,4,13,57,13,8,13,5,9,13,0,88,13,12,128,54,13,0,0,57,13,2,13,57,13,9,13,18,14,10,0,66,13,2,2,54,14,0,0,57,14,2,14,57,14,10,14,18,15,10,0,66,14,2,2,18,12,14,0,18,11,13,0,53,13,11,0,61,10,2,13,61,12,10,13,61,11,9,13,57,14,10,13,15,0,14,0,88,15,6,128,6,3,5,0,88,14,20,128,21,14,1,0,22,14,0,14,60,13,14,1,88,14,16,128,57,14,9,13,15,0,14,0,88,15,13,128,6,3,6,0,88,14,3,128,21,14,1,0,22,14,0,14,60,13,14,1,8,2,1,0,88,14,6,128,45,14,0,0,18,15,10,0,18,16,1,0,23,17,0,2,18,18,3,0,66,14,5,1,69,8,3,3,82,8,184,127,43,5,2,0,76,5,2,0,9,192,1,0,0,11,105,115,102,105,108,101,10,105,115,100,105,114,12,117,110,107,110,111,119,110,9,108,105,110,107,9,102,105,108,101,8,100,105,114,13,102,105,108,101,116,121,112,101,17,97,112,112,101,110,100,95,115,108,97,115,104,9,112,97,116,104,12,114,101,97,100,100,105,114,7,102,115,2,0,1,1,1,1,2,2,2,2,4,4,4,4,4,4,5,5,5,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,8,8,8,8,8,8,8,8,8,8,9,9,9,9,9,9,9,9,9,9,9,9,11,12,13,14,16,16,16,17,17,18,18,18,19,20,20,20,21,21,22,22,22,24,24,24,24,24,24,24,24,5,5,27,27,101,110,117,109,102,105,108,101,115,0,100,105,114,0,0,92,100,101,115,116,0,0,92,110,101,115,116,0,0,92,109,111,100,101,0,0,92,101,110,116,114,105,101,115,0,5,87,4,12,73,5,0,73,6,0,73,110,97,109,101,0,1,70,116,121,112,101,0,0,70,112,97,116,104,0,3,67,105,115,100,105,114,0,16,51,105,115,102,105,108,101,0,0,51,105,110,102,111,0,26,25,0,151,1,0,3,9,1,1,0,19,58,216,6,3,52,3,0,0,45,4,0,0,18,5,0,0,18,6,3,0,11,1,0,0,88,7,2,128,41,7,255,255,88,8,1,128,18,7,1,0,12,8,2,0,88,8,1,128,39,8,0,0,66,4,5,2,15,0,4,0,88,5,2,128,12,4,3,0,88,4,1,128,52,4,0,0,76,4,2,0,9,192,8,97,108,108,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,101,110,117,109,102,105,108,101,115,0,100,105,114,0,0,20,110,101,115,116,0,0,20,109,111,100,101,0,0,20,102,105,108,101,115,0,2,18,0,146,1,0,4,7,0,7,1,10,47,226,6,5,61,1,0,0,61,2,1,0,61,3,2,0,54,4,4,0,57,4,5,4,39,5,6,0,22,6,0,2,66,4,3,2,61,4,3,0,75,0,1,0,12,98,111,111,108,91,63,93,8,110,101,119,8,102,102,105,12,109,97,116,99,104,101,100,13,110,105,110,99,108,117,100,101,10,99,111,117,110,116,12,104,97,110,100,108,101,114,2,1,2,3,4,4,4,4,4,4,5,115,101,108,102,0,0,11,104,97,110,100,108,101,114,0,0,11,99,111,117,110,116,0,0,11,110,105,110,99,108,117,100,101,0,0,11,0,73,0,1,3,0,4,0,6,14,233,6,2,54,1,0,0,57,1,1,1,57,1,2,1,57,2,3,0,66,1,2,1,75,0,1,0,12,104,97,110,100,108,101,114,14,103,108,111,98,95,102,114,101,101,6,67,8,102,102,105,1,1,1,1,1,2,115,101,108,102,0,0,7,0,230,3,0,2,8,0,13,2,62,103,241,6,13,54,2,0,0,18,3,1,0,66,2,2,2,6,2,1,0,88,2,9,128,54,2,2,0,39,3,3,0,54,4,0,0,18,5,1,0,66,4,2,2,39,5,4,0,38,3,5,3,41,4,2,0,66,2,3,1,57,2,5,0,11,2,0,0,88,2,6,128,54,2,6,0,57,2,7,2,57,2,8,2,57,3,9,0,18,4,1,0,68,2,3,0,54,2,6,0,57,2,7,2,57,2,10,2,57,3,9,0,18,4,1,0,57,5,11,0,66,2,4,2,9,2,0,0,88,2,7,128,57,2,5,0,8,2,0,0,88,2,2,128,43,2,1,0,88,3,1,128,43,2,2,0,76,2,2,0,57,2,5,0,8,2,0,0,88,2,2,128,43,2,1,0,88,3,1,128,43,2,2,0,41,3,0,0,57,4,12,0,23,4,1,4,41,5,1,0,77,3,11,128,57,7,11,0,56,7,6,7,15,0,7,0,88,8,6,128,57,7,5,0,3,7,6,0,88,7,2,128,43,7,1,0,76,7,2,0,43,2,2,0,79,3,245,127,76,2,2,0,10,99,111,117,110,116,12,109,97,116,99,104,101,100,19,103,108,111,98,95,109,97,116,99,104,95,115,101,116,12,104,97,110,100,108,101,114,15,103,108,111,98,95,109,97,116,99,104,6,67,8,102,102,105,13,110,105,110,99,108,117,100,101,6,41,43,98,97,100,32,97,114,103,117,109,101,110,116,32,35,49,32,40,115,116,114,105,110,103,32,101,120,112,101,99,116,101,100,44,32,103,111,116,32,10,101,114,114,111,114,11,115,116,114,105,110,103,9,116,121,112,101,0,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,8,8,8,8,8,9,6,12,115,101,108,102,0,0,63,112,97,116,104,0,0,63,105,115,73,110,99,108,117,100,101,100,0,46,17,1,4,12,2,0,12,3,0,12,105,0,1,10,0,218,1,0,2,6,0,9,0,20,35,131,7,3,54,2,0,0,18,3,1,0,66,2,2,2,6,2,1,0,88,2,9,128,54,2,2,0,39,3,3,0,54,4,0,0,18,5,1,0,66,4,2,2,39,5,4,0,38,3,5,3,41,4,2,0,66,2,3,1,54,2,5,0,57,2,6,2,57,2,7,2,57,3,8,0,18,4,1,0,68,2,3,0,12,104,97,110,100,108,101,114,23,103,108,111,98,95,109,97,116,99,104,95,112,97,114,116,105,97,108,6,67,8,102,102,105,6,41,43,98,97,100,32,97,114,103,117,109,101,110,116,32,35,49,32,40,115,116,114,105,110,103,32,101,120,112,101,99,116,101,100,44,32,103,111,116,32,10,101,114,114,111,114,11,115,116,114,105,110,103,9,116,121,112,101,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,115,101,108,102,0,0,21,112,97,116,104,0,0,21,0,224,2,0,2,9,0,11,1,40,78,138,7,9,54,2,0,0,18,3,1,0,66,2,2,2,6,2,1,0,88,2,9,128,54,2,2,0,39,3,3,0,54,4,0,0,18,5,1,0,66,4,2,2,39,5,4,0,38,3,5,3,41,4,2,0,66,2,3,1,52,2,0,0,54,3,5,0,57,3,6,3,57,3,7,3,57,4,8,0,18,5,1,0,57,6,9,0,66,3,4,2,41,4,0,0,1,4,3,0,88,3,14,128,41,3,0,0,57,4,10,0,23,4,0,4,41,5,1,0,77,3,9,128,57,7,9,0,56,7,6,7,15,0,7,0,88,8,4,128,21,7,2,0,22,7,0,7,22,8,0,6,60,8,7,2,79,3,247,127,76,2,2,0,10,99,111,117,110,116,12,109,97,116,99,104,101,100,12,104,97,110,100,108,101,114,19,103,108,111,98,95,109,97,116,99,104,95,115,101,116,6,67,8,102,102,105,6,41,43,98,97,100,32,97,114,103,117,109,101,110,116,32,35,49,32,40,115,116,114,105,110,103,32,101,120,112,101,99,116,101,100,44,32,103,111,116,32,10,101,114,114,111,114,11,115,116,114,105,110,103,9,116,121,112,101,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,5,5,5,5,5,5,5,5,4,8,115,101,108,102,0,0,41,112,97,116,104,0,0,41,105,110,100,105,99,101,115,0,16,25,1,14,10,2,0,10,3,0,10,105,0,1,8,0,165,2,0,2,9,1,6,1,30,110,151,7,6,54,2,0,0,57,2,1,2,39,3,2,0,21,4,0,0,22,4,0,4,66,2,3,2,54,3,3,0,18,4,0,0,66,3,2,4,88,6,2,128,23,8,0,6,60,7,8,2,69,6,3,3,82,6,252,127,54,3,0,0,57,3,4,3,57,3,5,3,18,4,2,0,21,5,0,0,66,3,3,2,11,3,0,0,88,4,2,128,43,4,0,0,76,4,2,0,45,4,0,0,57,4,1,4,18,5,3,0,21,6,0,0,18,7,1,0,68,4,4,0,10,192,21,103,108,111,98,95,99,111,109,112,105,108,101,95,115,101,116,6,67,11,105,112,97,105,114,115,19,99,111,110,115,116,32,99,104,97,114,42,91,63,93,8,110,101,119,8,102,102,105,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,4,4,4,4,5,5,5,5,5,5,103,108,111,98,109,97,116,99,104,101,114,0,112,97,116,116,101,114,110,115,0,0,31,110,105,110,99,108,117,100,101,0,0,31,99,112,97,116,116,101,114,110,115,0,7,24,4,3,5,5,0,5,6,0,5,105,0,1,2,112,97,116,116,101,114,110,0,0,2,104,97,110,100,108,101,114,0,10,10,0,134,2,0,1,5,2,9,0,28,73,164,7,7,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,18,2,0,0,66,1,2,2,7,1,4,0,88,1,3,128,45,1,0,0,18,2,0,0,68,1,2,0,54,1,5,0,57,1,6,1,57,1,7,1,18,2,0,0,66,1,2,2,11,1,0,0,88,2,2,128,43,2,0,0,76,2,2,0,45,2,1,0,57,2,8,2,18,3,1,0,41,4,1,0,68,2,3,0,11,192,10,192,8,110,101,119,17,103,108,111,98,95,99,111,109,112,105,108,101,6,67,8,102,102,105,10,116,97,98,108,101,9,116,121,112,101,17,115,116,114,105,110,103,124,116,97,98,108,101,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,2,4,4,4,4,4,5,5,5,5,6,6,6,6,6,103,108,111,98,99,111,109,112,105,108,101,0,103,108,111,98,109,97,116,99,104,101,114,0,112,97,116,116,101,114,110,0,0,29,104,97,110,100,108,101,114,0,20,9,0,179,2,0,2,9,1,5,1,33,123,178,7,6,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,52,2,0,0,54,3,4,0,18,4,0,0,66,3,2,4,88,6,3,128,21,8,2,0,22,8,0,8,60,7,8,2,69,6,3,3,82,6,251,127,54,3,4,0,12,4,1,0,88,4,1,128,52,4,0,0,66,3,2,4,88,6,3,128,21,8,2,0,22,8,0,8,60,7,8,2,69,6,3,3,82,6,251,127,45,3,0,0,18,4,2,0,21,5,0,0,68,3,3,0,11,192,11,105,112,97,105,114,115,14,110,105,108,124,116,97,98,108,101,10,116,97,98,108,101,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,1,1,2,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,103,108,111,98,99,111,109,112,105,108,101,0,105,110,99,108,117,100,101,0,0,34,101,120,99,108,117,100,101,0,0,34,112,97,116,116,101,114,110,115,0,10,24,4,3,6,5,0,6,6,0,6,95,0,1,3,112,97,116,116,101,114,110,0,0,3,4,10,6,5,0,6,6,0,6,95,0,1,3,112,97,116,116,101,114,110,0,0,3,0,143,2,0,6,14,0,8,0,28,80,188,7,8,54,6,1,0,57,6,2,6,57,6,3,6,18,7,1,0,54,8,1,0,57,8,4,8,39,9,5,0,21,10,2,0,18,11,2,0,66,8,4,2,21,9,2,0,54,10,1,0,57,10,4,10,39,11,5,0,21,12,3,0,18,13,3,0,66,10,4,2,21,11,3,0,18,12,4,0,18,13,5,0,66,6,8,2,61,6,0,0,54,6,1,0,57,6,4,6,39,7,7,0,66,6,2,2,61,6,6,0,75,0,1,0,21,117,110,115,105,103,110,101,100,32,99,104,97,114,91,49,93,9,116,121,112,101,19,99,111,110,115,116,32,99,104,97,114,42,91,63,93,8,110,101,119,17,102,115,95,119,97,108,107,95,111,112,101,110,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,2,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,6,1,6,7,7,7,7,7,8,115,101,108,102,0,0,29,100,105,114,0,0,29,105,110,99,108,117,100,101,0,0,29,101,120,99,108,117,100,101,0,0,29,109,97,120,100,101,112,116,104,0,0,29,116,121,112,101,0,0,29,0,45,0,1,3,0,1,0,4,12,198,7,2,18,2,0,0,57,1,0,0,66,1,2,1,75,0,1,0,10,99,108,111,115,101,1,1,1,2,115,101,108,102,0,0,5,0,102,0,1,3,0,4,0,11,19,203,7,5,57,1,0,0,10,1,0,0,88,1,7,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,1,43,1,0,0,61,1,0,0,75,0,1,0,18,102,115,95,119,97,108,107,95,99,108,111,115,101,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,2,2,2,2,2,3,3,5,115,101,108,102,0,0,12,0,196,1,0,1,4,0,7,0,25,40,212,7,8,57,1,0,0,11,1,0,0,88,1,2,128,43,1,0,0,76,1,2,0,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,57,3,4,0,66,1,3,2,11,1,0,0,88,2,5,128,18,3,0,0,57,2,5,0,66,2,2,1,43,2,0,0,76,2,2,0,54,2,1,0,57,2,6,2,18,3,1,0,66,2,2,2,57,3,4,0,58,3,0,3,74,2,3,0,11,115,116,114,105,110,103,10,99,108,111,115,101,9,116,121,112,101,17,102,115,95,119,97,108,107,95,110,101,120,116,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,1,1,2,2,2,2,2,2,3,3,4,4,4,5,5,7,7,7,7,7,7,7,115,101,108,102,0,0,26,112,97,116,104,0,12,14,0,44,0,0,2,1,1,0,4,10,246,7,2,45,0,0,0,18,1,0,0,57,0,0,0,68,0,2,0,3,192,9,110,101,120,116,1,1,1,1,115,101,108,102,0,0,180,3,1,2,9,2,15,0,52,97,238,7,11,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,14,0,1,0,88,2,1,128,52,1,0,0,45,2,0,0,57,3,4,1,14,0,3,0,88,4,1,128,39,3,5,0,56,2,3,2,11,2,0,0,88,3,7,128,54,3,6,0,39,4,7,0,54,5,8,0,57,6,4,1,66,5,2,2,38,4,5,4,66,3,2,1,45,3,1,0,57,3,9,3,18,4,0,0,57,5,10,1,14,0,5,0,88,6,1,128,52,5,0,0,57,6,11,1,14,0,6,0,88,7,1,128,52,6,0,0,57,7,12,1,14,0,7,0,88,8,1,128,41,7,255,255,18,8,2,0,66,3,6,2,57,4,13,3,11,4,0,0,88,4,2,128,43,4,0,0,50,0,3,128,51,4,14,0,50,0,0,128,76,4,2,0,76,4,2,0,13,192,12,192,0,12,104,97,110,100,108,101,114,13,109,97,120,100,101,112,116,104,12,101,120,99,108,117,100,101,12,105,110,99,108,117,100,101,8,110,101,119,13,116,111,115,116,114,105,110,103,26,105,110,118,97,108,105,100,32,116,121,112,101,32,111,112,116,105,111,110,58,32,10,101,114,114,111,114,8,97,108,108,9,116,121,112,101,14,110,105,108,124,116,97,98,108,101,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,10,10,10,7,119,97,108,107,116,121,112,101,115,0,119,97,108,107,101,114,0,100,105,114,0,0,52,111,112,116,115,0,0,52,116,121,112,101,0,18,34,115,101,108,102,0,26,8,0,202,5,0,2,14,2,19,1,82,176,1,134,8,15,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,14,0,1,0,88,2,1,128,52,1,0,0,45,2,0,0,57,3,4,1,14,0,3,0,88,4,1,128,39,3,5,0,56,2,3,2,11,2,0,0,88,3,7,128,54,3,6,0,39,4,7,0,54,5,8,0,57,6,4,1,66,5,2,2,38,4,5,4,66,3,2,1,54,3,9,0,57,3,10,3,57,3,11,3,18,4,0,0,18,5,2,0,45,6,1,0,57,7,12,1,14,0,7,0,88,8,1,128,41,7,0,0,41,8,2,0,66,6,3,0,65,3,2,2,11,3,0,0,88,4,2,128,43,4,0,0,76,4,2,0,52,4,0,0,54,5,9,0,57,5,13,5,39,6,14,0,66,5,2,2,41,6,0,0,54,7,15,0,54,8,9,0,57,8,10,8,57,8,16,8,18,9,3,0,66,8,2,0,65,7,0,2,23,7,0,7,41,8,1,0,77,6,17,128,54,10,9,0,57,10,10,10,57,10,17,10,18,11,3,0,18,12,9,0,18,13,5,0,66,10,4,2,54,11,9,0,57,11,2,11,18,12,10,0,66,11,2,2,54,12,9,0,57,12,2,12,58,13,0,5,66,12,2,2,60,12,11,4,79,6,239,127,54,6,9,0,57,6,10,6,57,6,18,6,18,7,3,0,66,6,2,1,76,4,2,0,14,192,1,192,22,102,115,95,104,97,115,104,116,114,101,101,95,99,108,111,115,101,20,102,115,95,104,97,115,104,116,114,101,101,95,103,101,116,22,102,115,95,104,97,115,104,116,114,101,101,95,99,111,117,110,116,13,116,111,110,117,109,98,101,114,19,99,111,110,115,116,32,99,104,97,114,42,91,49,93,8,110,101,119,12,116,104,114,101,97,100,115,21,102,115,95,104,97,115,104,116,114,101,101,95,111,112,101,110,6,67,8,102,102,105,13,116,111,115,116,114,105,110,103,29,117,110,107,110,111,119,110,32,104,97,115,104,32,97,108,103,111,114,105,116,104,109,58,32,10,101,114,114,111,114,9,120,120,104,51,9,97,108,103,111,14,110,105,108,124,116,97,98,108,101,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,8,8,8,8,8,9,9,9,9,9,9,9,9,9,9,9,10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,11,9,13,13,13,13,13,14,104,97,115,104,97,108,103,111,115,0,99,104,101,99,107,116,104,114,101,97,100,115,0,100,105,114,0,0,83,111,112,116,115,0,0,83,97,108,103,111,0,18,65,104,97,110,100,108,101,114,0,22,43,109,97,110,105,102,101,115,116,0,9,34,100,105,103,101,115,116,0,0,34,1,10,18,2,0,18,3,0,18,105,0,1,16,112,97,116,104,0,7,9,0,166,1,0,3,5,0,9,0,14,43,156,8,5,61,1,0,0,61,2,1,0,54,3,3,0,57,3,4,3,39,4,5,0,66,3,2,2,61,3,2,0,54,3,3,0,57,3,7,3,57,3,8,3,18,4,1,0,66,3,2,2,61,3,6,0,75,0,1,0,16,102,115,95,119,97,116,99,104,95,102,100,6,67,7,102,100,11,105,110,116,91,49,93,8,110,101,119,8,102,102,105,11,97,99,116,105,111,110,13,100,101,98,111,117,110,99,101,12,104,97,110,100,108,101,114,1,2,3,3,3,3,3,4,4,4,4,4,4,5,115,101,108,102,0,0,15,104,97,110,100,108,101,114,0,0,15,100,101,98,111,117,110,99,101,0,0,15,0,45,0,1,3,0,1,0,4,12,163,8,2,18,2,0,0,57,1,0,0,66,1,2,1,75,0,1,0,10,99,108,111,115,101,1,1,1,2,115,101,108,102,0,0,5,0,103,0,1,3,0,4,0,11,19,168,8,5,57,1,0,0,10,1,0,0,88,1,7,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,1,43,1,0,0,61,1,0,0,75,0,1,0,19,102,115,95,119,97,116,99,104,95,99,108,111,115,101,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,2,2,2,2,2,3,3,5,115,101,108,102,0,0,12,0,233,3,0,2,16,1,15,2,59,132,1,179,8,12,57,2,0,0,11,2,0,0,88,2,2,128,43,2,0,0,76,2,2,0,54,2,1,0,54,3,2,0,57,3,3,3,57,3,4,3,57,4,0,0,12,5,1,0,88,5,1,128,41,5,255,255,57,6,5,0,66,3,4,0,65,2,0,2,9,2,0,0,88,3,2,128,43,3,0,0,76,3,2,0,52,3,0,0,41,4,0,0,23,5,1,2,41,6,1,0,77,4,33,128,54,8,2,0,57,8,3,8,57,8,6,8,57,9,0,0,18,10,7,0,57,11,7,0,66,8,4,2,57,9,7,0,58,9,0,9,22,10,1,7,53,11,9,0,54,12,2,0,57,12,8,12,18,13,8,0,66,12,2,2,61,12,10,11,45,12,0,0,56,12,9,12,14,0,12,0,88,13,10,128,45,12,0,0,54,13,11,0,57,13,12,13,18,14,9,0,41,15,8,0,66,13,3,2,56,12,13,12,14,0,12,0,88,13,1,128,39,12,13,0,61,12,14,11,60,11,10,3,79,4,223,127,76,3,2,0,15,192,10,101,118,101,110,116,13,109,111,100,105,102,105,101,100,9,98,97,110,100,8,98,105,116,9,112,97,116,104,1,0,0,11,115,116,114,105,110,103,11,97,99,116,105,111,110,17,102,115,95,119,97,116,99,104,95,103,101,116,13,100,101,98,111,117,110,99,101,18,102,115,95,119,97,116,99,104,95,110,101,120,116,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,12,104,97,110,100,108,101,114,0,2,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,5,6,6,6,6,7,7,7,7,7,7,7,8,8,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,6,11,119,97,116,99,104,101,118,101,110,116,115,0,115,101,108,102,0,0,60,116,105,109,101,111,117,116,0,0,60,110,0,17,43,99,104,97,110,103,101,115,0,5,38,1,3,34,2,0,34,3,0,34,105,0,1,32,112,97,116,104,0,7,25,97,99,116,105,111,110,0,2,23,0,44,0,1,4,0,1,0,4,12,196,8,2,18,2,0,0,57,1,0,0,41,3,0,0,68,1,3,0,9,110,101,120,116,1,1,1,1,115,101,108,102,0,0,5,0,221,3,0,2,9,1,14,1,57,117,213,8,10,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,14,0,1,0,88,2,1,128,52,1,0,0,54,2,4,0,18,3,0,0,66,2,2,2,7,2,5,0,88,2,3,128,52,2,3,0,62,0,1,2,18,0,2,0,54,2,6,0,57,2,7,2,39,3,8,0,21,4,0,0,22,4,0,4,66,2,3,2,54,3,9,0,18,4,0,0,66,3,2,4,88,6,2,128,23,8,0,6,60,7,8,2,69,6,3,3,82,6,252,127,54,3,6,0,57,3,10,3,57,3,11,3,18,4,2,0,21,5,0,0,57,6,12,1,11,6,1,0,88,6,2,128,43,6,1,0,88,7,1,128,43,6,2,0,66,3,4,2,11,3,0,0,88,4,2,128,43,4,0,0,76,4,2,0,45,4,0,0,57,4,7,4,18,5,3,0,57,6,13,1,14,0,6,0,88,7,1,128,41,6,50,0,68,4,3,0,16,192,16,100,101,98,111,117,110,99,101,95,109,115,14,114,101,99,117,114,115,105,118,101,18,102,115,95,119,97,116,99,104,95,111,112,101,110,6,67,11,105,112,97,105,114,115,19,99,111,110,115,116,32,99,104,97,114,42,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,9,116,121,112,101,14,110,105,108,124,116,97,98,108,101,17,115,116,114,105,110,103,124,116,97,98,108,101,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,3,3,5,5,5,5,5,5,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,8,8,8,8,9,9,9,9,9,9,9,9,119,97,116,99,104,101,114,0,100,105,114,115,0,0,58,111,112,116,115,0,0,58,99,100,105,114,115,0,26,32,4,3,5,5,0,5,6,0,5,105,0,1,2,100,105,114,0,0,2,104,97,110,100,108,101,114,0,16,12,0,82,0,0,2,1,3,0,7,20,249,8,3,54,0,0,0,57,0,1,0,57,0,2,0,45,1,0,0,66,0,2,1,49,0,0,0,75,0,1,0,0,0,19,102,115,95,97,115,121,110,99,95,99,108,111,115,101,6,67,8,102,102,105,1,1,1,1,1,2,3,97,115,121,110,99,101,110,103,105,110,101,0,0,135,2,1,0,3,3,9,0,27,64,244,8,11,45,0,0,0,11,0,0,0,88,0,21,128,54,0,0,0,57,0,1,0,57,0,2,0,41,1,0,0,41,2,0,0,66,0,3,2,46,0,0,0,54,0,0,0,57,0,3,0,39,1,4,0,66,0,2,2,46,1,0,0,54,0,5,0,43,1,2,0,66,0,2,2,46,2,0,0,54,0,6,0,45,1,2,0,66,0,2,2,51,1,8,0,61,1,7,0,45,0,0,0,50,0,0,128,76,0,2,0,17,128,18,128,19,128,0,9,95,95,103,99,17,103,101,116,109,101,116,97,116,97,98,108,101,13,110,101,119,112,114,111,120,121,26,102,115,95,97,115,121,110,99,95,114,101,115,117,108,116,95,116,91,54,52,93,8,110,101,119,18,102,115,95,97,115,121,110,99,95,111,112,101,110,6,67,8,102,102,105,1,1,1,2,2,2,2,2,2,2,3,3,3,3,3,4,4,4,4,5,5,5,8,8,10,10,10,97,115,121,110,99,101,110,103,105,110,101,0,97,115,121,110,99,114,101,115,117,108,116,115,0,97,115,121,110,99,103,117,97,114,100,0,0,151,2,2,1,7,2,8,1,32,72,130,9,6,54,1,0,0,57,1,1,1,18,2,0,0,71,3,1,0,65,1,1,3,14,0,1,0,88,3,8,128,54,3,2,0,54,4,3,0,57,4,4,4,18,5,0,0,18,6,2,0,66,4,3,2,41,5,0,0,66,3,3,1,54,3,0,0,57,3,5,3,18,4,0,0,66,3,2,2,7,3,6,0,88,3,10,128,45,3,0,0,4,2,3,0,88,3,7,128,45,3,1,0,45,4,1,0,21,4,4,0,22,4,0,4,53,5,7,0,62,0,1,5,60,5,4,3,75,0,1,0,24,192,22,128,1,3,0,0,0,3,0,14,115,117,115,112,101,110,100,101,100,11,115,116,97,116,117,115,14,116,114,97,99,101,98,97,99,107,10,100,101,98,117,103,10,101,114,114,111,114,11,114,101,115,117,109,101,14,99,111,114,111,117,116,105,110,101,2,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,6,97,115,121,110,99,115,105,103,110,97,108,0,97,115,121,110,99,114,101,97,100,121,0,99,111,0,0,33,111,107,0,6,27,114,101,116,0,0,27,0,200,6,0,1,13,6,20,4,103,254,1,140,9,25,54,1,0,0,54,2,1,0,57,2,2,2,57,2,3,2,45,3,0,0,45,4,1,0,41,5,64,0,18,6,0,0,66,2,5,0,65,1,0,2,52,2,0,0,41,3,0,0,23,4,0,1,41,5,1,0,77,3,71,128,45,7,1,0,56,7,6,7,45,8,2,0,57,9,4,7,56,8,9,8,45,9,2,0,57,10,4,7,43,11,0,0,60,11,10,9,57,9,5,7,8,9,1,0,88,9,12,128,53,9,7,0,54,10,1,0,57,10,8,10,54,11,1,0,57,11,2,11,57,11,9,11,57,12,5,7,66,11,2,0,65,10,0,0,63,10,2,0,61,9,6,8,88,9,34,128,57,9,10,8,7,9,11,0,88,9,9,128,52,9,3,0,54,10,1,0,57,10,8,10,57,11,12,7,57,12,13,7,66,10,3,0,63,10,3,0,61,9,6,8,88,9,22,128,57,9,10,8,7,9,14,0,88,9,7,128,52,9,3,0,54,10,0,0,57,11,13,7,66,10,2,0,63,10,3,0,61,9,6,8,88,9,12,128,57,9,10,8,7,9,15,0,88,9,7,128,52,9,3,0,45,10,3,0,57,11,15,7,66,10,2,0,63,10,3,0,61,9,6,8,88,9,2,128,53,9,16,0,61,9,6,8,54,9,1,0,57,9,2,9,57,9,17,9,45,10,0,0,57,11,4,7,66,9,3,1,57,9,18,8,15,0,9,0,88,10,3,128,21,9,2,0,22,9,0,9,60,8,9,2,79,3,185,127,54,3,19,0,18,4,2,0,66,3,2,4,88,6,10,128,45,8,4,0,23,8,0,8,46,4,8,0,45,8,5,0,57,9,18,7,57,10,6,7,58,10,1,10,57,11,6,7,58,11,2,11,66,8,4,1,69,6,3,3,82,6,244,127,75,0,1,0,17,128,18,128,20,192,0,192,23,128,26,192,11,105,112,97,105,114,115,7,99,111,21,102,115,95,97,115,121,110,99,95,114,101,108,101,97,115,101,1,2,0,0,2,9,115,116,97,116,14,119,114,105,116,101,102,105,108,101,9,115,105,122,101,9,100,97,116,97,13,114,101,97,100,102,105,108,101,9,107,105,110,100,13,115,116,114,101,114,114,111,114,11,115,116,114,105,110,103,1,0,0,12,114,101,115,117,108,116,115,10,101,114,114,111,114,7,105,100,18,102,115,95,97,115,121,110,99,95,119,97,105,116,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,2,0,5,128,128,192,153,4,3,128,128,192,153,4,1,1,1,1,1,1,1,1,1,1,2,3,3,3,3,4,4,5,5,5,6,6,6,6,7,7,7,8,8,8,8,8,8,8,8,8,8,8,8,9,9,9,10,10,10,10,10,10,10,10,10,11,11,11,12,12,12,12,12,12,12,13,13,13,14,14,14,14,14,14,14,16,16,18,18,18,18,18,18,19,19,19,19,19,19,3,21,21,21,21,22,22,22,23,23,23,23,23,23,23,21,21,25,97,115,121,110,99,101,110,103,105,110,101,0,97,115,121,110,99,114,101,115,117,108,116,115,0,97,115,121,110,99,119,97,105,116,105,110,103,0,115,116,97,116,116,97,98,108,101,0,97,115,121,110,99,115,117,115,112,101,110,100,101,100,0,97,115,121,110,99,114,101,115,117,109,101,0,116,105,109,101,111,117,116,0,0,104,110,0,11,93,114,101,115,117,109,101,100,0,1,92,1,3,72,2,0,72,3,0,72,105,0,1,70,114,101,115,117,108,116,0,2,68,101,110,116,114,121,0,3,65,4,69,13,5,0,13,6,0,13,95,0,1,10,101,110,116,114,121,0,0,10,0,68,0,0,1,1,1,0,8,15,183,9,0,45,0,0,0,57,0,0,0,11,0,0,0,88,0,2,128,43,0,1,0,88,1,1,128,43,0,2,0,76,0,2,0,4,192,12,114,101,115,117,108,116,115,0,0,0,0,0,0,0,0,101,110,116,114,121,0,0,148,4,1,3,8,5,13,2,63,165,1,169,9,19,9,1,0,0,88,3,3,128,43,3,0,0,39,4,0,0,50,0,56,128,54,3,1,0,57,3,2,3,66,3,1,2,15,0,3,0,88,4,17,128,45,4,0,0,56,4,3,4,15,0,4,0,88,5,13,128,45,4,1,0,53,5,3,0,61,3,4,5,61,0,5,5,61,2,6,5,60,5,1,4,45,4,2,0,22,4,1,4,46,2,4,0,54,4,1,0,57,4,7,4,45,5,3,0,50,0,35,128,53,4,8,0,61,0,5,4,61,2,6,4,45,5,1,0,60,4,1,5,57,5,9,4,11,5,0,0,88,5,20,128,85,5,19,128,15,0,3,0,88,5,13,128,54,5,10,0,57,5,11,5,57,5,7,5,15,0,5,0,88,6,8,128,54,5,10,0,57,5,11,5,57,5,7,5,18,6,3,0,51,7,12,0,66,5,3,2,14,0,5,0,88,5,237,127,45,5,4,0,41,6,255,255,66,5,2,1,88,5,233,127,57,5,9,4,58,5,1,5,57,6,9,4,58,6,2,6,50,0,0,128,74,5,3,0,74,3,3,0,68,4,2,0,21,192,20,192,23,128,24,192,27,192,0,10,97,115,121,110,99,7,102,115,12,114,101,115,117,108,116,115,1,0,0,10,121,105,101,108,100,11,97,110,99,104,111,114,9,107,105,110,100,7,99,111,1,0,0,12,114,117,110,110,105,110,103,14,99,111,114,111,117,116,105,110,101,32,102,97,105,108,101,100,32,116,111,32,115,116,97,114,116,32,116,104,101,32,114,101,113,117,101,115,116,0,2,1,1,1,1,1,3,3,3,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,7,7,7,7,10,10,10,11,11,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,15,15,15,16,18,18,18,18,18,18,1,7,97,115,121,110,99,109,97,110,97,103,101,100,0,97,115,121,110,99,119,97,105,116,105,110,103,0,97,115,121,110,99,115,117,115,112,101,110,100,101,100,0,97,115,121,110,99,115,105,103,110,97,108,0,97,115,121,110,99,100,105,115,112,97,116,99,104,0,107,105,110,100,0,0,62,105,100,0,0,62,97,110,99,104,111,114,0,0,62,99,111,0,9,53,101,110,116,114,121,0,22,31,0,128,1,0,0,2,1,5,0,12,23,192,9,2,54,0,0,0,57,0,1,0,57,0,2,0,45,1,0,0,66,1,1,0,65,0,0,2,15,0,0,0,88,1,2,128,39,0,3,0,88,1,1,128,39,0,4,0,76,0,2,0,25,192,15,116,104,114,101,97,100,112,111,111,108,13,105,111,95,117,114,105,110,103,22,102,115,95,97,115,121,110,99,95,105,115,95,117,114,105,110,103,6,67,8,102,102,105,1,1,1,1,1,1,1,1,1,1,1,1,97,115,121,110,99,111,112,101,110,0,0,183,1,0,1,6,2,7,0,16,49,198,9,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,45,1,0,0,39,2,3,0,54,3,4,0,57,3,5,3,57,3,6,3,45,4,1,0,66,4,1,2,18,5,0,0,66,3,3,0,67,1,1,0,28,192,25,192,22,102,115,95,97,115,121,110,99,95,114,101,97,100,102,105,108,101,6,67,8,102,102,105,13,114,101,97,100,102,105,108,101,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,97,115,121,110,99,97,119,97,105,116,0,97,115,121,110,99,111,112,101,110,0,102,105,108,101,110,97,109,101,0,0,17,0,217,1,0,2,9,2,7,0,21,61,205,9,3,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,2,0,66,2,6,1,45,2,0,0,39,3,3,0,54,4,4,0,57,4,5,4,57,4,6,4,45,5,1,0,66,5,1,2,18,6,0,0,18,7,1,0,21,8,1,0,66,4,5,2,18,5,1,0,68,2,4,0,28,192,25,192,23,102,115,95,97,115,121,110,99,95,119,114,105,116,101,102,105,108,101,6,67,8,102,102,105,14,119,114,105,116,101,102,105,108,101,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,97,115,121,110,99,97,119,97,105,116,0,97,115,121,110,99,111,112,101,110,0,102,105,108,101,110,97,109,101,0,0,22,100,97,116,97,0,0,22,0,171,1,0,1,6,2,7,0,16,45,212,9,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,45,1,0,0,39,2,3,0,54,3,4,0,57,3,5,3,57,3,6,3,45,4,1,0,66,4,1,2,18,5,0,0,66,3,3,0,67,1,1,0,28,192,25,192,18,102,115,95,97,115,121,110,99,95,115,116,97,116,6,67,8,102,102,105,9,115,116,97,116,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,97,115,121,110,99,97,119,97,105,116,0,97,115,121,110,99,111,112,101,110,0,112,97,116,104,0,0,17,0,251,1,0,3,11,2,8,0,24,73,219,9,3,54,3,0,0,57,3,1,3,41,4,3,0,18,5,0,0,39,6,2,0,18,7,1,0,39,8,2,0,18,9,2,0,39,10,3,0,66,3,8,1,45,3,0,0,39,4,4,0,54,5,5,0,57,5,6,5,57,5,7,5,45,6,1,0,66,6,1,2,18,7,0,0,18,8,1,0,12,9,2,0,88,9,1,128,43,9,1,0,66,5,5,0,67,3,1,0,28,192,25,192,22,102,115,95,97,115,121,110,99,95,99,111,112,121,102,105,108,101,6,67,8,102,102,105,13,99,111,112,121,102,105,108,101,16,110,105,108,124,98,111,111,108,101,97,110,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,97,115,121,110,99,97,119,97,105,116,0,97,115,121,110,99,111,112,101,110,0,115,114,99,0,0,25,100,101,115,116,0,0,25,105,115,79,118,101,114,119,114,105,116,101,0,0,25,0,72,0,0,2,1,3,0,6,17,233,9,2,54,0,0,0,57,0,1,0,57,0,2,0,45,1,0,0,66,1,1,0,67,0,0,0,25,192,16,102,115,95,97,115,121,110,99,95,102,100,6,67,8,102,102,105,1,1,1,1,1,1,97,115,121,110,99,111,112,101,110,0,0,77,0,0,2,2,0,0,7,34,239,9,2,45,0,0,0,10,0,0,0,88,0,3,128,45,0,1,0,41,1,0,0,66,0,2,1,75,0,1,0,17,128,27,192,1,1,1,1,1,1,2,97,115,121,110,99,101,110,103,105,110,101,0,97,115,121,110,99,100,105,115,112,97,116,99,104,0,0,247,1,2,1,8,2,7,2,28,63,246,9,6,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,18,2,0,0,66,1,2,2,45,2,0,0,43,3,2,0,60,3,1,2,45,2,1,0,45,3,1,0,21,3,3,0,22,3,0,3,52,4,4,0,62,1,1,4,54,5,5,0,39,6,6,0,71,7,1,0,65,5,1,2,62,5,2,4,71,5,1,0,63,5,1,0,60,4,3,2,76,1,2,0,21,192,22,128,6,35,11,115,101,108,101,99,116,11,99,114,101,97,116,101,14,99,111,114,111,117,116,105,110,101,13,102,117,110,99,116,105,111,110,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,7,128,128,192,153,4,1,1,1,1,1,1,2,2,2,2,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,97,115,121,110,99,109,97,110,97,103,101,100,0,97,115,121,110,99,114,101,97,100,121,0,102,110,0,0,29,99,111,0,11,18,0,77,2,0,4,0,4,1,9,10,140,10,2,53,0,2,0,54,1,0,0,39,2,1,0,71,3,0,0,65,1,1,2,61,1,3,0,71,1,0,0,63,1,0,0,76,0,2,0,6,110,1,0,0,6,35,11,115,101,108,101,99,116,3,128,128,192,153,4,1,1,1,1,1,1,1,1,1,0,69,2,0,3,3,0,0,7,24,143,10,2,45,0,1,0,45,1,2,0,71,2,0,0,65,1,0,0,65,0,0,2,46,0,0,0,75,0,1,0,3,128,4,192,0,192,1,1,1,1,1,1,2,114,101,115,117,108,116,115,0,112,97,99,107,0,102,110,0,0,234,5,3,1,17,5,15,2,89,221,1,134,10,27,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,66,1,1,2,10,1,0,0,88,2,4,128,45,2,0,0,56,2,1,2,11,2,0,0,88,2,2,128,43,2,1,0,88,3,1,128,43,2,2,0,43,3,0,0,51,4,5,0,54,5,6,0,57,5,7,5,57,5,8,5,51,6,9,0,71,7,1,0,65,5,1,1,10,3,0,0,88,5,11,128,14,0,2,0,88,5,53,128,45,5,1,0,21,5,5,0,41,6,0,0,0,6,5,0,88,5,4,128,45,5,2,0,41,6,0,0,1,6,5,0,88,5,44,128,85,5,43,128,45,5,1,0,52,6,0,0,46,1,6,0,54,6,10,0,18,7,5,0,66,6,2,4,88,9,9,128,45,11,3,0,58,12,1,10,54,13,11,0,18,14,10,0,41,15,3,0,58,16,2,10,22,16,0,16,66,13,4,0,65,11,1,1,69,9,3,3,82,9,245,127,45,6,2,0,41,7,0,0,1,7,6,0,88,6,11,128,45,6,4,0,45,7,1,0,21,7,7,0,41,8,0,0,1,8,7,0,88,7,2,128,41,7,0,0,88,8,1,128,41,7,255,255,66,6,2,1,88,6,209,127,11,3,0,0,88,6,207,127,45,6,1,0,21,6,6,0,9,6,1,0,88,6,203,127,54,6,12,0,39,7,13,0,66,6,2,1,88,5,199,127,54,5,11,0,18,6,3,0,41,7,1,0,57,8,14,3,50,0,0,128,68,5,4,0,21,192,22,128,23,128,26,192,27,192,6,110,68,102,115,46,97,115,121,110,99,46,114,117,110,58,32,116,104,101,32,99,111,114,111,117,116,105,110,101,32,105,115,32,115,117,115,112,101,110,100,101,100,32,98,121,32,111,116,104,101,114,32,116,104,97,110,32,102,115,46,97,115,121,110,99,10,101,114,114,111,114,11,117,110,112,97,99,107,11,105,112,97,105,114,115,0,10,115,112,97,119,110,10,97,115,121,110,99,7,102,115,0,12,114,117,110,110,105,110,103,14,99,111,114,111,117,116,105,110,101,13,102,117,110,99,116,105,111,110,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,4,0,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,3,3,3,4,8,9,9,9,11,11,9,14,14,14,14,14,14,14,14,14,14,14,14,14,14,15,16,16,17,17,17,17,18,18,18,18,18,18,18,18,18,17,17,20,20,20,20,21,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,23,23,23,24,26,26,26,26,26,26,97,115,121,110,99,109,97,110,97,103,101,100,0,97,115,121,110,99,114,101,97,100,121,0,97,115,121,110,99,115,117,115,112,101,110,100,101,100,0,97,115,121,110,99,114,101,115,117,109,101,0,97,115,121,110,99,100,105,115,112,97,116,99,104,0,102,110,0,0,90,99,111,0,10,80,105,115,78,101,115,116,101,100,0,9,71,114,101,115,117,108,116,115,0,1,70,112,97,99,107,0,1,69,114,101,97,100,121,0,21,41,4,5,12,5,0,12,6,0,12,95,0,1,9,116,97,115,107,0,0,9,0,219,76,3,0,31,0,188,1,0,197,2,144,8,0,162,10,54,0,0,0,14,0,0,0,88,1,1,128,52,0,0,0,55,0,0,0,54,0,0,0,52,1,0,0,61,1,1,0,54,0,2,0,57,0,3,0,39,1,4,0,66,0,2,1,54,0,0,0,57,0,1,0,51,1,6,0,61,1,5,0,54,0,0,0,57,0,1,0,51,1,8,0,61,1,7,0,54,0,0,0,57,0,1,0,51,1,10,0,61,1,9,0,54,0,0,0,57,0,1,0,51,1,12,0,61,1,11,0,54,0,0,0,57,0,1,0,51,1,14,0,61,1,13,0,54,0,0,0,57,0,1,0,51,1,16,0,61,1,15,0,54,0,0,0,57,0,1,0,51,1,18,0,61,1,17,0,54,0,0,0,57,0,1,0,51,1,20,0,61,1,19,0,54,0,0,0,57,0,1,0,51,1,22,0,61,1,21,0,54,0,0,0,57,0,1,0,51,1,24,0,61,1,23,0,51,0,25,0,54,1,0,0,57,1,1,1,51,2,27,0,61,2,26,1,54,1,0,0,57,1,1,1,51,2,29,0,61,2,28,1,54,1,0,0,57,1,1,1,51,2,31,0,61,2,30,1,54,1,0,0,51,2,33,0,61,2,32,1,54,1,0,0,51,2,35,0,61,2,34,1,54,1,0,0,51,2,37,0,61,2,36,1,51,1,38,0,54,2,0,0,51,3,40,0,61,3,39,2,53,2,41,0,54,3,0,0,51,4,43,0,61,4,42,3,54,3,0,0,51,4,45,0,61,4,44,3,54,3,0,0,51,4,47,0,61,4,46,3,54,3,0,0,53,4,49,0,61,4,48,3,54,3,0,0,41,4,255,255,61,4,50,3,54,3,51,0,53,4,53,0,51,5,52,0,61,5,54,4,51,5,55,0,61,5,56,4,51,5,57,0,61,5,58,4,51,5,59,0,61,5,60,4,51,5,61,0,61,5,62,4,51,5,63,0,61,5,64,4,51,5,65,0,61,5,66,4,51,5,67,0,61,5,68,4,51,5,69,0,61,5,70,4,51,5,71,0,61,5,72,4,51,5,73,0,61,5,74,4,51,5,75,0,61,5,76,4,51,5,77,0,61,5,78,4,51,5,79,0,61,5,80,4,51,5,81,0,61,5,82,4,66,3,2,2,54,4,0,0,51,5,84,0,61,5,83,4,54,4,0,0,51,5,86,0,61,5,85,4,54,4,51,0,53,5,88,0,51,6,87,0,61,6,54,5,51,6,89,0,61,6,56,5,51,6,90,0,61,6,91,5,51,6,92,0,61,6,74,5,51,6,93,0,61,6,82,5,66,4,2,2,54,5,0,0,51,6,95,0,61,6,94,5,53,5,96,0,51,6,97,0,54,7,51,0,53,8,99,0,51,9,98,0,61,9,54,8,51,9,100,0,61,9,56,8,51,9,101,0,61,9,91,8,51,9,102,0,61,9,103,8,51,9,104,0,61,9,42,8,66,7,2,2,54,8,0,0,51,9,106,0,61,9,105,8,54,8,51,0,53,9,108,0,51,10,107,0,61,10,54,9,51,10,109,0,61,10,56,9,51,10,110,0,61,10,91,9,51,10,111,0,61,10,78,9,51,10,112,0,61,10,113,9,51,10,114,0,61,10,115,9,66,8,2,2,54,9,0,0,51,10,117,0,61,10,116,9,54,9,0,0,51,10,119,0,61,10,118,9,54,9,0,0,53,10,121,0,61,10,120,9,54,9,0,0,51,10,123,0,61,10,122,9,51,9,124,0,54,10,0,0,51,11,126,0,61,11,125,10,54,10,0,0,52,11,0,0,61,11,127,10,54,10,51,0,53,11,129,0,51,12,128,0,61,12,54,11,51,12,130,0,61,12,56,11,51,12,131,0,61,12,132,11,51,12,133,0,61,12,134,11,51,12,135,0,61,12,136,11,66,10,2,2,51,11,137,0,54,12,0,0,57,12,127,12,51,13,139,0,61,13,138,12,54,12,0,0,57,12,127,12,51,13,141,0,61,13,140,12,54,12,51,0,53,13,143,0,51,14,142,0,61,14,54,13,51,14,144,0,61,14,56,13,51,14,145,0,61,14,91,13,51,14,146,0,61,14,147,13,66,12,2,2,53,13,148,0,54,14,0,0,57,14,120,14,57,14,149,14,61,14,149,13,54,14,0,0,57,14,120,14,57,14,150,14,61,14,150,13,54,14,0,0,51,15,152,0,61,15,151,14,53,14,153,0,54,15,0,0,51,16,155,0,61,16,154,15,53,15,156,0,54,16,51,0,53,17,158,0,51,18,157,0,61,18,54,17,51,18,159,0,61,18,56,17,51,18,160,0,61,18,91,17,51,18,161,0,61,18,147,17,51,18,162,0,61,18,163,17,66,16,2,2,54,17,0,0,51,18,165,0,61,18,164,17,54,17,0,0,52,18,0,0,61,18,166,17,44,17,19,0,52,20,0,0,54,21,167,0,52,22,0,0,53,23,168,0,66,21,3,2,52,22,0,0,41,23,0,0,52,24,0,0,51,25,169,0,51,26,170,0,51,27,171,0,51,28,172,0,54,29,0,0,57,29,166,29,51,30,174,0,61,30,173,29,54,29,0,0,57,29,166,29,51,30,176,0,61,30,175,29,54,29,0,0,57,29,166,29,51,30,177,0,61,30,85,29,54,29,0,0,57,29,166,29,51,30,178,0,61,30,26,29,54,29,0,0,57,29,166,29,51,30,179,0,61,30,32,29,54,29,0,0,57,29,166,29,43,30,0,0,61,30,180,29,54,29,0,0,57,29,166,29,51,30,182,0,61,30,181,29,54,29,0,0,57,29,166,29,51,30,183,0,61,30,163,29,54,29,0,0,57,29,166,29,51,30,185,0,61,30,184,29,54,29,0,0,57,29,166,29,51,30,187,0,61,30,186,29,50,0,0,128,75,0,1,0,0,8,114,117,110,0,10,115,112,97,119,110,0,0,7,102,100,10,121,105,101,108,100,0,0,0,0,13,114,101,97,100,102,105,108,101,0,12,98,97,99,107,101,110,100,0,0,0,0,1,0,1,11,95,95,109,111,100,101,6,107,17,115,101,116,109,101,116,97,116,97,98,108,101,10,97,115,121,110,99,0,10,119,97,116,99,104,9,112,111,108,108,0,0,0,0,1,0,0,0,1,9,0,0,12,99,114,101,97,116,101,100,13,109,111,100,105,102,105,101,100,0,12,114,101,109,111,118,101,100,0,0,0,13,111,118,101,114,102,108,111,119,0,14,104,97,115,104,95,116,114,101,101,1,0,3,9,120,120,104,51,3,2,11,115,104,97,50,53,54,3,3,10,99,114,99,51,50,3,1,0,9,119,97,108,107,8,100,105,114,9,102,105,108,101,1,0,1,8,97,108,108,3,0,9,110,101,120,116,0,0,0,1,0,0,0,0,11,102,105,108,116,101,114,0,12,99,111,109,112,105,108,101,0,12,109,97,116,99,104,101,115,0,12,112,97,114,116,105,97,108,0,10,109,97,116,99,104,0,0,1,0,0,0,9,103,108,111,98,0,14,101,110,117,109,102,105,108,101,115,0,0,12,114,101,97,100,100,105,114,1,0,8,12,99,104,97,114,100,101,118,3,2,12,117,110,107,110,111,119,110,3,0,13,98,108,111,99,107,100,101,118,3,6,9,102,105,108,101,3,8,8,100,105,114,3,4,11,115,111,99,107,101,116,3,12,9,108,105,110,107,3,10,9,102,105,102,111,3,1,13,102,105,108,101,116,121,112,101,0,12,115,99,97,110,100,105,114,0,12,111,112,101,110,100,105,114,13,114,101,97,100,112,97,116,104,0,13,114,101,97,100,110,97,109,101,0,0,0,0,1,0,0,0,0,9,109,109,97,112,0,11,97,100,118,105,115,101,0,0,0,1,0,0,0,0,1,0,5,15,115,101,113,117,101,110,116,105,97,108,3,1,11,114,97,110,100,111,109,3,2,13,104,117,103,101,112,97,103,101,3,8,13,119,105,108,108,110,101,101,100,3,4,11,110,111,114,109,97,108,3,0,0,11,119,114,105,116,101,114,0,0,10,99,108,111,115,101,0,0,1,0,0,0,0,14,119,114,105,116,101,102,105,108,101,0,9,111,112,101,110,10,102,108,117,115,104,0,8,112,111,115,0,9,115,101,101,107,0,14,119,114,105,116,101,99,104,97,114,0,10,119,114,105,116,101,0,9,114,101,97,100,0,13,114,101,97,100,99,104,97,114,0,10,108,105,110,101,115,0,13,114,101,97,100,108,105,110,101,0,9,115,105,122,101,0,14,103,101,116,114,101,97,100,101,114,0,15,115,121,110,99,114,101,97,100,101,114,0,16,99,108,111,115,101,114,101,97,100,101,114,0,15,100,101,115,116,114,117,99,116,111,114,0,16,99,111,110,115,116,114,117,99,116,111,114,1,0,0,0,10,99,108,97,115,115,8,101,111,102,1,0,3,8,99,117,114,3,1,9,116,97,105,108,3,2,9,104,101,97,100,3,0,14,115,101,101,107,95,102,114,111,109,0,11,114,101,110,97,109,101,0,10,114,109,100,105,114,0,9,115,121,110,99,1,0,2,15,109,116,105,109,101,43,115,105,122,101,3,0,9,104,97,115,104,3,1,0,12,99,111,112,121,100,105,114,0,0,10,109,107,100,105,114,0,11,114,109,102,105,108,101,0,13,99,111,112,121,102,105,108,101,0,17,114,101,109,111,118,101,95,115,108,97,115,104,0,17,97,112,112,101,110,100,95,115,108,97,115,104,0,9,115,116,97,116,0,0,15,99,108,101,97,114,99,97,99,104,101,0,10,99,97,99,104,101,0,14,110,111,114,109,97,108,105,122,101,0,13,99,111,109,112,108,101,116,101,0,10,105,115,100,105,114,0,11,105,115,102,105,108,101,0,14,112,97,114,101,110,116,100,105,114,0,8,101,120,116,0,9,115,116,101,109,0,13,98,97,115,101,110,97,109,101,137,51,116,121,112,101,100,101,102,32,115,116,114,117,99,116,32,123,10,32,32,32,32,117,110,115,105,103,110,101,100,32,108,111,110,103,32,100,101,118,105,99,101,95,105,100,44,32,105,110,111,100,101,59,10,32,32,32,32,117,110,115,105,103,110,101,100,32,115,104,111,114,116,32,97,99,99,101,115,115,95,109,111,100,101,59,10,32,32,32,32,115,104,111,114,116,32,110,108,105,110,107,115,44,32,117,115,101,114,95,105,100,44,32,103,114,111,117,112,95,105,100,59,10,32,32,32,32,117,110,115,105,103,110,101,100,32,108,111,110,103,32,115,112,101,99,105,97,108,95,100,101,118,105,99,101,95,105,100,59,10,32,32,32,32,117,110,115,105,103,110,101,100,32,108,111,110,103,32,108,111,110,103,32,115,105,122,101,44,10,32,32,32,32,32,32,32,32,108,97,115,116,95,97,99,99,101,115,115,101,100,95,115,101,99,111,110,100,115,44,10,32,32,32,32,32,32,32,32,108,97,115,116,95,109,111,100,105,102,105,101,100,95,115,101,99,111,110,100,115,44,10,32,32,32,32,32,32,32,32,108,97,115,116,95,99,104,97,110,103,101,100,95,115,101,99,111,110,100,115,59,10,125,32,112,97,116,104,95,115,116,97,116,95,116,59,10,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,98,97,115,101,110,97,109,101,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,115,116,101,109,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,101,120,116,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,112,97,114,101,110,116,100,105,114,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,115,105,122,101,95,116,32,112,97,116,104,95,112,97,114,101,110,116,100,105,114,95,115,40,99,104,97,114,32,42,100,101,115,116,44,32,115,105,122,101,95,116,32,115,105,122,101,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,44,32,98,111,111,108,32,105,115,70,117,108,108,80,97,116,104,82,101,113,117,105,114,101,100,41,59,10,98,111,111,108,32,112,97,116,104,95,105,115,102,105,108,101,40,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,98,111,111,108,32,112,97,116,104,95,105,115,100,105,114,40,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,99,111,109,112,108,101,116,101,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,115,105,122,101,95,116,32,112,97,116,104,95,99,111,109,112,108,101,116,101,95,115,40,99,104,97,114,32,42,100,101,115,116,44,32,115,105,122,101,95,116,32,115,105,122,101,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,110,111,114,109,97,108,105,122,101,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,118,111,105,100,32,112,97,116,104,95,99,97,99,104,101,95,101,110,97,98,108,101,40,115,105,122,101,95,116,32,99,97,112,97,99,105,116,121,41,59,10,118,111,105,100,32,112,97,116,104,95,99,97,99,104,101,95,99,108,101,97,114,40,41,59,10,98,111,111,108,32,112,97,116,104,95,115,116,97,116,40,112,97,116,104,95,115,116,97,116,95,116,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,97,112,112,101,110,100,95,115,108,97,115,104,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,95,114,101,109,111,118,101,95,115,108,97,115,104,40,99,104,97,114,32,42,100,101,115,116,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,10,115,116,114,117,99,116,32,70,73,76,69,32,42,102,115,95,102,111,112,101,110,40,99,111,110,115,116,32,99,104,97,114,32,42,102,105,108,101,110,97,109,101,44,32,99,111,110,115,116,32,99,104,97,114,32,42,109,111,100,101,41,59,10,115,116,114,117,99,116,32,70,73,76,69,32,42,102,115,95,112,111,112,101,110,40,99,111,110,115,116,32,99,104,97,114,32,42,112,114,111,99,110,97,109,101,44,32,99,111,110,115,116,32,99,104,97,114,32,42,109,111,100,101,41,59,10,118,111,105,100,32,102,115,95,102,99,108,111,115,101,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,118,111,105,100,32,102,115,95,112,99,108,111,115,101,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,105,110,116,32,102,103,101,116,99,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,115,105,122,101,95,116,32,102,114,101,97,100,40,118,111,105,100,32,42,98,117,102,44,32,115,105,122,101,95,116,32,115,105,122,101,44,32,115,105,122,101,95,116,32,110,44,32,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,115,105,122,101,95,116,32,102,119,114,105,116,101,40,99,111,110,115,116,32,118,111,105,100,32,42,98,117,102,44,32,115,105,122,101,95,116,32,115,105,122,101,44,32,115,105,122,101,95,116,32,110,44,32,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,105,110,116,32,102,112,117,116,99,40,105,110,116,32,99,44,32,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,105,110,116,32,102,115,101,101,107,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,44,32,108,111,110,103,32,111,102,102,115,101,116,44,32,105,110,116,32,111,114,105,103,105,110,41,59,10,108,111,110,103,32,105,110,116,32,102,116,101,108,108,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,105,110,116,32,102,102,108,117,115,104,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,41,59,10,10,98,111,111,108,32,102,115,95,99,111,112,121,102,105,108,101,40,99,111,110,115,116,32,99,104,97,114,32,42,115,114,99,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,101,115,116,44,32,98,111,111,108,32,105,115,79,118,101,114,119,114,105,116,101,41,59,10,98,111,111,108,32,102,115,95,99,111,112,121,102,105,108,101,95,101,120,40,99,111,110,115,116,32,99,104,97,114,32,42,115,114,99,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,101,115,116,44,32,98,111,111,108,32,105,115,79,118,101,114,119,114,105,116,101,44,32,98,111,111,108,32,105,115,77,111,100,101,80,114,101,115,101,114,118,101,100,44,32,98,111,111,108,32,105,115,77,116,105,109,101,80,114,101,115,101,114,118,101,100,41,59,10,98,111,111,108,32,102,115,95,114,109,102,105,108,101,40,99,111,110,115,116,32,99,104,97,114,32,42,102,105,108,101,110,97,109,101,41,59,10,98,111,111,108,32,102,115,95,109,107,100,105,114,40,99,111,110,115,116,32,99,104,97,114,32,42,100,105,114,41,59,10,98,111,111,108,32,102,115,95,99,111,112,121,100,105,114,40,99,111,110,115,116,32,99,104,97,114,32,42,115,114,99,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,101,115,116,41,59,10,98,111,111,108,32,102,115,95,114,109,100,105,114,40,99,111,110,115,116,32,99,104,97,114,32,42,100,105,114,41,59,10,98,111,111,108,32,102,115,95,99,111,112,121,100,105,114,95,112,97,114,97,108,108,101,108,40,99,111,110,115,116,32,99,104,97,114,32,42,115,114,99,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,101,115,116,44,32,115,105,122,101,95,116,32,116,104,114,101,97,100,115,41,59,10,98,111,111,108,32,102,115,95,114,109,100,105,114,95,112,97,114,97,108,108,101,108,40,99,111,110,115,116,32,99,104,97,114,32,42,100,105,114,44,32,115,105,122,101,95,116,32,116,104,114,101,97,100,115,41,59,10,115,105,122,101,95,116,32,102,115,95,119,114,105,116,101,102,105,108,101,40,99,111,110,115,116,32,99,104,97,114,32,42,102,105,108,101,110,97,109,101,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,97,116,97,44,32,115,105,122,101,95,116,32,115,105,122,101,41,59,10,98,111,111,108,32,102,115,95,114,101,110,97,109,101,40,99,111,110,115,116,32,99,104,97,114,32,42,115,114,99,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,101,115,116,44,32,98,111,111,108,32,105,115,79,118,101,114,119,114,105,116,101,41,59,10,10,115,116,114,117,99,116,32,102,115,95,115,121,110,99,95,116,32,42,102,115,95,115,121,110,99,40,99,111,110,115,116,32,99,104,97,114,32,42,115,114,99,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,101,115,116,44,32,105,110,116,32,99,111,109,112,97,114,101,44,32,98,111,111,108,32,105,115,68,101,108,101,116,101,100,44,32,115,105,122,101,95,116,32,116,104,114,101,97,100,115,41,59,10,118,111,105,100,32,102,115,95,115,121,110,99,95,102,114,101,101,40,115,116,114,117,99,116,32,102,115,95,115,121,110,99,95,116,32,42,115,101,108,102,41,59,10,115,105,122,101,95,116,32,102,115,95,115,121,110,99,95,99,111,117,110,116,40,115,116,114,117,99,116,32,102,115,95,115,121,110,99,95,116,32,42,115,101,108,102,44,32,105,110,116,32,107,105,110,100,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,102,115,95,115,121,110,99,95,103,101,116,40,115,116,114,117,99,116,32,102,115,95,115,121,110,99,95,116,32,42,115,101,108,102,44,32,105,110,116,32,107,105,110,100,44,32,115,105,122,101,95,116,32,105,110,100,101,120,41,59,10,117,110,115,105,103,110,101,100,32,108,111,110,103,32,108,111,110,103,32,102,115,95,115,121,110,99,95,98,121,116,101,115,40,115,116,114,117,99,116,32,102,115,95,115,121,110,99,95,116,32,42,115,101,108,102,41,59,10,10,115,116,114,117,99,116,32,102,115,95,100,105,114,101,110,116,95,116,32,42,102,115,95,111,112,101,110,100,105,114,40,99,111,110,115,116,32,99,104,97,114,32,42,100,105,114,41,59,10,118,111,105,100,32,102,115,95,99,108,111,115,101,100,105,114,40,115,116,114,117,99,116,32,102,115,95,100,105,114,101,110,116,95,116,32,42,115,101,108,102,41,59,10,98,111,111,108,32,102,115,95,115,101,101,107,100,105,114,40,115,116,114,117,99,116,32,102,115,95,100,105,114,101,110,116,95,116,32,42,115,101,108,102,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,102,115,95,114,101,97,100,100,105,114,95,110,97,109,101,40,115,116,114,117,99,116,32,102,115,95,100,105,114,101,110,116,95,116,32,42,115,101,108,102,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,102,115,95,114,101,97,100,100,105,114,95,112,97,116,104,40,115,116,114,117,99,116,32,102,115,95,100,105,114,101,110,116,95,116,32,42,115,101,108,102,41,59,10,10,116,121,112,101,100,101,102,32,115,116,114,117,99,116,32,123,10,32,32,32,32,115,105,122,101,95,116,32,110,97,109,101,95,111,102,102,115,101,116,59,10,32,32,32,32,117,110,115,105,103,110,101,100,32,108,111,110,103,32,108,111,110,103,32,105,110,111,100,101,59,10,32,32,32,32,117,110,115,105,103,110,101,100,32,99,104,97,114,32,116,121,112,101,59,10,125,32,102,115,95,101,110,116,114,121,95,116,59,10,10,115,105,122,101,95,116,32,102,115,95,114,101,97,100,100,105,114,95,98,97,116,99,104,40,115,116,114,117,99,116,32,102,115,95,100,105,114,101,110,116,95,116,32,42,115,101,108,102,44,32,102,115,95,101,110,116,114,121,95,116,32,42,111,117,116,44,32,115,105,122,101,95,116,32,99,97,112,44,32,99,104,97,114,32,42,112,111,111,108,44,32,115,105,122,101,95,116,32,112,111,111,108,99,97,112,41,59,10,10,115,116,114,117,99,116,32,103,108,111,98,95,109,97,116,99,104,101,114,95,116,32,42,103,108,111,98,95,99,111,109,112,105,108,101,40,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,116,101,114,110,41,59,10,115,116,114,117,99,116,32,103,108,111,98,95,109,97,116,99,104,101,114,95,116,32,42,103,108,111,98,95,99,111,109,112,105,108,101,95,115,101,116,40,99,111,110,115,116,32,99,104,97,114,32,42,42,112,97,116,116,101,114,110,115,44,32,115,105,122,101,95,116,32,110,41,59,10,118,111,105,100,32,103,108,111,98,95,102,114,101,101,40,115,116,114,117,99,116,32,103,108,111,98,95,109,97,116,99,104,101,114,95,116,32,42,115,101,108,102,41,59,10,98,111,111,108,32,103,108,111,98,95,109,97,116,99,104,40,99,111,110,115,116,32,115,116,114,117,99,116,32,103,108,111,98,95,109,97,116,99,104,101,114,95,116,32,42,115,101,108,102,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,98,111,111,108,32,103,108,111,98,95,109,97,116,99,104,95,112,97,114,116,105,97,108,40,99,111,110,115,116,32,115,116,114,117,99,116,32,103,108,111,98,95,109,97,116,99,104,101,114,95,116,32,42,115,101,108,102,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,115,105,122,101,95,116,32,103,108,111,98,95,109,97,116,99,104,95,115,101,116,40,99,111,110,115,116,32,115,116,114,117,99,116,32,103,108,111,98,95,109,97,116,99,104,101,114,95,116,32,42,115,101,108,102,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,44,32,98,111,111,108,32,42,109,97,116,99,104,101,100,41,59,10,10,115,116,114,117,99,116,32,102,115,95,119,97,108,107,95,116,32,42,102,115,95,119,97,108,107,95,111,112,101,110,40,99,111,110,115,116,32,99,104,97,114,32,42,100,105,114,44,32,99,111,110,115,116,32,99,104,97,114,32,42,42,105,110,99,108,117,100,101,44,32,115,105,122,101,95,116,32,110,105,110,99,108,117,100,101,44,32,99,111,110,115,116,32,99,104,97,114,32,42,42,101,120,99,108,117,100,101,44,32,115,105,122,101,95,116,32,110,101,120,99,108,117,100,101,44,32,105,110,116,32,109,97,120,100,101,112,116,104,44,32,117,110,115,105,103,110,101,100,32,99,104,97,114,32,116,121,112,101,41,59,10,118,111,105,100,32,102,115,95,119,97,108,107,95,99,108,111,115,101,40,115,116,114,117,99,116,32,102,115,95,119,97,108,107,95,116,32,42,115,101,108,102,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,102,115,95,119,97,108,107,95,110,101,120,116,40,115,116,114,117,99,116,32,102,115,95,119,97,108,107,95,116,32,42,115,101,108,102,44,32,117,110,115,105,103,110,101,100,32,99,104,97,114,32,42,116,121,112,101,41,59,10,10,116,121,112,101,100,101,102,32,115,116,114,117,99,116,32,123,10,32,32,32,32,99,104,97,114,32,42,112,116,114,59,10,32,32,32,32,117,110,115,105,103,110,101,100,32,108,111,110,103,32,108,111,110,103,32,115,105,122,101,59,10,32,32,32,32,117,110,115,105,103,110,101,100,32,108,111,110,103,32,108,111,110,103,32,104,97,110,100,108,101,114,44,32,109,97,112,112,105,110,103,59,10,32,32,32,32,98,111,111,108,32,105,115,95,119,114,105,116,97,98,108,101,59,10,125,32,102,115,95,109,109,97,112,95,116,59,10,10,102,115,95,109,109,97,112,95,116,32,42,102,115,95,109,109,97,112,95,111,112,101,110,40,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,44,32,98,111,111,108,32,105,115,87,114,105,116,97,98,108,101,44,32,105,110,116,32,97,100,118,105,99,101,41,59,10,98,111,111,108,32,102,115,95,109,109,97,112,95,97,100,118,105,115,101,40,102,115,95,109,109,97,112,95,116,32,42,115,101,108,102,44,32,105,110,116,32,97,100,118,105,99,101,41,59,10,98,111,111,108,32,102,115,95,109,109,97,112,95,115,121,110,99,40,102,115,95,109,109,97,112,95,116,32,42,115,101,108,102,41,59,10,118,111,105,100,32,102,115,95,109,109,97,112,95,99,108,111,115,101,40,102,115,95,109,109,97,112,95,116,32,42,115,101,108,102,41,59,10,10,115,116,114,117,99,116,32,102,115,95,114,101,97,100,101,114,95,116,32,42,102,115,95,114,101,97,100,101,114,95,111,112,101,110,40,115,116,114,117,99,116,32,70,73,76,69,32,42,102,112,44,32,115,105,122,101,95,116,32,98,117,102,115,105,122,101,41,59,10,115,116,114,117,99,116,32,102,115,95,114,101,97,100,101,114,95,116,32,42,102,115,95,114,101,97,100,101,114,95,111,112,101,110,102,100,40,105,110,116,32,102,100,44,32,115,105,122,101,95,116,32,98,117,102,115,105,122,101,41,59,10,118,111,105,100,32,102,115,95,114,101,97,100,101,114,95,99,108,111,115,101,40,115,116,114,117,99,116,32,102,115,95,114,101,97,100,101,114,95,116,32,42,115,101,108,102,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,102,115,95,114,101,97,100,101,114,95,114,101,97,100,108,105,110,101,40,115,116,114,117,99,116,32,102,115,95,114,101,97,100,101,114,95,116,32,42,115,101,108,102,44,32,115,105,122,101,95,116,32,42,108,101,110,41,59,10,115,105,122,101,95,116,32,102,115,95,114,101,97,100,101,114,95,114,101,97,100,40,115,116,114,117,99,116,32,102,115,95,114,101,97,100,101,114,95,116,32,42,115,101,108,102,44,32,99,104,97,114,32,42,100,101,115,116,44,32,115,105,122,101,95,116,32,115,105,122,101,41,59,10,105,110,116,32,102,115,95,114,101,97,100,101,114,95,103,101,116,99,40,115,116,114,117,99,116,32,102,115,95,114,101,97,100,101,114,95,116,32,42,115,101,108,102,41,59,10,115,105,122,101,95,116,32,102,115,95,114,101,97,100,101,114,95,102,105,108,108,40,115,116,114,117,99,116,32,102,115,95,114,101,97,100,101,114,95,116,32,42,115,101,108,102,41,59,10,98,111,111,108,32,102,115,95,114,101,97,100,101,114,95,115,121,110,99,40,115,116,114,117,99,116,32,102,115,95,114,101,97,100,101,114,95,116,32,42,115,101,108,102,41,59,10,10,115,116,114,117,99,116,32,102,115,95,119,114,105,116,101,114,95,116,32,42,102,115,95,119,114,105,116,101,114,95,111,112,101,110,40,99,111,110,115,116,32,99,104,97,114,32,42,102,105,108,101,110,97,109,101,44,32,98,111,111,108,32,105,115,65,112,112,101,110,100,101,100,44,32,115,105,122,101,95,116,32,98,117,102,115,105,122,101,41,59,10,115,116,114,117,99,116,32,102,115,95,119,114,105,116,101,114,95,116,32,42,102,115,95,119,114,105,116,101,114,95,111,112,101,110,102,100,40,105,110,116,32,102,100,44,32,115,105,122,101,95,116,32,98,117,102,115,105,122,101,41,59,10,98,111,111,108,32,102,115,95,119,114,105,116,101,114,95,119,114,105,116,101,40,115,116,114,117,99,116,32,102,115,95,119,114,105,116,101,114,95,116,32,42,115,101,108,102,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,97,116,97,44,32,115,105,122,101,95,116,32,115,105,122,101,41,59,10,98,111,111,108,32,102,115,95,119,114,105,116,101,114,95,119,114,105,116,101,118,40,115,116,114,117,99,116,32,102,115,95,119,114,105,116,101,114,95,116,32,42,115,101,108,102,44,32,99,111,110,115,116,32,99,104,97,114,32,42,42,100,97,116,97,44,32,99,111,110,115,116,32,115,105,122,101,95,116,32,42,115,105,122,101,115,44,32,115,105,122,101,95,116,32,110,41,59,10,98,111,111,108,32,102,115,95,119,114,105,116,101,114,95,102,108,117,115,104,40,115,116,114,117,99,116,32,102,115,95,119,114,105,116,101,114,95,116,32,42,115,101,108,102,41,59,10,98,111,111,108,32,102,115,95,119,114,105,116,101,114,95,99,108,111,115,101,40,115,116,114,117,99,116,32,102,115,95,119,114,105,116,101,114,95,116,32,42,115,101,108,102,41,59,10,10,116,121,112,101,100,101,102,32,115,116,114,117,99,116,32,123,10,32,32,32,32,117,110,115,105,103,110,101,100,32,105,110,116,32,105,100,59,10,32,32,32,32,105,110,116,32,101,114,114,111,114,59,10,32,32,32,32,99,111,110,115,116,32,99,104,97,114,32,42,100,97,116,97,59,10,32,32,32,32,117,110,115,105,103,110,101,100,32,108,111,110,103,32,108,111,110,103,32,115,105,122,101,59,10,32,32,32,32,112,97,116,104,95,115,116,97,116,95,116,32,115,116,97,116,59,10,125,32,102,115,95,97,115,121,110,99,95,114,101,115,117,108,116,95,116,59,10,10,115,116,114,117,99,116,32,102,115,95,97,115,121,110,99,95,116,32,42,102,115,95,97,115,121,110,99,95,111,112,101,110,40,115,105,122,101,95,116,32,101,110,116,114,105,101,115,44,32,115,105,122,101,95,116,32,116,104,114,101,97,100,115,41,59,10,118,111,105,100,32,102,115,95,97,115,121,110,99,95,99,108,111,115,101,40,115,116,114,117,99,116,32,102,115,95,97,115,121,110,99,95,116,32,42,115,101,108,102,41,59,10,98,111,111,108,32,102,115,95,97,115,121,110,99,95,105,115,95,117,114,105,110,103,40,115,116,114,117,99,116,32,102,115,95,97,115,121,110,99,95,116,32,42,115,101,108,102,41,59,10,117,110,115,105,103,110,101,100,32,105,110,116,32,102,115,95,97,115,121,110,99,95,114,101,97,100,102,105,108,101,40,115,116,114,117,99,116,32,102,115,95,97,115,121,110,99,95,116,32,42,115,101,108,102,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,117,110,115,105,103,110,101,100,32,105,110,116,32,102,115,95,97,115,121,110,99,95,119,114,105,116,101,102,105,108,101,40,115,116,114,117,99,116,32,102,115,95,97,115,121,110,99,95,116,32,42,115,101,108,102,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,97,116,97,44,32,115,105,122,101,95,116,32,115,105,122,101,41,59,10,117,110,115,105,103,110,101,100,32,105,110,116,32,102,115,95,97,115,121,110,99,95,115,116,97,116,40,115,116,114,117,99,116,32,102,115,95,97,115,121,110,99,95,116,32,42,115,101,108,102,44,32,99,111,110,115,116,32,99,104,97,114,32,42,112,97,116,104,41,59,10,117,110,115,105,103,110,101,100,32,105,110,116,32,102,115,95,97,115,121,110,99,95,99,111,112,121,102,105,108,101,40,115,116,114,117,99,116,32,102,115,95,97,115,121,110,99,95,116,32,42,115,101,108,102,44,32,99,111,110,115,116,32,99,104,97,114,32,42,115,114,99,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,101,115,116,44,32,98,111,111,108,32,105,115,79,118,101,114,119,114,105,116,101,41,59,10,115,105,122,101,95,116,32,102,115,95,97,115,121,110,99,95,119,97,105,116,40,115,116,114,117,99,116,32,102,115,95,97,115,121,110,99,95,116,32,42,115,101,108,102,44,32,102,115,95,97,115,121,110,99,95,114,101,115,117,108,116,95,116,32,42,114,101,115,117,108,116,115,44,32,115,105,122,101,95,116,32,99,97,112,97,99,105,116,121,44,32,105,110,116,32,116,105,109,101,111,117,116,41,59,10,118,111,105,100,32,102,115,95,97,115,121,110,99,95,114,101,108,101,97,115,101,40,115,116,114,117,99,116,32,102,115,95,97,115,121,110,99,95,116,32,42,115,101,108,102,44,32,117,110,115,105,103,110,101,100,32,105,110,116,32,105,100,41,59,10,115,105,122,101,95,116,32,102,115,95,97,115,121,110,99,95,112,101,110,100,105,110,103,40,115,116,114,117,99,116,32,102,115,95,97,115,121,110,99,95,116,32,42,115,101,108,102,41,59,10,105,110,116,32,102,115,95,97,115,121,110,99,95,102,100,40,115,116,114,117,99,116,32,102,115,95,97,115,121,110,99,95,116,32,42,115,101,108,102,41,59,10,10,115,116,114,117,99,116,32,102,115,95,119,97,116,99,104,95,116,32,42,102,115,95,119,97,116,99,104,95,111,112,101,110,40,99,111,110,115,116,32,99,104,97,114,32,42,42,100,105,114,115,44,32,115,105,122,101,95,116,32,110,100,105,114,115,44,32,98,111,111,108,32,105,115,82,101,99,117,114,115,105,118,101,41,59,10,118,111,105,100,32,102,115,95,119,97,116,99,104,95,99,108,111,115,101,40,115,116,114,117,99,116,32,102,115,95,119,97,116,99,104,95,116,32,42,115,101,108,102,41,59,10,115,105,122,101,95,116,32,102,115,95,119,97,116,99,104,95,110,101,120,116,40,115,116,114,117,99,116,32,102,115,95,119,97,116,99,104,95,116,32,42,115,101,108,102,44,32,105,110,116,32,116,105,109,101,111,117,116,44,32,105,110,116,32,100,101,98,111,117,110,99,101,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,102,115,95,119,97,116,99,104,95,103,101,116,40,115,116,114,117,99,116,32,102,115,95,119,97,116,99,104,95,116,32,42,115,101,108,102,44,32,115,105,122,101,95,116,32,105,110,100,101,120,44,32,105,110,116,32,42,97,99,116,105,111,110,41,59,10,105,110,116,32,102,115,95,119,97,116,99,104,95,102,100,40,115,116,114,117,99,116,32,102,115,95,119,97,116,99,104,95,116,32,42,115,101,108,102,41,59,10,10,115,116,114,117,99,116,32,102,115,95,104,97,115,104,116,114,101,101,95,116,32,42,102,115,95,104,97,115,104,116,114,101,101,95,111,112,101,110,40,99,111,110,115,116,32,99,104,97,114,32,42,100,105,114,44,32,105,110,116,32,97,108,103,111,44,32,115,105,122,101,95,116,32,116,104,114,101,97,100,115,41,59,10,118,111,105,100,32,102,115,95,104,97,115,104,116,114,101,101,95,99,108,111,115,101,40,115,116,114,117,99,116,32,102,115,95,104,97,115,104,116,114,101,101,95,116,32,42,115,101,108,102,41,59,10,115,105,122,101,95,116,32,102,115,95,104,97,115,104,116,114,101,101,95,99,111,117,110,116,40,115,116,114,117,99,116,32,102,115,95,104,97,115,104,116,114,101,101,95,116,32,42,115,101,108,102,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,102,115,95,104,97,115,104,116,114,101,101,95,103,101,116,40,115,116,114,117,99,116,32,102,115,95,104,97,115,104,116,114,101,101,95,116,32,42,115,101,108,102,44,32,115,105,122,101,95,116,32,105,110,100,101,120,44,32,99,111,110,115,116,32,99,104,97,114,32,42,42,100,105,103,101,115,116,41,59,10,10,99,104,97,114,32,42,115,116,114,101,114,114,111,114,40,105,110,116,32,101,114,114,110,117,109,41,59,10,9,99,100,101,102,8,102,102,105,9,112,97,116,104,7,102,115,2,0,2,0,2,0,2,0,2,0,3,0,3,0,3,0,5,0,5,0,147,0,147,0,151,0,151,0,155,0,151,0,159,0,159,0,163,0,159,0,167,0,167,0,171,0,167,0,175,0,175,0,181,0,175,0,184,0,184,0,187,0,184,0,190,0,190,0,193,0,190,0,196,0,196,0,208,0,196,0,212,0,212,0,216,0,212,0,222,0,222,0,225,0,222,0,228,0,228,0,230,0,228,0,247,0,251,0,251,0,0,1,251,0,3,1,3,1,7,1,3,1,10,1,10,1,14,1,10,1,20,1,24,1,20,1,27,1,30,1,27,1,33,1,36,1,33,1,44,1,49,1,56,1,49,1,59,1,79,1,99,1,79,1,104,1,111,1,104,1,114,1,117,1,114,1,121,1,121,1,125,1,128,1,128,1,128,1,131,1,131,1,162,1,162,1,166,1,166,1,174,1,174,1,181,1,181,1,190,1,190,1,201,1,201,1,210,1,210,1,221,1,221,1,228,1,228,1,238,1,238,1,248,1,248,1,1,2,1,2,11,2,11,2,18,2,18,2,24,2,24,2,131,1,34,2,39,2,34,2,51,2,54,2,51,2,57,2,57,2,62,2,62,2,66,2,66,2,75,2,75,2,102,2,102,2,109,2,109,2,57,2,120,2,128,2,120,2,132,2,143,2,145,2,145,2,150,2,150,2,154,2,154,2,163,2,163,2,171,2,171,2,178,2,178,2,145,2,189,2,198,2,189,2,201,2,201,2,205,2,205,2,209,2,209,2,217,2,217,2,223,2,223,2,229,2,229,2,234,2,234,2,201,2,240,2,245,2,240,2,252,2,8,3,252,2,11,3,11,3,20,3,28,3,50,3,28,3,81,3,88,3,91,3,88,3,94,3,94,3,94,3,96,3,96,3,103,3,103,3,107,3,107,3,126,3,126,3,134,3,134,3,147,3,147,3,96,3,157,3,164,3,164,3,171,3,164,3,178,3,178,3,184,3,178,3,187,3,187,3,196,3,196,3,200,3,200,3,208,3,208,3,220,3,220,3,187,3,224,3,224,3,224,3,224,3,224,3,224,3,224,3,224,3,224,3,238,3,249,3,238,3,252,3,6,4,21,4,6,4,25,4,27,4,27,4,33,4,33,4,37,4,37,4,45,4,45,4,63,4,63,4,70,4,70,4,27,4,85,4,95,4,85,4,98,4,98,4,98,4,101,4,106,4,109,4,109,4,109,4,109,4,110,4,111,4,114,4,127,4,136,4,165,4,188,4,192,4,192,4,194,4,192,4,198,4,198,4,201,4,198,4,205,4,205,4,208,4,205,4,212,4,212,4,215,4,212,4,219,4,219,4,222,4,219,4,228,4,228,4,228,4,228,4,233,4,233,4,235,4,233,4,239,4,239,4,241,4,239,4,246,4,246,4,252,4,246,4,6,5,6,5,33,5,6,5,33,5,33,5,115,116,97,116,116,97,98,108,101,0,54,144,2,99,104,101,99,107,116,104,114,101,97,100,115,0,22,250,1,115,121,110,99,99,111,109,112,97,114,101,115,0,4,246,1,102,105,108,101,114,119,0,48,198,1,119,114,105,116,101,114,0,19,179,1,109,109,97,112,97,100,118,105,99,101,0,4,175,1,109,109,97,112,95,97,100,118,105,99,101,0,1,174,1,109,109,97,112,102,105,108,101,0,13,161,1,101,110,117,109,101,114,97,116,111,114,0,18,143,1,101,110,117,109,102,105,108,101,115,0,13,130,1,103,108,111,98,109,97,116,99,104,101,114,0,19,111,103,108,111,98,99,111,109,112,105,108,101,0,1,110,119,97,108,107,101,114,0,19,91,119,97,108,107,116,121,112,101,115,0,9,82,104,97,115,104,97,108,103,111,115,0,4,78,119,97,116,99,104,101,118,101,110,116,115,0,4,74,119,97,116,99,104,101,114,0,13,61,97,115,121,110,99,101,110,103,105,110,101,0,7,54,97,115,121,110,99,114,101,115,117,108,116,115,0,0,54,97,115,121,110,99,103,117,97,114,100,0,0,54,97,115,121,110,99,119,97,105,116,105,110,103,0,1,53,97,115,121,110,99,109,97,110,97,103,101,100,0,4,49,97,115,121,110,99,114,101,97,100,121,0,1,48,97,115,121,110,99,115,117,115,112,101,110,100,101,100,0,1,47,97,115,121,110,99,115,105,103,110,97,108,0,1,46,97,115,121,110,99,111,112,101,110,0,1,45,97,115,121,110,99,114,101,115,117,109,101,0,1,44,97,115,121,110,99,100,105,115,112,97,116,99,104,0,1,43,97,115,121,110,99,97,119,97,105,116,0,1,42,0,0,
\ No newline at end of file
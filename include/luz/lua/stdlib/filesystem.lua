@@ -18,9 +18,14 @@ const char *path_basename(char *dest, const char *path);
 const char *path_stem(char *dest, const char *path);
 const char *path_ext(char *dest, const char *path);
 const char *path_parentdir(char *dest, const char *path);
+size_t path_parentdir_s(char *dest, size_t size, const char *path, bool isFullPathRequired);
 bool path_isfile(const char *path);
 bool path_isdir(const char *path);
 const char *path_complete(char *dest, const char *path);
+size_t path_complete_s(char *dest, size_t size, const char *path);
+const char *path_normalize(char *dest, const char *path);
+void path_cache_enable(size_t capacity);
+void path_cache_clear();
 bool path_stat(path_stat_t *dest, const char *path);
 const char *path_append_slash(char *dest, const char *path);
 const char *path_remove_slash(char *dest, const char *path);
@@ -38,17 +43,107 @@ long int ftell(struct FILE *fp);
 int fflush(struct FILE *fp);
 
 bool fs_copyfile(const char *src, const char *dest, bool isOverwrite);
+bool fs_copyfile_ex(const char *src, const char *dest, bool isOverwrite, bool isModePreserved, bool isMtimePreserved);
 bool fs_rmfile(const char *filename);
 bool fs_mkdir(const char *dir);
 bool fs_copydir(const char *src, const char *dest);
 bool fs_rmdir(const char *dir);
+bool fs_copydir_parallel(const char *src, const char *dest, size_t threads);
+bool fs_rmdir_parallel(const char *dir, size_t threads);
+size_t fs_writefile(const char *filename, const char *data, size_t size);
 bool fs_rename(const char *src, const char *dest, bool isOverwrite);
 
+struct fs_sync_t *fs_sync(const char *src, const char *dest, int compare, bool isDeleted, size_t threads);
+void fs_sync_free(struct fs_sync_t *self);
+size_t fs_sync_count(struct fs_sync_t *self, int kind);
+const char *fs_sync_get(struct fs_sync_t *self, int kind, size_t index);
+unsigned long long fs_sync_bytes(struct fs_sync_t *self);
+
 struct fs_dirent_t *fs_opendir(const char *dir);
 void fs_closedir(struct fs_dirent_t *self);
 bool fs_seekdir(struct fs_dirent_t *self);
 const char *fs_readdir_name(struct fs_dirent_t *self);
 const char *fs_readdir_path(struct fs_dirent_t *self);
+
+typedef struct {
+    size_t name_offset;
+    unsigned long long inode;
+    unsigned char type;
+} fs_entry_t;
+
+size_t fs_readdir_batch(struct fs_dirent_t *self, fs_entry_t *out, size_t cap, char *pool, size_t poolcap);
+
+struct glob_matcher_t *glob_compile(const char *pattern);
+struct glob_matcher_t *glob_compile_set(const char **patterns, size_t n);
+void glob_free(struct glob_matcher_t *self);
+bool glob_match(const struct glob_matcher_t *self, const char *path);
+bool glob_match_partial(const struct glob_matcher_t *self, const char *path);
+size_t glob_match_set(const struct glob_matcher_t *self, const char *path, bool *matched);
+
+struct fs_walk_t *fs_walk_open(const char *dir, const char **include, size_t ninclude, const char **exclude, size_t nexclude, int maxdepth, unsigned char type);
+void fs_walk_close(struct fs_walk_t *self);
+const char *fs_walk_next(struct fs_walk_t *self, unsigned char *type);
+
+typedef struct {
+    char *ptr;
+    unsigned long long size;
+    unsigned long long handler, mapping;
+    bool is_writable;
+} fs_mmap_t;
+
+fs_mmap_t *fs_mmap_open(const char *path, bool isWritable, int advice);
+bool fs_mmap_advise(fs_mmap_t *self, int advice);
+bool fs_mmap_sync(fs_mmap_t *self);
+void fs_mmap_close(fs_mmap_t *self);
+
+struct fs_reader_t *fs_reader_open(struct FILE *fp, size_t bufsize);
+struct fs_reader_t *fs_reader_openfd(int fd, size_t bufsize);
+void fs_reader_close(struct fs_reader_t *self);
+const char *fs_reader_readline(struct fs_reader_t *self, size_t *len);
+size_t fs_reader_read(struct fs_reader_t *self, char *dest, size_t size);
+int fs_reader_getc(struct fs_reader_t *self);
+size_t fs_reader_fill(struct fs_reader_t *self);
+bool fs_reader_sync(struct fs_reader_t *self);
+
+struct fs_writer_t *fs_writer_open(const char *filename, bool isAppended, size_t bufsize);
+struct fs_writer_t *fs_writer_openfd(int fd, size_t bufsize);
+bool fs_writer_write(struct fs_writer_t *self, const char *data, size_t size);
+bool fs_writer_writev(struct fs_writer_t *self, const char **data, const size_t *sizes, size_t n);
+bool fs_writer_flush(struct fs_writer_t *self);
+bool fs_writer_close(struct fs_writer_t *self);
+
+typedef struct {
+    unsigned int id;
+    int error;
+    const char *data;
+    unsigned long long size;
+    path_stat_t stat;
+} fs_async_result_t;
+
+struct fs_async_t *fs_async_open(size_t entries, size_t threads);
+void fs_async_close(struct fs_async_t *self);
+bool fs_async_is_uring(struct fs_async_t *self);
+unsigned int fs_async_readfile(struct fs_async_t *self, const char *path);
+unsigned int fs_async_writefile(struct fs_async_t *self, const char *path, const char *data, size_t size);
+unsigned int fs_async_stat(struct fs_async_t *self, const char *path);
+unsigned int fs_async_copyfile(struct fs_async_t *self, const char *src, const char *dest, bool isOverwrite);
+size_t fs_async_wait(struct fs_async_t *self, fs_async_result_t *results, size_t capacity, int timeout);
+void fs_async_release(struct fs_async_t *self, unsigned int id);
+size_t fs_async_pending(struct fs_async_t *self);
+int fs_async_fd(struct fs_async_t *self);
+
+struct fs_watch_t *fs_watch_open(const char **dirs, size_t ndirs, bool isRecursive);
+void fs_watch_close(struct fs_watch_t *self);
+size_t fs_watch_next(struct fs_watch_t *self, int timeout, int debounce);
+const char *fs_watch_get(struct fs_watch_t *self, size_t index, int *action);
+int fs_watch_fd(struct fs_watch_t *self);
+
+struct fs_hashtree_t *fs_hashtree_open(const char *dir, int algo, size_t threads);
+void fs_hashtree_close(struct fs_hashtree_t *self);
+size_t fs_hashtree_count(struct fs_hashtree_t *self);
+const char *fs_hashtree_get(struct fs_hashtree_t *self, size_t index, const char **digest);
+
+char *strerror(int errnum);
 ]]
 
 -- Get the base name of path
@@ -79,8 +174,10 @@ end
 -- @param {string} path: e.g. "/path/to/sample.txt" => "/path/to"
 function fs.path.parentdir(path)
     debug.checkarg(1, path, "string")
+    -- the parent directory is taken from the full path, which may be longer than path (completed only once)
+    path = fs.path.complete(path)
     local dest = ffi.new("char[?]", path:len() + 1)
-    return ffi.string(ffi.C.path_parentdir(dest, path))
+    return ffi.string(dest, ffi.C.path_parentdir_s(dest, path:len() + 1, path, false))
 end
 
 -- Identifies if the path is file
@@ -98,16 +195,42 @@ end
 -- Get the full path
 function fs.path.complete(path)
     debug.checkarg(1, path, "string")
-    local dest = ffi.new("char[?]", 1024)
-    return ffi.string(ffi.C.path_complete(dest, path))
+    local size = path:len() + 256
+    local dest = ffi.new("char[?]", size)
+    local len = ffi.C.path_complete_s(dest, size, path)
+    if len >= size then
+        -- grow the buffer to the real length
+        size = len + 1
+        dest = ffi.new("char[?]", size)
+        len = ffi.C.path_complete_s(dest, size, path)
+    end
+    return ffi.string(dest, len)
 end
 
--- Get the file / directory state
--- @returns {table<path_stat_t>|nil}
-function fs.path.stat(path)
+-- Normalize the path lexically (without accessing the file system)
+-- @param {string} path: e.g. "/path//to/./sub/../sample.txt" => "/path/to/sample.txt"
+function fs.path.normalize(path)
     debug.checkarg(1, path, "string")
-    local stat = ffi.new("path_stat_t")
-    if not ffi.C.path_stat(stat, path) then return nil end
+    local dest = ffi.new("char[?]", path:len() + 2)
+    return ffi.string(ffi.C.path_normalize(dest, path))
+end
+
+-- Enable / Disable the memoization of fs.path.complete
+-- @param {number} capacity: max count of cached paths (0: disable and clear the cache)
+--                           the cache is keyed by (current working directory, path),
+--                           so call `fs.path.cache(0)` or `fs.path.clearcache()` after renaming files
+function fs.path.cache(capacity)
+    debug.checkarg(1, capacity, "number")
+    ffi.C.path_cache_enable(capacity)
+end
+
+-- Clear the cache of fs.path.complete
+function fs.path.clearcache()
+    ffi.C.path_cache_clear()
+end
+
+-- @private path_stat_t => table
+local function stattable(stat)
     return {
         device_id = stat.device_id,
         inode = stat.inode,
@@ -123,6 +246,15 @@ function fs.path.stat(path)
     }
 end
 
+-- Get the file / directory state
+-- @returns {table<path_stat_t>|nil}
+function fs.path.stat(path)
+    debug.checkarg(1, path, "string")
+    local stat = ffi.new("path_stat_t")
+    if not ffi.C.path_stat(stat, path) then return nil end
+    return stattable(stat)
+end
+
 -- Append slash symbol into the end of path
 function fs.path.append_slash(path)
     debug.checkarg(1, path, "string")
@@ -138,9 +270,13 @@ function fs.path.remove_slash(path)
 end
 
 -- Copy file
-function fs.copyfile(src, dest, isOverwrite)
+-- @param {boolean} isOverwrite (default: true)
+-- @param {table} opts (default: {}): {mode: boolean, mtime: boolean}
+--                 mode: preserve the permission bits, mtime: preserve the last accessed / modified time
+function fs.copyfile(src, dest, isOverwrite, opts)
     debug.checkarg(2, src, "string", dest, "string")
-    return ffi.C.fs_copyfile(src, dest, isOverwrite == nil and true or isOverwrite)
+    opts = opts or {}
+    return ffi.C.fs_copyfile_ex(src, dest, isOverwrite == nil and true or isOverwrite, opts.mode == true, opts.mtime == true)
 end
 
 -- Remove file
@@ -155,15 +291,78 @@ function fs.mkdir(dir)
     return ffi.C.fs_mkdir(dir)
 end
 
+-- @private check the count of worker threads, which is passed as size_t
+local function checkthreads(threads, level)
+    if type(threads) ~= "number" or threads < 0 or threads % 1 ~= 0 or threads > 1024 then
+        error("threads must be an integer in 0..1024", level + 1)
+    end
+    return threads
+end
+
 -- Copy directory
-function fs.copydir(src, dest)
+-- @param {table} opts (default: {}): {threads: number}
+--                 threads: copy in parallel by the count of threads in 0..1024 (0: count of hardware threads, 1: no parallel)
+function fs.copydir(src, dest, opts)
     debug.checkarg(2, src, "string", dest, "string")
+    local threads = checkthreads(opts and opts.threads or 1, 2)
+    if threads ~= 1 then
+        return ffi.C.fs_copydir_parallel(src, dest, threads)
+    end
     return ffi.C.fs_copydir(src, dest)
 end
 
+-- @private fs.sync compare option => FS_SYNC_*
+local synccompares = {["mtime+size"] = 0, hash = 1}
+
+-- Make dest the same as src by copying only new or changed files in parallel
+-- * changed files are copied by the fastest way the file system supports (reflink, copy_file_range, ...) keeping the permission and mtime
+-- * each changed file is written to the temporary file in dest and renamed over the old one, so it is replaced atomically even if read-only
+-- @param {string} src
+-- @param {string} dest: created if it does not exist
+-- @param {table} opts: {
+--     compare: {string} "mtime+size"(default): same size and last modified time (seconds) => unchanged
+--                     | "hash": same contents => unchanged (reads both files, but detects changes within the same second),
+--     delete: {boolean} remove files / directories in dest which do not exist in src (default: false),
+--     threads: {number} count of worker threads in 0..1024 (default: 0 => count of hardware threads),
+-- }
+-- @returns {table|nil} summary: {
+--     copied: {string[]} relative paths of copied files,
+--     deleted: {string[]} relative paths of removed files / directories,
+--     failed: {string[]} relative paths which could not be copied / removed,
+--     skipped: {number} count of unchanged files,
+--     bytes: {number} total size of copied files,
+-- }; nil if src is not a directory or dest cannot be created
+function fs.sync(src, dest, opts)
+    debug.checkarg(3, src, "string", dest, "string", opts, "nil|table")
+    opts = opts or {}
+    local compare = synccompares[opts.compare or "mtime+size"]
+    if compare == nil then error("invalid compare option: " .. tostring(opts.compare)) end
+
+    local handler = ffi.C.fs_sync(src, dest, compare, opts.delete == true, checkthreads(opts.threads or 0, 2))
+    if handler == nil then return nil end
+    local summary = {
+        skipped = tonumber(ffi.C.fs_sync_count(handler, 3)),
+        bytes = tonumber(ffi.C.fs_sync_bytes(handler)),
+    }
+    for kind, key in pairs{[0] = "copied", [1] = "deleted", [2] = "failed"} do
+        summary[key] = {}
+        for i = 0, tonumber(ffi.C.fs_sync_count(handler, kind)) - 1 do
+            summary[key][i + 1] = ffi.string(ffi.C.fs_sync_get(handler, kind, i))
+        end
+    end
+    ffi.C.fs_sync_free(handler)
+    return summary
+end
+
 -- Remove directory
-function fs.rmdir(dir)
+-- @param {table} opts (default: {}): {threads: number}
+--                 threads: remove in parallel by the count of threads in 0..1024 (0: count of hardware threads, 1: no parallel)
+function fs.rmdir(dir, opts)
     debug.checkarg(1, dir, "string")
+    local threads = checkthreads(opts and opts.threads or 1, 2)
+    if threads ~= 1 then
+        return ffi.C.fs_rmdir_parallel(dir, threads)
+    end
     return ffi.C.fs_rmdir(dir)
 end
 
@@ -195,22 +394,21 @@ local filerw = class {
         -- pipe-mode
         if mode:match"^p" then
             self.close = function (self)
+                self:closereader()
                 if self.handler ~= nil then
                     ffi.C.fs_pclose(self.handler)
                     self.handler = nil
                 end
             end
-            self.handler = ffi.C.fs_popen(filename, mode.sub(2))
-        end
-        -- create parent directory recursively
-        if mode:match"^w" then
-            fs.mkdir(fs.path.parentdir(filename))
+            self.handler = ffi.C.fs_popen(filename, mode:sub(2))
+            return
         end
         -- force to open in binary-mode
         if mode:find"b" == nil then
             mode = mode .. "b"
         end
         self.close = function (self)
+            self:closereader()
             if self.handler then
                 ffi.C.fs_fclose(self.handler)
                 self.handler = nil
@@ -223,6 +421,30 @@ local filerw = class {
         if self.close then self:close() end
     end,
     
+    -- @private Free the buffered reader
+    closereader = function (self)
+        if self.reader ~= nil then
+            ffi.C.fs_reader_close(self.reader)
+            self.reader = nil
+        end
+    end,
+
+    -- @private Move the file pointer back to the first unread byte of the buffered reader
+    syncreader = function (self)
+        if self.reader ~= nil then
+            ffi.C.fs_reader_sync(self.reader)
+        end
+    end,
+
+    -- @private Get the buffered reader (created at the first call)
+    getreader = function (self)
+        if self.reader == nil then
+            self.reader = ffi.C.fs_reader_open(self.handler, 0)
+            self.linesize = ffi.new("size_t[1]")
+        end
+        return self.reader
+    end,
+
     -- Get file size
     -- @returns {number}
     size = function (self)
@@ -234,27 +456,30 @@ local filerw = class {
         return size
     end,
     
-    -- Read one line
-    -- @returns {string}
+    -- Read one line (separated by "\n" or "\r\n")
+    -- * the file is read ahead by the large buffer, and lines are searched by memchr
+    -- @returns {string} "" if no line any more (same as an empty line: use file:lines() to stop at the end of the file)
     readline = function (self)
-        local bytes = {}
-        local c = self:readchar()
-        while c ~= fs.eof do
-            if c == 13 --[[ \r ]] then
-                self:seek(1, fs.seek_from.cur) -- skip next lf
-                break
-            elseif c == 10 --[[ \n ]] then
-                break
-            end
-            bytes[#bytes + 1] = c
-            c = self:readchar()
+        local line = ffi.C.fs_reader_readline(self:getreader(), self.linesize)
+        if line == nil then return "" end
+        return ffi.string(line, self.linesize[0])
+    end,
+
+    -- Iterate lines (empty lines are included, and stops at the end of the file)
+    -- e.g. `for line in file:lines() do ... end`
+    -- @returns {function()->string|nil}
+    lines = function (self)
+        return function()
+            local line = ffi.C.fs_reader_readline(self:getreader(), self.linesize)
+            if line == nil then return nil end
+            return ffi.string(line, self.linesize[0])
         end
-        return string.char(unpack(bytes))
     end,
     
     -- Read 1 byte
     -- @returns {number}
     readchar = function (self)
+        if self.reader ~= nil then return ffi.C.fs_reader_getc(self.reader) end
         return ffi.C.fgetc(self.handler)
     end,
     
@@ -264,7 +489,7 @@ local filerw = class {
     read = function (self, size)
         debug.checkarg(1, size, "number")
         local data = ffi.new("char[?]", size + 1)
-        local read = ffi.C.fread(data, 1, size, self.handler)
+        local read = self.reader ~= nil and ffi.C.fs_reader_read(self.reader, data, size) or ffi.C.fread(data, 1, size, self.handler)
         return read > 0 and ffi.string(data, read) or ""
     end,
     
@@ -274,6 +499,7 @@ local filerw = class {
     -- @returns {number} written size
     write = function (self, data, size)
         debug.checkarg(1, data, "string")
+        self:syncreader()
         return ffi.C.fwrite(ffi.cast("const char*", data), 1, size or data:len(), self.handler)
     end,
     
@@ -282,6 +508,7 @@ local filerw = class {
     -- @returns {boolean}
     writechar = function (self, c)
         debug.checkarg(1, c, "number")
+        self:syncreader()
         return fs.eof ~= ffi.C.fputc(c, self.handler)
     end,
     
@@ -291,12 +518,14 @@ local filerw = class {
     -- @returns {boolean}
     seek = function (self, offset, from)
         debug.checkarg(1, offset, "number")
+        self:syncreader()
         return 0 == ffi.C.fseek(self.handler, offset, from or fs.seek_from.head)
     end,
     
     -- Get current file pointer position
     -- @returns {number}
     pos = function (self)
+        self:syncreader()
         return tonumber(ffi.C.ftell(self.handler))
     end,
     
@@ -310,8 +539,9 @@ local filerw = class {
 -- Open file (sopports pipe-mode)
 -- @param {string} filename: corrspondence of recursive mkdir if write-mode
 -- @param {string} mode: "r" => read-mode (default), "w" => write-mode, "a" => append-mode, "w+" => read+write-mode
---                       If you specify "p" at the beginning of mode, it will open in pipe-mode: "pw", "pr+", etc
---                       If the mode is write-mode, parent directories will be created automatically
+--                       If you specify "p" at the beginning of mode, it will open in pipe-mode: "pw", "pr", etc
+--                       (use os.spawn for bidirectional / non-blocking pipes)
+--                       If the mode is write / append-mode, parent directories will be created automatically
 -- @returns {filerw|nil}
 function fs.open(filename, mode)
     local file = filerw.new(filename, mode)
@@ -321,30 +551,163 @@ function fs.open(filename, mode)
 end
 
 -- Read all data in the file
-function fs.readfile(filename, size)
-    debug.checkarg(1, filename, "string")
-
-    local file = fs.open(filename, "rb")
-    if file == nil then return "" end
-    
-    size = size or file:size()
-    local data = file:read(size)
-    file:close()
-    return data
-end
+-- * fs.readfile(filename, size) is implemented natively (lua/native/filesystem.cpp):
+--   the size is taken by fstat and the data is read into a Lua string at once ("" if the file cannot be read)
 
 -- Write data to the file
+-- * parent directories are created automatically
+-- @param {string} filename
+-- @param {string} data
+-- @param {number} size: writing size (default: data:len())
+-- @returns {number} written size
 function fs.writefile(filename, data, size)
     debug.checkarg(2, filename, "string", data, "string")
+    return tonumber(ffi.C.fs_writefile(filename, data, size or data:len()))
+end
+
+--- Buffered writer ---
+local writer = class {
+    constructor = function (self, handler)
+        self.handler = handler
+        self.capacity = 0 -- count of elements of self.data / self.sizes
+        self.anchors = {} -- keep converted strings alive while writing
+    end,
 
-    local file = fs.open(filename, "wb")
-    if file == nil then return "" end
+    destructor = function (self)
+        self:close()
+    end,
+
+    -- Flush and close writer
+    -- @returns {boolean} false if writing has failed
+    close = function (self)
+        if self.handler == nil then return false end
+        local result = ffi.C.fs_writer_close(self.handler)
+        self.handler = nil
+        return result
+    end,
 
-    local written = file:write(data, size)
-    file:close()
-    return written
+    -- Write data in order without concatenating them
+    -- e.g. `writer:write("key", "=", value, "\n")`
+    -- @param {string|number} ...
+    -- @returns {boolean} false if writing has failed or the writer is closed
+    write = function (self, ...)
+        if self.handler == nil then return false end
+        local n = select("#", ...)
+        if n == 1 then
+            local data = ...
+            if type(data) ~= "string" then data = tostring(data) end
+            return ffi.C.fs_writer_write(self.handler, data, #data)
+        end
+        if n > self.capacity then
+            self.capacity = n * 2
+            self.data, self.sizes = ffi.new("const char*[?]", self.capacity), ffi.new("size_t[?]", self.capacity)
+        end
+        for i = 1, n do
+            local data = select(i, ...)
+            if type(data) ~= "string" then
+                data = tostring(data)
+                self.anchors[i] = data
+            end
+            self.data[i - 1], self.sizes[i - 1] = data, #data
+        end
+        return ffi.C.fs_writer_writev(self.handler, self.data, self.sizes, n)
+    end,
+
+    -- Write the buffered data into the file
+    -- @returns {boolean} false if writing has failed or the writer is closed
+    flush = function (self)
+        if self.handler == nil then return false end
+        return ffi.C.fs_writer_flush(self.handler)
+    end,
+}
+
+-- Open buffered writer
+-- * small data is gathered into the buffer, and large data is written with the buffered data by one writev
+-- @param {string|number} target: file name (parent directories are created automatically) or file descriptor (e.g. 1: stdout)
+-- @param {table} opts: {
+--     bufsize: {number} buffer size (default: 1 MiB),
+--     append: {boolean} append to the file instead of truncating it (default: false),
+-- }
+-- @returns {writer|nil}
+function fs.writer(target, opts)
+    debug.checkarg(2, target, "string|number", opts, "nil|table")
+    opts = opts or {}
+    local handler = type(target) == "number"
+        and ffi.C.fs_writer_openfd(target, opts.bufsize or 0)
+        or ffi.C.fs_writer_open(target, opts.append == true, opts.bufsize or 0)
+    if handler == nil then return nil end
+    return writer.new(handler)
 end
 
+--- Memory-mapped file ---
+-- @private fs.mmap advice => FS_MMAP_* flags
+local mmapadvice = {normal = 0, sequential = 1, random = 2, willneed = 4, hugepage = 8}
+
+-- @private Convert the list of access pattern hints into FS_MMAP_* flags
+local function mmap_advice(advice)
+    local flags = 0
+    for _, name in ipairs(advice or {}) do
+        local flag = mmapadvice[name]
+        if flag == nil then error("invalid mmap advice: " .. tostring(name)) end
+        flags = bit.bor(flags, flag)
+    end
+    return flags
+end
+
+local mmapfile = class {
+    constructor = function (self, handler)
+        self.handler = handler
+        self.ptr = handler.is_writable and handler.ptr or ffi.cast("const char*", handler.ptr)
+        self.size = tonumber(handler.size)
+    end,
+
+    destructor = function (self)
+        self:close()
+    end,
+
+    -- Unmap file
+    -- * ptr must not be accessed after closing
+    close = function (self)
+        if self.handler ~= nil then
+            ffi.C.fs_mmap_close(self.handler)
+            self.handler, self.ptr, self.size = nil, nil, 0
+        end
+    end,
+
+    -- Give access pattern hints
+    -- @param {string[]} advice: see fs.mmap
+    -- @returns {boolean} false if closed
+    advise = function (self, advice)
+        if self.handler == nil then return false end
+        return ffi.C.fs_mmap_advise(self.handler, mmap_advice(advice))
+    end,
+
+    -- Flush the changes into the file (read-write mode)
+    -- @returns {boolean} false if closed
+    sync = function (self)
+        if self.handler == nil then return false end
+        return ffi.C.fs_mmap_sync(self.handler)
+    end,
+}
+
+-- Map the whole file into memory
+-- * the data can be scanned without copies: e.g. `for i = 0, m.size - 1 do local c = m.ptr[i] ... end`
+-- @param {string} path
+-- @param {table} opts: {
+--     mode: {string} "r"(default) => read-only (ptr: const char*) | "rw" => read-write (ptr: char*, writes go to the file),
+--     advice: {string[]} access pattern hints: "sequential" | "random" | "willneed" | "hugepage" (ignored on Windows),
+-- }
+-- @returns {mmapfile|nil} {ptr: cdata<const char*>, size: number}; ptr is NULL if the file is empty
+function fs.mmap(path, opts)
+    debug.checkarg(2, path, "string", opts, "nil|table")
+    opts = opts or {}
+    local mode = opts.mode or "r"
+    if mode ~= "r" and mode ~= "rw" then error("invalid mmap mode: " .. tostring(mode)) end
+
+    local handler = ffi.C.fs_mmap_open(path, mode == "rw", mmap_advice(opts.advice))
+    if handler == nil then return nil end
+    return mmapfile.new(handler)
+end
 
 --- File enumerator ---
 local enumerator = class {
@@ -412,23 +775,75 @@ function fs.scandir(dir, callback, ...)
     return true
 end
 
+-- File types of fs.readdir
+fs.filetype = {
+    unknown = 0,
+    fifo = 1,
+    chardev = 2,
+    dir = 4,
+    blockdev = 6,
+    file = 8,
+    link = 10,
+    socket = 12,
+}
+
+-- Iterate directory entries in batches
+-- * "." and ".." are skipped
+-- * type is fs.filetype.unknown if the file system does not report it
+-- @param {string} dir
+-- @param {number} batchsize: max count of entries read by one system call (default: 256)
+-- @returns {function()->(string, number, number)|nil} iterator of (name, type, inode); nil if dir cannot be opened
+function fs.readdir(dir, batchsize)
+    debug.checkarg(2, dir, "string", batchsize, "nil|number")
+    local dirent = fs.opendir(dir)
+    if dirent == nil then return nil end
+
+    local cap = batchsize or 256
+    local poolsize = cap * 64 < 1024 and 1024 or cap * 64 -- at least larger than max file name
+    local entries, pool = ffi.new("fs_entry_t[?]", cap), ffi.new("char[?]", poolsize)
+    local count, index = 0, 0
+    return function()
+        if index >= count then
+            if dirent.handler == nil then return nil end
+            count, index = tonumber(ffi.C.fs_readdir_batch(dirent.handler, entries, cap, pool, poolsize)), 0
+            if count == 0 then
+                dirent:close()
+                return nil
+            end
+        end
+        local entry = entries[index]
+        index = index + 1
+        return ffi.string(pool + entry.name_offset), entry.type, tonumber(entry.inode)
+    end
+end
+
 -- @private Enumerate files / directories base function
-local function enumfiles(name, path, dest, nest, mode)
-    if name == ".." or name == "." then return true end
-    local info = {
-        path = path,
-        isfile = fs.path.isfile(path),
-        isdir = fs.path.isdir(path),
-    }
-    if info.isfile then
-        if mode ~= "dir" then
-            dest[#dest + 1] = info
+local function enumfiles(dir, dest, nest, mode)
+    local entries = fs.readdir(dir)
+    if entries == nil then return false end
+
+    dir = fs.path.append_slash(dir)
+    for name, type in entries do
+        local path = dir .. name
+        local isdir, isfile = type == fs.filetype.dir, type == fs.filetype.file
+        if type == fs.filetype.link or type == fs.filetype.unknown then -- resolve the type of link target
+            isdir, isfile = fs.path.isdir(path), fs.path.isfile(path)
         end
-    elseif info.isdir then
-        if mode ~= "file" then
-            dest[#dest + 1] = info
+        local info = {
+            path = path,
+            isfile = isfile,
+            isdir = isdir,
+        }
+        if info.isfile then
+            if mode ~= "dir" then
+                dest[#dest + 1] = info
+            end
+        elseif info.isdir then
+            if mode ~= "file" then
+                dest[#dest + 1] = info
+            end
+            if nest ~= 0 then enumfiles(path, dest, nest - 1, mode) end -- skip the subdirectory which cannot be read
         end
-        return nest ~= 0 and fs.scandir(info.path, enumfiles, dest, nest - 1, mode) or true
     end
     return true
 end
@@ -437,8 +852,462 @@ end
 -- @param {string} dir: target directory
 -- @param {number} nest: recursive enumeration nest (default: -1 => infite), 0 => no enumeration
 -- @param {string} mode: "all"(default) | "file" | "dir"
--- @returns {table[]} {name: string, path: string, isfile: boolean, isdir: boolean}[]
+-- @returns {table[]} {name: string, path: string, isfile: boolean, isdir: boolean}[]; empty if the directory cannot be read (unreadable subdirectories are skipped)
 function fs.enumfiles(dir, nest, mode)
     local files = {}
-    return fs.scandir(dir, enumfiles, files, nest == nil and -1 or nest, mode or "all") and files or {}
+    return enumfiles(dir, files, nest == nil and -1 or nest, mode or "all") and files or {}
+end
+
+--- Glob matcher ---
+fs.glob = {}
+
+local globmatcher = class {
+    -- @param {number} ninclude: count of include patterns followed by exclude patterns (nil: all patterns are include)
+    constructor = function (self, handler, count, ninclude)
+        self.handler = handler
+        self.count = count
+        self.ninclude = ninclude
+        self.matched = ffi.new("bool[?]", count + 1)
+    end,
+
+    destructor = function (self)
+        ffi.C.glob_free(self.handler)
+    end,
+
+    -- Identifies if the path matches (filter: matches any include pattern and no exclude pattern)
+    -- * the path is scanned only once however many patterns are compiled
+    -- * debug.checkarg is not used, since it steps the GC on each call and this is called for each path
+    -- @returns {boolean}
+    match = function (self, path)
+        if type(path) ~= "string" then error("bad argument #1 (string expected, got " .. type(path) .. ")", 2) end
+        if self.ninclude == nil then return ffi.C.glob_match(self.handler, path) end
+
+        if ffi.C.glob_match_set(self.handler, path, self.matched) == 0 then return self.ninclude == 0 end
+        local isIncluded = self.ninclude == 0
+        for i = 0, self.count - 1 do
+            if self.matched[i] then
+                if i >= self.ninclude then return false end
+                isIncluded = true
+            end
+        end
+        return isIncluded
+    end,
+
+    -- Identifies if the path can be a prefix of matching paths (e.g. "src/" for "src/**/*.lua")
+    -- * use it to skip directories which never contain matching paths
+    -- @returns {boolean}
+    partial = function (self, path)
+        if type(path) ~= "string" then error("bad argument #1 (string expected, got " .. type(path) .. ")", 2) end
+        return ffi.C.glob_match_partial(self.handler, path)
+    end,
+
+    -- Get indices of the matched patterns (in a single pass)
+    -- @returns {number[]} indices of the patterns (1-based)
+    matches = function (self, path)
+        if type(path) ~= "string" then error("bad argument #1 (string expected, got " .. type(path) .. ")", 2) end
+        local indices = {}
+        if ffi.C.glob_match_set(self.handler, path, self.matched) > 0 then
+            for i = 0, self.count - 1 do
+                if self.matched[i] then indices[#indices + 1] = i + 1 end
+            end
+        end
+        return indices
+    end,
+}
+
+-- @private compile the patterns into one matcher
+local function globcompile(patterns, ninclude)
+    local cpatterns = ffi.new("const char*[?]", #patterns + 1)
+    for i, pattern in ipairs(patterns) do cpatterns[i - 1] = pattern end
+    local handler = ffi.C.glob_compile_set(cpatterns, #patterns)
+    if handler == nil then return nil end
+    return globmatcher.new(handler, #patterns, ninclude)
+end
+
+-- Compile the glob pattern (or the set of patterns) into the matching program in C
+-- * syntax: "*", "?", "**" (zero or more directories), "[a-z]", "[!a-z]", "{a,b}", "\\*" (escape: except Windows)
+-- * the pattern matches the whole path, e.g. `fs.glob.compile"src/**/*.{c,cpp}":match"src/sub/main.cpp"` => true
+-- @param {string|string[]} pattern: set of patterns matches the path if any of them matches
+-- @returns {globmatcher|nil} nil if the pattern is invalid
+function fs.glob.compile(pattern)
+    debug.checkarg(1, pattern, "string|table")
+    if type(pattern) == "table" then return globcompile(pattern) end
+
+    local handler = ffi.C.glob_compile(pattern)
+    if handler == nil then return nil end
+    return globmatcher.new(handler, 1)
+end
+
+-- Compile include / exclude patterns into one filter matched in a single pass
+-- e.g. `fs.glob.filter({"**/*.lua"}, {"extlib/**"}):match"src/main.lua"` => true
+-- @param {string[]} include: patterns of paths to be accepted (empty: all paths)
+-- @param {string[]} exclude: patterns of paths to be rejected
+-- @returns {globmatcher|nil} nil if any pattern is invalid
+function fs.glob.filter(include, exclude)
+    debug.checkarg(2, include, "table", exclude, "nil|table")
+    local patterns = {}
+    for _, pattern in ipairs(include) do patterns[#patterns + 1] = pattern end
+    for _, pattern in ipairs(exclude or {}) do patterns[#patterns + 1] = pattern end
+    return globcompile(patterns, #include)
+end
+
+--- Recursive file walker ---
+local walker = class {
+    constructor = function (self, dir, include, exclude, maxdepth, type)
+        self.handler = ffi.C.fs_walk_open(
+            dir,
+            ffi.new("const char*[?]", #include, include), #include,
+            ffi.new("const char*[?]", #exclude, exclude), #exclude,
+            maxdepth, type
+        )
+        self.type = ffi.new("unsigned char[1]")
+    end,
+
+    destructor = function (self)
+        self:close()
+    end,
+
+    -- Close walker
+    close = function (self)
+        if self.handler ~= nil then
+            ffi.C.fs_walk_close(self.handler)
+            self.handler = nil
+        end
+    end,
+
+    -- Get next path
+    -- @returns {string|nil, number}
+    next = function (self)
+        if self.handler == nil then return nil end
+        local path = ffi.C.fs_walk_next(self.handler, self.type)
+        if path == nil then
+            self:close()
+            return nil
+        end
+        return ffi.string(path), self.type[0]
+    end,
+}
+
+-- @private fs.walk type option => fs.filetype
+local walktypes = {all = 0, file = fs.filetype.file, dir = fs.filetype.dir}
+
+-- Walk files / directories in the directory tree recursively
+-- * globs are matched in C to the relative path from dir, e.g. "**/*_test.lua" matches "test.lua" in dir and the sub directories
+-- * glob syntax: "*", "?", "**" (zero or more directories), "[a-z]", "[!a-z]", "{a,b}"
+-- * excluded directories are not descended into, and symbolic links to directories are not followed
+-- @param {string} dir
+-- @param {table} opts: {
+--     include: {string[]} globs of paths to be yielded (default: all paths),
+--     exclude: {string[]} globs of paths to be skipped,
+--     maxdepth: {number} max depth of recursion (default: -1 => infinite), 0 => only entries in dir,
+--     type: {string} "all"(default) | "file" | "dir",
+-- }
+-- @returns {function()->(string, number)|nil} iterator of (path, fs.filetype); nil if dir cannot be opened or any glob is invalid
+function fs.walk(dir, opts)
+    debug.checkarg(2, dir, "string", opts, "nil|table")
+    opts = opts or {}
+    local type = walktypes[opts.type or "all"]
+    if type == nil then error("invalid type option: " .. tostring(opts.type)) end
+
+    local self = walker.new(dir, opts.include or {}, opts.exclude or {}, opts.maxdepth or -1, type)
+    if self.handler == nil then return nil end
+    return function()
+        return self:next()
+    end
+end
+
+-- @private hash algorithm name => HASH_*
+local hashalgos = {crc32 = 1, xxh3 = 2, sha256 = 3}
+
+-- Get hex digests of all files in the directory tree in parallel
+-- * symbolic links to directories are not followed, and unreadable files are skipped
+-- @param {string} dir
+-- @param {table} opts: {
+--     algo: {string} "xxh3"(default, fastest) | "crc32" | "sha256",
+--     threads: {number} count of worker threads in 0..1024 (default: 0 => count of hardware threads),
+-- }
+-- @returns {table<string, string>|nil} manifest: relative path from dir => lowercase hex digest; nil if dir cannot be opened
+function fs.hash_tree(dir, opts)
+    debug.checkarg(2, dir, "string", opts, "nil|table")
+    opts = opts or {}
+    local algo = hashalgos[opts.algo or "xxh3"]
+    if algo == nil then error("unknown hash algorithm: " .. tostring(opts.algo)) end
+
+    local handler = ffi.C.fs_hashtree_open(dir, algo, checkthreads(opts.threads or 0, 2))
+    if handler == nil then return nil end
+    local manifest, digest = {}, ffi.new("const char*[1]")
+    for i = 0, tonumber(ffi.C.fs_hashtree_count(handler)) - 1 do
+        local path = ffi.C.fs_hashtree_get(handler, i, digest)
+        manifest[ffi.string(path)] = ffi.string(digest[0])
+    end
+    ffi.C.fs_hashtree_close(handler)
+    return manifest
+end
+
+--- File system watcher ---
+-- @private FS_WATCH_* => event name
+local watchevents = {[1] = "created", [2] = "modified", [4] = "removed", [8] = "overflow"}
+
+local watcher = class {
+    constructor = function (self, handler, debounce)
+        self.handler = handler
+        self.debounce = debounce
+        self.action = ffi.new("int[1]")
+        self.fd = ffi.C.fs_watch_fd(handler) -- readable when changes arrive (-1 on Windows)
+    end,
+
+    destructor = function (self)
+        self:close()
+    end,
+
+    -- Stop watching
+    close = function (self)
+        if self.handler ~= nil then
+            ffi.C.fs_watch_close(self.handler)
+            self.handler = nil
+        end
+    end,
+
+    -- Wait for changes, and get them as one batch
+    -- * changes of the same path are coalesced (e.g. a file created and removed in the batch is not reported)
+    -- @param {number} timeout: milliseconds to wait for the first change (default: -1 => infinite)
+    -- @returns {table[]|nil} {path: string, event: "created"|"modified"|"removed"|"overflow"}[]; nil if timed out or closed
+    next = function (self, timeout)
+        if self.handler == nil then return nil end
+        local n = tonumber(ffi.C.fs_watch_next(self.handler, timeout or -1, self.debounce))
+        if n == 0 then return nil end
+
+        local changes = {}
+        for i = 0, n - 1 do
+            local path = ffi.C.fs_watch_get(self.handler, i, self.action)
+            local action = self.action[0]
+            changes[i + 1] = {path = ffi.string(path), event = watchevents[action] or watchevents[bit.band(action, 8)] or "modified"}
+        end
+        return changes
+    end,
+
+    -- Get changes arrived so far without blocking
+    -- * call repeatedly from a coroutine / event loop instead of blocking in next()
+    -- @returns {table[]|nil}
+    poll = function (self)
+        return self:next(0)
+    end,
+}
+
+-- Watch changes in the directories (inotify on Linux, ReadDirectoryChangesW on Windows)
+-- e.g.
+--     local w = fs.watch({"src"}, {debounce_ms = 100})
+--     while true do
+--         for _, change in ipairs(w:next()) do print(change.event, change.path) end
+--     end
+-- @param {string|string[]} dirs
+-- @param {table} opts: {
+--     recursive: {boolean} watch the sub directories too (default: true),
+--     debounce_ms: {number} keep collecting changes until no change arrives for the milliseconds (default: 50),
+-- }
+-- @returns {watcher|nil} nil if any directory cannot be watched
+function fs.watch(dirs, opts)
+    debug.checkarg(2, dirs, "string|table", opts, "nil|table")
+    opts = opts or {}
+    if type(dirs) == "string" then dirs = {dirs} end
+
+    local cdirs = ffi.new("const char*[?]", #dirs + 1)
+    for i, dir in ipairs(dirs) do cdirs[i - 1] = dir end
+    local handler = ffi.C.fs_watch_open(cdirs, #dirs, opts.recursive ~= false)
+    if handler == nil then return nil end
+    return watcher.new(handler, opts.debounce_ms or 50)
+end
+
+--- asynchronous file I/O ---
+fs.async = {}
+
+-- @private engine opened at the first request (closed when the Lua state is closed)
+local asyncengine = nil
+local asyncresults = nil
+local asyncguard = nil
+
+-- @private request id => {co: coroutine waiting for the result (nil: waited synchronously), kind, anchor: data kept until completion, results}
+local asyncwaiting = {}
+
+-- @private coroutines scheduled by fs.async.run / fs.async.spawn
+local asyncmanaged = setmetatable({}, {__mode = "k"})
+local asyncready = {} -- {coroutine, count of args, args...} to be resumed
+local asyncsuspended = 0 -- count of managed coroutines waiting for the result
+
+-- @private value yielded by coroutines waiting for the result
+local asyncsignal = {}
+
+local function asyncopen()
+    if asyncengine == nil then
+        asyncengine = ffi.C.fs_async_open(0, 0)
+        asyncresults = ffi.new("fs_async_result_t[64]")
+        asyncguard = newproxy(true)
+        getmetatable(asyncguard).__gc = function ()
+            ffi.C.fs_async_close(asyncengine)
+            asyncengine = nil
+        end
+    end
+    return asyncengine
+end
+
+-- @private resume the coroutine, and reschedule it if it yields without waiting for the result
+local function asyncresume(co, ...)
+    local ok, ret = coroutine.resume(co, ...)
+    if not ok then error(debug.traceback(co, ret), 0) end
+    if coroutine.status(co) == "suspended" and ret ~= asyncsignal then
+        asyncready[#asyncready + 1] = {co, 0}
+    end
+end
+
+-- @private wait for completed requests, and resume the coroutines waiting for them
+-- @param {number} timeout: milliseconds (-1: infinite, 0: no wait)
+local function asyncdispatch(timeout)
+    local n = tonumber(ffi.C.fs_async_wait(asyncengine, asyncresults, 64, timeout))
+    local resumed = {}
+    for i = 0, n - 1 do
+        local result = asyncresults[i]
+        local entry = asyncwaiting[result.id]
+        asyncwaiting[result.id] = nil
+        if result.error ~= 0 then
+            entry.results = {nil, ffi.string(ffi.C.strerror(result.error))}
+        elseif entry.kind == "readfile" then
+            entry.results = {ffi.string(result.data, result.size)}
+        elseif entry.kind == "writefile" then
+            entry.results = {tonumber(result.size)}
+        elseif entry.kind == "stat" then
+            entry.results = {stattable(result.stat)}
+        else
+            entry.results = {true}
+        end
+        ffi.C.fs_async_release(asyncengine, result.id)
+        if entry.co then resumed[#resumed + 1] = entry end
+    end
+    for _, entry in ipairs(resumed) do
+        asyncsuspended = asyncsuspended - 1
+        asyncresume(entry.co, entry.results[1], entry.results[2])
+    end
+end
+
+-- @private wait for the result of the request
+-- * yields if called in the coroutine scheduled by fs.async.run / fs.async.spawn, otherwise blocks
+local function asyncawait(kind, id, anchor)
+    if id == 0 then return nil, "failed to start the request" end
+
+    local co = coroutine.running()
+    if co and asyncmanaged[co] then
+        asyncwaiting[id] = {co = co, kind = kind, anchor = anchor}
+        asyncsuspended = asyncsuspended + 1
+        return coroutine.yield(asyncsignal)
+    end
+
+    local entry = {kind = kind, anchor = anchor}
+    asyncwaiting[id] = entry
+    while entry.results == nil do
+        -- the coroutine of another scheduler (luz.loop) yields until the request is completed
+        if not (co and fs.async.yield and fs.async.yield(co, function () return entry.results ~= nil end)) then
+            asyncdispatch(-1)
+        end
+    end
+    return entry.results[1], entry.results[2]
+end
+
+-- Get the backend of asynchronous file I/O
+-- @returns {string} "io_uring" | "threadpool"
+function fs.async.backend()
+    return ffi.C.fs_async_is_uring(asyncopen()) and "io_uring" or "threadpool"
+end
+
+-- Read all data in the file asynchronously
+-- @returns {string|nil, string} data, error message
+function fs.async.readfile(filename)
+    debug.checkarg(1, filename, "string")
+    return asyncawait("readfile", ffi.C.fs_async_readfile(asyncopen(), filename))
+end
+
+-- Write data into the file asynchronously (parent directories are created automatically)
+-- @returns {number|nil, string} written size, error message
+function fs.async.writefile(filename, data)
+    debug.checkarg(2, filename, "string", data, "string")
+    return asyncawait("writefile", ffi.C.fs_async_writefile(asyncopen(), filename, data, #data), data)
+end
+
+-- Get the file / directory state asynchronously
+-- @returns {table<path_stat_t>|nil, string} state, error message
+function fs.async.stat(path)
+    debug.checkarg(1, path, "string")
+    return asyncawait("stat", ffi.C.fs_async_stat(asyncopen(), path))
+end
+
+-- Copy the file asynchronously
+-- @returns {boolean|nil, string} true if succeeded, error message
+function fs.async.copyfile(src, dest, isOverwrite)
+    debug.checkarg(3, src, "string", dest, "string", isOverwrite, "nil|boolean")
+    return asyncawait("copyfile", ffi.C.fs_async_copyfile(asyncopen(), src, dest, isOverwrite or false))
+end
+
+-- Hook to wait for the request without blocking the coroutine of another scheduler (set by luz.loop)
+-- * called with the coroutine and the function identifying if the request is completed
+-- * returns true after it has yielded until fs.async.poll() completes the request, or false to block
+-- @type {function(thread, function()->boolean)->boolean|nil}
+fs.async.yield = nil
+
+-- Get the descriptor which becomes readable when any request is completed
+-- * the queued requests are submitted; call fs.async.poll() when it's readable
+-- @returns {number} -1 if io_uring is not used (call fs.async.poll() periodically)
+function fs.async.fd()
+    return ffi.C.fs_async_fd(asyncopen())
+end
+
+-- Dispatch the completed requests without blocking
+-- * the coroutines waiting for them are resumed (or marked as completed if they are waiting in another scheduler)
+function fs.async.poll()
+    if asyncengine ~= nil then asyncdispatch(0) end
+end
+
+-- Schedule the function as a coroutine resumed by fs.async.run
+-- * fs.async.* functions called in the coroutine yield until the request is completed
+-- @returns {thread}
+function fs.async.spawn(fn, ...)
+    debug.checkarg(1, fn, "function")
+    local co = coroutine.create(fn)
+    asyncmanaged[co] = true
+    asyncready[#asyncready + 1] = {co, select("#", ...), ...}
+    return co
+end
+
+-- Run the function as a coroutine, and resume the scheduled coroutines until all of them are finished
+-- e.g.
+--     fs.async.run(function ()
+--         for _, path in ipairs(paths) do
+--             fs.async.spawn(function () contents[path] = fs.async.readfile(path) end)
+--         end
+--     end)
+-- @returns {any} values returned by fn
+function fs.async.run(fn, ...)
+    debug.checkarg(1, fn, "function")
+    local co = coroutine.running()
+    local isNested = co ~= nil and asyncmanaged[co] ~= nil
+    local results = nil
+
+    local function pack(...)
+        return {n = select("#", ...), ...}
+    end
+    fs.async.spawn(function (...)
+        results = pack(fn(...))
+    end, ...)
+
+    -- the nested run only waits for fn (the outer run resumes the rest)
+    while results == nil or (not isNested and (#asyncready > 0 or asyncsuspended > 0)) do
+        local ready = asyncready
+        asyncready = {}
+        for _, task in ipairs(ready) do
+            asyncresume(task[1], unpack(task, 3, task[2] + 2))
+        end
+        if asyncsuspended > 0 then
+            asyncdispatch(#asyncready > 0 and 0 or -1)
+        elseif results == nil and #asyncready == 0 then
+            error("fs.async.run: the coroutine is suspended by other than fs.async")
+        end
+    end
+    return unpack(results, 1, results.n)
 end
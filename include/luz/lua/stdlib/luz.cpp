@@ -0,0 +1 @@
+27,76,74,2,0,13,64,115,116,100,108,105,98,58,47,47,108,117,122,76,0,0,2,1,3,0,7,19,53,3,54,0,0,0,57,0,1,0,57,0,2,0,45,1,0,0,66,0,2,1,49,0,0,0,75,0,1,0,0,0,15,108,111,111,112,95,99,108,111,115,101,6,67,8,102,102,105,1,1,1,1,1,2,3,108,111,111,112,101,110,103,105,110,101,0,0,177,2,1,0,2,3,11,0,31,64,47,12,45,0,0,0,11,0,0,0,88,0,25,128,54,0,0,0,57,0,1,0,57,0,2,0,66,0,1,2,46,0,0,0,45,0,0,0,11,0,0,0,88,0,3,128,54,0,3,0,39,1,4,0,66,0,2,1,54,0,0,0,57,0,5,0,39,1,6,0,66,0,2,2,46,1,0,0,54,0,7,0,43,1,2,0,66,0,2,2,46,2,0,0,54,0,8,0,45,1,2,0,66,0,2,2,51,1,10,0,61,1,9,0,45,0,0,0,50,0,0,128,76,0,2,0,1,128,2,128,3,128,0,9,95,95,103,99,17,103,101,116,109,101,116,97,116,97,98,108,101,13,110,101,119,112,114,111,120,121,21,108,111,111,112,95,101,118,101,110,116,95,116,91,54,52,93,8,110,101,119,34,102,97,105,108,101,100,32,116,111,32,111,112,101,110,32,116,104,101,32,101,118,101,110,116,32,108,111,111,112,10,101,114,114,111,114,14,108,111,111,112,95,111,112,101,110,6,67,8,102,102,105,1,1,1,2,2,2,2,2,3,3,3,3,3,3,4,4,4,4,4,5,5,5,5,6,6,6,9,9,11,11,11,108,111,111,112,101,110,103,105,110,101,0,108,111,111,112,101,118,101,110,116,115,0,108,111,111,112,103,117,97,114,100,0,0,108,0,0,2,1,2,0,12,30,62,4,54,0,0,0,57,0,1,0,66,0,1,2,15,0,0,0,88,1,5,128,45,1,0,0,56,1,0,1,15,0,1,0,88,2,1,128,76,0,2,0,43,1,0,0,76,1,2,0,5,192,12,114,117,110,110,105,110,103,14,99,111,114,111,117,116,105,110,101,1,1,1,2,2,2,2,2,2,2,3,3,108,111,111,112,109,97,110,97,103,101,100,0,99,111,0,4,9,0,148,2,2,1,7,2,8,1,32,70,69,6,54,1,0,0,57,1,1,1,18,2,0,0,71,3,1,0,65,1,1,3,14,0,1,0,88,3,8,128,54,3,2,0,54,4,3,0,57,4,4,4,18,5,0,0,18,6,2,0,66,4,3,2,41,5,0,0,66,3,3,1,54,3,0,0,57,3,5,3,18,4,0,0,66,3,2,2,7,3,6,0,88,3,10,128,45,3,0,0,4,2,3,0,88,3,7,128,45,3,1,0,45,4,1,0,21,4,4,0,22,4,0,4,53,5,7,0,62,0,1,5,60,5,4,3,75,0,1,0,9,192,6,128,1,3,0,0,0,3,0,14,115,117,115,112,101,110,100,101,100,11,115,116,97,116,117,115,14,116,114,97,99,101,98,97,99,107,10,100,101,98,117,103,10,101,114,114,111,114,11,114,101,115,117,109,101,14,99,111,114,111,117,116,105,110,101,2,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,6,108,111,111,112,115,105,103,110,97,108,0,108,111,111,112,114,101,97,100,121,0,99,111,0,0,33,111,107,0,6,27,114,101,116,0,0,27,0,108,0,1,7,1,2,0,9,49,78,4,54,1,0,0,57,2,1,0,66,1,2,4,88,4,2,128,45,6,0,0,60,0,5,6,69,4,3,3,82,4,252,127,75,0,1,0,4,192,8,105,100,115,11,105,112,97,105,114,115,1,1,1,1,2,2,1,1,4,108,111,111,112,119,97,105,116,105,110,103,0,119,97,105,116,101,114,0,0,10,4,4,5,5,0,5,6,0,5,95,0,1,2,105,100,0,0,2,0,194,1,0,1,9,2,5,0,20,71,85,7,54,1,0,0,57,2,1,0,66,1,2,4,88,4,13,128,45,6,0,0,56,6,5,6,5,6,0,0,88,6,9,128,45,6,0,0,43,7,0,0,60,7,5,6,54,6,2,0,57,6,3,6,57,6,4,6,45,7,1,0,18,8,5,0,66,6,3,1,69,4,3,3,82,4,241,127,75,0,1,0,4,192,1,128,16,108,111,111,112,95,99,97,110,99,101,108,6,67,8,102,102,105,8,105,100,115,11,105,112,97,105,114,115,1,1,1,1,2,2,2,2,3,3,3,4,4,4,4,4,4,1,1,7,108,111,111,112,119,97,105,116,105,110,103,0,108,111,111,112,101,110,103,105,110,101,0,119,97,105,116,101,114,0,0,21,4,4,16,5,0,16,6,0,16,95,0,1,13,105,100,0,0,13,0,164,3,0,1,13,5,9,1,48,158,1,96,15,54,1,0,0,54,2,1,0,57,2,2,2,57,2,3,2,45,3,0,0,18,4,0,0,45,5,1,0,41,6,64,0,66,2,5,0,65,1,0,2,41,2,0,0,23,3,0,1,41,4,1,0,77,2,33,128,45,6,1,0,56,6,5,6,57,6,4,6,45,7,1,0,56,7,5,7,57,7,5,7,45,8,2,0,56,8,6,8,15,0,8,0,88,9,22,128,45,9,2,0,43,10,0,0,60,10,6,9,45,9,3,0,18,10,8,0,66,9,2,1,57,9,6,8,15,0,9,0,88,10,4,128,57,9,6,8,18,10,7,0,66,9,2,1,88,9,9,128,45,9,4,0,45,10,4,0,21,10,10,0,22,10,0,10,53,11,8,0,57,12,7,8,62,12,1,11,62,7,3,11,60,11,10,9,79,2,223,127,75,0,1,0,1,128,2,128,4,192,15,192,6,128,1,3,0,0,0,3,1,7,99,111,7,102,110,11,114,101,115,117,108,116,7,105,100,14,108,111,111,112,95,119,97,105,116,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,3,3,3,3,3,3,4,4,5,5,6,6,6,7,7,7,8,8,8,9,9,9,9,11,11,11,11,11,11,11,11,11,2,15,108,111,111,112,101,110,103,105,110,101,0,108,111,111,112,101,118,101,110,116,115,0,108,111,111,112,119,97,105,116,105,110,103,0,108,111,111,112,117,110,114,101,103,105,115,116,101,114,0,108,111,111,112,114,101,97,100,121,0,116,105,109,101,111,117,116,0,0,49,110,0,11,38,1,3,34,2,0,34,3,0,34,105,0,1,32,105,100,0,6,26,114,101,115,117,108,116,0,0,26,119,97,105,116,101,114,0,2,24,0,121,0,2,4,2,5,0,9,45,115,3,45,2,0,0,53,3,0,0,61,0,1,3,61,1,2,3,66,2,2,1,54,2,3,0,57,2,4,2,45,3,1,0,68,2,2,0,14,192,9,192,10,121,105,101,108,100,14,99,111,114,111,117,116,105,110,101,8,105,100,115,7,99,111,1,0,0,1,1,1,1,1,2,2,2,2,108,111,111,112,114,101,103,105,115,116,101,114,0,108,111,111,112,115,105,103,110,97,108,0,99,111,0,0,10,105,100,115,0,0,10,0,166,3,0,4,19,3,8,1,47,158,1,122,11,52,4,0,0,54,5,0,0,18,6,1,0,66,5,2,4,88,8,36,128,54,10,1,0,57,10,2,10,57,10,3,10,45,11,0,0,66,11,1,2,18,12,9,0,56,13,8,2,18,14,3,0,66,10,5,2,9,10,0,0,88,11,24,128,54,11,0,0,18,12,4,0,66,11,2,4,88,14,6,128,54,16,1,0,57,16,2,16,57,16,4,16,45,17,1,0,18,18,15,0,66,16,3,1,69,14,3,3,82,14,248,127,43,11,0,0,54,12,1,0,57,12,5,12,54,13,1,0,57,13,2,13,57,13,6,13,54,14,1,0,57,14,7,14,66,14,1,0,65,13,0,0,65,12,0,0,73,11,1,0,60,10,8,4,69,8,3,3,82,8,218,127,45,5,2,0,18,6,0,0,18,7,4,0,68,5,3,0,11,192,1,128,17,192,10,101,114,114,110,111,13,115,116,114,101,114,114,111,114,11,115,116,114,105,110,103,16,108,111,111,112,95,99,97,110,99,101,108,15,108,111,111,112,95,119,97,116,99,104,6,67,8,102,102,105,11,105,112,97,105,114,115,0,1,2,2,2,2,3,3,3,3,3,3,3,3,3,4,4,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,6,8,2,2,10,10,10,10,108,111,111,112,111,112,101,110,0,108,111,111,112,101,110,103,105,110,101,0,108,111,111,112,97,119,97,105,116,0,99,111,0,0,48,102,100,115,0,0,48,101,118,101,110,116,115,0,0,48,116,105,109,101,111,117,116,0,0,48,105,100,115,0,2,46,4,3,39,5,0,39,6,0,39,105,0,1,36,102,100,0,0,36,105,100,0,9,27,4,5,9,5,0,9,6,0,9,95,0,1,6,111,116,104,101,114,0,0,6,0,36,0,0,1,1,0,0,2,15,137,1,2,45,0,0,0,68,0,1,0,12,192,1,1,108,111,111,112,99,117,114,114,101,110,116,0,0,198,1,0,1,8,3,5,1,21,65,143,1,4,45,1,0,0,66,1,1,2,11,1,0,0,88,2,4,128,54,2,0,0,57,2,1,2,18,3,0,0,68,2,2,0,45,2,1,0,18,3,1,0,52,4,3,0,54,5,2,0,57,5,3,5,57,5,4,5,45,6,2,0,66,6,1,2,18,7,0,0,66,5,3,0,63,5,0,0,66,2,3,1,75,0,1,0,12,192,17,192,11,192,15,108,111,111,112,95,116,105,109,101,114,6,67,8,102,102,105,10,115,108,101,101,112,7,111,115,3,128,128,192,153,4,1,1,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,4,108,111,111,112,99,117,114,114,101,110,116,0,108,111,111,112,97,119,97,105,116,0,108,111,111,112,111,112,101,110,0,109,115,101,99,0,0,22,99,111,0,3,19,0,234,3,0,3,13,3,6,1,54,163,1,156,1,11,45,3,0,0,66,3,1,2,11,3,0,0,88,4,3,128,54,4,0,0,39,5,1,0,66,4,2,1,54,4,2,0,18,5,0,0,66,4,2,2,7,4,3,0,88,4,2,128,12,4,0,0,88,4,2,128,52,4,3,0,62,0,1,4,52,5,0,0,41,6,1,0,21,7,4,0,41,8,1,0,77,6,14,128,45,10,1,0,12,11,1,0,88,11,1,128,39,11,4,0,56,10,11,10,14,0,10,0,88,11,5,128,54,10,0,0,39,11,5,0,18,12,1,0,38,11,12,11,66,10,2,2,60,10,9,5,79,6,242,127,45,6,2,0,18,7,3,0,18,8,4,0,18,9,5,0,12,10,2,0,88,10,1,128,41,10,255,255,66,6,5,3,11,6,0,0,88,8,3,128,43,8,0,0,18,9,7,0,74,8,3,0,9,6,0,0,88,8,2,128,43,8,1,0,88,9,1,128,43,8,2,0,76,8,2,0,12,192,10,192,18,192,19,105,110,118,97,108,105,100,32,109,111,100,101,58,32,6,114,10,116,97,98,108,101,9,116,121,112,101,62,108,117,122,46,108,111,111,112,46,119,97,105,116,95,102,100,58,32,99,97,108,108,101,100,32,111,117,116,32,111,102,32,116,104,101,32,99,111,114,111,117,116,105,110,101,32,111,102,32,108,117,122,46,108,111,111,112,10,101,114,114,111,114,0,1,1,2,2,2,2,2,4,4,4,4,4,4,4,4,4,4,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,6,6,5,8,8,8,8,8,8,8,8,9,9,9,9,9,10,10,10,10,10,10,108,111,111,112,99,117,114,114,101,110,116,0,108,111,111,112,109,111,100,101,115,0,108,111,111,112,119,97,105,116,102,100,115,0,102,100,0,0,55,109,111,100,101,0,0,55,116,105,109,101,111,117,116,0,0,55,99,111,0,3,52,102,100,115,0,15,37,101,118,101,110,116,115,0,0,37,1,3,15,2,0,15,3,0,15,105,0,1,13,114,101,115,117,108,116,0,22,11,109,101,115,115,97,103,101,0,0,11,0,229,3,0,0,7,4,16,1,64,114,175,1,12,54,0,0,0,57,0,1,0,66,0,1,2,45,1,0,0,57,1,2,1,14,0,1,0,88,1,53,128,85,1,52,128,54,1,3,0,57,1,4,1,45,2,0,0,57,2,5,2,32,2,2,0,54,3,0,0,57,3,1,3,66,3,1,0,65,1,1,2,18,0,1,0,45,1,0,0,53,2,8,0,45,3,0,0,57,3,7,3,61,3,7,2,52,3,3,0,54,4,9,0,57,4,10,4,57,4,11,4,45,5,1,0,66,5,1,2,54,6,0,0,57,6,1,6,66,6,1,2,33,6,6,0,66,4,3,0,63,4,0,0,61,3,12,2,61,2,6,1,45,1,2,0,45,2,0,0,57,2,6,2,66,1,2,1,54,1,13,0,57,1,14,1,45,2,3,0,66,1,2,1,45,1,0,0,43,2,0,0,61,2,6,1,45,1,0,0,57,1,2,1,14,0,1,0,88,2,8,128,45,1,0,0,57,1,15,1,45,2,0,0,66,1,2,2,11,1,1,0,88,1,201,127,88,1,1,128,88,1,199,127,45,1,0,0,43,2,2,0,61,2,2,1,75,0,1,0,0,192,0,0,1,0,2,0,7,102,110,10,121,105,101,108,100,14,99,111,114,111,117,116,105,110,101,8,105,100,115,15,108,111,111,112,95,116,105,109,101,114,6,67,8,102,102,105,1,0,0,7,99,111,11,119,97,105,116,101,114,13,105,110,116,101,114,118,97,108,8,109,97,120,9,109,97,116,104,12,115,116,111,112,112,101,100,12,115,121,115,116,105,109,101,7,111,115,3,128,128,192,153,4,1,1,1,2,2,2,2,2,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,8,9,9,9,9,9,9,9,9,9,9,9,9,11,11,11,12,115,101,108,102,0,108,111,111,112,111,112,101,110,0,108,111,111,112,114,101,103,105,115,116,101,114,0,108,111,111,112,115,105,103,110,97,108,0,100,101,97,100,108,105,110,101,0,4,61,0,195,1,1,3,5,3,9,0,15,72,171,1,17,18,3,1,0,61,2,1,0,61,3,0,0,43,3,0,0,61,3,2,0,43,3,1,0,61,3,3,0,54,3,5,0,57,3,6,3,57,3,7,3,51,4,8,0,66,3,2,2,61,3,4,0,50,0,0,128,75,0,1,0,11,192,14,192,9,192,0,10,115,112,97,119,110,9,108,111,111,112,8,108,117,122,7,99,111,12,115,116,111,112,112,101,100,11,119,97,105,116,101,114,7,102,110,13,105,110,116,101,114,118,97,108,1,1,1,2,2,3,3,4,4,4,16,4,16,17,17,108,111,111,112,111,112,101,110,0,108,111,111,112,114,101,103,105,115,116,101,114,0,108,111,111,112,115,105,103,110,97,108,0,115,101,108,102,0,0,16,105,110,116,101,114,118,97,108,0,0,16,102,110,0,0,16,0,106,0,1,3,1,2,0,11,34,191,1,6,43,1,2,0,61,1,0,0,57,1,1,0,15,0,1,0,88,2,5,128,45,1,0,0,57,2,1,0,66,1,2,1,43,1,0,0,61,1,1,0,75,0,1,0,15,192,11,119,97,105,116,101,114,12,115,116,111,112,112,101,100,1,1,2,2,2,3,3,3,4,4,6,108,111,111,112,117,110,114,101,103,105,115,116,101,114,0,115,101,108,102,0,0,12,0,140,1,0,2,8,1,5,0,13,40,206,1,3,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,45,2,0,0,57,2,4,2,18,3,0,0,18,4,1,0,68,2,3,0,19,192,8,110,101,119,13,102,117,110,99,116,105,111,110,11,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,2,108,111,111,112,116,105,109,101,114,0,105,110,116,101,114,118,97,108,0,0,14,102,110,0,0,14,0,191,1,2,1,8,2,4,2,22,55,214,1,5,54,1,0,0,57,1,1,1,18,2,0,0,66,1,2,2,45,2,0,0,43,3,2,0,60,3,1,2,45,2,1,0,45,3,1,0,21,3,3,0,22,3,0,3,52,4,4,0,62,1,1,4,54,5,2,0,39,6,3,0,71,7,1,0,65,5,1,2,62,5,2,4,71,5,1,0,63,5,1,0,60,4,3,2,76,1,2,0,5,192,6,128,6,35,11,115,101,108,101,99,116,11,99,114,101,97,116,101,14,99,111,114,111,117,116,105,110,101,2,7,128,128,192,153,4,1,1,1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,108,111,111,112,109,97,110,97,103,101,100,0,108,111,111,112,114,101,97,100,121,0,102,110,0,0,23,99,111,0,5,18,0,36,0,0,1,1,0,0,2,15,222,1,2,49,0,2,0,75,0,1,0,8,128,1,2,108,111,111,112,115,116,111,112,112,101,100,0,0,77,2,0,4,0,4,1,9,10,242,1,2,53,0,2,0,54,1,0,0,39,2,1,0,71,3,0,0,65,1,1,2,61,1,3,0,71,1,0,0,63,1,0,0,76,0,2,0,6,110,1,0,0,6,35,11,115,101,108,101,99,116,3,128,128,192,153,4,1,1,1,1,1,1,1,1,1,0,69,2,0,3,3,0,0,7,24,245,1,2,45,0,1,0,45,1,2,0,71,2,0,0,65,1,0,0,65,0,0,2,46,0,0,0,75,0,1,0,1,128,2,192,0,192,1,1,1,1,1,1,2,114,101,115,117,108,116,115,0,112,97,99,107,0,102,110,0,0,133,3,0,0,12,5,3,1,52,139,1,251,1,11,45,0,0,0,14,0,0,0,88,0,48,128,45,0,1,0,21,0,0,0,41,1,0,0,0,1,0,0,88,0,5,128,54,0,0,0,45,1,2,0,66,0,2,2,10,0,0,0,88,0,38,128,85,0,37,128,45,0,1,0,52,1,0,0,46,1,1,0,54,1,1,0,18,2,0,0,66,1,2,4,88,4,9,128,45,6,3,0,58,7,1,5,54,8,2,0,18,9,5,0,41,10,3,0,58,11,2,5,22,11,0,11,66,8,4,0,65,6,1,1,69,4,3,3,82,4,245,127,54,1,0,0,45,2,2,0,66,1,2,2,10,1,0,0,88,1,219,127,45,1,0,0,14,0,1,0,88,1,216,127,45,1,4,0,45,2,1,0,21,2,2,0,41,3,0,0,1,3,2,0,88,2,2,128,41,2,0,0,88,3,1,128,41,2,255,255,66,1,2,1,88,0,205,127,75,0,1,0,1,0,2,0,3,0,4,0,5,0,11,117,110,112,97,99,107,11,105,112,97,105,114,115,9,110,101,120,116,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,3,3,4,4,4,4,5,5,5,5,5,5,5,5,5,4,4,7,7,7,7,7,7,7,7,8,8,8,8,8,8,8,8,8,8,9,11,108,111,111,112,115,116,111,112,112,101,100,0,108,111,111,112,114,101,97,100,121,0,108,111,111,112,119,97,105,116,105,110,103,0,108,111,111,112,114,101,115,117,109,101,0,108,111,111,112,100,105,115,112,97,116,99,104,0,114,101,97,100,121,0,16,35,4,5,12,5,0,12,6,0,12,95,0,1,9,116,97,115,107,0,0,9,0,215,3,3,1,8,6,14,0,46,154,1,236,1,30,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,45,1,0,0,15,0,1,0,88,2,3,128,54,1,3,0,39,2,4,0,66,1,2,1,43,1,0,0,15,0,0,0,88,2,8,128,51,2,5,0,54,3,6,0,57,3,7,3,57,3,8,3,51,4,9,0,71,5,1,0,65,3,1,1,50,2,0,128,43,2,2,0,49,1,1,0,46,0,2,0,54,2,10,0,51,3,11,0,66,2,2,3,49,0,1,0,14,0,2,0,88,4,4,128,54,4,3,0,18,5,3,0,41,6,0,0,66,4,3,1,15,0,1,0,88,4,6,128,54,4,12,0,18,5,1,0,41,6,1,0,57,7,13,1,50,0,0,128,68,4,4,0,50,0,0,128,75,0,1,0,7,128,8,128,6,128,4,192,13,192,16,192,6,110,11,117,110,112,97,99,107,0,10,112,99,97,108,108,0,10,115,112,97,119,110,9,108,111,111,112,8,108,117,122,0,46,108,117,122,46,108,111,111,112,46,114,117,110,58,32,116,104,101,32,108,111,111,112,32,105,115,32,97,108,114,101,97,100,121,32,114,117,110,110,105,110,103,10,101,114,114,111,114,17,110,105,108,124,102,117,110,99,116,105,111,110,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,4,5,5,8,9,9,9,11,11,9,11,14,14,14,15,26,15,27,28,28,28,28,28,28,29,29,29,29,29,29,29,29,30,30,108,111,111,112,114,117,110,110,105,110,103,0,108,111,111,112,115,116,111,112,112,101,100,0,108,111,111,112,114,101,97,100,121,0,108,111,111,112,119,97,105,116,105,110,103,0,108,111,111,112,114,101,115,117,109,101,0,108,111,111,112,100,105,115,112,97,116,99,104,0,102,110,0,0,47,114,101,115,117,108,116,115,0,14,33,112,97,99,107,0,3,6,111,107,0,13,17,109,101,115,115,97,103,101,0,0,17,0,250,4,0,3,14,7,10,3,80,214,1,147,2,14,54,3,0,0,54,4,1,0,57,4,2,4,57,4,3,4,57,5,4,1,45,6,0,0,45,7,1,0,66,4,4,0,65,3,0,2,41,4,0,0,1,3,4,0,88,4,22,128,45,4,2,0,18,5,0,0,52,6,3,0,54,7,1,0,57,7,2,7,57,7,5,7,45,8,3,0,66,8,1,2,41,9,0,0,1,2,9,0,88,9,2,128,41,9,10,0,88,10,5,128,54,9,6,0,57,9,7,9,41,10,10,0,18,11,2,0,66,9,3,2,66,7,3,0,63,7,0,0,66,4,3,1,75,0,1,0,9,3,1,0,88,4,1,128,75,0,1,0,52,4,0,0,52,5,0,0,41,6,0,0,23,7,2,3,41,8,1,0,77,6,17,128,22,10,2,9,22,11,2,9,45,12,0,0,56,12,9,12,45,13,1,0,56,13,9,13,15,0,13,0,88,14,4,128,45,13,4,0,57,13,8,13,14,0,13,0,88,14,2,128,45,13,4,0,57,13,9,13,60,13,11,5,60,12,10,4,79,6,239,127,45,6,5,0,18,7,0,0,18,8,4,0,18,9,5,0,18,10,2,0,66,6,5,2,11,6,0,0,88,6,11,128,45,6,2,0,18,7,0,0,52,8,3,0,54,9,1,0,57,9,2,9,57,9,5,9,45,10,6,0,41,11,0,0,66,9,3,0,63,9,0,0,66,6,3,1,75,0,1,0,20,192,21,192,17,192,11,192,10,192,18,192,1,128,6,114,6,119,8,109,105,110,9,109,97,116,104,15,108,111,111,112,95,116,105,109,101,114,12,104,97,110,100,108,101,114,23,111,115,95,112,114,111,99,101,115,115,95,112,111,108,108,102,100,115,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,3,128,128,192,153,4,0,2,1,1,1,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,6,6,6,7,7,8,8,8,8,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,8,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,14,112,114,111,99,101,115,115,102,100,115,0,112,114,111,99,101,115,115,119,114,105,116,97,98,108,101,0,108,111,111,112,97,119,97,105,116,0,108,111,111,112,111,112,101,110,0,108,111,111,112,109,111,100,101,115,0,108,111,111,112,119,97,105,116,102,100,115,0,108,111,111,112,101,110,103,105,110,101,0,99,111,0,0,81,112,114,111,99,0,0,81,116,105,109,101,111,117,116,0,0,81,110,0,10,71,102,100,115,0,30,41,101,118,101,110,116,115,0,0,41,1,3,18,2,0,18,3,0,18,105,0,1,16,0,103,0,1,4,0,4,0,12,24,164,2,3,11,0,0,0,88,1,2,128,41,1,255,255,76,1,2,0,54,1,0,0,57,1,1,1,41,2,0,0,54,3,2,0,57,3,3,3,66,3,1,2,33,3,3,0,68,1,3,0,12,115,121,115,116,105,109,101,7,111,115,8,109,97,120,9,109,97,116,104,1,1,1,1,2,2,2,2,2,2,2,2,100,101,97,100,108,105,110,101,0,0,13,0,185,3,0,2,10,3,10,1,55,130,1,173,2,12,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,45,2,0,0,66,2,1,2,11,2,0,0,88,3,4,128,18,4,0,0,57,3,4,0,18,5,1,0,68,3,3,0,18,4,0,0,57,3,5,0,66,3,2,1,15,0,1,0,88,3,9,128,41,3,0,0,3,3,1,0,88,3,6,128,54,3,6,0,57,3,7,3,66,3,1,2,32,3,1,3,14,0,3,0,88,4,1,128,43,3,0,0,85,4,22,128,18,5,0,0,57,4,8,0,66,4,2,2,14,0,4,0,88,5,8,128,57,5,9,0,10,5,0,0,88,5,5,128,45,5,1,0,18,6,3,0,66,5,2,2,9,5,0,0,88,5,1,128,76,4,2,0,45,5,2,0,18,6,2,0,18,7,0,0,45,8,1,0,18,9,3,0,66,8,2,0,65,5,2,1,88,4,233,127,75,0,1,0,12,192,23,192,22,192,12,104,97,110,100,108,101,114,9,112,111,108,108,12,115,121,115,116,105,109,101,7,111,115,15,99,108,111,115,101,115,116,100,105,110,9,119,97,105,116,15,110,105,108,124,110,117,109,98,101,114,10,116,97,98,108,101,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,0,1,1,1,1,1,1,1,1,2,2,3,3,3,3,3,3,5,5,5,6,6,6,6,6,6,6,6,6,6,6,6,7,8,8,8,9,9,9,9,9,9,9,9,9,9,9,10,10,10,10,10,10,10,10,12,108,111,111,112,99,117,114,114,101,110,116,0,114,101,109,97,105,110,105,110,103,0,112,114,111,99,101,115,115,119,97,105,116,0,112,114,111,99,0,0,56,116,105,109,101,111,117,116,0,0,56,99,111,0,11,45,100,101,97,100,108,105,110,101,0,21,24,99,111,100,101,0,4,18,0,231,2,0,2,10,3,5,1,47,124,191,2,10,45,2,0,0,66,2,1,2,11,2,0,0,88,3,4,128,18,4,0,0,57,3,0,0,18,5,1,0,68,3,3,0,15,0,1,0,88,3,9,128,41,3,0,0,3,3,1,0,88,3,6,128,54,3,1,0,57,3,2,3,66,3,1,2,32,3,1,3,14,0,3,0,88,4,1,128,43,3,0,0,85,4,25,128,18,5,0,0,57,4,0,0,41,6,0,0,66,4,3,2,14,0,4,0,88,5,10,128,18,6,0,0,57,5,3,0,66,5,2,2,14,0,5,0,88,6,5,128,45,5,1,0,18,6,3,0,66,5,2,2,9,5,0,0,88,5,1,128,76,4,2,0,45,5,2,0,18,6,2,0,57,7,4,0,45,8,1,0,18,9,3,0,66,8,2,0,65,5,2,1,88,4,230,127,75,0,1,0,12,192,23,192,22,192,9,112,114,111,99,8,101,111,102,12,115,121,115,116,105,109,101,7,111,115,13,114,101,97,100,108,105,110,101,0,1,1,2,2,2,2,2,2,4,4,4,4,4,4,4,4,4,4,4,4,5,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,8,8,8,8,8,8,8,8,10,108,111,111,112,99,117,114,114,101,110,116,0,114,101,109,97,105,110,105,110,103,0,112,114,111,99,101,115,115,119,97,105,116,0,114,101,97,100,101,114,0,0,48,116,105,109,101,111,117,116,0,0,48,99,111,0,3,45,100,101,97,100,108,105,110,101,0,18,27,108,105,110,101,0,5,20,0,172,6,0,2,15,6,21,2,108,229,1,207,2,18,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,45,2,0,0,66,2,1,2,11,2,0,0,88,3,4,128,18,4,0,0,57,3,4,0,18,5,1,0,68,3,3,0,15,0,1,0,88,3,9,128,41,3,0,0,3,3,1,0,88,3,6,128,54,3,5,0,57,3,6,3,66,3,1,2,32,3,1,3,14,0,3,0,88,4,1,128,43,3,0,0,57,4,7,0,10,4,0,0,88,4,75,128,85,4,74,128,18,5,0,0,57,4,8,0,66,4,2,2,15,0,4,0,88,5,1,128,76,4,2,0,45,5,1,0,18,6,3,0,66,5,2,2,9,5,0,0,88,5,2,128,43,5,0,0,76,5,2,0,57,5,9,0,41,6,0,0,0,5,6,0,88,5,15,128,45,5,2,0,18,6,2,0,52,7,3,0,57,8,9,0,62,8,1,7,52,8,3,0,45,9,3,0,57,9,10,9,62,9,1,8,45,9,1,0,18,10,3,0,66,9,2,0,65,5,3,2,11,5,0,0,88,5,32,128,54,5,11,0,57,5,12,5,57,6,13,0,41,7,10,0,66,5,3,2,45,6,4,0,18,7,2,0,52,8,3,0,54,9,14,0,57,9,15,9,57,9,16,9,45,10,5,0,66,10,1,2,45,11,1,0,18,12,3,0,66,11,2,2,41,12,0,0,1,11,12,0,88,11,2,128,12,11,5,0,88,11,7,128,54,11,11,0,57,11,17,11,18,12,5,0,45,13,1,0,18,14,3,0,66,13,2,0,65,11,1,2,66,9,3,0,63,9,1,0,66,6,3,1,88,5,188,127,57,5,13,0,41,6,0,0,1,6,5,0,88,5,184,127,54,5,18,0,57,5,19,5,57,5,20,5,57,6,13,0,66,5,2,1,88,4,178,127,43,4,0,0,76,4,2,0,12,192,23,192,18,192,10,192,17,192,11,192,10,115,108,101,101,112,9,108,111,111,112,8,108,117,122,8,109,105,110,15,108,111,111,112,95,116,105,109,101,114,6,67,8,102,102,105,13,100,101,98,111,117,110,99,101,8,109,97,120,9,109,97,116,104,6,114,7,102,100,9,112,111,108,108,12,104,97,110,100,108,101,114,12,115,121,115,116,105,109,101,7,111,115,9,110,101,120,116,15,110,105,108,124,110,117,109,98,101,114,10,116,97,98,108,101,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,0,3,128,128,192,153,4,1,1,1,1,1,1,1,1,2,2,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,7,7,7,8,8,8,9,9,9,9,9,9,9,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,13,13,13,13,14,14,14,14,14,15,17,17,108,111,111,112,99,117,114,114,101,110,116,0,114,101,109,97,105,110,105,110,103,0,108,111,111,112,119,97,105,116,102,100,115,0,108,111,111,112,109,111,100,101,115,0,108,111,111,112,97,119,97,105,116,0,108,111,111,112,111,112,101,110,0,119,97,116,99,104,101,114,0,0,109,116,105,109,101,111,117,116,0,0,109,99,111,0,11,98,100,101,97,100,108,105,110,101,0,18,80,99,104,97,110,103,101,115,0,7,70,105,110,116,101,114,118,97,108,0,34,26,0,201,2,0,0,10,4,5,1,40,121,239,2,13,49,0,1,0,54,0,0,0,57,0,1,0,57,0,2,0,66,0,1,1,45,0,1,0,52,1,0,0,46,1,1,0,54,1,3,0,18,2,0,0,66,1,2,4,88,4,18,128,58,6,2,5,66,6,1,2,15,0,6,0,88,7,9,128,45,6,2,0,45,7,2,0,21,7,7,0,22,7,0,7,53,8,4,0,58,9,1,5,62,9,1,8,60,8,7,6,88,6,5,128,45,6,1,0,45,7,1,0,21,7,7,0,22,7,0,7,60,5,7,6,69,4,3,3,82,4,236,127,45,1,1,0,21,1,1,0,41,2,0,0,1,2,1,0,88,1,2,128,45,1,3,0,66,1,1,1,75,0,1,0,0,0,4,0,5,0,6,0,1,3,0,0,0,3,0,11,105,112,97,105,114,115,9,112,111,108,108,10,97,115,121,110,99,7,102,115,2,1,2,2,2,2,3,4,4,5,5,5,5,6,6,6,6,7,7,7,7,7,7,7,7,7,9,9,9,9,9,5,5,12,12,12,12,12,12,12,13,97,115,121,110,99,119,97,116,99,104,105,110,103,0,97,115,121,110,99,119,97,105,116,101,114,115,0,108,111,111,112,114,101,97,100,121,0,97,115,121,110,99,119,97,116,99,104,0,119,97,105,116,101,114,115,0,7,34,4,5,21,5,0,21,6,0,21,95,0,1,18,119,97,105,116,101,114,0,0,18,0,140,3,1,0,6,7,12,1,45,136,1,233,2,20,45,0,0,0,15,0,0,0,88,1,1,128,50,0,40,128,49,0,2,0,54,0,0,0,57,0,1,0,57,0,2,0,66,0,1,2,41,1,0,0,3,1,0,0,88,1,12,128,54,1,3,0,57,1,4,1,57,1,5,1,45,2,1,0,66,2,1,2,18,3,0,0,45,4,2,0,57,4,6,4,41,5,255,255,66,1,5,2,14,0,1,0,88,2,1,128,41,1,0,0,9,1,0,0,88,2,8,128,54,2,3,0,57,2,4,2,57,2,7,2,45,3,1,0,66,3,1,2,41,4,1,0,66,2,3,2,18,1,2,0,45,2,3,0,53,3,8,0,52,4,3,0,62,1,1,4,61,4,9,3,51,4,10,0,61,4,11,3,66,2,2,1,75,0,1,0,75,0,1,0,25,128,11,192,10,192,14,192,24,128,6,128,26,192,7,102,110,0,8,105,100,115,1,0,0,15,108,111,111,112,95,116,105,109,101,114,6,114,15,108,111,111,112,95,119,97,116,99,104,6,67,8,102,102,105,7,102,100,10,97,115,121,110,99,7,102,115,0,1,1,1,1,2,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,19,19,6,20,1,97,115,121,110,99,119,97,116,99,104,105,110,103,0,108,111,111,112,111,112,101,110,0,108,111,111,112,109,111,100,101,115,0,108,111,111,112,114,101,103,105,115,116,101,114,0,97,115,121,110,99,119,97,105,116,101,114,115,0,108,111,111,112,114,101,97,100,121,0,97,115,121,110,99,119,97,116,99,104,0,102,100,0,10,35,105,100,0,16,19,0,213,1,0,2,5,4,2,1,22,89,128,3,6,45,2,0,0,56,2,0,2,14,0,2,0,88,2,2,128,43,2,1,0,76,2,2,0,45,2,1,0,45,3,1,0,21,3,3,0,22,3,0,3,52,4,3,0,62,0,1,4,62,1,2,4,60,4,3,2,45,2,2,0,66,2,1,1,54,2,0,0,57,2,1,2,45,3,3,0,66,2,2,1,43,2,2,0,76,2,2,0,5,192,24,128,26,192,9,192,10,121,105,101,108,100,14,99,111,114,111,117,116,105,110,101,2,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,4,4,4,4,5,5,108,111,111,112,109,97,110,97,103,101,100,0,97,115,121,110,99,119,97,105,116,101,114,115,0,97,115,121,110,99,119,97,116,99,104,0,108,111,111,112,115,105,103,110,97,108,0,99,111,0,0,23,105,115,67,111,109,112,108,101,116,101,100,0,0,23,0,166,5,0,1,11,0,25,0,88,114,144,3,10,54,1,0,0,57,1,1,1,39,2,2,0,18,3,0,0,66,1,3,2,15,0,1,0,88,2,12,128,39,1,3,0,54,2,0,0,57,2,4,2,54,3,0,0,57,3,5,3,39,4,6,0,18,5,0,0,66,3,3,2,41,4,8,0,66,2,3,2,38,1,2,1,76,1,2,0,54,1,0,0,57,1,1,1,39,2,7,0,18,3,0,0,66,1,3,2,15,0,1,0,88,2,12,128,39,1,8,0,54,2,0,0,57,2,4,2,54,3,0,0,57,3,5,3,39,4,9,0,18,5,0,0,66,3,3,2,41,4,8,0,66,2,3,2,38,1,2,1,76,1,2,0,54,1,10,0,54,2,0,0,57,2,11,2,18,3,0,0,66,2,2,0,65,1,0,2,18,3,1,0,57,2,12,1,39,4,13,0,66,2,3,2,15,0,2,0,88,3,23,128,39,2,14,0,54,3,0,0,57,3,4,3,54,4,0,0,57,4,5,4,39,5,15,0,54,6,0,0,57,6,16,6,39,7,17,0,54,8,0,0,57,8,16,8,39,9,18,0,18,10,0,0,66,8,3,0,65,6,1,0,65,4,1,2,54,5,0,0,57,5,19,5,39,6,17,0,66,5,2,0,65,3,1,2,38,2,3,2,76,2,2,0,54,2,20,0,18,3,0,0,66,2,2,2,11,2,0,0,88,3,6,128,54,3,21,0,39,4,22,0,18,5,1,0,39,6,23,0,38,4,6,4,66,3,2,1,39,3,24,0,18,4,2,0,38,3,4,3,76,3,2,0,6,110,24,32,40,112,97,115,115,32,116,104,101,32,112,111,105,110,116,101,114,41,22,99,97,110,110,111,116,32,115,101,114,105,97,108,105,122,101,32,10,101,114,114,111,114,13,116,111,110,117,109,98,101,114,11,115,105,122,101,111,102,16,99,111,110,115,116,32,118,111,105,100,42,14,117,105,110,116,112,116,114,95,116,9,99,97,115,116,17,117,105,110,116,112,116,114,95,116,91,49,93,6,112,14,91,37,42,37,93,38,93,62,36,9,102,105,110,100,11,116,121,112,101,111,102,13,116,111,115,116,114,105,110,103,16,117,105,110,116,54,52,95,116,91,49,93,6,117,13,117,105,110,116,54,52,95,116,15,105,110,116,54,52,95,116,91,49,93,8,110,101,119,11,115,116,114,105,110,103,6,105,12,105,110,116,54,52,95,116,11,105,115,116,121,112,101,8,102,102,105,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,7,7,7,8,8,8,8,8,8,8,8,9,9,9,9,118,97,108,117,101,0,0,89,99,116,121,112,101,0,45,44,110,117,109,98,101,114,0,32,12,0,200,2,0,1,8,0,11,0,42,67,156,3,6,18,2,0,0,57,1,0,0,41,3,1,0,41,4,1,0,66,1,4,2,18,3,0,0,57,2,0,0,41,4,2,0,66,2,3,2,7,1,1,0,88,3,7,128,54,3,2,0,57,3,3,3,39,4,4,0,18,5,2,0,66,3,3,2,58,3,0,3,76,3,2,0,7,1,5,0,88,3,7,128,54,3,2,0,57,3,3,3,39,4,6,0,18,5,2,0,66,3,3,2,58,3,0,3,76,3,2,0,7,1,7,0,88,3,10,128,54,3,2,0,57,3,3,3,39,4,8,0,54,5,2,0,57,5,3,5,39,6,9,0,18,7,2,0,66,5,3,2,58,5,0,5,68,3,3,0,54,3,10,0,18,4,2,0,68,3,2,0,13,116,111,110,117,109,98,101,114,21,99,111,110,115,116,32,117,105,110,116,112,116,114,95,116,42,10,118,111,105,100,42,6,112,20,99,111,110,115,116,32,117,105,110,116,54,52,95,116,42,6,117,19,99,111,110,115,116,32,105,110,116,54,52,95,116,42,9,99,97,115,116,8,102,102,105,6,105,8,115,117,98,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,5,5,5,100,97,116,97,0,0,43,107,105,110,100,0,10,33,112,97,121,108,111,97,100,0,0,33,0,167,1,0,2,7,1,3,0,14,51,164,3,4,45,2,0,0,56,2,0,2,11,2,0,0,88,3,7,128,54,3,0,0,39,4,1,0,54,5,2,0,18,6,0,0,66,5,2,2,38,4,5,4,66,3,2,1,18,3,2,0,18,4,1,0,68,3,2,0,27,192,13,116,111,115,116,114,105,110,103,36,99,97,110,110,111,116,32,100,101,115,101,114,105,97,108,105,122,101,32,116,104,101,32,111,98,106,101,99,116,58,32,10,101,114,114,111,114,1,1,2,2,2,2,2,2,2,2,2,3,3,3,117,110,112,97,99,107,101,114,115,0,107,105,110,100,0,0,15,118,97,108,117,101,0,0,15,117,110,112,97,99,107,101,114,0,3,12,0,252,2,0,2,8,0,9,1,29,62,183,3,8,54,2,0,0,57,2,1,2,18,3,0,0,41,4,1,0,66,2,3,2,10,2,0,0,88,3,8,128,54,3,2,0,39,4,3,0,18,5,4,0,57,4,4,4,18,6,2,0,66,4,3,2,22,5,0,1,66,3,3,1,54,3,5,0,54,4,6,0,57,4,7,4,18,5,0,0,66,3,3,3,14,0,3,0,88,5,6,128,54,5,2,0,39,6,8,0,18,7,4,0,38,6,7,6,22,7,0,1,66,5,3,1,76,4,2,0,36,116,104,101,32,102,117,110,99,116,105,111,110,32,99,97,110,110,111,116,32,98,101,32,100,117,109,112,101,100,58,32,9,100,117,109,112,11,115,116,114,105,110,103,10,112,99,97,108,108,11,102,111,114,109,97,116,114,116,104,101,32,102,117,110,99,116,105,111,110,32,114,101,102,101,114,115,32,116,111,32,116,104,101,32,117,112,118,97,108,117,101,32,39,37,115,39,32,119,104,105,99,104,32,99,97,110,110,111,116,32,98,101,32,115,104,105,112,112,101,100,32,116,111,32,97,110,111,116,104,101,114,32,76,117,97,32,115,116,97,116,101,32,40,112,97,115,115,32,105,116,32,97,115,32,97,110,32,97,114,103,117,109,101,110,116,41,10,101,114,114,111,114,15,103,101,116,117,112,118,97,108,117,101,10,100,101,98,117,103,2,1,1,1,1,1,2,2,3,3,3,3,3,3,3,3,5,5,5,5,5,6,6,6,6,6,6,6,6,7,102,110,0,0,30,108,101,118,101,108,0,0,30,110,97,109,101,0,6,24,111,107,0,15,9,99,111,100,101,0,0,9,0,135,1,0,2,5,1,3,1,14,41,194,3,3,54,2,0,0,18,3,0,0,66,2,2,2,7,2,1,0,88,2,3,128,18,2,0,0,39,3,2,0,74,2,3,0,45,2,0,0,18,3,0,0,22,4,0,1,66,2,3,2,39,3,2,0,74,2,3,0,28,192,16,61,108,117,122,46,116,104,114,101,97,100,11,115,116,114,105,110,103,9,116,121,112,101,2,1,1,1,1,1,1,1,1,2,2,2,2,2,2,100,117,109,112,102,117,110,99,116,105,111,110,0,102,110,0,0,15,108,101,118,101,108,0,0,15,0,77,0,3,4,0,3,0,6,26,201,3,3,18,3,1,0,61,2,1,0,61,3,0,0,43,3,0,0,61,3,2,0,75,0,1,0,12,114,101,115,117,108,116,115,7,105,100,9,112,111,111,108,1,1,1,2,2,3,115,101,108,102,0,0,7,112,111,111,108,0,0,7,105,100,0,0,7,0,137,1,0,1,4,1,5,0,14,29,206,3,2,57,1,0,0,11,1,0,0,88,1,10,128,57,1,1,0,57,1,2,1,10,1,0,0,88,1,6,128,45,1,0,0,57,1,3,1,57,2,1,0,57,2,2,2,57,3,4,0,66,1,3,1,75,0,1,0,0,192,7,105,100,19,116,104,114,101,97,100,95,114,101,108,101,97,115,101,12,104,97,110,100,108,101,114,9,112,111,111,108,12,114,101,115,117,108,116,115,1,1,1,1,1,1,1,1,1,1,1,1,1,2,110,97,116,105,118,101,0,115,101,108,102,0,0,15,0,231,3,0,2,7,1,13,0,66,102,214,3,11,57,2,0,0,10,2,0,0,88,2,2,128,43,2,2,0,76,2,2,0,57,2,1,0,57,2,2,2,11,2,0,0,88,2,3,128,54,2,3,0,39,3,4,0,66,2,2,1,54,2,5,0,57,2,6,2,57,2,7,2,66,2,1,2,11,2,0,0,88,2,9,128,45,2,0,0,57,2,8,2,57,3,1,0,57,3,2,3,57,4,9,0,12,5,1,0,88,5,1,128,41,5,255,255,68,2,4,0,15,0,1,0,88,2,9,128,41,2,0,0,3,2,1,0,88,2,6,128,54,2,10,0,57,2,11,2,66,2,1,2,32,2,1,2,14,0,2,0,88,3,1,128,43,2,0,0,45,3,0,0,57,3,8,3,57,4,1,0,57,4,2,4,57,5,9,0,41,6,0,0,66,3,4,2,14,0,3,0,88,3,16,128,85,3,15,128,15,0,2,0,88,3,7,128,54,3,10,0,57,3,11,3,66,3,1,2,3,2,3,0,88,3,2,128,43,3,1,0,76,3,2,0,54,3,5,0,57,3,6,3,57,3,12,3,41,4,1,0,66,3,2,1,88,3,231,127,43,3,2,0,76,3,2,0,0,192,10,115,108,101,101,112,12,115,121,115,116,105,109,101,7,111,115,7,105,100,16,116,104,114,101,97,100,95,119,97,105,116,12,99,117,114,114,101,110,116,9,108,111,111,112,8,108,117,122,36,116,104,101,32,116,104,114,101,97,100,32,112,111,111,108,32,104,97,115,32,98,101,101,110,32,99,108,111,115,101,100,10,101,114,114,111,114,12,104,97,110,100,108,101,114,9,112,111,111,108,12,114,101,115,117,108,116,115,1,1,1,1,1,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,8,8,8,8,8,8,10,10,110,97,116,105,118,101,0,115,101,108,102,0,0,67,116,105,109,101,111,117,116,0,0,67,100,101,97,100,108,105,110,101,0,40,27,0,44,0,1,4,0,1,0,4,12,229,3,2,18,2,0,0,57,1,0,0,41,3,0,0,68,1,3,0,9,119,97,105,116,1,1,1,1,115,101,108,102,0,0,5,0,102,2,0,5,1,5,1,11,17,240,3,2,45,0,0,0,53,1,3,0,54,2,1,0,39,3,2,0,71,4,0,0,65,2,1,2,61,2,4,1,71,2,0,0,63,2,0,0,61,1,0,0,75,0,1,0,0,192,6,110,1,0,0,6,35,11,115,101,108,101,99,116,12,114,101,115,117,108,116,115,3,128,128,192,153,4,1,1,1,1,1,1,1,1,1,1,2,115,101,108,102,0,0,136,2,1,1,6,1,11,0,33,55,236,3,11,57,1,0,0,11,1,0,0,88,1,14,128,18,2,0,0,57,1,1,0,66,1,2,1,53,1,2,0,61,1,0,0,51,1,3,0,18,2,1,0,45,3,0,0,57,3,4,3,57,4,5,0,57,4,6,4,57,5,7,0,66,3,3,0,65,2,0,1,57,1,0,0,58,1,1,1,14,0,1,0,88,1,5,128,54,1,8,0,57,2,0,0,58,2,2,2,41,3,0,0,66,1,3,1,54,1,9,0,57,2,0,0,41,3,2,0,57,4,0,0,57,4,10,4,50,0,0,128,68,1,4,0,0,192,6,110,11,117,110,112,97,99,107,10,101,114,114,111,114,7,105,100,12,104,97,110,100,108,101,114,9,112,111,111,108,16,116,104,114,101,97,100,95,116,97,107,101,0,1,0,1,6,110,3,0,9,119,97,105,116,12,114,101,115,117,108,116,115,1,1,1,2,2,2,3,3,6,7,7,7,7,7,7,7,7,9,9,9,9,9,9,9,9,9,10,10,10,10,10,10,10,110,97,116,105,118,101,0,115,101,108,102,0,0,34,112,97,99,107,0,10,8,0,130,1,0,2,4,1,4,0,11,36,252,3,3,45,2,0,0,57,2,1,2,18,3,1,0,66,2,2,2,61,2,0,0,45,2,0,0,57,2,3,2,57,3,0,0,66,2,2,2,61,2,2,0,75,0,1,0,0,192,16,116,104,114,101,97,100,95,115,105,122,101,9,115,105,122,101,16,116,104,114,101,97,100,95,111,112,101,110,12,104,97,110,100,108,101,114,1,1,1,1,1,2,2,2,2,2,3,110,97,116,105,118,101,0,115,101,108,102,0,0,12,116,104,114,101,97,100,115,0,0,12,0,45,0,1,3,0,1,0,4,12,129,4,2,18,2,0,0,57,1,0,0,66,1,2,1,75,0,1,0,10,99,108,111,115,101,1,1,1,2,115,101,108,102,0,0,5,0,99,0,1,3,1,2,0,10,25,134,4,5,57,1,0,0,10,1,0,0,88,1,6,128,45,1,0,0,57,1,1,1,57,2,0,0,66,1,2,1,43,1,0,0,61,1,0,0,75,0,1,0,0,192,17,116,104,114,101,97,100,95,99,108,111,115,101,12,104,97,110,100,108,101,114,1,1,1,2,2,2,2,3,3,5,110,97,116,105,118,101,0,115,101,108,102,0,0,11,0,246,1,2,2,11,3,5,0,21,81,145,4,4,57,2,0,0,11,2,0,0,88,2,3,128,54,2,1,0,39,3,2,0,66,2,2,1,45,2,0,0,18,3,1,0,41,4,2,0,66,2,3,3,45,4,1,0,57,4,3,4,18,5,0,0,45,6,2,0,57,6,4,6,57,7,0,0,18,8,2,0,18,9,3,0,71,10,2,0,65,6,3,0,67,4,1,0,29,192,30,192,0,192,18,116,104,114,101,97,100,95,115,117,98,109,105,116,8,110,101,119,36,116,104,101,32,116,104,114,101,97,100,32,112,111,111,108,32,104,97,115,32,98,101,101,110,32,99,108,111,115,101,100,10,101,114,114,111,114,12,104,97,110,100,108,101,114,1,1,1,1,1,1,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,116,104,114,101,97,100,99,111,100,101,0,116,104,114,101,97,100,106,111,98,0,110,97,116,105,118,101,0,115,101,108,102,0,0,22,102,110,0,0,22,99,111,100,101,0,11,11,99,104,117,110,107,110,97,109,101,0,0,11,0,241,1,0,1,5,1,6,2,26,48,162,4,5,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,14,0,0,0,88,1,1,128,41,0,0,0,41,1,0,0,0,0,1,0,88,1,6,128,26,1,0,0,9,1,1,0,88,1,3,128,41,1,0,4,1,1,0,0,88,1,4,128,54,1,3,0,39,2,4,0,41,3,2,0,66,1,3,1,45,1,0,0,57,1,5,1,18,2,0,0,68,1,2,0,31,192,8,110,101,119,42,116,104,114,101,97,100,115,32,109,117,115,116,32,98,101,32,97,110,32,105,110,116,101,103,101,114,32,105,110,32,48,46,46,49,48,50,52,10,101,114,114,111,114,15,110,105,108,124,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,0,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,116,104,114,101,97,100,112,111,111,108,0,116,104,114,101,97,100,115,0,0,27,0,93,0,0,2,2,1,0,10,34,172,4,3,45,0,0,0,11,0,0,0,88,0,5,128,45,0,1,0,57,0,0,0,41,1,0,0,66,0,2,2,46,0,0,0,45,0,0,0,76,0,2,0,32,128,31,192,8,110,101,119,1,1,1,1,1,1,1,1,2,2,100,101,102,97,117,108,116,112,111,111,108,0,116,104,114,101,97,100,112,111,111,108,0,0,134,1,2,1,5,1,4,0,13,34,180,4,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,45,1,0,0,66,1,1,2,18,2,1,0,57,1,3,1,18,3,0,0,71,4,1,0,67,1,2,0,33,192,8,114,117,110,20,102,117,110,99,116,105,111,110,124,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,103,101,116,100,101,102,97,117,108,116,112,111,111,108,0,102,110,0,0,14,0,208,3,0,5,16,0,9,1,54,159,1,190,4,25,54,5,0,0,57,5,1,5,66,5,1,2,57,6,2,5,10,6,0,0,88,7,4,128,57,7,3,6,41,8,16,0,3,8,7,0,88,7,2,128,53,6,4,0,61,6,2,5,56,7,0,6,11,7,0,0,88,8,12,128,54,8,5,0,54,9,6,0,18,10,0,0,39,11,7,0,66,9,3,0,65,8,0,2,18,7,8,0,18,8,7,0,57,9,3,6,22,9,0,9,61,9,3,6,60,8,0,6,7,1,8,0,88,8,13,128,52,8,0,0,41,9,1,0,18,10,3,0,41,11,1,0,77,9,7,128,18,13,7,0,56,14,12,4,32,15,12,2,23,15,0,15,66,13,3,2,60,13,12,8,79,9,249,127,76,8,2,0,58,8,1,4,41,9,2,0,18,10,3,0,41,11,1,0,77,9,6,128,18,13,7,0,18,14,8,0,56,15,12,4,66,13,3,2,18,8,13,0,79,9,250,127,76,8,2,0,8,109,97,112,18,61,108,117,122,46,112,97,114,97,108,108,101,108,15,108,111,97,100,115,116,114,105,110,103,11,97,115,115,101,114,116,1,0,1,6,110,3,0,6,110,17,108,117,122,46,112,97,114,97,108,108,101,108,16,103,101,116,114,101,103,105,115,116,114,121,10,100,101,98,117,103,2,1,1,1,2,3,3,3,3,3,3,4,5,7,8,8,9,9,9,9,9,9,9,10,10,10,10,10,13,13,14,15,15,15,15,16,16,16,16,16,16,15,18,20,21,21,21,21,22,22,22,22,22,21,24,99,111,100,101,0,0,55,109,111,100,101,0,0,55,102,105,114,115,116,0,0,55,99,111,117,110,116,0,0,55,105,116,101,109,115,0,0,55,114,101,103,105,115,116,114,121,0,4,51,99,97,99,104,101,0,1,50,102,110,0,9,41,114,101,115,117,108,116,115,0,17,12,1,3,8,2,0,8,3,0,8,105,0,1,6,97,99,99,0,9,11,1,3,7,2,0,7,3,0,7,105,0,1,5,0,202,5,0,5,24,4,12,3,87,254,1,222,4,18,14,0,3,0,88,5,1,128,52,3,0,0,57,5,0,3,14,0,5,0,88,6,2,128,45,5,0,0,66,5,1,2,45,6,1,0,18,7,1,0,22,8,0,4,66,6,3,2,57,7,1,3,14,0,7,0,88,8,11,128,54,7,2,0,57,7,3,7,41,8,1,0,54,9,2,0,57,9,4,9,21,10,2,0,57,11,5,5,24,11,1,11,35,10,11,10,66,9,2,0,65,7,1,2,54,8,6,0,18,9,7,0,66,8,2,2,7,8,7,0,88,8,6,128,41,8,1,0,0,7,8,0,88,8,3,128,26,8,0,7,8,8,2,0,88,8,4,128,54,8,8,0,39,9,9,0,22,10,0,4,66,8,3,1,45,8,2,0,14,0,8,0,88,9,4,128,45,8,1,0,45,9,3,0,22,10,0,4,66,8,3,2,46,2,8,0,52,8,0,0,41,9,1,0,21,10,2,0,18,11,7,0,77,9,30,128,54,13,2,0,57,13,10,13,18,14,7,0,21,15,2,0,33,15,12,15,22,15,0,15,66,13,3,2,52,14,0,0,41,15,1,0,18,16,13,0,41,17,1,0,77,15,5,128,32,19,18,12,23,19,0,19,56,19,19,2,60,19,18,14,79,15,251,127,21,15,8,0,22,15,0,15,18,17,5,0,57,16,11,5,45,18,2,0,18,19,6,0,18,20,0,0,18,21,12,0,18,22,13,0,18,23,14,0,66,16,8,2,60,16,15,8,79,9,226,127,18,9,8,0,18,10,7,0,74,9,3,0,33,192,28,192,35,128,34,192,8,114,117,110,8,109,105,110,37,99,104,117,110,107,32,109,117,115,116,32,98,101,32,97,32,112,111,115,105,116,105,118,101,32,105,110,116,101,103,101,114,10,101,114,114,111,114,11,110,117,109,98,101,114,9,116,121,112,101,9,115,105,122,101,9,99,101,105,108,8,109,97,120,9,109,97,116,104,10,99,104,117,110,107,9,112,111,111,108,2,16,0,1,1,1,2,2,2,2,2,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,9,10,10,10,10,11,11,11,11,11,11,11,11,12,12,12,12,13,13,13,13,12,15,15,15,15,15,15,15,15,15,15,15,15,10,17,17,17,103,101,116,100,101,102,97,117,108,116,112,111,111,108,0,100,117,109,112,102,117,110,99,116,105,111,110,0,112,97,114,97,108,108,101,108,99,111,100,101,0,112,97,114,97,108,108,101,108,99,104,117,110,107,0,109,111,100,101,0,0,88,102,110,0,0,88,108,105,115,116,0,0,88,111,112,116,105,111,110,115,0,0,88,108,101,118,101,108,0,0,88,112,111,111,108,0,9,79,99,111,100,101,0,4,75,115,105,122,101,0,14,61,106,111,98,115,0,24,37,1,3,31,2,0,31,3,0,31,102,105,114,115,116,0,1,29,99,111,117,110,116,0,8,21,105,116,101,109,115,0,0,21,1,3,6,2,0,6,3,0,6,105,0,1,4,0,147,3,0,3,19,1,10,1,43,151,1,250,4,11,54,3,0,0,57,3,1,3,41,4,3,0,18,5,0,0,39,6,2,0,18,7,1,0,39,8,3,0,18,9,2,0,39,10,4,0,66,3,8,1,45,3,0,0,39,4,5,0,18,5,0,0,18,6,1,0,18,7,2,0,41,8,2,0,66,3,6,3,52,5,0,0,54,6,6,0,18,7,3,0,66,6,2,4,88,9,18,128,18,12,10,0,57,11,7,10,66,11,2,2,23,12,0,9,34,12,4,12,41,13,1,0,54,14,8,0,57,14,9,14,18,15,4,0,21,16,1,0,33,16,12,16,66,14,3,2,41,15,1,0,77,13,4,128,32,17,16,12,56,18,16,11,60,18,17,5,79,13,252,127,69,9,3,3,82,9,236,127,76,5,2,0,36,192,8,109,105,110,9,109,97,116,104,9,106,111,105,110,11,105,112,97,105,114,115,8,109,97,112,14,110,105,108,124,116,97,98,108,101,10,116,97,98,108,101,13,102,117,110,99,116,105,111,110,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,3,4,4,4,4,5,5,5,5,5,6,6,6,6,6,6,6,6,6,7,7,7,6,4,4,10,112,97,114,97,108,108,101,108,114,117,110,0,102,110,0,0,44,108,105,115,116,0,0,44,111,112,116,105,111,110,115,0,0,44,106,111,98,115,0,18,26,115,105,122,101,0,0,26,114,101,115,117,108,116,115,0,1,25,4,3,21,5,0,21,6,0,21,107,0,1,18,106,111,98,0,0,18,99,104,117,110,107,0,5,13,111,102,102,115,101,116,0,0,13,1,8,5,2,0,5,3,0,5,105,0,1,3,0,213,2,0,4,14,1,9,0,38,113,144,5,8,54,4,0,0,57,4,1,4,41,5,4,0,18,6,0,0,39,7,2,0,18,8,1,0,39,9,3,0,18,10,2,0,39,11,4,0,18,12,3,0,39,13,5,0,66,4,10,1,18,4,2,0,54,5,6,0,45,6,0,0,39,7,7,0,18,8,0,0,18,9,1,0,18,10,3,0,41,11,2,0,66,6,6,0,65,5,0,4,88,8,12,128,18,11,9,0,57,10,8,9,66,10,2,2,11,4,0,0,88,11,2,128,18,4,10,0,88,11,5,128,18,11,0,0,18,12,4,0,18,13,10,0,66,11,3,2,18,4,11,0,69,8,3,3,82,8,242,127,76,4,2,0,36,192,9,106,111,105,110,11,114,101,100,117,99,101,11,105,112,97,105,114,115,14,110,105,108,124,116,97,98,108,101,8,97,110,121,10,116,97,98,108,101,13,102,117,110,99,116,105,111,110,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,1,1,1,1,2,3,3,3,3,3,3,3,3,3,3,4,4,4,5,5,5,5,5,5,5,5,5,3,3,7,112,97,114,97,108,108,101,108,114,117,110,0,102,110,0,0,39,108,105,115,116,0,0,39,105,110,105,116,0,0,39,111,112,116,105,111,110,115,0,0,39,97,99,99,0,14,25,4,9,15,5,0,15,6,0,15,95,0,1,12,106,111,98,0,0,12,118,97,108,117,101,0,3,9,0,47,0,2,2,0,1,0,2,20,159,5,2,61,1,0,0,75,0,1,0,12,104,97,110,100,108,101,114,1,2,115,101,108,102,0,0,3,104,97,110,100,108,101,114,0,0,3,0,77,0,1,3,1,2,0,5,20,163,5,2,45,1,0,0,57,1,0,1,57,2,1,0,66,1,2,1,75,0,1,0,0,192,12,104,97,110,100,108,101,114,20,99,104,97,110,110,101,108,95,114,101,108,101,97,115,101,1,1,1,1,2,110,97,116,105,118,101,0,115,101,108,102,0,0,6,0,94,0,1,3,1,3,0,7,22,168,5,3,45,1,0,0,57,1,0,1,57,2,1,0,66,1,2,1,39,1,2,0,57,2,1,0,74,1,3,0,0,192,12,99,104,97,110,110,101,108,12,104,97,110,100,108,101,114,19,99,104,97,110,110,101,108,95,114,101,116,97,105,110,1,1,1,1,2,2,2,110,97,116,105,118,101,0,115,101,108,102,0,0,8,0,156,4,0,3,10,1,12,1,69,136,1,178,5,15,14,0,2,0,88,3,1,128,41,2,255,255,8,2,0,0,88,3,6,128,54,3,0,0,57,3,1,3,57,3,2,3,66,3,1,2,11,3,0,0,88,3,6,128,45,3,0,0,57,3,3,3,57,4,4,0,18,5,2,0,18,6,1,0,68,3,4,0,45,3,0,0,57,3,5,3,18,4,1,0,66,3,2,3,41,5,0,0,1,5,2,0,88,5,6,128,54,5,6,0,57,5,7,5,66,5,1,2,32,5,2,5,14,0,5,0,88,6,1,128,43,5,0,0,45,6,0,0,57,6,8,6,57,7,4,0,41,8,0,0,18,9,3,0,66,6,4,2,14,0,6,0,88,6,28,128,85,6,27,128,45,6,0,0,57,6,9,6,57,7,4,0,66,6,2,2,14,0,6,0,88,7,7,128,15,0,5,0,88,6,13,128,54,6,6,0,57,6,7,6,66,6,1,2,3,5,6,0,88,6,8,128,15,0,4,0,88,6,4,128,54,6,0,0,57,6,10,6,18,7,3,0,66,6,2,1,43,6,1,0,76,6,2,0,54,6,0,0,57,6,1,6,57,6,11,6,41,7,1,0,66,6,2,1,88,6,220,127,43,6,2,0,76,6,2,0,0,192,10,115,108,101,101,112,16,100,101,115,101,114,105,97,108,105,122,101,22,99,104,97,110,110,101,108,95,105,115,95,99,108,111,115,101,100,17,99,104,97,110,110,101,108,95,115,101,110,100,12,115,121,115,116,105,109,101,7,111,115,19,99,104,97,110,110,101,108,95,101,110,99,111,100,101,12,104,97,110,100,108,101,114,17,99,104,97,110,110,101,108,95,112,117,115,104,12,99,117,114,114,101,110,116,9,108,111,111,112,8,108,117,122,0,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,5,5,5,5,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,8,8,8,8,8,8,8,8,8,8,8,8,8,9,9,9,9,9,9,10,10,12,12,12,12,12,12,14,14,110,97,116,105,118,101,0,115,101,108,102,0,0,70,118,97,108,117,101,0,0,70,116,105,109,101,111,117,116,0,0,70,109,101,115,115,97,103,101,0,22,48,104,97,115,79,98,106,101,99,116,115,0,0,48,100,101,97,100,108,105,110,101,0,10,38,0,87,0,2,6,1,2,0,6,29,197,5,2,45,2,0,0,57,2,0,2,57,3,1,0,41,4,0,0,18,5,1,0,68,2,4,0,0,192,12,104,97,110,100,108,101,114,17,99,104,97,110,110,101,108,95,112,117,115,104,1,1,1,1,1,1,110,97,116,105,118,101,0,115,101,108,102,0,0,7,118,97,108,117,101,0,0,7,0,158,3,0,2,7,1,9,1,55,108,205,5,11,14,0,1,0,88,2,1,128,41,1,255,255,8,1,0,0,88,2,6,128,54,2,0,0,57,2,1,2,57,2,2,2,66,2,1,2,11,2,0,0,88,2,5,128,45,2,0,0,57,2,3,2,57,3,4,0,18,4,1,0,68,2,3,0,41,2,0,0,1,2,1,0,88,2,6,128,54,2,5,0,57,2,6,2,66,2,1,2,32,2,1,2,14,0,2,0,88,3,1,128,43,2,0,0,85,3,27,128,45,3,0,0,57,3,7,3,57,4,4,0,66,3,2,2,45,4,0,0,57,4,3,4,57,5,4,0,41,6,0,0,66,4,3,2,11,4,0,0,88,5,9,128,14,0,3,0,88,5,7,128,15,0,2,0,88,5,6,128,54,5,5,0,57,5,6,5,66,5,1,2,3,2,5,0,88,5,1,128,76,4,2,0,54,5,0,0,57,5,1,5,57,5,8,5,41,6,1,0,66,5,2,1,88,3,228,127,75,0,1,0,0,192,10,115,108,101,101,112,22,99,104,97,110,110,101,108,95,105,115,95,99,108,111,115,101,100,12,115,121,115,116,105,109,101,7,111,115,12,104,97,110,100,108,101,114,16,99,104,97,110,110,101,108,95,112,111,112,12,99,117,114,114,101,110,116,9,108,111,111,112,8,108,117,122,0,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,4,4,4,4,4,4,4,4,4,4,5,6,6,6,6,7,7,7,7,7,8,8,8,8,8,8,8,8,8,8,8,8,9,9,9,9,9,9,11,110,97,116,105,118,101,0,115,101,108,102,0,0,56,116,105,109,101,111,117,116,0,0,56,100,101,97,100,108,105,110,101,0,27,29,99,108,111,115,101,100,0,5,22,118,97,108,117,101,0,5,17,0,73,0,1,4,1,2,0,5,20,220,5,2,45,1,0,0,57,1,0,1,57,2,1,0,41,3,0,0,68,1,3,0,0,192,12,104,97,110,100,108,101,114,16,99,104,97,110,110,101,108,95,112,111,112,1,1,1,1,1,110,97,116,105,118,101,0,115,101,108,102,0,0,6,0,43,0,0,2,1,1,0,4,10,227,5,2,45,0,0,0,18,1,0,0,57,0,0,0,68,0,2,0,0,192,8,112,111,112,1,1,1,1,115,101,108,102,0,0,35,1,1,2,0,1,0,3,11,226,5,4,51,1,0,0,50,0,0,128,76,1,2,0,0,3,3,3,115,101,108,102,0,0,4,0,75,0,1,3,1,2,0,5,20,233,5,2,45,1,0,0,57,1,0,1,57,2,1,0,66,1,2,1,75,0,1,0,0,192,12,104,97,110,100,108,101,114,18,99,104,97,110,110,101,108,95,99,108,111,115,101,1,1,1,1,2,110,97,116,105,118,101,0,115,101,108,102,0,0,6,0,74,0,1,3,1,2,0,4,19,239,5,2,45,1,0,0,57,1,0,1,57,2,1,0,68,1,2,0,0,192,12,104,97,110,100,108,101,114,22,99,104,97,110,110,101,108,95,105,115,95,99,108,111,115,101,100,1,1,1,1,110,97,116,105,118,101,0,115,101,108,102,0,0,5,0,69,0,1,3,1,2,0,4,19,245,5,2,45,1,0,0,57,1,0,1,57,2,1,0,68,1,2,0,0,192,12,104,97,110,100,108,101,114,17,99,104,97,110,110,101,108,95,115,105,122,101,1,1,1,1,110,97,116,105,118,101,0,115,101,108,102,0,0,5,0,56,0,1,3,1,1,0,4,23,250,5,2,45,1,0,0,57,1,0,1,18,2,0,0,68,1,2,0,37,192,8,110,101,119,1,1,1,1,99,104,97,110,110,101,108,0,104,97,110,100,108,101,114,0,0,5,0,199,2,0,2,8,2,9,3,33,70,137,6,4,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,41,2,1,0,0,0,2,0,88,2,6,128,42,2,0,0,0,2,0,0,88,2,3,128,26,2,1,0,8,2,2,0,88,2,6,128,54,2,4,0,39,3,5,0,18,4,0,0,38,3,4,3,41,4,2,0,66,2,3,1,45,2,0,0,57,2,6,2,45,3,1,0,57,3,7,3,18,4,0,0,13,5,1,0,88,5,1,128,57,5,8,1,66,3,3,0,67,2,0,0,37,192,0,192,9,115,112,115,99,17,99,104,97,110,110,101,108,95,111,112,101,110,8,110,101,119,48,99,97,112,97,99,105,116,121,32,109,117,115,116,32,98,101,32,116,104,101,32,105,110,116,101,103,101,114,32,105,110,32,49,32,46,46,32,50,94,50,52,58,32,10,101,114,114,111,114,14,110,105,108,124,116,97,98,108,101,11,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,128,128,128,16,2,0,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,99,104,97,110,110,101,108,0,110,97,116,105,118,101,0,99,97,112,97,99,105,116,121,0,0,34,111,112,116,105,111,110,115,0,0,34,0,244,20,3,0,40,0,115,0,197,1,162,7,0,164,6,54,0,0,0,14,0,0,0,88,1,1,128,52,0,0,0,55,0,0,0,54,0,0,0,57,0,1,0,54,1,0,0,43,2,0,0,61,2,1,1,54,1,2,0,57,1,3,1,39,2,4,0,66,1,2,1,54,1,0,0,52,2,0,0,61,2,5,1,44,1,3,0,52,4,0,0,54,5,6,0,52,6,0,0,53,7,7,0,66,5,3,2,52,6,0,0,43,7,1,0,43,8,1,0,52,9,0,0,53,10,8,0,51,11,9,0,51,12,10,0,51,13,11,0,51,14,12,0,51,15,13,0,51,16,14,0,51,17,15,0,51,18,16,0,54,19,0,0,57,19,5,19,51,20,18,0,61,20,17,19,54,19,0,0,57,19,5,19,51,20,20,0,61,20,19,19,54,19,0,0,57,19,5,19,51,20,22,0,61,20,21,19,54,19,23,0,53,20,25,0,51,21,24,0,61,21,26,20,51,21,27,0,61,21,28,20,66,19,2,2,54,20,0,0,57,20,5,20,51,21,30,0,61,21,29,20,54,20,0,0,57,20,5,20,51,21,32,0,61,21,31,20,54,20,0,0,57,20,5,20,51,21,33,0,61,21,28,20,54,20,0,0,57,20,5,20,51,21,35,0,61,21,34,20,54,20,2,0,57,20,36,20,39,21,37,0,66,20,2,2,54,21,2,0,57,21,36,21,39,22,38,0,66,21,2,2,51,22,39,0,51,23,40,0,54,24,0,0,57,24,5,24,51,25,42,0,61,25,41,24,54,24,0,0,57,24,5,24,51,25,44,0,61,25,43,24,54,24,0,0,57,24,5,24,51,25,46,0,61,25,45,24,52,24,0,0,43,25,1,0,51,26,47,0,54,27,48,0,57,27,49,27,51,28,51,0,61,28,50,27,52,27,0,0,54,28,52,0,57,28,53,28,66,28,1,2,53,29,56,0,51,30,55,0,61,30,57,29,51,30,58,0,61,30,59,29,51,30,60,0,61,30,61,29,61,29,54,28,54,28,0,0,52,29,0,0,61,29,62,28,51,28,63,0,51,29,64,0,54,30,23,0,53,31,66,0,51,32,65,0,61,32,26,31,51,32,67,0,61,32,68,31,51,32,69,0,61,32,70,31,51,32,71,0,61,32,72,31,51,32,73,0,61,32,74,31,66,30,2,2,54,31,23,0,53,32,76,0,51,33,75,0,61,33,26,32,51,33,77,0,61,33,68,32,51,33,78,0,61,33,79,32,51,33,80,0,61,33,34,32,66,31,2,2,54,32,0,0,57,32,62,32,51,33,82,0,61,33,81,32,43,32,0,0,51,33,83,0,54,34,0,0,57,34,62,34,51,35,84,0,61,35,34,34,54,34,0,0,52,35,0,0,61,35,85,34,51,34,86,0,43,35,0,0,51,36,87,0,54,37,0,0,57,37,85,37,51,38,89,0,61,38,88,37,54,37,0,0,57,37,85,37,51,38,91,0,61,38,90,37,54,37,23,0,53,38,93,0,51,39,92,0,61,39,26,38,51,39,94,0,61,39,68,38,51,39,95,0,61,39,96,38,51,39,97,0,61,39,98,38,51,39,99,0,61,39,100,38,51,39,101,0,61,39,102,38,51,39,103,0,61,39,104,38,51,39,105,0,61,39,106,38,51,39,107,0,61,39,79,38,51,39,108,0,61,39,109,38,51,39,110,0,61,39,111,38,66,37,2,2,51,38,113,0,61,38,112,27,54,38,0,0,51,39,114,0,61,39,112,38,50,0,0,128,75,0,1,0,0,0,12,99,104,97,110,110,101,108,9,115,105,122,101,0,11,99,108,111,115,101,100,0,0,11,118,97,108,117,101,115,0,12,116,114,121,95,112,111,112,0,8,112,111,112,0,13,116,114,121,95,112,117,115,104,0,9,112,117,115,104,0,11,95,95,112,97,99,107,0,0,1,0,0,0,0,11,114,101,100,117,99,101,0,8,109,97,112,0,0,13,112,97,114,97,108,108,101,108,0,0,0,9,112,111,111,108,0,10,99,108,111,115,101,0,0,1,0,0,0,9,106,111,105,110,0,9,100,111,110,101,0,9,119,97,105,116,0,15,100,101,115,116,114,117,99,116,111,114,0,1,0,0,0,0,0,11,116,104,114,101,97,100,11,117,110,112,97,99,107,0,11,100,101,99,111,100,101,0,11,101,110,99,111,100,101,1,0,0,0,14,108,117,122,46,99,111,100,101,99,16,103,101,116,114,101,103,105,115,116,114,121,10,100,101,98,117,103,0,10,121,105,101,108,100,10,97,115,121,110,99,7,102,115,0,0,15,119,97,116,99,104,95,110,101,120,116,0,13,114,101,97,100,108,105,110,101,0,17,119,97,105,116,95,112,114,111,99,101,115,115,0,0,12,98,111,111,108,91,52,93,11,105,110,116,91,52,93,8,110,101,119,0,8,114,117,110,0,0,10,115,112,97,119,110,0,10,116,105,109,101,114,9,115,116,111,112,0,16,99,111,110,115,116,114,117,99,116,111,114,1,0,0,0,10,99,108,97,115,115,0,12,119,97,105,116,95,102,100,0,10,115,108,101,101,112,0,12,99,117,114,114,101,110,116,0,0,0,0,0,0,0,0,1,0,3,6,119,3,2,7,114,119,3,3,6,114,3,1,1,0,1,11,95,95,109,111,100,101,6,107,17,115,101,116,109,101,116,97,116,97,98,108,101,9,108,111,111,112,250,3,116,121,112,101,100,101,102,32,115,116,114,117,99,116,32,123,10,32,32,32,32,117,110,115,105,103,110,101,100,32,105,110,116,32,105,100,59,10,32,32,32,32,105,110,116,32,114,101,115,117,108,116,59,10,125,32,108,111,111,112,95,101,118,101,110,116,95,116,59,10,10,115,116,114,117,99,116,32,108,111,111,112,95,116,32,42,108,111,111,112,95,111,112,101,110,40,41,59,10,118,111,105,100,32,108,111,111,112,95,99,108,111,115,101,40,115,116,114,117,99,116,32,108,111,111,112,95,116,32,42,115,101,108,102,41,59,10,117,110,115,105,103,110,101,100,32,105,110,116,32,108,111,111,112,95,116,105,109,101,114,40,115,116,114,117,99,116,32,108,111,111,112,95,116,32,42,115,101,108,102,44,32,100,111,117,98,108,101,32,109,115,101,99,41,59,10,117,110,115,105,103,110,101,100,32,105,110,116,32,108,111,111,112,95,119,97,116,99,104,40,115,116,114,117,99,116,32,108,111,111,112,95,116,32,42,115,101,108,102,44,32,105,110,116,32,102,100,44,32,105,110,116,32,101,118,101,110,116,115,44,32,100,111,117,98,108,101,32,116,105,109,101,111,117,116,41,59,10,118,111,105,100,32,108,111,111,112,95,99,97,110,99,101,108,40,115,116,114,117,99,116,32,108,111,111,112,95,116,32,42,115,101,108,102,44,32,117,110,115,105,103,110,101,100,32,105,110,116,32,105,100,41,59,10,115,105,122,101,95,116,32,108,111,111,112,95,112,101,110,100,105,110,103,40,115,116,114,117,99,116,32,108,111,111,112,95,116,32,42,115,101,108,102,41,59,10,115,105,122,101,95,116,32,108,111,111,112,95,119,97,105,116,40,115,116,114,117,99,116,32,108,111,111,112,95,116,32,42,115,101,108,102,44,32,105,110,116,32,116,105,109,101,111,117,116,44,32,108,111,111,112,95,101,118,101,110,116,95,116,32,42,101,118,101,110,116,115,44,32,115,105,122,101,95,116,32,99,97,112,97,99,105,116,121,41,59,10,105,110,116,32,108,111,111,112,95,102,100,40,115,116,114,117,99,116,32,108,111,111,112,95,116,32,42,115,101,108,102,41,59,10,9,99,100,101,102,8,102,102,105,13,95,95,110,97,116,105,118,101,8,108,117,122,2,0,2,0,2,0,2,0,2,0,5,0,5,0,6,0,6,0,6,0,8,0,8,0,22,0,22,0,25,0,25,0,25,0,28,0,33,0,36,0,36,0,36,0,36,0,37,0,38,0,39,0,42,0,45,0,59,0,66,0,75,0,82,0,92,0,111,0,118,0,133,0,137,0,137,0,139,0,137,0,143,0,143,0,147,0,143,0,156,0,156,0,167,0,156,0,170,0,170,0,188,0,188,0,197,0,197,0,170,0,206,0,206,0,209,0,206,0,214,0,214,0,219,0,214,0,222,0,222,0,224,0,222,0,236,0,236,0,10,1,236,0,15,1,15,1,15,1,15,1,16,1,16,1,16,1,16,1,33,1,39,1,45,1,45,1,57,1,45,1,63,1,63,1,73,1,63,1,79,1,79,1,97,1,79,1,100,1,101,1,125,1,128,1,128,1,134,1,134,1,139,1,143,1,143,1,143,1,143,1,154,1,154,1,162,1,162,1,168,1,168,1,169,1,179,1,179,1,179,1,191,1,197,1,200,1,200,1,204,1,204,1,208,1,208,1,225,1,225,1,231,1,231,1,247,1,247,1,200,1,251,1,251,1,255,1,255,1,3,2,3,2,11,2,11,2,21,2,21,2,251,1,34,2,34,2,39,2,34,2,42,2,47,2,52,2,52,2,55,2,52,2,58,2,58,2,58,2,87,2,90,2,112,2,122,2,122,2,133,2,122,2,144,2,144,2,152,2,144,2,157,2,157,2,161,2,161,2,165,2,165,2,171,2,171,2,193,2,193,2,199,2,199,2,216,2,216,2,222,2,222,2,230,2,230,2,235,2,235,2,241,2,241,2,247,2,247,2,157,2,252,2,252,2,9,3,13,3,9,3,13,3,13,3,110,97,116,105,118,101,0,8,190,1,108,111,111,112,101,110,103,105,110,101,0,11,179,1,108,111,111,112,101,118,101,110,116,115,0,0,179,1,108,111,111,112,103,117,97,114,100,0,0,179,1,108,111,111,112,119,97,105,116,105,110,103,0,1,178,1,108,111,111,112,109,97,110,97,103,101,100,0,4,174,1,108,111,111,112,114,101,97,100,121,0,1,173,1,108,111,111,112,114,117,110,110,105,110,103,0,1,172,1,108,111,111,112,115,116,111,112,112,101,100,0,1,171,1,108,111,111,112,115,105,103,110,97,108,0,1,170,1,108,111,111,112,109,111,100,101,115,0,1,169,1,108,111,111,112,111,112,101,110,0,1,168,1,108,111,111,112,99,117,114,114,101,110,116,0,1,167,1,108,111,111,112,114,101,115,117,109,101,0,1,166,1,108,111,111,112,114,101,103,105,115,116,101,114,0,1,165,1,108,111,111,112,117,110,114,101,103,105,115,116,101,114,0,1,164,1,108,111,111,112,100,105,115,112,97,116,99,104,0,1,163,1,108,111,111,112,97,119,97,105,116,0,1,162,1,108,111,111,112,119,97,105,116,102,100,115,0,1,161,1,108,111,111,112,116,105,109,101,114,0,19,142,1,112,114,111,99,101,115,115,102,100,115,0,20,122,112,114,111,99,101,115,115,119,114,105,116,97,98,108,101,0,4,118,112,114,111,99,101,115,115,119,97,105,116,0,1,117,114,101,109,97,105,110,105,110,103,0,1,116,97,115,121,110,99,119,97,105,116,101,114,115,0,13,103,97,115,121,110,99,119,97,116,99,104,105,110,103,0,1,102,97,115,121,110,99,119,97,116,99,104,0,1,101,117,110,112,97,99,107,101,114,115,0,5,96,100,117,109,112,102,117,110,99,116,105,111,110,0,15,81,116,104,114,101,97,100,99,111,100,101,0,1,80,116,104,114,101,97,100,106,111,98,0,13,67,116,104,114,101,97,100,112,111,111,108,0,11,56,100,101,102,97,117,108,116,112,111,111,108,0,5,51,103,101,116,100,101,102,97,117,108,116,112,111,111,108,0,1,50,112,97,114,97,108,108,101,108,99,104,117,110,107,0,8,42,112,97,114,97,108,108,101,108,99,111,100,101,0,1,41,112,97,114,97,108,108,101,108,114,117,110,0,1,40,99,104,97,110,110,101,108,0,33,7,0,0,
\ No newline at end of file
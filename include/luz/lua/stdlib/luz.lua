@@ -0,0 +1,803 @@
+--- luz library ---
+luz = luz or {}
+
+-- @private native functions (Lua C API) registered by lua_registlib
+local native = luz.__native
+luz.__native = nil
+
+ffi.cdef[[
+typedef struct {
+    unsigned int id;
+    int result;
+} loop_event_t;
+
+struct loop_t *loop_open();
+void loop_close(struct loop_t *self);
+unsigned int loop_timer(struct loop_t *self, double msec);
+unsigned int loop_watch(struct loop_t *self, int fd, int events, double timeout);
+void loop_cancel(struct loop_t *self, unsigned int id);
+size_t loop_pending(struct loop_t *self);
+size_t loop_wait(struct loop_t *self, int timeout, loop_event_t *events, size_t capacity);
+int loop_fd(struct loop_t *self);
+]]
+
+--- event loop ---
+luz.loop = {}
+
+-- @private loop opened at the first wait (closed when the Lua state is closed)
+local loopengine = nil
+local loopevents = nil
+local loopguard = nil
+
+-- @private wait id => {co: coroutine to be resumed | fn: function to be called, ids: wait ids completed together}
+local loopwaiting = {}
+
+-- @private coroutines scheduled by luz.loop.run / luz.loop.spawn
+local loopmanaged = setmetatable({}, {__mode = "k"})
+local loopready = {} -- {coroutine, count of args, args...} to be resumed
+local looprunning = false
+local loopstopped = false
+
+-- @private value yielded by coroutines waiting in the loop
+local loopsignal = {}
+
+-- @private "r" | "w" | "rw" => LOOP_READ | LOOP_WRITE
+local loopmodes = {r = 1, w = 2, rw = 3}
+
+local function loopopen()
+    if loopengine == nil then
+        loopengine = ffi.C.loop_open()
+        if loopengine == nil then error"failed to open the event loop" end
+        loopevents = ffi.new("loop_event_t[64]")
+        loopguard = newproxy(true)
+        getmetatable(loopguard).__gc = function ()
+            ffi.C.loop_close(loopengine)
+            loopengine = nil
+        end
+    end
+    return loopengine
+end
+
+-- @private get the running coroutine if it's scheduled by luz.loop
+local function loopcurrent()
+    local co = coroutine.running()
+    if co and loopmanaged[co] then return co end
+    return nil
+end
+
+-- @private resume the coroutine, and reschedule it if it yields without waiting in the loop
+local function loopresume(co, ...)
+    local ok, ret = coroutine.resume(co, ...)
+    if not ok then error(debug.traceback(co, ret), 0) end
+    if coroutine.status(co) == "suspended" and ret ~= loopsignal then
+        loopready[#loopready + 1] = {co, 0}
+    end
+end
+
+-- @private register the waiter for the wait ids (any of them completes the waiter)
+local function loopregister(waiter)
+    for _, id in ipairs(waiter.ids) do
+        loopwaiting[id] = waiter
+    end
+end
+
+-- @private cancel the waits of the waiter
+local function loopunregister(waiter)
+    for _, id in ipairs(waiter.ids) do
+        if loopwaiting[id] == waiter then
+            loopwaiting[id] = nil
+            ffi.C.loop_cancel(loopengine, id)
+        end
+    end
+end
+
+-- @private wait for the completed waits, and schedule the coroutines waiting for them
+-- @param {number} timeout: milliseconds (-1: infinite, 0: no wait)
+local function loopdispatch(timeout)
+    local n = tonumber(ffi.C.loop_wait(loopengine, timeout, loopevents, 64))
+    for i = 0, n - 1 do
+        local id, result = loopevents[i].id, loopevents[i].result
+        local waiter = loopwaiting[id]
+        if waiter then
+            loopwaiting[id] = nil
+            loopunregister(waiter)
+            if waiter.fn then
+                waiter.fn(result)
+            else
+                loopready[#loopready + 1] = {waiter.co, 1, result}
+            end
+        end
+    end
+end
+
+-- @private yield the coroutine until any of the waits is completed
+-- @returns {number} LOOP_* flags of the descriptor (0: timer expired / timed out)
+local function loopawait(co, ids)
+    loopregister({co = co, ids = ids})
+    return coroutine.yield(loopsignal)
+end
+
+-- @private wait for the readiness of the descriptors
+-- @returns {number|nil, string} LOOP_* flags (0: timed out); nil and error message if any descriptor cannot be waited for
+local function loopwaitfds(co, fds, events, timeout)
+    local ids = {}
+    for i, fd in ipairs(fds) do
+        local id = ffi.C.loop_watch(loopopen(), fd, events[i], timeout)
+        if id == 0 then
+            for _, other in ipairs(ids) do ffi.C.loop_cancel(loopengine, other) end
+            return nil, ffi.string(ffi.C.strerror(ffi.errno()))
+        end
+        ids[i] = id
+    end
+    return loopawait(co, ids)
+end
+
+-- Get the running coroutine if it's scheduled by luz.loop
+-- @returns {thread|nil}
+function luz.loop.current()
+    return loopcurrent()
+end
+
+-- Sleep [milli seconds]
+-- * yields if called in the coroutine scheduled by luz.loop.run / luz.loop.spawn, otherwise blocks
+function luz.loop.sleep(msec)
+    local co = loopcurrent()
+    if co == nil then return os.sleep(msec) end
+    loopawait(co, {ffi.C.loop_timer(loopopen(), msec)})
+end
+
+-- Wait for the descriptor to be readable / writable
+-- * must be called in the coroutine scheduled by luz.loop (epoll on Linux; not supported on the other platforms)
+-- e.g. `luz.loop.wait_fd(watcher.fd, "r")`
+-- @param {number|number[]} fd: descriptor(s) to wait for (any of them)
+-- @param {string} mode: "r" (default) | "w" | "rw"
+-- @param {number} timeout: milliseconds (default: -1 => infinite)
+-- @returns {boolean|nil, string} true if ready, false if timed out; nil and error message if it cannot be waited for
+function luz.loop.wait_fd(fd, mode, timeout)
+    local co = loopcurrent()
+    if co == nil then error"luz.loop.wait_fd: called out of the coroutine of luz.loop" end
+
+    local fds, events = type(fd) == "table" and fd or {fd}, {}
+    for i = 1, #fds do
+        events[i] = loopmodes[mode or "r"] or error("invalid mode: " .. mode)
+    end
+    local result, message = loopwaitfds(co, fds, events, timeout or -1)
+    if result == nil then return nil, message end
+    return result ~= 0
+end
+
+-- @private repeating timer
+local looptimer = class {
+    constructor = function (self, interval, fn)
+        self.interval, self.fn = interval, fn
+        self.waiter = nil
+        self.stopped = false
+        self.co = luz.loop.spawn(function ()
+            local deadline = os.systime()
+            while not self.stopped do
+                -- fixed rate: the time spent in fn is not accumulated, and the missed ticks are not replayed
+                deadline = math.max(deadline + self.interval, os.systime())
+                self.waiter = {co = self.co, ids = {ffi.C.loop_timer(loopopen(), deadline - os.systime())}}
+                loopregister(self.waiter)
+                coroutine.yield(loopsignal)
+                self.waiter = nil
+                if self.stopped or self.fn(self) == false then break end
+            end
+            self.stopped = true
+        end)
+    end,
+
+    -- Stop the timer (the pending tick is cancelled)
+    stop = function (self)
+        self.stopped = true
+        if self.waiter then
+            loopunregister(self.waiter)
+            self.waiter = nil
+        end
+    end,
+}
+
+-- Call the function repeatedly in the loop
+-- * fn is called in the coroutine of the timer, so it can wait (the ticks missed while waiting are skipped)
+-- e.g. `local t = luz.loop.timer(100, function () print"tick" end); ...; t:stop()`
+-- @param {number} interval: milliseconds
+-- @param {function(timer)->boolean|nil} fn: return false to stop the timer
+-- @returns {looptimer} timer: call timer:stop() to stop it
+function luz.loop.timer(interval, fn)
+    debug.checkarg(2, interval, "number", fn, "function")
+    return looptimer.new(interval, fn)
+end
+
+-- Schedule the function as a coroutine resumed by luz.loop.run
+-- * luz.loop.* functions called in the coroutine yield until the wait is completed
+-- @returns {thread}
+function luz.loop.spawn(fn, ...)
+    local co = coroutine.create(fn)
+    loopmanaged[co] = true
+    loopready[#loopready + 1] = {co, select("#", ...), ...}
+    return co
+end
+
+-- Stop luz.loop.run after the current iteration (the pending waits are resumed by the next run)
+function luz.loop.stop()
+    loopstopped = true
+end
+
+-- Run the scheduled coroutines until all of them are finished (or luz.loop.stop is called)
+-- * one thread waits for thousands of timers / descriptors / processes / fs.async requests at once
+-- e.g.
+--     luz.loop.run(function ()
+--         for i = 1, 1000 do
+--             luz.loop.spawn(function () luz.loop.sleep(i); done = done + 1 end)
+--         end
+--     end)
+-- @param {function|nil} fn: run as a coroutine
+-- @returns {any} values returned by fn
+function luz.loop.run(fn, ...)
+    debug.checkarg(1, fn, "nil|function")
+    if looprunning then error"luz.loop.run: the loop is already running" end
+
+    local results = nil
+    if fn then
+        local function pack(...)
+            return {n = select("#", ...), ...}
+        end
+        luz.loop.spawn(function (...)
+            results = pack(fn(...))
+        end, ...)
+    end
+
+    looprunning, loopstopped = true, false
+    local ok, message = pcall(function ()
+        while not loopstopped and (#loopready > 0 or next(loopwaiting) ~= nil) do
+            local ready = loopready
+            loopready = {}
+            for _, task in ipairs(ready) do
+                loopresume(task[1], unpack(task, 3, task[2] + 2))
+            end
+            if next(loopwaiting) ~= nil and not loopstopped then
+                loopdispatch(#loopready > 0 and 0 or -1)
+            end
+        end
+    end)
+    looprunning = false
+    if not ok then error(message, 0) end
+    if results then return unpack(results, 1, results.n) end
+end
+
+--- integration with the other libraries ---
+
+-- @private descriptors of the child process (pending stdin, stdout, stderr, exit)
+local processfds = ffi.new("int[4]")
+local processwritable = ffi.new("bool[4]")
+
+-- @private wait for the progress of the child process (output, input or exit)
+local function processwait(co, proc, timeout)
+    local n = tonumber(ffi.C.os_process_pollfds(proc.handler, processfds, processwritable))
+    if n < 0 then -- the exit cannot be waited for with a descriptor
+        loopawait(co, {ffi.C.loop_timer(loopopen(), timeout < 0 and 10 or math.min(10, timeout))})
+        return
+    end
+    if n == 0 then return end
+    local fds, events = {}, {}
+    for i = 0, n - 1 do
+        fds[i + 1], events[i + 1] = processfds[i], processwritable[i] and loopmodes.w or loopmodes.r
+    end
+    if loopwaitfds(co, fds, events, timeout) == nil then -- e.g. closed descriptor
+        loopawait(co, {ffi.C.loop_timer(loopengine, 0)})
+    end
+end
+
+-- @private get the remaining milliseconds (-1: infinite)
+local function remaining(deadline)
+    if deadline == nil then return -1 end
+    return math.max(0, deadline - os.systime())
+end
+
+-- Wait for the child process (os.spawn) to exit
+-- * yields if called in the coroutine of luz.loop (pidfd on Linux, otherwise polls every 10 ms), otherwise calls proc:wait
+-- @param {number} timeout: milliseconds (default: -1 => infinite)
+-- @returns {number|nil} exit code; nil if timed out or the process has been closed
+function luz.loop.wait_process(proc, timeout)
+    debug.checkarg(2, proc, "table", timeout, "nil|number")
+    local co = loopcurrent()
+    if co == nil then return proc:wait(timeout) end
+
+    proc:closestdin()
+    local deadline = timeout and timeout >= 0 and os.systime() + timeout or nil
+    while true do
+        local code = proc:poll()
+        if code or proc.handler == nil or remaining(deadline) == 0 then return code end
+        processwait(co, proc, remaining(deadline))
+    end
+end
+
+-- Read one line from the pipe of the child process (proc.stdout / proc.stderr)
+-- * yields if called in the coroutine of luz.loop, otherwise calls reader:readline
+-- @param {number} timeout: milliseconds (default: -1 => infinite)
+-- @returns {string|nil} nil if timed out or EOF (check reader:eof())
+function luz.loop.readline(reader, timeout)
+    local co = loopcurrent()
+    if co == nil then return reader:readline(timeout) end
+
+    local deadline = timeout and timeout >= 0 and os.systime() + timeout or nil
+    while true do
+        local line = reader:readline(0)
+        if line or reader:eof() or remaining(deadline) == 0 then return line end
+        processwait(co, reader.proc, remaining(deadline))
+    end
+end
+
+-- Wait for the changes of the file system watcher (fs.watch)
+-- * yields if called in the coroutine of luz.loop, otherwise calls watcher:next
+-- @param {number} timeout: milliseconds to wait for the first change (default: -1 => infinite)
+-- @returns {table[]|nil} changes; nil if timed out or closed
+function luz.loop.watch_next(watcher, timeout)
+    debug.checkarg(2, watcher, "table", timeout, "nil|number")
+    local co = loopcurrent()
+    if co == nil then return watcher:next(timeout) end
+
+    local deadline = timeout and timeout >= 0 and os.systime() + timeout or nil
+    while watcher.handler ~= nil do
+        local changes = watcher:poll()
+        if changes then return changes end
+        if remaining(deadline) == 0 then return nil end
+        if watcher.fd < 0 or loopwaitfds(co, {watcher.fd}, {loopmodes.r}, remaining(deadline)) == nil then
+            local interval = math.max(watcher.debounce, 10) -- the changes cannot be waited for with the descriptor
+            loopawait(co, {ffi.C.loop_timer(loopopen(), remaining(deadline) < 0 and interval or math.min(interval, remaining(deadline)))})
+        elseif watcher.debounce > 0 then
+            luz.loop.sleep(watcher.debounce) -- collect the burst of changes without blocking the loop
+        end
+    end
+    return nil
+end
+
+-- @private coroutines of luz.loop waiting for fs.async requests: {coroutine, function identifying if the request is completed}
+local asyncwaiters = {}
+local asyncwatching = false
+
+-- @private wait for fs.async in the loop, and resume the coroutines whose requests are completed
+-- * io_uring is waited for with its descriptor, otherwise fs.async is polled every 1 ms
+local function asyncwatch()
+    if asyncwatching then return end
+    asyncwatching = true
+    local fd = fs.async.fd()
+    local id = fd >= 0 and ffi.C.loop_watch(loopopen(), fd, loopmodes.r, -1) or 0
+    if id == 0 then id = ffi.C.loop_timer(loopopen(), 1) end
+    loopregister({ids = {id}, fn = function ()
+        asyncwatching = false
+        fs.async.poll() -- only this dispatches the requests of the waiters, so no completion is missed
+        local waiters = asyncwaiters
+        asyncwaiters = {}
+        for _, waiter in ipairs(waiters) do
+            if waiter[2]() then
+                loopready[#loopready + 1] = {waiter[1], 0}
+            else
+                asyncwaiters[#asyncwaiters + 1] = waiter
+            end
+        end
+        if #asyncwaiters > 0 then asyncwatch() end
+    end})
+end
+
+-- fs.async.* called in the coroutine of luz.loop yields until the request is completed
+fs.async.yield = function (co, isCompleted)
+    if not loopmanaged[co] then return false end
+    asyncwaiters[#asyncwaiters + 1] = {co, isCompleted}
+    asyncwatch()
+    coroutine.yield(loopsignal)
+    return true
+end
+
+--- serialization ---
+
+-- @private kind => function(value) restoring the object serialized by object:__pack() (registered by each kind of the shared objects)
+local unpackers = {}
+
+-- @private codec of cdata values and objects for luz.serialize (called by lua_serialize / lua_deserialize)
+-- * pointers, arrays and references are passed by address: the memory is shared (not copied), so keep it alive while it's used
+debug.getregistry()["luz.codec"] = {
+    encode = function (value)
+        if ffi.istype("int64_t", value) then return "i" .. ffi.string(ffi.new("int64_t[1]", value), 8) end
+        if ffi.istype("uint64_t", value) then return "u" .. ffi.string(ffi.new("uint64_t[1]", value), 8) end
+        local ctype = tostring(ffi.typeof(value))
+        if ctype:find"[%*%]&]>$" then
+            return "p" .. ffi.string(ffi.new("uintptr_t[1]", ffi.cast("uintptr_t", ffi.cast("const void*", value))), ffi.sizeof"uintptr_t")
+        end
+        local number = tonumber(value)
+        if number == nil then error("cannot serialize " .. ctype .. " (pass the pointer)") end
+        return "n" .. number
+    end,
+
+    decode = function (data)
+        local kind, payload = data:sub(1, 1), data:sub(2)
+        if kind == "i" then return ffi.cast("const int64_t*", payload)[0] end
+        if kind == "u" then return ffi.cast("const uint64_t*", payload)[0] end
+        if kind == "p" then return ffi.cast("void*", ffi.cast("const uintptr_t*", payload)[0]) end
+        return tonumber(payload)
+    end,
+
+    unpack = function (kind, value)
+        local unpacker = unpackers[kind]
+        if unpacker == nil then error("cannot deserialize the object: " .. tostring(kind)) end
+        return unpacker(value)
+    end,
+}
+
+-- Serialize the values into a string, and restore them in any Lua state of the process
+-- * luz.serialize(...) and luz.deserialize(data) are implemented natively (lua/native/luz.cpp, lua/serialize.cpp):
+--   nil, boolean, number, string, table (without the metatable) and cdata are supported; functions and recursive tables raise the error
+-- * the objects which have `__pack` method (e.g. luz.channel) are shared between the Lua states only as the arguments / results of luz.thread
+--   and the values of luz.channel (luz.serialize and luz.shared raise the error, since the data may be restored any times)
+-- * pointer / array cdata (FFI buffers) are passed by address without copying the memory (restored as void*)
+
+--- worker threads ---
+luz.thread = {}
+
+-- @private get the bytecode of the function to run in another Lua state
+-- * upvalues are not shipped by string.dump, so the function which has them is rejected
+local function dumpfunction(fn, level)
+    local name = debug.getupvalue(fn, 1)
+    if name ~= nil then
+        error(("the function refers to the upvalue '%s' which cannot be shipped to another Lua state (pass it as an argument)"):format(name), level + 1)
+    end
+    local ok, code = pcall(string.dump, fn)
+    if not ok then error("the function cannot be dumped: " .. code, level + 1) end
+    return code
+end
+
+-- @private function or chunk => code, chunkname
+local function threadcode(fn, level)
+    if type(fn) == "string" then return fn, "=luz.thread" end
+    return dumpfunction(fn, level + 1), "=luz.thread"
+end
+
+-- @private job running in the worker thread
+local threadjob = class {
+    constructor = function (self, pool, id)
+        self.pool, self.id = pool, id
+        self.results = nil
+    end,
+
+    destructor = function (self)
+        if self.results == nil and self.pool.handler ~= nil then native.thread_release(self.pool.handler, self.id) end
+    end,
+
+    -- Wait for the job to finish
+    -- * yields if called in the coroutine of luz.loop (polls every 1 ms)
+    -- @param {number} timeout: milliseconds (default: -1 => infinite)
+    -- @returns {boolean} false if timed out
+    wait = function (self, timeout)
+        if self.results ~= nil then return true end
+        if self.pool.handler == nil then error"the thread pool has been closed" end
+        if luz.loop.current() == nil then return native.thread_wait(self.pool.handler, self.id, timeout or -1) end
+
+        local deadline = timeout and timeout >= 0 and os.systime() + timeout or nil
+        while not native.thread_wait(self.pool.handler, self.id, 0) do
+            if deadline and os.systime() >= deadline then return false end
+            luz.loop.sleep(1)
+        end
+        return true
+    end,
+
+    -- Identifies if the job has finished
+    -- @returns {boolean}
+    done = function (self)
+        return self:wait(0)
+    end,
+
+    -- Wait for the job, and get the values returned in the worker
+    -- * the error raised in the worker is raised again (with the traceback of the worker)
+    -- @returns {any}
+    join = function (self)
+        if self.results == nil then
+            self:wait()
+            self.results = {n = 0}
+            local function pack(...)
+                self.results = {n = select("#", ...), ...}
+            end
+            pack(native.thread_take(self.pool.handler, self.id))
+        end
+        if not self.results[1] then error(self.results[2], 0) end
+        return unpack(self.results, 2, self.results.n)
+    end,
+}
+
+-- @private pool of worker threads
+local threadpool = class {
+    constructor = function (self, threads)
+        self.handler = native.thread_open(threads)
+        self.size = native.thread_size(self.handler)
+    end,
+
+    destructor = function (self)
+        self:close()
+    end,
+
+    -- Stop the workers (the queued jobs are cancelled, and the running jobs are waited for)
+    close = function (self)
+        if self.handler ~= nil then
+            native.thread_close(self.handler)
+            self.handler = nil
+        end
+    end,
+
+    -- Run the function or chunk in any worker
+    -- * arguments and results are serialized by luz.serialize (FFI buffers are passed by address)
+    -- @param {function|string} fn: function without upvalues (shipped by string.dump), or Lua source (arguments: ...)
+    -- @returns {threadjob} job: call job:join() to get the results
+    run = function (self, fn, ...)
+        if self.handler == nil then error"the thread pool has been closed" end
+        local code, chunkname = threadcode(fn, 2)
+        return threadjob.new(self, native.thread_submit(self.handler, code, chunkname, ...))
+    end,
+}
+
+-- Start the pool of worker threads
+-- * each worker has own Lua state initialized with the standard libraries (the globals remain between the jobs)
+-- e.g.
+--     local pool = luz.thread.pool(4)
+--     local jobs = {}
+--     for i = 1, 4 do jobs[i] = pool:run(function (n) return n * n end, i) end
+--     for i = 1, 4 do print(jobs[i]:join()) end
+--     pool:close()
+-- @param {number} threads: count of worker threads in 0..1024 (default: 0 => count of hardware threads)
+-- @returns {threadpool}
+function luz.thread.pool(threads)
+    debug.checkarg(1, threads, "nil|number")
+    threads = threads or 0
+    if threads < 0 or threads % 1 ~= 0 or threads > 1024 then error("threads must be an integer in 0..1024", 2) end
+    return threadpool.new(threads)
+end
+
+-- @private pool used by luz.thread.run and luz.parallel (started at the first call)
+local defaultpool = nil
+
+local function getdefaultpool()
+    if defaultpool == nil then defaultpool = threadpool.new(0) end
+    return defaultpool
+end
+
+-- Run the function or chunk in the worker thread of the default pool (count of hardware threads)
+-- e.g. `local job = luz.thread.run(function (a, b) return a + b end, 1, 2); print(job:join())`
+-- @returns {threadjob}
+function luz.thread.run(fn, ...)
+    debug.checkarg(1, fn, "function|string")
+    return getdefaultpool():run(fn, ...)
+end
+
+--- data parallelism ---
+luz.parallel = {}
+
+-- @private process the chunk of the list in the worker (shipped by string.dump, so it must not refer to upvalues)
+-- * the function loaded from the bytecode is cached in the worker state
+local function parallelchunk(code, mode, first, count, items)
+    local registry = debug.getregistry()
+    local cache = registry["luz.parallel"]
+    if cache == nil or cache.n >= 16 then
+        cache = {n = 0}
+        registry["luz.parallel"] = cache
+    end
+    local fn = cache[code]
+    if fn == nil then
+        fn = assert(loadstring(code, "=luz.parallel"))
+        cache[code], cache.n = fn, cache.n + 1
+    end
+
+    if mode == "map" then
+        local results = {}
+        for i = 1, count do
+            results[i] = fn(items[i], first + i - 1)
+        end
+        return results
+    end
+    local acc = items[1]
+    for i = 2, count do
+        acc = fn(acc, items[i])
+    end
+    return acc
+end
+
+-- @private bytecode of parallelchunk (dumped at the first call)
+local parallelcode = nil
+
+-- @private split the list into the chunks, and run them in the pool
+-- @returns {threadjob[], number} jobs in order of the chunks, count of the items of each chunk
+local function parallelrun(mode, fn, list, options, level)
+    options = options or {}
+    local pool = options.pool or getdefaultpool()
+    local code = dumpfunction(fn, level + 1)
+    -- small chunks balance the load dynamically (idle workers steal the queued chunks)
+    local size = options.chunk or math.max(1, math.ceil(#list / (pool.size * 8)))
+    if type(size) ~= "number" or size < 1 or size % 1 ~= 0 then error("chunk must be a positive integer", level + 1) end
+    parallelcode = parallelcode or dumpfunction(parallelchunk, level + 1)
+
+    local jobs = {}
+    for first = 1, #list, size do
+        local count, items = math.min(size, #list - first + 1), {}
+        for i = 1, count do
+            items[i] = list[first + i - 1]
+        end
+        jobs[#jobs + 1] = pool:run(parallelcode, code, mode, first, count, items) -- the bytecode is loaded as the chunk
+    end
+    return jobs, size
+end
+
+-- Call the function for each item of the list in parallel, and get the results in order
+-- * the list is split into the chunks which run in the worker threads (work stealing)
+-- * the items and results are serialized by luz.serialize (the errors in the workers are raised again)
+-- e.g. `local sizes = luz.parallel.map(function (file) return fs.readfile(file.path):len() end, fs.enumfiles"src")`
+-- @param {function} fn: function(item, index) -> result; without upvalues (shipped by string.dump)
+-- @param {table} list: array of the items
+-- @param {table} options: {chunk: integer (count of the items of each job; default: #list / (workers * 8)), pool: threadpool (default: the pool of luz.thread.run)}
+-- @returns {table} results: results[i] = fn(list[i], i)
+function luz.parallel.map(fn, list, options)
+    debug.checkarg(3, fn, "function", list, "table", options, "nil|table")
+    local jobs, size = parallelrun("map", fn, list, options, 2)
+    local results = {}
+    for k, job in ipairs(jobs) do
+        local chunk, offset = job:join(), (k - 1) * size
+        for i = 1, math.min(size, #list - offset) do
+            results[offset + i] = chunk[i]
+        end
+    end
+    return results
+end
+
+-- Reduce the list in parallel: fn(fn(fn(init, list[1]), list[2]), ...)
+-- * each chunk is reduced in the worker, and the results of the chunks are reduced in order in the caller
+--   so fn must be associative (e.g. sum, max, merge of tables)
+-- e.g. `local total = luz.parallel.reduce(function (a, b) return a + b end, numbers, 0)`
+-- @param {function} fn: function(accumulator, item) -> accumulator; without upvalues (shipped by string.dump)
+-- @param {table} list: array of the items
+-- @param {any} init: initial value (default: nil => the first item)
+-- @param {table} options: same as luz.parallel.map
+-- @returns {any}
+function luz.parallel.reduce(fn, list, init, options)
+    debug.checkarg(4, fn, "function", list, "table", init, "any", options, "nil|table")
+    local acc = init
+    for _, job in ipairs(parallelrun("reduce", fn, list, options, 2)) do
+        local value = job:join()
+        if acc == nil then acc = value else acc = fn(acc, value) end
+    end
+    return acc
+end
+
+--- channels ---
+
+-- @private bounded channel shared between the Lua states (lock-free ring buffer: core/channel.hpp)
+local channel = class {
+    -- @param handler: channel whose reference is owned by this object
+    constructor = function (self, handler)
+        self.handler = handler
+    end,
+
+    destructor = function (self)
+        native.channel_release(self.handler)
+    end,
+
+    -- @private shared with another Lua state by luz.thread / luz.channel (the reference is moved into the serialized data)
+    __pack = function (self)
+        native.channel_retain(self.handler)
+        return "channel", self.handler
+    end,
+
+    -- Push the value (serialized by luz.serialize)
+    -- * yields if called in the coroutine of luz.loop while the channel is full (polls every 1 ms)
+    -- @param {any} value: value except nil
+    -- @param {number} timeout: milliseconds to wait while the channel is full (default: -1 => infinite)
+    -- @returns {boolean} false if timed out or closed
+    push = function (self, value, timeout)
+        timeout = timeout or -1
+        if timeout == 0 or luz.loop.current() == nil then return native.channel_push(self.handler, timeout, value) end
+
+        -- serialized once: the objects shared by reference are moved into the message only once
+        local message, hasObjects = native.channel_encode(value)
+        local deadline = timeout > 0 and os.systime() + timeout or nil
+        while not native.channel_send(self.handler, 0, message) do
+            if native.channel_is_closed(self.handler) or deadline and os.systime() >= deadline then
+                if hasObjects then luz.deserialize(message) end -- release the references moved into the message
+                return false
+            end
+            luz.loop.sleep(1)
+        end
+        return true
+    end,
+
+    -- Push the value without waiting
+    -- @returns {boolean} false if the channel is full or closed
+    try_push = function (self, value)
+        return native.channel_push(self.handler, 0, value)
+    end,
+
+    -- Pop the value
+    -- * yields if called in the coroutine of luz.loop while the channel is empty (polls every 1 ms)
+    -- @param {number} timeout: milliseconds to wait while the channel is empty (default: -1 => infinite)
+    -- @returns {any} nil if timed out, or the channel is closed and empty
+    pop = function (self, timeout)
+        timeout = timeout or -1
+        if timeout == 0 or luz.loop.current() == nil then return native.channel_pop(self.handler, timeout) end
+
+        local deadline = timeout > 0 and os.systime() + timeout or nil
+        while true do
+            local closed = native.channel_is_closed(self.handler)
+            local value = native.channel_pop(self.handler, 0)
+            if value ~= nil or closed or deadline and os.systime() >= deadline then return value end
+            luz.loop.sleep(1)
+        end
+    end,
+
+    -- Pop the value without waiting
+    -- @returns {any} nil if the channel is empty
+    try_pop = function (self)
+        return native.channel_pop(self.handler, 0)
+    end,
+
+    -- Iterate the popped values until the channel is closed and empty
+    -- e.g. `for value in ch:values() do print(value) end`
+    values = function (self)
+        return function ()
+            return self:pop()
+        end
+    end,
+
+    -- Close the channel for all the Lua states: push fails, and pop returns the remaining values (then nil)
+    close = function (self)
+        native.channel_close(self.handler)
+    end,
+
+    -- Identifies if the channel is closed
+    -- @returns {boolean}
+    closed = function (self)
+        return native.channel_is_closed(self.handler)
+    end,
+
+    -- Get count of the values in the channel
+    -- @returns {number}
+    size = function (self)
+        return native.channel_size(self.handler)
+    end,
+}
+
+unpackers.channel = function (handler)
+    return channel.new(handler)
+end
+
+-- Create the bounded channel to pass values between the Lua states (e.g. luz.thread workers)
+-- * pass the channel to another state as an argument of luz.thread (the channel is shared, not copied)
+-- * values are serialized by luz.serialize, and blocking push / pop park the thread (futex)
+-- e.g.
+--     local ch = luz.channel(64)
+--     local job = luz.thread.run(function (ch) for i = 1, 100 do ch:push(i) end ch:close() end, ch)
+--     local sum = 0
+--     for value in ch:values() do sum = sum + value end
+-- @param {number} capacity: max count of the values (rounded up to the power of 2; 2^24 at most)
+-- @param {table} options: {spsc: boolean (single producer and single consumer; faster, but the caller must guarantee it)}
+-- @returns {channel}
+function luz.channel(capacity, options)
+    debug.checkarg(2, capacity, "number", options, "nil|table")
+    if capacity < 1 or capacity > 2^24 or capacity % 1 ~= 0 then error("capacity must be the integer in 1 .. 2^24: " .. capacity, 2) end
+    return channel.new(native.channel_open(capacity, options and options.spsc))
+end
+
+--- shared store ---
+
+-- Process-global key-value store shared by all the Lua states (e.g. luz.thread workers)
+-- * luz.shared.* are implemented natively (lua/native/luz.cpp, core/shared.hpp): hash map of sharded locks
+-- * numbers are stored as they are, and the other values are stored as immutable data serialized by luz.serialize
+--   (the objects shared by reference such as luz.channel cannot be stored)
+--   (luz.shared.get returns the new copy of the table each time, so cache it in the local variable while it's used)
+-- e.g.
+--     luz.shared.set("config", {threads = 4})
+--     luz.thread.run(function () return luz.shared.get"config".threads, luz.shared.incr"workers" end):join()
+--
+-- luz.shared.get(key: string) -> any: nil if not stored
+-- luz.shared.set(key: string, value: any) -> boolean: nil removes the entry; false if the value is larger than the byte budget (the current value remains)
+-- luz.shared.cas(key: string, expected: any, value: any) -> boolean: set the value only if the current value equals to expected
+--   (nil: not stored; the tables are compared by the serialized data, so the order of the keys may differ)
+-- luz.shared.incr(key: string, delta: number = 1) -> number: add delta atomically (the entry not stored starts from 0)
+-- luz.shared.remove(key: string) -> boolean: false if not stored
+-- luz.shared.clear()
+-- luz.shared.budget(bytes: number): max bytes of the keys and values (0: unlimited); least recently used entries are evicted beyond it
+-- luz.shared.bytes() -> number: bytes of the keys and values
+-- luz.shared.count() -> number: count of the entries
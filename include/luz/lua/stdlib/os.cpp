@@ -1 +1 @@
-27,76,74,2,0,12,64,115,116,100,108,105,98,58,47,47,111,115,111,0,1,5,0,6,0,11,18,14,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,15,111,115,95,101,120,101,99,117,116,101,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,99,109,100,0,0,12,0,110,0,1,5,0,6,0,11,19,20,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,13,111,115,95,115,108,101,101,112,6,67,8,102,102,105,11,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,109,115,101,99,0,0,12,0,48,0,0,1,0,3,0,4,5,26,2,54,0,0,0,57,0,1,0,57,0,2,0,68,0,1,0,15,111,115,95,103,101,116,116,105,109,101,6,67,8,102,102,105,1,1,1,1,0,132,1,0,2,8,0,6,0,14,28,31,3,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,2,0,66,2,6,1,54,2,3,0,57,2,4,2,57,2,5,2,18,3,0,0,18,4,1,0,68,2,3,0,14,111,115,95,115,101,116,101,110,118,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,2,2,110,97,109,101,0,0,15,118,97,108,0,0,15,0,126,0,1,5,0,6,0,14,22,37,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,2,1,54,2,3,0,57,2,4,2,57,2,5,2,18,3,0,0,66,2,2,0,67,1,0,0,14,111,115,95,103,101,116,101,110,118,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,2,110,97,109,101,0,0,15,0,110,0,1,5,0,6,0,11,18,43,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,14,111,115,95,115,101,116,99,119,100,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,100,105,114,0,0,12,0,126,0,0,5,0,6,0,14,22,49,3,54,0,0,0,57,0,1,0,39,1,2,0,52,2,0,0,66,0,3,2,54,1,0,0,57,1,3,1,54,2,0,0,57,2,4,2,57,2,5,2,18,3,0,0,41,4,0,4,66,2,3,0,67,1,0,0,14,111,115,95,103,101,116,99,119,100,6,67,11,115,116,114,105,110,103,15,99,104,97,114,91,49,48,50,53,93,8,110,101,119,8,102,102,105,1,1,1,1,1,2,2,2,2,2,2,2,2,2,100,101,115,116,0,6,9,0,226,3,3,0,2,0,18,0,26,27,0,53,54,0,0,0,57,0,1,0,39,1,2,0,66,0,2,1,54,0,3,0,51,1,5,0,61,1,4,0,54,0,3,0,51,1,7,0,61,1,6,0,54,0,3,0,51,1,9,0,61,1,8,0,54,0,3,0,51,1,11,0,61,1,10,0,54,0,3,0,51,1,13,0,61,1,12,0,54,0,3,0,51,1,15,0,61,1,14,0,54,0,3,0,51,1,17,0,61,1,16,0,75,0,1,0,0,11,103,101,116,99,119,100,0,11,115,101,116,99,119,100,0,11,103,101,116,101,110,118,0,11,115,101,116,101,110,118,0,12,115,121,115,116,105,109,101,0,10,115,108,101,101,112,0,12,101,120,101,99,117,116,101,7,111,115,147,2,108,111,110,103,32,111,115,95,101,120,101,99,117,116,101,40,99,111,110,115,116,32,99,104,97,114,32,42,99,109,100,41,59,10,118,111,105,100,32,111,115,95,115,108,101,101,112,40,117,110,115,105,103,110,101,100,32,108,111,110,103,32,109,115,101,99,41,59,10,117,110,115,105,103,110,101,100,32,108,111,110,103,32,111,115,95,103,101,116,116,105,109,101,40,41,59,10,98,111,111,108,32,111,115,95,115,101,116,101,110,118,40,99,111,110,115,116,32,99,104,97,114,32,42,110,97,109,101,44,32,99,111,110,115,116,32,99,104,97,114,32,42,118,97,108,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,111,115,95,103,101,116,101,110,118,40,99,111,110,115,116,32,99,104,97,114,32,42,110,97,109,101,41,59,10,98,111,111,108,32,111,115,95,115,101,116,99,119,100,40,99,111,110,115,116,32,99,104,97,114,32,42,100,105,114,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,111,115,95,103,101,116,99,119,100,40,99,104,97,114,32,42,100,101,115,116,44,32,115,105,122,101,95,116,32,115,105,122,101,41,59,10,9,99,100,101,102,8,102,102,105,3,3,11,11,14,17,14,20,23,20,26,28,26,31,34,31,37,40,37,43,46,43,49,52,49,52,0,0,
\ No newline at end of file
+27,76,74,2,0,12,64,115,116,100,108,105,98,58,47,47,111,115,111,0,1,5,0,6,0,11,18,38,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,15,111,115,95,101,120,101,99,117,116,101,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,99,109,100,0,0,12,0,110,0,1,5,0,6,0,11,19,44,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,13,111,115,95,115,108,101,101,112,6,67,8,102,102,105,11,110,117,109,98,101,114,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,109,115,101,99,0,0,12,0,67,0,0,2,0,4,0,6,7,52,2,54,0,0,0,54,1,1,0,57,1,2,1,57,1,3,1,66,1,1,0,67,0,0,0,15,111,115,95,103,101,116,116,105,109,101,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,1,1,1,1,1,1,0,49,0,0,1,0,3,0,4,5,59,2,54,0,0,0,57,0,1,0,57,0,2,0,68,0,1,0,16,111,115,95,99,108,111,99,107,95,110,115,6,67,8,102,102,105,1,1,1,1,0,50,0,0,1,0,3,0,4,5,65,2,54,0,0,0,57,0,1,0,57,0,2,0,68,0,1,0,17,111,115,95,99,108,111,99,107,95,99,112,117,6,67,8,102,102,105,1,1,1,1,0,46,0,0,1,0,3,0,4,5,72,2,54,0,0,0,57,0,1,0,57,0,2,0,68,0,1,0,13,111,115,95,114,100,116,115,99,6,67,8,102,102,105,1,1,1,1,0,68,0,0,2,0,4,0,6,7,79,2,54,0,0,0,54,1,1,0,57,1,2,1,57,1,3,1,66,1,1,0,67,0,0,0,16,111,115,95,114,100,116,115,99,95,104,122,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,1,1,1,1,1,1,0,132,1,0,2,8,0,6,0,14,28,84,3,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,2,0,66,2,6,1,54,2,3,0,57,2,4,2,57,2,5,2,18,3,0,0,18,4,1,0,68,2,3,0,14,111,115,95,115,101,116,101,110,118,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,1,1,2,2,2,2,2,2,110,97,109,101,0,0,15,118,97,108,0,0,15,0,126,0,1,5,0,6,0,14,22,90,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,2,1,54,2,3,0,57,2,4,2,57,2,5,2,18,3,0,0,66,2,2,0,67,1,0,0,14,111,115,95,103,101,116,101,110,118,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,2,2,2,110,97,109,101,0,0,15,0,110,0,1,5,0,6,0,11,18,96,3,54,1,0,0,57,1,1,1,41,2,1,0,18,3,0,0,39,4,2,0,66,1,4,1,54,1,3,0,57,1,4,1,57,1,5,1,18,2,0,0,68,1,2,0,14,111,115,95,115,101,116,99,119,100,6,67,8,102,102,105,11,115,116,114,105,110,103,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,1,1,1,1,1,1,2,2,2,2,2,100,105,114,0,0,12,0,126,0,0,5,0,6,0,14,22,102,3,54,0,0,0,57,0,1,0,39,1,2,0,52,2,0,0,66,0,3,2,54,1,0,0,57,1,3,1,54,2,0,0,57,2,4,2,57,2,5,2,18,3,0,0,41,4,0,4,66,2,3,0,67,1,0,0,14,111,115,95,103,101,116,99,119,100,6,67,11,115,116,114,105,110,103,15,99,104,97,114,91,49,48,50,53,93,8,110,101,119,8,102,102,105,1,1,1,1,1,2,2,2,2,2,2,2,2,2,100,101,115,116,0,6,9,0,68,0,0,2,0,4,0,6,7,108,2,54,0,0,0,54,1,1,0,57,1,2,1,57,1,3,1,66,1,1,0,67,0,0,0,16,111,115,95,99,112,117,99,111,117,110,116,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,1,1,1,1,1,1,0,116,0,3,5,0,6,0,9,32,120,3,18,3,1,0,61,2,1,0,61,3,0,0,54,3,3,0,57,3,4,3,39,4,5,0,66,3,2,2,61,3,2,0,75,0,1,0,14,115,105,122,101,95,116,91,49,93,8,110,101,119,8,102,102,105,13,108,105,110,101,115,105,122,101,10,105,110,100,101,120,9,112,114,111,99,1,1,1,2,2,2,2,2,3,115,101,108,102,0,0,10,112,114,111,99,0,0,10,105,110,100,101,120,0,0,10,0,232,1,0,2,7,0,8,0,27,52,128,1,5,57,2,0,0,57,2,1,2,11,2,0,0,88,2,2,128,43,2,0,0,76,2,2,0,54,2,2,0,57,2,3,2,57,2,4,2,57,3,0,0,57,3,1,3,57,4,5,0,57,5,6,0,12,6,1,0,88,6,1,128,41,6,255,255,66,2,5,2,11,2,0,0,88,3,2,128,43,3,0,0,76,3,2,0,54,3,2,0,57,3,7,3,18,4,2,0,57,5,6,0,58,5,0,5,68,3,3,0,11,115,116,114,105,110,103,13,108,105,110,101,115,105,122,101,10,105,110,100,101,120,24,111,115,95,112,114,111,99,101,115,115,95,114,101,97,100,108,105,110,101,6,67,8,102,102,105,12,104,97,110,100,108,101,114,9,112,114,111,99,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,4,4,4,4,4,4,115,101,108,102,0,0,28,116,105,109,101,111,117,116,0,0,28,108,105,110,101,0,18,10,0,48,0,0,2,1,1,0,4,10,140,1,2,45,0,0,0,18,1,0,0,57,0,0,0,68,0,2,0,0,192,13,114,101,97,100,108,105,110,101,1,1,1,1,115,101,108,102,0,0,35,1,1,2,0,1,0,3,11,139,1,4,51,1,0,0,50,0,0,128,76,1,2,0,0,3,3,3,115,101,108,102,0,0,4,0,164,3,0,3,13,0,13,3,53,109,149,1,10,57,3,0,0,57,3,1,3,11,3,0,0,88,3,2,128,39,3,2,0,76,3,2,0,12,3,1,0,88,3,1,128,42,3,0,0,54,4,3,0,57,4,4,4,39,5,5,0,18,6,3,0,66,4,3,2,52,5,0,0,85,6,33,128,54,6,6,0,54,7,3,0,57,7,7,7,57,7,8,7,57,8,0,0,57,8,1,8,57,9,9,0,18,10,4,0,18,11,3,0,15,0,1,0,88,12,2,128,12,12,2,0,88,12,1,128,41,12,255,255,66,7,6,0,65,6,0,2,41,7,0,0,1,6,7,0,88,7,2,128,43,7,0,0,76,7,2,0,21,7,5,0,22,7,1,7,54,8,3,0,57,8,10,8,18,9,4,0,18,10,6,0,66,8,3,2,60,8,7,5,14,0,1,0,88,7,2,128,9,6,2,0,88,7,222,127,54,6,11,0,57,6,12,6,18,7,5,0,68,6,2,0,11,99,111,110,99,97,116,10,116,97,98,108,101,11,115,116,114,105,110,103,10,105,110,100,101,120,20,111,115,95,112,114,111,99,101,115,115,95,114,101,97,100,6,67,13,116,111,110,117,109,98,101,114,12,99,104,97,114,91,63,93,8,110,101,119,8,102,102,105,5,12,104,97,110,100,108,101,114,9,112,114,111,99,128,128,8,2,0,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,7,7,7,7,8,8,8,8,9,9,9,9,115,101,108,102,0,0,54,115,105,122,101,0,0,54,116,105,109,101,111,117,116,0,0,54,99,104,117,110,107,0,10,44,100,97,116,97,0,6,38,99,104,117,110,107,115,0,0,38,114,101,97,100,0,17,17,0,139,1,0,1,4,0,6,0,16,24,163,1,2,57,1,0,0,57,1,1,1,10,1,0,0,88,1,10,128,54,1,2,0,57,1,3,1,57,1,4,1,57,2,0,0,57,2,1,2,57,3,5,0,66,1,3,2,88,2,3,128,43,1,1,0,88,2,1,128,43,1,2,0,76,1,2,0,10,105,110,100,101,120,19,111,115,95,112,114,111,99,101,115,115,95,101,111,102,6,67,8,102,102,105,12,104,97,110,100,108,101,114,9,112,114,111,99,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,115,101,108,102,0,0,17,0,59,0,2,3,0,2,0,4,19,170,1,3,61,1,0,0,41,2,255,255,61,2,1,0,75,0,1,0,12,116,105,109,101,111,117,116,9,112,114,111,99,1,2,2,3,115,101,108,102,0,0,5,112,114,111,99,0,0,5,0,44,0,2,2,0,1,0,2,17,177,1,2,61,1,0,0,75,0,1,0,12,116,105,109,101,111,117,116,1,2,115,101,108,102,0,0,3,109,115,101,99,0,0,3,0,195,2,2,1,11,0,11,0,42,70,185,1,8,57,1,0,0,57,1,1,1,11,1,0,0,88,1,2,128,43,1,1,0,76,1,2,0,41,1,1,0,54,2,2,0,39,3,3,0,71,4,1,0,65,2,1,2,41,3,1,0,77,1,27,128,54,5,2,0,18,6,4,0,71,7,1,0,65,5,1,2,54,6,4,0,18,7,5,0,66,6,2,2,6,6,5,0,88,6,4,128,54,6,6,0,18,7,5,0,66,6,2,2,18,5,6,0,54,6,7,0,57,6,8,6,57,6,9,6,57,7,0,0,57,7,1,7,18,8,5,0,21,9,5,0,57,10,10,0,66,6,5,2,14,0,6,0,88,6,2,128,43,6,1,0,76,6,2,0,79,1,229,127,43,1,2,0,76,1,2,0,12,116,105,109,101,111,117,116,21,111,115,95,112,114,111,99,101,115,115,95,119,114,105,116,101,6,67,8,102,102,105,13,116,111,115,116,114,105,110,103,11,115,116,114,105,110,103,9,116,121,112,101,6,35,11,115,101,108,101,99,116,12,104,97,110,100,108,101,114,9,112,114,111,99,1,1,1,1,1,1,2,2,2,2,2,2,2,3,3,3,3,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,2,7,7,115,101,108,102,0,0,43,1,13,28,2,0,28,3,0,28,105,0,1,26,100,97,116,97,0,4,22,0,155,1,0,2,5,0,5,0,18,36,198,1,2,57,2,0,0,57,2,1,2,10,2,0,0,88,2,10,128,54,2,2,0,57,2,3,2,57,2,4,2,57,3,0,0,57,3,1,3,12,4,1,0,88,4,1,128,41,4,255,255,66,2,3,2,88,3,3,128,43,2,1,0,88,3,1,128,43,2,2,0,76,2,2,0,21,111,115,95,112,114,111,99,101,115,115,95,102,108,117,115,104,6,67,8,102,102,105,12,104,97,110,100,108,101,114,9,112,114,111,99,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,115,101,108,102,0,0,19,116,105,109,101,111,117,116,0,0,19,0,60,0,1,3,0,2,0,5,13,203,1,2,57,1,0,0,18,2,1,0,57,1,1,1,66,1,2,1,75,0,1,0,15,99,108,111,115,101,115,116,100,105,110,9,112,114,111,99,1,1,1,1,2,115,101,108,102,0,0,6,0,232,2,0,3,11,4,10,0,37,128,1,212,1,7,61,1,0,0,54,3,2,0,54,4,3,0,57,4,4,4,57,4,5,4,18,5,1,0,66,4,2,0,65,3,0,2,61,3,1,0,58,3,0,2,45,4,0,0,57,4,6,4,5,3,4,0,88,3,5,128,45,3,1,0,57,3,8,3,18,4,0,0,66,3,2,2,61,3,7,0,54,3,9,0,45,4,2,0,66,3,2,4,88,6,11,128,56,8,6,2,45,9,0,0,57,9,6,9,5,8,9,0,88,8,6,128,45,8,3,0,57,8,8,8,18,9,0,0,18,10,6,0,66,8,3,2,60,8,7,0,69,6,3,3,82,6,243,127,75,0,1,0,0,192,2,192,3,192,1,192,11,105,112,97,105,114,115,8,110,101,119,10,115,116,100,105,110,9,112,105,112,101,19,111,115,95,112,114,111,99,101,115,115,95,112,105,100,6,67,8,102,102,105,13,116,111,110,117,109,98,101,114,8,112,105,100,12,104,97,110,100,108,101,114,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,4,4,7,115,112,97,119,110,109,111,100,101,115,0,112,105,112,101,119,114,105,116,101,114,0,115,116,114,101,97,109,110,97,109,101,115,0,112,105,112,101,114,101,97,100,101,114,0,115,101,108,102,0,0,38,104,97,110,100,108,101,114,0,0,38,109,111,100,101,115,0,0,38,4,23,14,5,0,14,6,0,14,105,0,1,11,110,97,109,101,0,0,11,0,45,0,1,3,0,1,0,4,12,221,1,2,18,2,0,0,57,1,0,0,66,1,2,1,75,0,1,0,10,99,108,111,115,101,1,1,1,2,115,101,108,102,0,0,5,0,121,0,1,3,0,5,0,13,21,227,1,4,57,1,0,0,11,1,0,0,88,1,1,128,75,0,1,0,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,1,44,1,2,0,61,2,4,0,61,1,0,0,75,0,1,0,10,115,116,100,105,110,21,111,115,95,112,114,111,99,101,115,115,95,99,108,111,115,101,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,1,2,2,2,2,2,3,3,3,4,115,101,108,102,0,0,14,0,133,1,0,1,4,0,5,0,15,23,234,1,5,57,1,0,0,15,0,1,0,88,2,11,128,57,1,1,0,10,1,0,0,88,1,8,128,43,1,0,0,61,1,0,0,54,1,2,0,57,1,3,1,57,1,4,1,57,2,1,0,41,3,0,0,66,1,3,1,75,0,1,0,23,111,115,95,112,114,111,99,101,115,115,95,99,108,111,115,101,102,100,6,67,8,102,102,105,12,104,97,110,100,108,101,114,10,115,116,100,105,110,1,1,1,1,1,1,2,2,3,3,3,3,3,3,5,115,101,108,102,0,0,16,0,108,0,1,3,0,4,0,10,18,243,1,3,57,1,0,0,11,1,0,0,88,1,3,128,54,1,1,0,39,2,2,0,66,1,2,1,57,1,0,0,18,2,1,0,57,1,3,1,68,1,2,0,10,108,105,110,101,115,24,115,116,100,111,117,116,32,105,115,32,110,111,116,32,112,105,112,101,100,10,101,114,114,111,114,11,115,116,100,111,117,116,1,1,1,1,1,1,2,2,2,2,115,101,108,102,0,0,11,0,154,1,0,1,3,0,5,0,17,25,250,1,3,57,1,0,0,10,1,0,0,88,1,7,128,54,1,1,0,57,1,2,1,57,1,3,1,57,2,0,0,66,1,2,2,14,0,1,0,88,1,2,128,43,1,0,0,76,1,2,0,54,1,1,0,57,1,2,1,57,1,4,1,57,2,0,0,68,1,2,0,24,111,115,95,112,114,111,99,101,115,115,95,101,120,105,116,99,111,100,101,20,111,115,95,112,114,111,99,101,115,115,95,112,111,108,108,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,115,101,108,102,0,0,18,0,222,3,0,2,6,0,13,0,64,93,132,2,11,57,2,0,0,11,2,0,0,88,2,2,128,43,2,0,0,76,2,2,0,14,0,1,0,88,2,1,128,41,1,255,255,57,2,1,0,15,0,2,0,88,3,38,128,54,2,2,0,57,2,3,2,66,2,1,2,32,2,1,2,54,3,4,0,57,3,5,3,57,3,6,3,57,4,0,0,18,5,1,0,66,3,3,2,14,0,3,0,88,3,11,128,54,3,4,0,57,3,5,3,57,3,7,3,57,4,0,0,41,5,0,0,66,3,3,2,41,4,0,0,3,4,3,0,88,3,2,128,43,3,0,0,76,3,2,0,18,4,0,0,57,3,8,0,66,3,2,1,41,3,0,0,3,3,1,0,88,3,9,128,54,3,9,0,57,3,10,3,41,4,0,0,54,5,2,0,57,5,3,5,66,5,1,2,33,5,5,2,66,3,3,2,18,1,3,0,54,2,4,0,57,2,5,2,57,2,11,2,57,3,0,0,18,4,1,0,66,2,3,2,14,0,2,0,88,2,2,128,43,2,0,0,76,2,2,0,54,2,4,0,57,2,5,2,57,2,12,2,57,3,0,0,68,2,2,0,24,111,115,95,112,114,111,99,101,115,115,95,101,120,105,116,99,111,100,101,20,111,115,95,112,114,111,99,101,115,115,95,119,97,105,116,8,109,97,120,9,109,97,116,104,15,99,108,111,115,101,115,116,100,105,110,18,111,115,95,112,114,111,99,101,115,115,95,102,100,21,111,115,95,112,114,111,99,101,115,115,95,102,108,117,115,104,6,67,8,102,102,105,12,115,121,115,116,105,109,101,7,111,115,10,115,116,100,105,110,12,104,97,110,100,108,101,114,1,1,1,1,1,2,2,2,3,3,3,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,9,9,9,9,9,9,9,9,9,9,10,10,10,10,10,115,101,108,102,0,0,65,116,105,109,101,111,117,116,0,0,65,100,101,97,100,108,105,110,101,0,16,34,0,138,1,0,2,5,0,4,0,16,33,148,2,2,57,2,0,0,10,2,0,0,88,2,9,128,54,2,1,0,57,2,2,2,57,2,3,2,57,3,0,0,12,4,1,0,88,4,1,128,41,4,15,0,66,2,3,2,88,3,3,128,43,2,1,0,88,3,1,128,43,2,2,0,76,2,2,0,20,111,115,95,112,114,111,99,101,115,115,95,107,105,108,108,6,67,8,102,102,105,12,104,97,110,100,108,101,114,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,115,101,108,102,0,0,17,115,105,103,110,97,108,0,0,17,0,226,1,0,2,7,0,9,0,25,54,155,2,5,57,2,0,0,11,2,0,0,88,2,2,128,39,2,1,0,76,2,2,0,54,2,2,0,57,2,3,2,39,3,4,0,66,2,2,2,54,3,2,0,57,3,5,3,57,3,6,3,57,4,0,0,7,1,7,0,88,5,2,128,41,5,2,0,88,6,1,128,41,5,1,0,18,6,2,0,66,3,4,2,54,4,2,0,57,4,8,4,18,5,3,0,58,6,0,2,68,4,3,0,11,115,116,114,105,110,103,11,115,116,100,101,114,114,22,111,115,95,112,114,111,99,101,115,115,95,111,117,116,112,117,116,6,67,14,115,105,122,101,95,116,91,49,93,8,110,101,119,8,102,102,105,5,12,104,97,110,100,108,101,114,1,1,1,1,1,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,4,4,4,4,4,115,101,108,102,0,0,26,110,97,109,101,0,0,26,115,105,122,101,0,10,16,100,97,116,97,0,11,5,0,221,8,0,2,19,2,25,3,143,1,202,2,177,2,31,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,54,2,4,0,18,3,0,0,66,2,2,2,7,2,5,0,88,2,3,128,52,2,3,0,62,0,1,2,18,0,2,0,14,0,1,0,88,2,1,128,52,1,0,0,54,2,6,0,57,2,7,2,39,3,8,0,21,4,0,0,22,4,0,4,66,2,3,2,52,3,0,0,54,4,9,0,18,5,0,0,66,4,2,4,88,7,7,128,54,9,10,0,18,10,8,0,66,9,2,2,60,9,7,3,23,9,0,7,56,10,7,3,60,10,9,2,69,7,3,3,82,7,247,127,43,4,0,0,41,5,0,0,57,6,11,1,15,0,6,0,88,7,33,128,52,6,0,0,54,7,12,0,57,8,11,1,66,7,2,4,72,10,9,128,21,12,6,0,22,12,0,12,18,13,10,0,39,14,13,0,54,15,10,0,18,16,11,0,66,15,2,2,38,13,15,13,60,13,12,6,70,10,3,3,82,10,245,127,54,7,6,0,57,7,7,7,39,8,8,0,21,9,6,0,22,9,0,9,66,7,3,2,21,5,6,0,18,4,7,0,54,7,9,0,18,8,6,0,66,7,2,4,88,10,2,128,23,12,0,10,60,11,12,4,69,10,3,3,82,10,252,127,61,6,11,3,54,6,6,0,57,6,7,6,39,7,14,0,66,6,2,2,54,7,9,0,53,8,15,0,66,7,2,4,88,10,27,128,45,12,0,0,56,13,11,1,14,0,13,0,88,14,1,128,39,13,16,0,56,12,13,12,10,12,0,0,88,13,8,128,9,12,1,0,88,13,2,128,8,10,0,0,88,13,4,128,9,12,2,0,88,13,11,128,8,10,1,0,88,13,9,128,54,13,17,0,39,14,18,0,18,15,11,0,39,16,19,0,54,17,10,0,56,18,11,1,66,17,2,2,38,14,17,14,66,13,2,1,23,13,0,10,60,12,13,6,69,10,3,3,82,10,227,127,54,7,6,0,57,7,20,7,57,7,21,7,18,8,2,0,21,9,0,0,18,10,4,0,18,11,5,0,57,12,22,1,18,13,6,0,66,7,7,2,11,7,0,0,88,8,12,128,43,8,0,0,54,9,6,0,57,9,5,9,54,10,6,0,57,10,20,10,57,10,23,10,54,11,6,0,57,11,24,11,66,11,1,0,65,10,0,0,65,9,0,0,73,8,1,0,45,8,1,0,57,8,7,8,18,9,7,0,18,10,6,0,68,8,3,0,0,192,4,192,10,101,114,114,110,111,13,115,116,114,101,114,114,111,114,8,99,119,100,13,111,115,95,115,112,97,119,110,6,67,14,32,111,112,116,105,111,110,58,32,13,105,110,118,97,108,105,100,32,10,101,114,114,111,114,12,105,110,104,101,114,105,116,1,4,0,0,10,115,116,100,105,110,11,115,116,100,111,117,116,11,115,116,100,101,114,114,11,105,110,116,91,51,93,6,61,10,112,97,105,114,115,8,101,110,118,13,116,111,115,116,114,105,110,103,11,105,112,97,105,114,115,19,99,111,110,115,116,32,99,104,97,114,42,91,63,93,8,110,101,119,8,102,102,105,11,115,116,114,105,110,103,9,116,121,112,101,14,110,105,108,124,116,97,98,108,101,17,115,116,114,105,110,103,124,116,97,98,108,101,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,6,8,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,5,5,5,5,5,5,6,7,7,7,7,8,8,8,8,9,9,9,7,7,11,11,12,12,12,13,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,15,15,15,15,15,15,15,15,16,16,16,16,16,16,16,16,17,19,19,19,19,20,20,20,20,21,21,21,21,21,21,22,22,22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,23,23,25,25,20,20,28,28,28,28,28,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,29,29,30,30,30,30,30,115,112,97,119,110,109,111,100,101,115,0,112,114,111,99,101,115,115,0,97,114,103,118,0,0,144,1,111,112,116,115,0,0,144,1,99,97,114,103,118,0,26,118,97,110,99,104,111,114,115,0,1,117,4,3,10,5,0,10,6,0,10,105,0,1,7,97,114,103,0,0,7,99,101,110,118,0,11,102,110,101,110,118,0,0,102,101,110,116,114,105,101,115,0,4,32,4,3,12,5,0,12,6,0,12,110,97,109,101,0,1,9,118,97,108,117,101,0,0,9,4,22,5,5,0,5,6,0,5,105,0,1,2,101,110,116,114,121,0,0,2,109,111,100,101,115,0,9,62,4,3,30,5,0,30,6,0,30,105,0,1,27,110,97,109,101,0,0,27,109,111,100,101,0,6,21,104,97,110,100,108,101,114,0,33,19,0,227,8,0,2,14,0,36,1,141,1,144,2,218,2,29,54,2,0,0,57,2,1,2,41,3,2,0,18,4,0,0,39,5,2,0,18,6,1,0,39,7,3,0,66,2,6,1,14,0,1,0,88,2,1,128,52,1,0,0,54,2,4,0,57,2,5,2,41,3,1,0,57,4,6,1,14,0,4,0,88,5,3,128,54,4,7,0,57,4,8,4,66,4,1,2,66,2,3,2,52,3,0,0,52,4,0,0,54,5,9,0,57,5,10,5,39,6,11,0,18,7,2,0,66,5,3,2,41,6,1,0,21,7,0,0,2,6,7,0,88,7,4,128,21,7,4,0,41,8,0,0,1,8,7,0,88,7,104,128,85,7,103,128,21,7,4,0,1,7,2,0,88,7,43,128,21,7,0,0,3,6,7,0,88,7,40,128,85,7,39,128,56,7,6,0,54,8,7,0,57,8,12,8,18,9,7,0,53,10,14,0,57,11,13,7,14,0,11,0,88,12,1,128,39,11,15,0,61,11,13,10,57,11,16,7,14,0,11,0,88,12,1,128,39,11,17,0,61,11,16,10,57,11,18,7,14,0,11,0,88,12,1,128,39,11,17,0,61,11,18,10,57,11,19,7,61,11,19,10,57,11,20,7,61,11,20,10,66,8,3,3,15,0,8,0,88,10,7,128,21,10,4,0,22,10,0,10,52,11,3,0,62,8,1,11,62,6,2,11,60,11,10,4,88,10,3,128,53,10,21,0,61,9,22,10,60,10,6,3,22,6,0,6,88,7,210,127,21,7,4,0,41,8,0,0,1,8,7,0,88,7,198,127,54,7,23,0,18,8,4,0,66,7,2,4,88,10,4,128,23,12,0,10,58,13,1,11,57,13,24,13,60,13,12,5,69,10,3,3,82,10,250,127,54,7,25,0,54,8,9,0,57,8,26,8,57,8,27,8,18,9,5,0,21,10,4,0,41,11,255,255,66,8,4,0,65,7,0,2,22,7,0,7,41,8,1,0,1,7,8,0,88,8,3,128,54,8,22,0,39,9,28,0,66,8,2,1,54,8,29,0,54,9,2,0,57,9,30,9,18,10,4,0,18,11,7,0,66,9,3,0,65,8,0,3,53,10,32,0,18,12,8,0,57,11,31,8,66,11,2,2,61,11,33,10,18,12,8,0,57,11,34,8,39,13,16,0,66,11,3,2,61,11,16,10,18,12,8,0,57,11,34,8,39,13,18,0,66,11,3,2,61,11,18,10,60,10,9,3,18,11,8,0,57,10,35,8,66,10,2,1,88,7,145,127,76,3,2,0,10,99,108,111,115,101,11,111,117,116,112,117,116,9,99,111,100,101,1,0,0,9,119,97,105,116,11,114,101,109,111,118,101,11,117,110,112,97,99,107,37,102,97,105,108,101,100,32,116,111,32,119,97,105,116,32,102,111,114,32,116,104,101,32,112,114,111,99,101,115,115,101,115,23,111,115,95,112,114,111,99,101,115,115,95,119,97,105,116,97,110,121,6,67,13,116,111,110,117,109,98,101,114,12,104,97,110,100,108,101,114,11,105,112,97,105,114,115,10,101,114,114,111,114,1,0,0,8,99,119,100,8,101,110,118,11,115,116,100,101,114,114,12,99,97,112,116,117,114,101,11,115,116,100,111,117,116,9,110,117,108,108,1,0,0,10,115,116,100,105,110,10,115,112,97,119,110,28,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,42,91,63,93,8,110,101,119,8,102,102,105,13,99,112,117,99,111,117,110,116,7,111,115,16,99,111,110,99,117,114,114,101,110,99,121,8,109,97,120,9,109,97,116,104,14,110,105,108,124,116,97,98,108,101,10,116,97,98,108,101,13,99,104,101,99,107,97,114,103,10,100,101,98,117,103,2,1,1,1,1,1,1,1,1,2,2,2,3,3,3,3,3,3,3,3,3,3,4,4,5,5,5,5,5,6,8,8,8,8,8,8,8,8,9,9,9,9,9,9,9,10,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,13,13,13,13,11,15,15,15,15,15,15,15,15,15,16,16,16,17,17,19,19,19,19,20,20,20,20,20,20,20,20,20,20,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,25,25,26,28,106,111,98,115,0,0,142,1,111,112,116,115,0,0,142,1,99,111,110,99,117,114,114,101,110,99,121,0,22,120,114,101,115,117,108,116,115,0,2,118,114,117,110,110,105,110,103,0,0,118,104,97,110,100,108,101,114,115,0,5,113,110,101,120,116,106,111,98,0,1,112,106,111,98,0,16,37,112,114,111,99,0,24,13,101,114,114,0,0,13,4,21,7,5,0,7,6,0,7,105,0,1,4,101,110,116,114,121,0,0,4,105,0,16,32,112,114,111,99,0,13,19,105,110,100,101,120,0,0,19,0,223,20,3,0,7,0,72,0,97,130,2,0,248,2,54,0,0,0,57,0,1,0,39,1,2,0,66,0,2,1,54,0,3,0,51,1,5,0,61,1,4,0,54,0,3,0,51,1,7,0,61,1,6,0,54,0,3,0,51,1,9,0,61,1,8,0,54,0,3,0,51,1,11,0,61,1,10,0,54,0,3,0,51,1,13,0,61,1,12,0,54,0,3,0,51,1,15,0,61,1,14,0,54,0,3,0,51,1,17,0,61,1,16,0,54,0,3,0,51,1,19,0,61,1,18,0,54,0,3,0,51,1,21,0,61,1,20,0,54,0,3,0,51,1,23,0,61,1,22,0,54,0,3,0,51,1,25,0,61,1,24,0,54,0,3,0,51,1,27,0,61,1,26,0,53,0,28,0,54,1,29,0,53,2,31,0,51,3,30,0,61,3,32,2,51,3,33,0,61,3,34,2,51,3,35,0,61,3,36,2,51,3,37,0,61,3,38,2,51,3,39,0,61,3,40,2,66,1,2,2,54,2,29,0,53,3,42,0,51,4,41,0,61,4,32,3,51,4,43,0,61,4,44,3,51,4,45,0,61,4,46,3,51,4,47,0,61,4,48,3,51,4,49,0,61,4,50,3,66,2,2,2,53,3,51,0,54,4,29,0,53,5,53,0,51,6,52,0,61,6,32,5,51,6,54,0,61,6,55,5,51,6,56,0,61,6,50,5,51,6,57,0,61,6,58,5,51,6,59,0,61,6,36,5,51,6,60,0,61,6,61,5,51,6,62,0,61,6,63,5,51,6,64,0,61,6,65,5,51,6,66,0,61,6,67,5,66,4,2,2,54,5,3,0,51,6,69,0,61,6,68,5,54,5,3,0,51,6,71,0,61,6,70,5,50,0,0,128,75,0,1,0,0,14,115,112,97,119,110,95,97,108,108,0,10,115,112,97,119,110,11,111,117,116,112,117,116,0,9,107,105,108,108,0,9,119,97,105,116,0,9,112,111,108,108,0,0,15,99,108,111,115,101,115,116,100,105,110,0,0,15,100,101,115,116,114,117,99,116,111,114,0,1,0,0,0,1,3,0,0,11,115,116,100,111,117,116,11,115,116,100,101,114,114,10,99,108,111,115,101,0,10,102,108,117,115,104,0,10,119,114,105,116,101,0,15,115,101,116,116,105,109,101,111,117,116,0,1,0,0,0,8,101,111,102,0,9,114,101,97,100,0,10,108,105,110,101,115,0,13,114,101,97,100,108,105,110,101,0,16,99,111,110,115,116,114,117,99,116,111,114,1,0,0,0,10,99,108,97,115,115,1,0,5,9,112,105,112,101,3,1,12,105,110,104,101,114,105,116,3,0,11,115,116,100,111,117,116,3,4,9,110,117,108,108,3,2,12,99,97,112,116,117,114,101,3,3,0,13,99,112,117,99,111,117,110,116,0,11,103,101,116,99,119,100,0,11,115,101,116,99,119,100,0,11,103,101,116,101,110,118,0,11,115,101,116,101,110,118,0,13,114,100,116,115,99,95,104,122,0,10,114,100,116,115,99,0,14,99,108,111,99,107,95,99,112,117,0,13,99,108,111,99,107,95,110,115,0,12,115,121,115,116,105,109,101,0,10,115,108,101,101,112,0,12,101,120,101,99,117,116,101,7,111,115,250,12,108,111,110,103,32,111,115,95,101,120,101,99,117,116,101,40,99,111,110,115,116,32,99,104,97,114,32,42,99,109,100,41,59,10,118,111,105,100,32,111,115,95,115,108,101,101,112,40,117,110,115,105,103,110,101,100,32,108,111,110,103,32,109,115,101,99,41,59,10,117,110,115,105,103,110,101,100,32,108,111,110,103,32,108,111,110,103,32,111,115,95,103,101,116,116,105,109,101,40,41,59,10,117,105,110,116,54,52,95,116,32,111,115,95,99,108,111,99,107,95,110,115,40,41,59,10,117,105,110,116,54,52,95,116,32,111,115,95,99,108,111,99,107,95,99,112,117,40,41,59,10,117,105,110,116,54,52,95,116,32,111,115,95,114,100,116,115,99,40,41,59,10,117,105,110,116,54,52,95,116,32,111,115,95,114,100,116,115,99,95,104,122,40,41,59,10,98,111,111,108,32,111,115,95,115,101,116,101,110,118,40,99,111,110,115,116,32,99,104,97,114,32,42,110,97,109,101,44,32,99,111,110,115,116,32,99,104,97,114,32,42,118,97,108,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,111,115,95,103,101,116,101,110,118,40,99,111,110,115,116,32,99,104,97,114,32,42,110,97,109,101,41,59,10,98,111,111,108,32,111,115,95,115,101,116,99,119,100,40,99,111,110,115,116,32,99,104,97,114,32,42,100,105,114,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,111,115,95,103,101,116,99,119,100,40,99,104,97,114,32,42,100,101,115,116,44,32,115,105,122,101,95,116,32,115,105,122,101,41,59,10,117,110,115,105,103,110,101,100,32,108,111,110,103,32,111,115,95,99,112,117,99,111,117,110,116,40,41,59,10,10,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,111,115,95,115,112,97,119,110,40,99,111,110,115,116,32,99,104,97,114,32,42,42,97,114,103,118,44,32,115,105,122,101,95,116,32,97,114,103,99,44,32,99,111,110,115,116,32,99,104,97,114,32,42,42,101,110,118,44,32,115,105,122,101,95,116,32,110,101,110,118,44,32,99,111,110,115,116,32,99,104,97,114,32,42,99,119,100,44,32,99,111,110,115,116,32,105,110,116,32,42,109,111,100,101,115,41,59,10,118,111,105,100,32,111,115,95,112,114,111,99,101,115,115,95,99,108,111,115,101,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,41,59,10,98,111,111,108,32,111,115,95,112,114,111,99,101,115,115,95,112,111,108,108,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,41,59,10,98,111,111,108,32,111,115,95,112,114,111,99,101,115,115,95,119,97,105,116,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,44,32,105,110,116,32,116,105,109,101,111,117,116,41,59,10,108,111,110,103,32,111,115,95,112,114,111,99,101,115,115,95,119,97,105,116,97,110,121,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,42,112,114,111,99,115,44,32,115,105,122,101,95,116,32,110,44,32,105,110,116,32,116,105,109,101,111,117,116,41,59,10,105,110,116,32,111,115,95,112,114,111,99,101,115,115,95,101,120,105,116,99,111,100,101,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,41,59,10,108,111,110,103,32,111,115,95,112,114,111,99,101,115,115,95,112,105,100,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,41,59,10,98,111,111,108,32,111,115,95,112,114,111,99,101,115,115,95,107,105,108,108,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,44,32,105,110,116,32,115,105,103,110,97,108,41,59,10,105,110,116,32,111,115,95,112,114,111,99,101,115,115,95,102,100,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,44,32,105,110,116,32,105,110,100,101,120,41,59,10,105,110,116,32,111,115,95,112,114,111,99,101,115,115,95,112,111,108,108,102,100,115,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,44,32,105,110,116,32,42,102,100,115,44,32,98,111,111,108,32,42,105,115,87,114,105,116,97,98,108,101,41,59,10,118,111,105,100,32,111,115,95,112,114,111,99,101,115,115,95,99,108,111,115,101,102,100,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,44,32,105,110,116,32,105,110,100,101,120,41,59,10,98,111,111,108,32,111,115,95,112,114,111,99,101,115,115,95,119,114,105,116,101,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,44,32,99,111,110,115,116,32,99,104,97,114,32,42,100,97,116,97,44,32,115,105,122,101,95,116,32,115,105,122,101,44,32,105,110,116,32,116,105,109,101,111,117,116,41,59,10,98,111,111,108,32,111,115,95,112,114,111,99,101,115,115,95,102,108,117,115,104,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,44,32,105,110,116,32,116,105,109,101,111,117,116,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,111,115,95,112,114,111,99,101,115,115,95,114,101,97,100,108,105,110,101,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,44,32,105,110,116,32,105,110,100,101,120,44,32,115,105,122,101,95,116,32,42,108,101,110,44,32,105,110,116,32,116,105,109,101,111,117,116,41,59,10,108,111,110,103,32,108,111,110,103,32,111,115,95,112,114,111,99,101,115,115,95,114,101,97,100,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,44,32,105,110,116,32,105,110,100,101,120,44,32,99,104,97,114,32,42,100,101,115,116,44,32,115,105,122,101,95,116,32,115,105,122,101,44,32,105,110,116,32,116,105,109,101,111,117,116,41,59,10,98,111,111,108,32,111,115,95,112,114,111,99,101,115,115,95,101,111,102,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,44,32,105,110,116,32,105,110,100,101,120,41,59,10,99,111,110,115,116,32,99,104,97,114,32,42,111,115,95,112,114,111,99,101,115,115,95,111,117,116,112,117,116,40,115,116,114,117,99,116,32,111,115,95,112,114,111,99,101,115,115,95,116,32,42,115,101,108,102,44,32,105,110,116,32,105,110,100,101,120,44,32,115,105,122,101,95,116,32,42,115,105,122,101,41,59,10,99,104,97,114,32,42,115,116,114,101,114,114,111,114,40,105,110,116,32,101,114,114,110,117,109,41,59,10,9,99,100,101,102,8,102,102,105,3,0,3,0,35,0,35,0,38,0,41,0,38,0,44,0,47,0,44,0,52,0,54,0,52,0,59,0,61,0,59,0,65,0,67,0,65,0,72,0,74,0,72,0,79,0,81,0,79,0,84,0,87,0,84,0,90,0,93,0,90,0,96,0,99,0,96,0,102,0,105,0,102,0,108,0,110,0,108,0,115,0,119,0,119,0,123,0,123,0,133,0,133,0,143,0,143,0,159,0,159,0,165,0,165,0,119,0,169,0,169,0,173,0,173,0,179,0,179,0,193,0,193,0,200,0,200,0,205,0,205,0,169,0,209,0,211,0,211,0,219,0,219,0,223,0,223,0,231,0,231,0,239,0,239,0,246,0,246,0,253,0,253,0,15,1,15,1,22,1,22,1,32,1,32,1,211,0,49,1,80,1,49,1,90,1,119,1,90,1,119,1,119,1,115,112,97,119,110,109,111,100,101,115,0,42,56,112,105,112,101,114,101,97,100,101,114,0,13,43,112,105,112,101,119,114,105,116,101,114,0,13,30,115,116,114,101,97,109,110,97,109,101,115,0,1,29,112,114,111,99,101,115,115,0,21,8,0,0,
\ No newline at end of file
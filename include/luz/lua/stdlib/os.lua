@@ -3,11 +3,35 @@
 ffi.cdef[[
 long os_execute(const char *cmd);
 void os_sleep(unsigned long msec);
-unsigned long os_gettime();
+unsigned long long os_gettime();
+uint64_t os_clock_ns();
+uint64_t os_clock_cpu();
+uint64_t os_rdtsc();
+uint64_t os_rdtsc_hz();
 bool os_setenv(const char *name, const char *val);
 const char *os_getenv(const char *name);
 bool os_setcwd(const char *dir);
 const char *os_getcwd(char *dest, size_t size);
+unsigned long os_cpucount();
+
+struct os_process_t *os_spawn(const char **argv, size_t argc, const char **env, size_t nenv, const char *cwd, const int *modes);
+void os_process_close(struct os_process_t *self);
+bool os_process_poll(struct os_process_t *self);
+bool os_process_wait(struct os_process_t *self, int timeout);
+long os_process_waitany(struct os_process_t **procs, size_t n, int timeout);
+int os_process_exitcode(struct os_process_t *self);
+long os_process_pid(struct os_process_t *self);
+bool os_process_kill(struct os_process_t *self, int signal);
+int os_process_fd(struct os_process_t *self, int index);
+int os_process_pollfds(struct os_process_t *self, int *fds, bool *isWritable);
+void os_process_closefd(struct os_process_t *self, int index);
+bool os_process_write(struct os_process_t *self, const char *data, size_t size, int timeout);
+bool os_process_flush(struct os_process_t *self, int timeout);
+const char *os_process_readline(struct os_process_t *self, int index, size_t *len, int timeout);
+long long os_process_read(struct os_process_t *self, int index, char *dest, size_t size, int timeout);
+bool os_process_eof(struct os_process_t *self, int index);
+const char *os_process_output(struct os_process_t *self, int index, size_t *size);
+char *strerror(int errnum);
 ]]
 
 -- Execute OS command
@@ -22,9 +46,38 @@ function os.sleep(msec)
     return ffi.C.os_sleep(msec)
 end
 
--- Get system time [milli seconds]
+-- Get monotonic time [milli seconds]
+-- * it's not affected by the system clock adjustment (use os.time for the calendar time)
+-- @returns {number}
 function os.systime()
-    return ffi.C.os_gettime()
+    return tonumber(ffi.C.os_gettime())
+end
+
+-- Get monotonic time [nano seconds]
+-- e.g. `local start = os.clock_ns(); ...; print(tonumber(os.clock_ns() - start) / 1e6, "ms")`
+-- @returns {uint64_t} 64-bit integer cdata
+function os.clock_ns()
+    return ffi.C.os_clock_ns()
+end
+
+-- Get CPU time consumed by the current thread [nano seconds]
+-- @returns {uint64_t} 64-bit integer cdata
+function os.clock_cpu()
+    return ffi.C.os_clock_cpu()
+end
+
+-- Read the CPU cycle counter (TSC / CNTVCT)
+-- * lowest overhead timer for microbenchmarks: convert ticks into seconds by os.rdtsc_hz()
+-- @returns {uint64_t} 64-bit integer cdata
+function os.rdtsc()
+    return ffi.C.os_rdtsc()
+end
+
+-- Get the frequency of os.rdtsc [ticks per second]
+-- * calibrated against os.clock_ns at the first call (it takes about 20 ms)
+-- @returns {number}
+function os.rdtsc_hz()
+    return tonumber(ffi.C.os_rdtsc_hz())
 end
 
 -- Set system environmental variable
@@ -50,3 +103,273 @@ function os.getcwd()
     local dest = ffi.new("char[1025]", {})
     return ffi.string(ffi.C.os_getcwd(dest, 1024))
 end
+
+-- Get count of logical processors
+function os.cpucount()
+    return tonumber(ffi.C.os_cpucount())
+end
+
+--- Child process ---
+
+-- @private os.spawn stream option => OS_SPAWN_*
+local spawnmodes = {inherit = 0, pipe = 1, null = 2, capture = 3, stdout = 4}
+
+-- @private reader of the stdout / stderr pipe
+-- * the pending input of the stdin is written and the other output is buffered while waiting, so it never deadlocks
+local pipereader = class {
+    constructor = function (self, proc, index)
+        self.proc, self.index = proc, index
+        self.linesize = ffi.new("size_t[1]")
+    end,
+
+    -- Read one line (separated by "\n" or "\r\n")
+    -- @param {number} timeout: milliseconds to wait for a whole line (default: -1 => infinite)
+    -- @returns {string|nil} nil if timed out or EOF (check reader:eof())
+    readline = function (self, timeout)
+        if self.proc.handler == nil then return nil end
+        local line = ffi.C.os_process_readline(self.proc.handler, self.index, self.linesize, timeout or -1)
+        if line == nil then return nil end
+        return ffi.string(line, self.linesize[0])
+    end,
+
+    -- Iterate lines until EOF
+    -- * the output is read ahead by the large buffer, and lines are searched by memchr
+    -- e.g. `for line in proc.stdout:lines() do ... end`
+    -- @returns {function()->string|nil}
+    lines = function (self)
+        return function()
+            return self:readline()
+        end
+    end,
+
+    -- Read data
+    -- @param {number|nil} size: max reading size (nil: read until EOF)
+    -- @param {number} timeout: milliseconds to wait for any data (default: -1 => infinite)
+    -- @returns {string|nil} available data ("" at EOF); nil if timed out
+    read = function (self, size, timeout)
+        if self.proc.handler == nil then return "" end
+        local chunk = size or 64 * 1024
+        local data, chunks = ffi.new("char[?]", chunk), {}
+        repeat
+            local read = tonumber(ffi.C.os_process_read(self.proc.handler, self.index, data, chunk, size and timeout or -1))
+            if read < 0 then return nil end
+            chunks[#chunks + 1] = ffi.string(data, read)
+        until size or read == 0
+        return table.concat(chunks)
+    end,
+
+    -- Identifies if all the output has been read
+    -- @returns {boolean}
+    eof = function (self)
+        return self.proc.handler == nil or ffi.C.os_process_eof(self.proc.handler, self.index)
+    end,
+}
+
+-- @private writer of the stdin pipe
+local pipewriter = class {
+    constructor = function (self, proc)
+        self.proc = proc
+        self.timeout = -1
+    end,
+
+    -- Set the timeout of write
+    -- @param {number} msec: milliseconds to block while more than 1 MiB is pending (-1: infinite)
+    settimeout = function (self, msec)
+        self.timeout = msec
+    end,
+
+    -- Write data in order
+    -- * the data is queued and written while reading / waiting; it blocks only while more than 1 MiB is pending (up to the timeout)
+    -- @param {string|number} ...
+    -- @returns {boolean} false if the child has closed the stdin, or timed out (the data remains queued)
+    write = function (self, ...)
+        if self.proc.handler == nil then return false end
+        for i = 1, select("#", ...) do
+            local data = select(i, ...)
+            if type(data) ~= "string" then data = tostring(data) end
+            if not ffi.C.os_process_write(self.proc.handler, data, #data, self.timeout) then return false end
+        end
+        return true
+    end,
+
+    -- Write all the pending data
+    -- @param {number} timeout: milliseconds (default: -1 => infinite)
+    -- @returns {boolean} false if timed out or the child has closed the stdin
+    flush = function (self, timeout)
+        return self.proc.handler ~= nil and ffi.C.os_process_flush(self.proc.handler, timeout or -1)
+    end,
+
+    -- Write the pending data, and close the pipe to send EOF
+    close = function (self)
+        self.proc:closestdin()
+    end,
+}
+
+-- @private stream index => name
+local streamnames = {"stdout", "stderr"}
+
+local process = class {
+    constructor = function (self, handler, modes)
+        self.handler = handler
+        self.pid = tonumber(ffi.C.os_process_pid(handler))
+        if modes[0] == spawnmodes.pipe then self.stdin = pipewriter.new(self) end
+        for i, name in ipairs(streamnames) do
+            if modes[i] == spawnmodes.pipe then self[name] = pipereader.new(self, i) end
+        end
+    end,
+
+    destructor = function (self)
+        self:close()
+    end,
+
+    -- Close the pipes, and release the process handle
+    -- * the pending input is discarded, and the process is not killed (POSIX: reaped in the background when it exits)
+    close = function (self)
+        if self.handler == nil then return end
+        ffi.C.os_process_close(self.handler)
+        self.handler, self.stdin = nil, nil
+    end,
+
+    -- Write the pending input, and close the stdin pipe to send EOF
+    closestdin = function (self)
+        if self.stdin and self.handler ~= nil then
+            self.stdin = nil
+            ffi.C.os_process_closefd(self.handler, 0)
+        end
+    end,
+
+    -- Iterate lines of the stdout pipe
+    -- @returns {function()->string|nil}
+    lines = function (self)
+        if self.stdout == nil then error"stdout is not piped" end
+        return self.stdout:lines()
+    end,
+
+    -- Check whether the process has exited without blocking
+    -- @returns {number|nil} exit code (-signal if killed by the signal); nil if running or closed
+    poll = function (self)
+        if self.handler == nil or not ffi.C.os_process_poll(self.handler) then return nil end
+        return ffi.C.os_process_exitcode(self.handler)
+    end,
+
+    -- Wait for the process to exit
+    -- * the pending input is written and the stdin pipe is closed before waiting, and the output of the pipes is buffered while waiting
+    -- * if the pending input cannot be written within the timeout, the stdin pipe remains open
+    -- @param {number} timeout: milliseconds (default: -1 => infinite)
+    -- @returns {number|nil} exit code; nil if timed out or closed
+    wait = function (self, timeout)
+        if self.handler == nil then return nil end
+        timeout = timeout or -1
+        if self.stdin then
+            local deadline = os.systime() + timeout
+            if not ffi.C.os_process_flush(self.handler, timeout) and ffi.C.os_process_fd(self.handler, 0) >= 0 then return nil end
+            self:closestdin()
+            if timeout >= 0 then timeout = math.max(0, deadline - os.systime()) end
+        end
+        if not ffi.C.os_process_wait(self.handler, timeout) then return nil end
+        return ffi.C.os_process_exitcode(self.handler)
+    end,
+
+    -- Send the signal to the process (terminate on Windows)
+    -- @param {number} signal: (default: 15 => SIGTERM)
+    -- @returns {boolean} false if the process has exited or been closed
+    kill = function (self, signal)
+        return self.handler ~= nil and ffi.C.os_process_kill(self.handler, signal or 15)
+    end,
+
+    -- Get the collected output of the "capture" stream
+    -- @param {string} name: "stdout" (default) | "stderr"
+    -- @returns {string} "" if closed
+    output = function (self, name)
+        if self.handler == nil then return "" end
+        local size = ffi.new("size_t[1]")
+        local data = ffi.C.os_process_output(self.handler, name == "stderr" and 2 or 1, size)
+        return ffi.string(data, size[0])
+    end,
+}
+
+-- Spawn the child process without shell (posix_spawn / CreateProcess)
+-- e.g.
+--     local proc = os.spawn({"git", "status", "--short"}, {stdout = "pipe"})
+--     for line in proc.stdout:lines() do print(line) end
+--     print(proc:wait())
+-- @param {string|string[]} argv: the executable is searched in PATH if it has no directory separator
+-- @param {table} opts: {
+--     stdin: {string} "inherit" (default) | "pipe" (proc.stdin: writer) | "null",
+--     stdout, stderr: {string} "inherit" (default) | "pipe" (proc.stdout / proc.stderr: reader) | "null"
+--                           | "capture" (collected while waiting: proc:output(name)) | "stdout" (stderr only),
+--     env: {table} {NAME = value} added to the current environment,
+--     cwd: {string} working directory of the child process,
+-- }
+-- @returns {process|nil, string|nil} process handle; nil and error message if the process cannot be spawned
+function os.spawn(argv, opts)
+    debug.checkarg(2, argv, "string|table", opts, "nil|table")
+    if type(argv) == "string" then argv = {argv} end
+    opts = opts or {}
+
+    local cargv = ffi.new("const char*[?]", #argv + 1)
+    local anchors = {}
+    for i, arg in ipairs(argv) do
+        anchors[i] = tostring(arg)
+        cargv[i - 1] = anchors[i]
+    end
+    local cenv, nenv = nil, 0
+    if opts.env then
+        local entries = {}
+        for name, value in pairs(opts.env) do entries[#entries + 1] = name .. "=" .. tostring(value) end
+        cenv, nenv = ffi.new("const char*[?]", #entries + 1), #entries
+        for i, entry in ipairs(entries) do cenv[i - 1] = entry end
+        anchors.env = entries
+    end
+    local modes = ffi.new("int[3]")
+    for i, name in ipairs{"stdin", "stdout", "stderr"} do
+        local mode = spawnmodes[opts[name] or "inherit"]
+        if mode == nil or (mode == 3 and i == 1) or (mode == 4 and i ~= 3) then
+            error("invalid " .. name .. " option: " .. tostring(opts[name]))
+        end
+        modes[i - 1] = mode
+    end
+
+    local handler = ffi.C.os_spawn(cargv, #argv, cenv, nenv, opts.cwd, modes)
+    if handler == nil then return nil, ffi.string(ffi.C.strerror(ffi.errno())) end
+    return process.new(handler, modes)
+end
+
+-- Run the commands in parallel
+-- e.g. `os.spawn_all({{"cc", "-c", "a.c"}, {"cc", "-c", "b.c", cwd = "sub"}}, {concurrency = 8})`
+-- @param {table[]} jobs: argv list, and the options of os.spawn in the hash part
+--                        (default: stdin = "null", stdout = "capture", stderr = "capture")
+-- @param {table} opts: {
+--     concurrency: {number} max count of running processes (default: os.cpucount()),
+-- }
+-- @returns {table[]} results in order of jobs: {code: number, stdout: string, stderr: string} or {error: string}
+function os.spawn_all(jobs, opts)
+    debug.checkarg(2, jobs, "table", opts, "nil|table")
+    opts = opts or {}
+    local concurrency = math.max(1, opts.concurrency or os.cpucount())
+    local results, running = {}, {} -- running: {proc, index}[]
+    local handlers = ffi.new("struct os_process_t*[?]", concurrency)
+    local nextjob = 1
+
+    while nextjob <= #jobs or #running > 0 do
+        while #running < concurrency and nextjob <= #jobs do
+            local job = jobs[nextjob]
+            local proc, err = os.spawn(job, {
+                stdin = job.stdin or "null", stdout = job.stdout or "capture", stderr = job.stderr or "capture",
+                env = job.env, cwd = job.cwd,
+            })
+            if proc then running[#running + 1] = {proc, nextjob}
+            else results[nextjob] = {error = err} end
+            nextjob = nextjob + 1
+        end
+        if #running > 0 then
+            for i, entry in ipairs(running) do handlers[i - 1] = entry[1].handler end
+            local i = tonumber(ffi.C.os_process_waitany(handlers, #running, -1)) + 1
+            if i < 1 then error"failed to wait for the processes" end
+            local proc, index = unpack(table.remove(running, i))
+            results[index] = {code = proc:wait(), stdout = proc:output"stdout", stderr = proc:output"stderr"}
+            proc:close()
+        end
+    end
+    return results
+end
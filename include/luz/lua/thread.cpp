@@ -0,0 +1,134 @@
+﻿#include "../lua.hpp"
+#include <chrono>
+
+/// @private Lua state of the worker thread (created by the first job of the thread, closed when the thread exits)
+static thread_local std::unique_ptr<sol::state> __worker_state;
+static thread_local std::string __worker_error; // error message of lua_registlib
+
+/*** ================================================== ***/
+/*** @private worker helpers ***/
+
+/// @private message handler of the job: append the traceback
+static int __traceback(lua_State *L) {
+    const char *message = lua_tostring(L, 1);
+    luaL_traceback(L, L, message ? message : "(error object is not a string)", 1);
+    return 1;
+}
+
+/// @private run the job in the protected mode: chunk(args...) => results
+static int __runjob(lua_State *L) {
+    lua_thread_pool_t::job_t *job = (lua_thread_pool_t::job_t*)lua_touserdata(L, 1);
+    int base = lua_gettop(L);
+    if (0 != luaL_loadbuffer(L, job->code.data(), job->code.size(), job->chunkname.c_str())) return lua_error(L);
+
+    int nargs = lua_deserialize(L, job->args.data(), job->args.size());
+    lua_call(L, nargs, LUA_MULTRET);
+    lua_serialize(L, base + 1, lua_gettop(L), job->results, true);
+    return 0;
+}
+
+/// @private get the state of the current worker
+static lua_State *__workerstate() {
+    if (!__worker_state) {
+        __worker_state.reset(new sol::state);
+        if (!lua_registlib(*__worker_state, &__worker_error) && __worker_error.empty()) __worker_error = "failed to initialize the Lua state";
+    }
+    return __worker_error.empty() ? __worker_state->lua_state() : nullptr;
+}
+
+/*** ================================================== ***/
+/*** Lua thread pool ***/
+
+lua_thread_pool_t::lua_thread_pool_t(size_t threads): pool(new thread_pool_t(threads)), nextid(1), isStopping(false) {}
+
+lua_thread_pool_t::~lua_thread_pool_t() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isStopping = true;
+    }
+    pool.reset(); // the destructor runs the queued jobs as cancelled ones in this thread
+}
+
+unsigned int lua_thread_pool_t::submit(std::string code, std::string chunkname, std::string args) {
+    job_t *job = new job_t {std::move(code), std::move(chunkname), std::move(args), "", false, false, false};
+    unsigned int id;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        id = nextid++;
+        if (nextid == 0) nextid = 1;
+        jobs[id].reset(job);
+    }
+    pool->push([this, job, id] {
+        try {
+            execute(job);
+        } catch (...) { // e.g. std::bad_alloc: the job must be finished anyway
+            job->isError = true;
+            job->results = "the job has failed with an exception";
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        job->isDone = true;
+        if (job->isReleased) jobs.erase(id);
+        finished.notify_all();
+    });
+    return id;
+}
+
+void lua_thread_pool_t::execute(job_t *job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (isStopping) {
+            job->isError = true;
+            job->results = "the thread pool has been closed";
+            return;
+        }
+    }
+    lua_State *L = __workerstate();
+    if (L == nullptr) {
+        job->isError = true;
+        job->results = __worker_error;
+        return;
+    }
+    lua_pushcfunction(L, __traceback);
+    lua_pushcfunction(L, __runjob);
+    lua_pushlightuserdata(L, job);
+    if (0 != lua_pcall(L, 1, 0, -3)) {
+        const char *message = lua_tostring(L, -1);
+        job->isError = true;
+        job->results = message ? message : "(error object is not a string)";
+    }
+    lua_settop(L, 0);
+    job->code.clear();
+    job->code.shrink_to_fit();
+    job->args.clear();
+    job->args.shrink_to_fit();
+}
+
+bool lua_thread_pool_t::wait(unsigned int id, int timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto isDone = [this, id] {
+        auto it = jobs.find(id);
+        return it == jobs.end() || it->second->isDone;
+    };
+    if (timeout < 0) {
+        finished.wait(lock, isDone);
+        return true;
+    }
+    return finished.wait_for(lock, std::chrono::milliseconds(timeout), isDone);
+}
+
+std::unique_ptr<lua_thread_pool_t::job_t> lua_thread_pool_t::take(unsigned int id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = jobs.find(id);
+    if (it == jobs.end() || !it->second->isDone) return nullptr;
+    std::unique_ptr<job_t> job = std::move(it->second);
+    jobs.erase(it);
+    return job;
+}
+
+void lua_thread_pool_t::release(unsigned int id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = jobs.find(id);
+    if (it == jobs.end()) return;
+    if (it->second->isDone) jobs.erase(it);
+    else it->second->isReleased = true;
+}
@@ -4,6 +4,13 @@
 #include <unzip.h>
 #include <time.h>
 
+#ifndef _WINDOWS
+    #include <sys/stat.h>
+    #include <dirent.h>
+    #include <fcntl.h>
+    #include <errno.h>
+#endif
+
 /// zip global information structure
 typedef struct {
     size_t  entries,      // entry count
@@ -323,33 +330,91 @@ extern "C" {
         return true;
     }
 
-    /// @private compress the directory (base)
-    static bool __compress(zip_archiver_t *zip, const char *dir, size_t basedir_len, const char *password, const char *root) {
-        fs_dirent_t *dirent = fs_opendir(dir);
+    #ifdef _WINDOWS
+        /// @private compress the directory (base)
+        static bool __compress(zip_archiver_t *zip, const char *dir, size_t basedir_len, const char *password, const char *root) {
+            fs_dirent_t *dirent = fs_opendir(dir);
         
-        if (!dirent) return false;
-        do {
-            std::string name = fs_readdir_name(dirent);
-            if (name == "." || name == "..") continue;
+            if (!dirent) return false;
+            do {
+                std::string name = fs_readdir_name(dirent);
+                if (name == "." || name == "..") continue;
             
-            std::string path = fs_readdir_path(dirent);
-            if (path_isdir(path)) {
-                // process recursively
-                if (!__compress(zip, path.c_str(), basedir_len, password, root)) {
-                    fs_closedir(dirent);
-                    return false;
+                std::string path = fs_readdir_path(dirent);
+                if (path_isdir(path)) {
+                    // process recursively
+                    if (!__compress(zip, path.c_str(), basedir_len, password, root)) {
+                        fs_closedir(dirent);
+                        return false;
+                    }
+                } else if (path_isfile(path)) {
+                    // append file into zip
+                    if (!zip_append_file(zip, path.c_str(), (root + path.substr(basedir_len)).c_str(), password, nullptr)) {
+                        fs_closedir(dirent);
+                        return false;
+                    }
                 }
-            } else if (path_isfile(path)) {
-                // append file into zip
-                if (!zip_append_file(zip, path.c_str(), (root + path.substr(basedir_len)).c_str(), password, nullptr)) {
-                    fs_closedir(dirent);
+            } while (fs_seekdir(dirent));
+            fs_closedir(dirent);
+            return true;
+        }
+    #else
+        /// @private read file content (name: relative to the directory fd)
+        static bool __get_filecontentat(int dirfd, const char *name, std::string &dest) {
+            int fd = openat(dirfd, name, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) return false;
+
+            struct stat st;
+            if (0 != fstat(fd, &st)) {
+                close(fd);
+                return false;
+            }
+            dest.resize(st.st_size);
+            for (size_t size = 0; size < dest.size();) {
+                ssize_t n = read(fd, &dest[size], dest.size() - size);
+                if (n < 0 && errno == EINTR) continue;
+                if (n <= 0) {
+                    close(fd);
                     return false;
                 }
+                size += n;
             }
-        } while (fs_seekdir(dirent));
-        fs_closedir(dirent);
-        return true;
-    }
+            close(fd);
+            return true;
+        }
+
+        /// @private compress the directory (name: relative to the parent directory fd)
+        // @param zipdir: directory path in the zip (root + relative path from the base directory)
+        static bool __compressat(zip_archiver_t *zip, int parent, const char *name, const std::string &zipdir, const char *password) {
+            int fd = openat(parent, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (fd < 0) return false;
+
+            DIR *dir = fdopendir(fd);
+            if (!dir) {
+                close(fd);
+                return false;
+            }
+
+            bool result = true;
+            for (struct dirent *dent = readdir(dir); result && dent; dent = readdir(dir)) {
+                if (strcmp(dent->d_name, ".") == 0 || strcmp(dent->d_name, "..") == 0) continue;
+
+                struct stat st;
+                if (0 != fstatat(fd, dent->d_name, &st, 0)) continue; // broken link
+                if (S_ISDIR(st.st_mode)) {
+                    // process recursively
+                    result = __compressat(zip, fd, dent->d_name, zipdir + dent->d_name + "/", password);
+                } else if (S_ISREG(st.st_mode)) {
+                    // append file into zip
+                    std::string data;
+                    result = __get_filecontentat(fd, dent->d_name, data)
+                        && zip_append(zip, data.c_str(), data.size(), (zipdir + dent->d_name).c_str(), password, nullptr);
+                }
+            }
+            closedir(dir);
+            return result;
+        }
+    #endif
 
     __export bool zip_compress(const char *dir, const char *output, unsigned short level, const char *password, const char *mode, const char *root) {
         if (!path_isdir(dir)) return false;
@@ -357,7 +422,11 @@ extern "C" {
         zip_archiver_t *zip = zip_open(output, mode, level);
         if (!zip) return false;
 
-        bool result = __compress(zip, dir, path_append_slash(dir).size(), password, root);
+        #ifdef _WINDOWS
+            bool result = __compress(zip, dir, path_append_slash(dir).size(), password, root);
+        #else
+            bool result = __compressat(zip, AT_FDCWD, dir, root, password);
+        #endif
         zip_close(zip, nullptr);
         return result;
     }
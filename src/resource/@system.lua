@@ -158,13 +158,16 @@ function load(code, chunkname, mode, env)
     if f == nil then
         return f, err
     end
+    -- resolve current script info only once per chunk (not per invocation)
+    local chunkfile = chunkname and (chunkname:sub(1, 1) == "@" and chunkname:sub(2) or chunkname)
+    local chunkdir = chunkfile and fs.path.parentdir(chunkfile)
     return function()
         -- store previous package.__file, package.__dir
         local __file = package.__file
         local __dir = package.__dir
         -- enable to get current script info from package.__file, package.__dir
-        package.__file = chunkname and (chunkname:sub(1, 1) == "@" and chunkname:sub(2) or chunkname)
-        package.__dir = package.__file and fs.path.parentdir(package.__file)
+        package.__file = chunkfile
+        package.__dir = chunkdir
         
         local result = f()
         -- restore package.__file, package.__dir
@@ -230,7 +233,7 @@ end
 -- @returns {string, userdata, table} module_name, file_handler( has :close() method ), errors
 local function try_search_module(filepath, tried)
     local file = fs.open(filepath)
-    if file == nil then
+    if file ~= nil then
         return filepath, file, nil
     end
     table.insert(tried, "no file '" .. filepath .. "'")
@@ -243,7 +246,8 @@ function teal.search_module(module_name, search_dtl)
     -- * in this case: "." not replaced into "/"
     if module_name:find"/" and package.__dir then
         for entry in package.path:gmatch"[^;]+" do
-            local filepath = fs.path.complete(package.__dir .. "/" .. entry:replace("?", module_name))
+            -- package.__dir has been completed by fs.path.parentdir: lexical normalization is enough
+            local filepath = fs.path.normalize(package.__dir .. "/" .. entry:replace("?", module_name))
             local p, f, e = try_search_module(filepath, tried)
             if p then
                 return p, f, e
@@ -269,6 +273,7 @@ table.insert(package.loaders, 1, function (modname)
     if not filename then
         return "\n\t" .. table.concat(tried or {}, "\n\t")
     end
+    file:close()
     
     local loader, err = loadfile(filename)
     if not loader then
@@ -303,7 +308,7 @@ table.insert(package.loaders, 2, function (module_name)
     -- * in this case: "." not replaced into "/"
     if module_name:find"/" and package.__dir then
         for entry in package.cpath:gmatch"[^;]+" do
-            local filepath = fs.path.complete(package.__dir .. "/" .. entry:replace("?", module_name))
+            local filepath = fs.path.normalize(package.__dir .. "/" .. entry:replace("?", module_name))
             local loader; loader, err = try_search_dynlib(filepath, err)
             if loader then return loader end
         end
@@ -1,7 +1,6 @@
 ﻿-- version
-luz = {
-    version = "v0.1.0"
-}
+luz = luz or {}
+luz.version = "v0.1.0"
 
 -- help text
 local helptext = [==[
@@ -131,37 +130,36 @@ local commands = {
     test = function ()
         -- Execute test codes in the target directory or current directory, and measure execution time
         -- * Test codes: `*_test.lua` or `*_test.tl`
-        local files = fs.enumfiles(os.argv[2] or ".", -1, "file")
+        local files = fs.walk(os.argv[2] or ".", {include = {"**/*_test.{lua,tl}"}, type = "file"}) or function() end
         local ok, ng = 0, 0 -- count of test results
-        local teststart = os.systime() -- measure execution time
-
-        for _, file in ipairs(files) do
-            if file.path:match("_test%.lua$") or file.path:match("_test%.tl$") then
-                -- test code execution time: lua or teal
-                local start = os.systime()
-                local f, err = loadfile(file.path)
-
-                if f then
-                    local result, err = pcall(f, "@" .. file.path)
-
-                    if result then -- OK
-                        printf("✅ %s (%d ms)\n", file.path, os.systime() - start)
-                        ok = ok + 1
-                    else -- NG
-                        printf("❌ %s (%d ms)\n", file.path, os.systime() - start)
-                        print(err)
-                        ng = ng + 1
-                    end
-                else -- syntax error
-                    printf("❌ %s (%d ms)\n", file.path, os.systime() - start)
+        local teststart = os.clock_ns() -- measure execution time
+        local function elapsed(start) return tonumber(os.clock_ns() - start) / 1e6 end
+
+        for path in files do
+            -- test code execution time: lua or teal
+            local start = os.clock_ns()
+            local f, err = loadfile(path)
+
+            if f then
+                local result, err = pcall(f, "@" .. path)
+
+                if result then -- OK
+                    printf("✅ %s (%.2f ms)\n", path, elapsed(start))
+                    ok = ok + 1
+                else -- NG
+                    printf("❌ %s (%.2f ms)\n", path, elapsed(start))
                     print(err)
                     ng = ng + 1
                 end
+            else -- syntax error
+                printf("❌ %s (%.2f ms)\n", path, elapsed(start))
+                print(err)
+                ng = ng + 1
             end
         end
         -- display test summary
         printf("\nTests:\t%d failed, %d total\n", ng, ok + ng)
-        printf("Time:\t%d ms\n\n", os.systime() - teststart)
+        printf("Time:\t%.2f ms\n\n", elapsed(teststart))
     end,
 }
 
@@ -2,16 +2,64 @@
 print("current working directory:", os.getcwd())
 print("current script file:", package.__file, fs.path.stat(package.__file))
 print("invalid file state:", fs.path.stat"invalid?file!", "")
+local sep = package.config:sub(1, 1)
+local function native(path) return (path:gsub("/", sep)) end
+assert(fs.path.normalize"a//b/./c/../d" == native"a/b/d")
+assert(fs.path.normalize"./a/b" == native"a/b" and fs.path.normalize"a/b/" == native"a/b" and fs.path.normalize"./" == ".")
+if sep == "/" then -- absolute roots
+    assert(fs.path.normalize"/" == "/" and fs.path.normalize"/a/../.." == "/" and fs.path.normalize"//a/" == "/a")
+else
+    assert(fs.path.normalize"C:/a/../.." == "C:\\" and fs.path.normalize"//server/a/" == "\\\\server\\a")
+end
+assert(fs.path.normalize"../a/.." == "..")
+assert(fs.path.parentdir(fs.path.basename(package.__file)) == fs.path.parentdir(package.__file))
 
 assert(fs.copyfile(package.__file, "✅copied/test.lua"))
+if package.config:sub(1, 1) == "/" then
+    assert(fs.writefile("✅mode", "mode") and os.execute("chmod 0750 ✅mode && touch -m -d @1000000000 ✅mode"))
+    assert(fs.copyfile("✅mode", "✅mode.kept", true, {mode = true, mtime = true}))
+    assert(fs.copyfile("✅mode", "✅mode.new", true))
+    local src, kept, new = fs.path.stat"✅mode", fs.path.stat"✅mode.kept", fs.path.stat"✅mode.new"
+    assert(bit.band(kept.access_mode, 4095) == tonumber("750", 8) and kept.last_modified_seconds == 1000000000)
+    assert(bit.band(new.access_mode, 4095) ~= tonumber("750", 8) and new.last_modified_seconds > src.last_modified_seconds)
+    assert(fs.rmfile"✅mode" and fs.rmfile"✅mode.kept" and fs.rmfile"✅mode.new")
+end
 assert(fs.copydir("✅copied", "❗party"))
 assert(fs.rename("✅copied", "❗party/✨subdir"))
+assert(fs.copydir("❗party", "❗party2", {threads = 4}))
+assert(fs.readfile"❗party2/✨subdir/test.lua" == fs.readfile(package.__file))
+assert(fs.rmdir("❗party2", {threads = 4}))
+assert(not pcall(fs.copydir, "❗party", "❗party2", {threads = -1}) and not pcall(fs.rmdir, "❗party", {threads = 2.5}) and not fs.path.isdir"❗party2")
 
 print(collectgarbage"stop")
 
 print("file list in ❗party/", fs.enumfiles"❗party")
+for name, type in fs.readdir("❗party", 1) do
+    assert(name == "test.lua" and type ~= fs.filetype.dir or name == "✨subdir" and type ~= fs.filetype.file)
+end
+for path, type in fs.walk("❗party", {include = {"✨*/**/*.{lua,tl}"}, exclude = {"node_modules"}, type = "file"}) do
+    assert(path == "❗party/✨subdir/test.lua" and type == fs.filetype.file)
+end
 assert(fs.rmdir"❗party")
 
+if package.config:sub(1, 1) == "/" then -- the unreadable subdirectory is skipped
+    assert(fs.writefile("❗enum/✨a/⭐", "1") and fs.writefile("❗enum/✨locked/⭐", "1"))
+    assert(os.execute"chmod 000 ❗enum/✨locked")
+    local paths = {}
+    for _, file in ipairs(fs.enumfiles"❗enum") do paths[file.path] = true end
+    assert(paths["❗enum/✨a/⭐"] and paths["❗enum/✨locked"])
+    assert(os.execute"chmod 755 ❗enum/✨locked" and fs.rmdir"❗enum")
+end
+
+local glob = fs.glob.compile"✨*/**/*.{lua,tl}"
+assert(glob:match"✨sub/a/b.tl" and not glob:match"sub/a.lua" and glob:partial"✨sub/")
+local globs = fs.glob.compile{"*.lua", "**/*_test.lua"}
+assert(table.concat(globs:matches"a_test.lua", ",") == "1,2" and not globs:match"a.tl")
+local filter = fs.glob.filter({"**/*.lua"}, {"extlib/**"})
+assert(filter:match"src/main.lua" and not filter:match"extlib/a.lua")
+assert(fs.glob.compile"{a,b" == nil)
+assert(not pcall(glob.match, glob, nil) and not pcall(glob.partial, glob, nil) and not pcall(globs.match, globs) and not pcall(globs.matches, globs, 1))
+
 print(collectgarbage"collect")
 
 -- wait for removal of directory
@@ -30,7 +78,103 @@ print("write bytes:", fs.writefile("⭐", "⭐🌍🌛"))
 
 local file = fs.open("⭐")
 assert(file:readline() == "⭐🌍🌛")
+assert(file:readline() == "") -- "" at the end of the file (compatible with the former readline)
+file:close()
+
+local mapped = fs.mmap("⭐", {advice = {"sequential"}})
+assert(ffi.string(mapped.ptr, mapped.size) == "⭐🌍🌛")
+mapped:close()
+assert(not mapped:advise{"random"} and not mapped:sync())
+
+assert(fs.writefile("⭐", "1\r\n22\n\n" .. ("4"):rep(100000)) > 0)
+local lines = {}
+file = fs.open("⭐")
+for line in file:lines() do
+    lines[#lines + 1] = #line
+end
 file:close()
+assert(table.concat(lines, ",") == "1,2,0,100000")
+
+local writer = fs.writer("⭐", {bufsize = 8})
+assert(writer:write("⭐", "🌍", 1, ("🌛"):rep(4)))
+assert(writer:close())
+assert(not writer:write"⭐" and not writer:write("⭐", 1) and not writer:flush())
+assert(fs.readfile"⭐" == "⭐🌍1" .. ("🌛"):rep(4))
+local large = ("⭐"):rep(512 * 1024) -- larger than 1 MiB
+assert(fs.writefile("⭐", large) and fs.readfile"⭐" == large and fs.readfile("⭐", 7) == large:sub(1, 7))
+
+local contents = {}
+print("async backend:", fs.async.backend())
+fs.async.run(function ()
+    for i = 1, 8 do
+        fs.async.spawn(function ()
+            assert(fs.async.writefile("❗async/" .. i, ("⭐"):rep(i)) == #"⭐" * i)
+            contents[i] = fs.async.readfile("❗async/" .. i)
+        end)
+    end
+end)
+assert(contents[8] == ("⭐"):rep(8))
+assert(fs.async.stat"❗async/8".size == #"⭐" * 8)
+assert(fs.async.readfile"❗async/nothing" == nil)
+assert(fs.rmdir"❗async")
+
+-- close the engine right after the requests of the thread pool (no poll remains armed)
+for _ = 1, 20 do
+    local engine, results = ffi.C.fs_async_open(0, 1), ffi.new("fs_async_result_t[1]")
+    ffi.C.fs_async_copyfile(engine, package.__file, "❗asynccopy", true)
+    while ffi.C.fs_async_wait(engine, results, 1, -1) == 0 do end
+    assert(results[0].error == 0)
+    ffi.C.fs_async_close(engine)
+end
+assert(fs.rmfile"❗asynccopy")
+
+assert(fs.mkdir"❗watch")
+local watcher = fs.watch("❗watch", {debounce_ms = 20})
+if watcher then -- not supported on macOS
+    assert(watcher:poll() == nil)
+    fs.writefile("❗watch/✨sub/⭐", "1")
+    fs.writefile("❗watch/tmp", "1")
+    fs.rmfile("❗watch/tmp")
+    local changes = watcher:next(1000)
+    assert(#changes == 2 and changes[1].event == "created")
+    watcher:close()
+end
+assert(fs.rmdir"❗watch")
+
+assert(("luz"):hash() == "57eab2e1b980b48b")
+assert(("luz"):hash"crc32" == "5c14fec7")
+assert((""):hash"sha256" == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855")
+assert(fs.writefile("❗hash/✨sub/⭐", "luz") and fs.writefile("❗hash/empty", ""))
+local manifest = fs.hash_tree("❗hash", {algo = "crc32", threads = 2})
+assert(manifest[fs.path.normalize"✨sub/⭐"] == "5c14fec7" and manifest.empty == "00000000")
+assert(not pcall(fs.hash_tree, "❗hash", {threads = -1}) and not pcall(fs.hash_tree, "❗hash", {threads = 0.5}))
+local sizes = {1, 240, 241, 1024, 1025, 65536, 65537, 200000} -- digests of the chunks equal those of the whole data
+for i, size in ipairs(sizes) do assert(fs.writefile("❗hashsize/" .. i, ("⭐"):rep(size):sub(1, size))) end
+for _, algo in ipairs{"crc32", "xxh3", "sha256"} do
+    local digests = fs.hash_tree("❗hashsize", {algo = algo})
+    for i, size in ipairs(sizes) do assert(digests[tostring(i)] == ("⭐"):rep(size):sub(1, size):hash(algo), algo .. " " .. size) end
+end
+assert(fs.rmdir"❗hashsize")
+
+local summary = fs.sync("❗hash", "❗synced")
+assert(#summary.copied == 2 and summary.skipped == 0 and summary.bytes == 3)
+assert(fs.writefile("❗synced/extra", "1"))
+summary = fs.sync("❗hash", "❗synced", {compare = "hash", delete = true})
+assert(#summary.copied == 0 and summary.skipped == 2 and summary.deleted[1] == "extra")
+assert(not pcall(fs.sync, "❗hash", "❗synced", {threads = -1}) and not pcall(fs.sync, "❗hash", "❗synced", {threads = 1e30}))
+if package.config:sub(1, 1) == "/" then -- the read-only file is replaced by the next sync
+    assert(fs.writefile("❗hash/readonly", "1") and os.execute"chmod 444 ❗hash/readonly" and #fs.sync("❗hash", "❗synced").copied == 1)
+    assert(os.execute"chmod 644 ❗hash/readonly" and fs.writefile("❗hash/readonly", "⭐") and os.execute"chmod 444 ❗hash/readonly")
+    summary = fs.sync("❗hash", "❗synced")
+    assert(#summary.copied == 1 and #summary.failed == 0 and fs.readfile"❗synced/readonly" == "⭐" and #fs.enumfiles"❗synced" == 4) -- no temporary file remains
+end
+assert(fs.rmdir"❗hash" and fs.rmdir"❗synced")
+
+local appended = fs.open("❗nested/✨a/✨b/⭐", "a")
+assert(appended:write"⭐" == #"⭐")
+appended:close()
+assert(fs.readfile"❗nested/✨a/✨b/⭐" == "⭐" and fs.mkdir"❗nested/✨a" and not fs.mkdir"❗nested/✨a/✨b/⭐")
+assert(fs.rmdir"❗nested")
 
 assert(fs.rmfile"⭐")
 
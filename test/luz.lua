@@ -0,0 +1,193 @@
+﻿assert(os.setcwd(package.__dir))
+
+-- thousands of sleeping coroutines are waited for by one thread
+local start, done, order = os.systime(), 0, {}
+luz.loop.run(function ()
+    for i = 1, 2000 do
+        luz.loop.spawn(function ()
+            luz.loop.sleep(50 - i % 50)
+            done = done + 1
+            if i <= 3 then order[#order + 1] = i end
+        end)
+    end
+end)
+assert(done == 2000 and table.concat(order, ",") == "3,2,1" and os.systime() - start < 1000)
+
+local ticks = 0
+assert(luz.loop.run(function ()
+    local timer = luz.loop.timer(10, function ()
+        ticks = ticks + 1
+        return ticks < 3
+    end)
+    local stopped = luz.loop.timer(10, function () error"must be stopped" end)
+    stopped:stop()
+    luz.loop.sleep(100)
+    return timer.stopped
+end) and ticks == 3)
+
+if package.config:sub(1, 1) == "/" then -- POSIX shell is required
+    local lines = {}
+    luz.loop.run(function ()
+        for i = 1, 3 do
+            luz.loop.spawn(function ()
+                local proc = assert(os.spawn({"sh", "-c", "sleep 0.0" .. (4 - i) .. "; echo " .. i}, {stdout = "pipe"}))
+                local line = luz.loop.readline(proc.stdout)
+                lines[#lines + 1] = line
+                assert(luz.loop.wait_process(proc) == 0)
+                proc:close()
+            end)
+        end
+        local proc = assert(os.spawn({"sleep", "10"}))
+        assert(luz.loop.wait_process(proc, 20) == nil)
+        proc:kill()
+        assert(luz.loop.wait_process(proc) ~= 0)
+        proc:close()
+    end)
+    assert(table.concat(lines, ",") == "3,2,1")
+end
+
+local contents = {}
+luz.loop.run(function ()
+    for i = 1, 4 do
+        luz.loop.spawn(function ()
+            assert(fs.async.writefile("❗loop/" .. i, ("⭐"):rep(i)) == #"⭐" * i)
+            contents[i] = fs.async.readfile("❗loop/" .. i)
+        end)
+    end
+end)
+assert(contents[4] == ("⭐"):rep(4))
+
+local watcher = fs.watch("❗loop", {debounce_ms = 20})
+if watcher then -- not supported on macOS
+    local changes = nil
+    luz.loop.run(function ()
+        luz.loop.spawn(function ()
+            luz.loop.sleep(20)
+            fs.writefile("❗loop/new", "1")
+        end)
+        changes = luz.loop.watch_next(watcher, 1000)
+    end)
+    assert(changes and changes[1].event == "created")
+    watcher:close()
+end
+assert(fs.rmdir"❗loop")
+
+local a, b, c = luz.deserialize(luz.serialize("⭐", {x = {1, true}}, -5LL))
+assert(a == "⭐" and b.x[1] == 1 and b.x[2] == true and c == -5LL)
+assert(not pcall(luz.serialize, print))
+
+local pool = luz.thread.pool(2)
+local buffer, jobs = ffi.new("char[4]"), {}
+for i = 1, 4 do
+    jobs[i] = pool:run(function (i, buffer)
+        ffi.cast("char*", buffer)[i - 1] = 48 + i -- FFI buffer is shared without copying
+        return i * i, {i = i}
+    end, i, buffer)
+end
+for i = 1, 4 do
+    local square, t = jobs[i]:join()
+    assert(square == i * i and t.i == i)
+end
+assert(ffi.string(buffer, 4) == "1234")
+assert(pool:run("return ... + 1", 41):join() == 42)
+assert(not pcall(function () pool:run(function () error"⭐" end):join() end))
+assert(not pcall(luz.thread.pool, -1) and not pcall(luz.thread.pool, 1.5) and not pcall(luz.thread.pool, 1e30))
+local upvalue = 1
+assert(not pcall(pool.run, pool, function () return upvalue end))
+
+local ch = luz.channel(4)
+assert(ch:try_pop() == nil and ch:pop(10) == nil)
+assert(ch:try_push({"⭐", n = 1}) and ch:try_pop().n == 1)
+local producers = {}
+for i = 1, 2 do
+    producers[i] = pool:run(function (ch, first)
+        for n = first, 1000, 2 do assert(ch:push(n)) end
+    end, ch, i)
+end
+local sum = 0
+for _ = 1, 1000 do sum = sum + ch:pop() end
+assert(sum == 500500 and ch:size() == 0)
+for i = 1, 2 do producers[i]:join() end
+ch:close()
+assert(not ch:push(1) and ch:pop() == nil)
+
+local spsc = luz.channel(2, {spsc = true})
+local consumer = pool:run(function (ch)
+    local values = {}
+    for value in ch:values() do values[#values + 1] = value end
+    return table.concat(values, ",")
+end, spsc)
+for i = 1, 5 do assert(spsc:push(("⭐"):rep(i * 40))) end -- larger than the inline cell
+spsc:close()
+assert(#consumer:join() == #"⭐" * 40 * 15 + 4)
+
+local received = {}
+local loopch = luz.channel(1)
+luz.loop.run(function ()
+    luz.loop.spawn(function ()
+        for i = 1, 3 do loopch:push(i) end
+        loopch:close()
+    end)
+    for value in loopch:values() do received[#received + 1] = value end
+end)
+assert(table.concat(received, ",") == "1,2,3")
+assert(not pcall(luz.channel, 1e30) and not pcall(luz.channel, 2.5) and not pcall(luz.serialize, loopch))
+
+local inner, full = luz.channel(1), luz.channel(1)
+while full:try_push(0) do end
+luz.loop.run(function ()
+    assert(not full:push(inner, 5)) -- the reference moved into the message is released
+end)
+assert(not full:try_push(inner))
+for _ = 1, 3 do collectgarbage() end
+assert(inner:push(1) and inner:pop() == 1)
+pool:close()
+
+luz.shared.clear()
+assert(luz.shared.set("config", {name = "⭐", list = {1, 2}}) and luz.shared.get"config".list[2] == 2)
+assert(luz.shared.get"nothing" == nil and not luz.shared.remove"nothing")
+assert(luz.shared.cas("flag", nil, true) and not luz.shared.cas("flag", nil, false) and luz.shared.cas("flag", true, "on"))
+assert(luz.shared.get"flag" == "on" and not pcall(luz.shared.incr, "flag"))
+local sharedch = luz.channel(4)
+assert(not pcall(luz.shared.set, "ch", sharedch) and not pcall(luz.shared.cas, "ch", sharedch, 1) and not pcall(luz.shared.set, "ch", {sharedch}))
+for _ = 1, 3 do
+    assert(luz.shared.get"ch" == nil)
+    collectgarbage()
+end
+assert(sharedch:push(1) and sharedch:pop() == 1)
+local workers = luz.thread.pool(4)
+local counters = {}
+for i = 1, 4 do
+    counters[i] = workers:run(function ()
+        for _ = 1, 1000 do luz.shared.incr"counter" end
+        return luz.shared.get"config".name
+    end)
+end
+for i = 1, 4 do assert(counters[i]:join() == "⭐") end
+workers:close()
+assert(luz.shared.get"counter" == 4000 and luz.shared.incr("counter", -1) == 3999)
+
+luz.shared.clear()
+luz.shared.budget(4096)
+for i = 1, 100 do assert(luz.shared.set("key" .. i, ("x"):rep(100))) end
+assert(luz.shared.bytes() <= 4096 and luz.shared.count() < 100 and luz.shared.get"key100" ~= nil)
+assert(not luz.shared.set("huge", ("x"):rep(8192)))
+assert(not luz.shared.set("key100", ("x"):rep(8192)) and not luz.shared.cas("key100", ("x"):rep(100), ("x"):rep(8192)))
+assert(luz.shared.get"key100" == ("x"):rep(100) and not pcall(luz.shared.budget, -1))
+luz.shared.budget(0)
+luz.shared.clear()
+assert(luz.shared.count() == 0 and luz.shared.bytes() == 0)
+
+local numbers = {}
+for i = 1, 1000 do numbers[i] = i end
+local squares = luz.parallel.map(function (n, i)
+    if n % 100 == 0 then os.sleep(5) end -- uneven cost
+    return n * n + i - n
+end, numbers, {chunk = 7})
+assert(#squares == 1000 and squares[1] == 1 and squares[1000] == 1000000)
+assert(#luz.parallel.map(function (n) return n end, {}) == 0)
+assert(luz.parallel.reduce(function (a, b) return a + b end, numbers, 0) == 500500)
+assert(luz.parallel.reduce(function (a, b) return math.max(a, b) end, numbers, nil, {chunk = 3}) == 1000)
+assert(not pcall(luz.parallel.map, function (n) return n + upvalue end, numbers))
+assert(not pcall(luz.parallel.map, function (n) error"⭐" end, numbers))
+assert(not pcall(luz.parallel.map, function (n) return n end, numbers, {chunk = 2.5}) and not pcall(luz.parallel.reduce, function (a, b) return a + b end, numbers, 0, {chunk = 0}))
@@ -0,0 +1,78 @@
+﻿assert(os.cpucount() >= 1)
+
+local start, cpustart, ticks = os.clock_ns(), os.clock_cpu(), os.rdtsc()
+os.sleep(20)
+local elapsed = tonumber(os.clock_ns() - start) / 1e6
+assert(elapsed >= 19 and elapsed < 1000 and type(os.systime()) == "number")
+assert(os.clock_cpu() >= cpustart and tonumber(os.rdtsc() - ticks) / os.rdtsc_hz() * 1000 >= 19)
+
+if package.config:sub(1, 1) == "/" then -- POSIX shell is required
+    local proc = assert(os.spawn({"sh", "-c", "echo ⭐; echo err >&2; exit 3"}, {stdout = "pipe", stderr = "capture"}))
+    assert(proc.stdout:readline() == "⭐" and proc.stdout:readline() == nil)
+    assert(proc:wait() == 3 and proc:output"stderr" == "err\n")
+    proc:close()
+
+    proc = assert(os.spawn({"cat"}, {stdin = "pipe", stdout = "pipe"}))
+    proc.stdin:write("🌍\n", 1)
+    proc:closestdin()
+    assert(proc.stdout:read() == "🌍\n1" and proc:wait() == 0)
+    proc:close()
+
+    -- stream the output while writing more than the pipe capacity into the stdin
+    proc = assert(os.spawn({"sh", "-c", "cat; head -c 1000000 /dev/zero >&2"}, {stdin = "pipe", stdout = "pipe", stderr = "pipe"}))
+    for i = 1, 100000 do proc.stdin:write(i, "\n") end
+    proc:closestdin()
+    local count = 0
+    for line in proc:lines() do
+        count = count + 1
+        assert(tonumber(line) == count)
+    end
+    assert(count == 100000 and proc.stdout:eof() and #proc.stderr:read() == 1000000 and proc:wait() == 0)
+    proc:close()
+
+    proc = assert(os.spawn({"sh", "-c", "sleep 0.2; echo ⭐"}, {stdout = "pipe"}))
+    assert(proc.stdout:readline(10) == nil and not proc.stdout:eof() and proc.stdout:readline() == "⭐")
+    proc:close()
+
+    proc = assert(os.spawn({"sh", "-c", "echo $LUZ_TEST; pwd"}, {stdout = "capture", env = {LUZ_TEST = "✨"}, cwd = "/"}))
+    assert(proc:wait() == 0 and proc:output() == "✨\n/\n")
+    proc:close()
+
+    -- the child which doesn't read the stdin
+    proc = assert(os.spawn({"sleep", "3"}, {stdin = "pipe"}))
+    proc.stdin:settimeout(50)
+    start = os.systime()
+    assert(proc.stdin:write(("⭐"):rep(100000)) and not proc.stdin:write(("⭐"):rep(400000)))
+    assert(proc:wait(100) == nil and os.systime() - start < 1000 and proc.stdin ~= nil)
+    assert(proc:kill() and proc:wait() == -15)
+    proc:close()
+
+    proc = assert(os.spawn({"sleep", "10"}))
+    assert(proc:poll() == nil and proc:wait(10) == nil and proc:kill() and proc:wait() == -15)
+    proc:close()
+
+    -- the running child is reaped after closing
+    proc = assert(os.spawn({"sleep", "0.1"}))
+    local pid = proc.pid
+    proc:close()
+    os.sleep(500)
+    if fs.path.isdir"/proc/self" then assert(not fs.path.isdir("/proc/" .. pid)) end
+
+    -- the methods of the closed process
+    proc = assert(os.spawn({"true"}, {stdin = "pipe", stdout = "pipe"}))
+    assert(proc:wait() == 0)
+    proc:close()
+    proc:closestdin()
+    assert(proc:poll() == nil and proc:wait() == nil and not proc:kill() and proc:output() == "" and proc.stdout:read() == "")
+
+    assert(os.spawn{"❗no-such-command"} == nil)
+
+    local jobs = {}
+    for i = 1, 20 do jobs[i] = {"sh", "-c", "head -c 100000 /dev/zero; exit " .. i % 3} end
+    local results = os.spawn_all(jobs, {concurrency = 4})
+    assert(#results == 20 and #results[20].stdout == 100000 and results[20].code == 2)
+
+    local pipe = fs.open("echo ⭐", "pr")
+    assert(pipe:readline() == "⭐")
+    pipe:close()
+end